@@ -23,6 +23,11 @@
 #include <string.h>
 #include <glad/glad.h>
 
+#if defined(OFX_OPENGL_LAZY_LOAD) && defined(DEBUG)
+/* the debug wrappers call the resolved functions */
+#undef OFX_OPENGL_LAZY_LOAD
+#endif
+
 static void* get_proc(const char *namez);
 
 #ifdef _WIN32
@@ -44,6 +49,7 @@ int open_gl(void) {
     return 0;
 }
 
+#ifndef OFX_OPENGL_LAZY_LOAD
 static
 void close_gl(void) {
     if(libGL != NULL) {
@@ -51,6 +57,7 @@ void close_gl(void) {
         libGL = NULL;
     }
 }
+#endif
 #else
 #include <dlfcn.h>
 static void* libGL;
@@ -91,6 +98,7 @@ int open_gl(void) {
     return 0;
 }
 
+#ifndef OFX_OPENGL_LAZY_LOAD
 static
 void close_gl() {
     if(libGL != NULL) {
@@ -99,6 +107,7 @@ void close_gl() {
     }
 }
 #endif
+#endif
 
 static
 void* get_proc(const char *namez) {
@@ -126,7 +135,10 @@ int gladLoadGL(void) {
 
     if(open_gl()) {
         status = gladLoadGLLoader(&get_proc);
+        /* with lazy loading, get_proc is still used by the trampolines */
+#ifndef OFX_OPENGL_LAZY_LOAD
         close_gl();
+#endif
     }
 
     return status;
@@ -1472,6 +1484,3067 @@ static void load_GL_APPLE_vertex_array_object(GLADloadproc load) {
 	glad_glGenVertexArraysAPPLE = (PFNGLGENVERTEXARRAYSAPPLEPROC)load("glGenVertexArraysAPPLE");
 	glad_glIsVertexArrayAPPLE = (PFNGLISVERTEXARRAYAPPLEPROC)load("glIsVertexArrayAPPLE");
 }
+#ifdef OFX_OPENGL_LAZY_LOAD
+/* Lazy loading: instead of resolving every function when loading, each glad_gl* pointer is set to
+ * a trampoline, which resolves the function with the loader on its first call and replaces the
+ * pointer with it. Only the functions actually used by the plug-in are resolved.
+ * Two threads calling the same trampoline for the first time both store the same value. */
+static GLADloadproc glad_lazy_load = NULL;
+
+#define GLAD_LAZY_RESOLVE(type, name) if (glad_##name == glad_lazy_##name) glad_##name = (type)glad_lazy_load(#name)
+
+static void APIENTRY glad_lazy_glCullFace(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLCULLFACEPROC, glCullFace); return glad_glCullFace(a0); }
+static void APIENTRY glad_lazy_glFrontFace(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLFRONTFACEPROC, glFrontFace); return glad_glFrontFace(a0); }
+static void APIENTRY glad_lazy_glHint(GLenum a0, GLenum a1) { GLAD_LAZY_RESOLVE(PFNGLHINTPROC, glHint); return glad_glHint(a0, a1); }
+static void APIENTRY glad_lazy_glLineWidth(GLfloat a0) { GLAD_LAZY_RESOLVE(PFNGLLINEWIDTHPROC, glLineWidth); return glad_glLineWidth(a0); }
+static void APIENTRY glad_lazy_glPointSize(GLfloat a0) { GLAD_LAZY_RESOLVE(PFNGLPOINTSIZEPROC, glPointSize); return glad_glPointSize(a0); }
+static void APIENTRY glad_lazy_glPolygonMode(GLenum a0, GLenum a1) { GLAD_LAZY_RESOLVE(PFNGLPOLYGONMODEPROC, glPolygonMode); return glad_glPolygonMode(a0, a1); }
+static void APIENTRY glad_lazy_glScissor(GLint a0, GLint a1, GLsizei a2, GLsizei a3) { GLAD_LAZY_RESOLVE(PFNGLSCISSORPROC, glScissor); return glad_glScissor(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glTexParameterf(GLenum a0, GLenum a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLTEXPARAMETERFPROC, glTexParameterf); return glad_glTexParameterf(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexParameterfv(GLenum a0, GLenum a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLTEXPARAMETERFVPROC, glTexParameterfv); return glad_glTexParameterfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexParameteri(GLenum a0, GLenum a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLTEXPARAMETERIPROC, glTexParameteri); return glad_glTexParameteri(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexParameteriv(GLenum a0, GLenum a1, const GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLTEXPARAMETERIVPROC, glTexParameteriv); return glad_glTexParameteriv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLint a4, GLenum a5, GLenum a6, const void* a7) { GLAD_LAZY_RESOLVE(PFNGLTEXIMAGE1DPROC, glTexImage1D); return glad_glTexImage1D(a0, a1, a2, a3, a4, a5, a6, a7); }
+static void APIENTRY glad_lazy_glTexImage2D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const void* a8) { GLAD_LAZY_RESOLVE(PFNGLTEXIMAGE2DPROC, glTexImage2D); return glad_glTexImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static void APIENTRY glad_lazy_glDrawBuffer(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLDRAWBUFFERPROC, glDrawBuffer); return glad_glDrawBuffer(a0); }
+static void APIENTRY glad_lazy_glClear(GLbitfield a0) { GLAD_LAZY_RESOLVE(PFNGLCLEARPROC, glClear); return glad_glClear(a0); }
+static void APIENTRY glad_lazy_glClearColor(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLCLEARCOLORPROC, glClearColor); return glad_glClearColor(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glClearStencil(GLint a0) { GLAD_LAZY_RESOLVE(PFNGLCLEARSTENCILPROC, glClearStencil); return glad_glClearStencil(a0); }
+static void APIENTRY glad_lazy_glClearDepth(GLdouble a0) { GLAD_LAZY_RESOLVE(PFNGLCLEARDEPTHPROC, glClearDepth); return glad_glClearDepth(a0); }
+static void APIENTRY glad_lazy_glStencilMask(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLSTENCILMASKPROC, glStencilMask); return glad_glStencilMask(a0); }
+static void APIENTRY glad_lazy_glColorMask(GLboolean a0, GLboolean a1, GLboolean a2, GLboolean a3) { GLAD_LAZY_RESOLVE(PFNGLCOLORMASKPROC, glColorMask); return glad_glColorMask(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glDepthMask(GLboolean a0) { GLAD_LAZY_RESOLVE(PFNGLDEPTHMASKPROC, glDepthMask); return glad_glDepthMask(a0); }
+static void APIENTRY glad_lazy_glDisable(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLDISABLEPROC, glDisable); return glad_glDisable(a0); }
+static void APIENTRY glad_lazy_glEnable(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLENABLEPROC, glEnable); return glad_glEnable(a0); }
+static void APIENTRY glad_lazy_glFinish() { GLAD_LAZY_RESOLVE(PFNGLFINISHPROC, glFinish); return glad_glFinish(); }
+static void APIENTRY glad_lazy_glFlush() { GLAD_LAZY_RESOLVE(PFNGLFLUSHPROC, glFlush); return glad_glFlush(); }
+static void APIENTRY glad_lazy_glBlendFunc(GLenum a0, GLenum a1) { GLAD_LAZY_RESOLVE(PFNGLBLENDFUNCPROC, glBlendFunc); return glad_glBlendFunc(a0, a1); }
+static void APIENTRY glad_lazy_glLogicOp(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLLOGICOPPROC, glLogicOp); return glad_glLogicOp(a0); }
+static void APIENTRY glad_lazy_glStencilFunc(GLenum a0, GLint a1, GLuint a2) { GLAD_LAZY_RESOLVE(PFNGLSTENCILFUNCPROC, glStencilFunc); return glad_glStencilFunc(a0, a1, a2); }
+static void APIENTRY glad_lazy_glStencilOp(GLenum a0, GLenum a1, GLenum a2) { GLAD_LAZY_RESOLVE(PFNGLSTENCILOPPROC, glStencilOp); return glad_glStencilOp(a0, a1, a2); }
+static void APIENTRY glad_lazy_glDepthFunc(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLDEPTHFUNCPROC, glDepthFunc); return glad_glDepthFunc(a0); }
+static void APIENTRY glad_lazy_glPixelStoref(GLenum a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLPIXELSTOREFPROC, glPixelStoref); return glad_glPixelStoref(a0, a1); }
+static void APIENTRY glad_lazy_glPixelStorei(GLenum a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLPIXELSTOREIPROC, glPixelStorei); return glad_glPixelStorei(a0, a1); }
+static void APIENTRY glad_lazy_glReadBuffer(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLREADBUFFERPROC, glReadBuffer); return glad_glReadBuffer(a0); }
+static void APIENTRY glad_lazy_glReadPixels(GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, void* a6) { GLAD_LAZY_RESOLVE(PFNGLREADPIXELSPROC, glReadPixels); return glad_glReadPixels(a0, a1, a2, a3, a4, a5, a6); }
+static void APIENTRY glad_lazy_glGetBooleanv(GLenum a0, GLboolean* a1) { GLAD_LAZY_RESOLVE(PFNGLGETBOOLEANVPROC, glGetBooleanv); return glad_glGetBooleanv(a0, a1); }
+static void APIENTRY glad_lazy_glGetDoublev(GLenum a0, GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLGETDOUBLEVPROC, glGetDoublev); return glad_glGetDoublev(a0, a1); }
+static GLenum APIENTRY glad_lazy_glGetError() { GLAD_LAZY_RESOLVE(PFNGLGETERRORPROC, glGetError); return glad_glGetError(); }
+static void APIENTRY glad_lazy_glGetFloatv(GLenum a0, GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLGETFLOATVPROC, glGetFloatv); return glad_glGetFloatv(a0, a1); }
+static void APIENTRY glad_lazy_glGetIntegerv(GLenum a0, GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLGETINTEGERVPROC, glGetIntegerv); return glad_glGetIntegerv(a0, a1); }
+static const GLubyte* APIENTRY glad_lazy_glGetString(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLGETSTRINGPROC, glGetString); return glad_glGetString(a0); }
+static void APIENTRY glad_lazy_glGetTexImage(GLenum a0, GLint a1, GLenum a2, GLenum a3, void* a4) { GLAD_LAZY_RESOLVE(PFNGLGETTEXIMAGEPROC, glGetTexImage); return glad_glGetTexImage(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glGetTexParameterfv(GLenum a0, GLenum a1, GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLGETTEXPARAMETERFVPROC, glGetTexParameterfv); return glad_glGetTexParameterfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetTexParameteriv(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETTEXPARAMETERIVPROC, glGetTexParameteriv); return glad_glGetTexParameteriv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetTexLevelParameterfv(GLenum a0, GLint a1, GLenum a2, GLfloat* a3) { GLAD_LAZY_RESOLVE(PFNGLGETTEXLEVELPARAMETERFVPROC, glGetTexLevelParameterfv); return glad_glGetTexLevelParameterfv(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGetTexLevelParameteriv(GLenum a0, GLint a1, GLenum a2, GLint* a3) { GLAD_LAZY_RESOLVE(PFNGLGETTEXLEVELPARAMETERIVPROC, glGetTexLevelParameteriv); return glad_glGetTexLevelParameteriv(a0, a1, a2, a3); }
+static GLboolean APIENTRY glad_lazy_glIsEnabled(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLISENABLEDPROC, glIsEnabled); return glad_glIsEnabled(a0); }
+static void APIENTRY glad_lazy_glDepthRange(GLdouble a0, GLdouble a1) { GLAD_LAZY_RESOLVE(PFNGLDEPTHRANGEPROC, glDepthRange); return glad_glDepthRange(a0, a1); }
+static void APIENTRY glad_lazy_glViewport(GLint a0, GLint a1, GLsizei a2, GLsizei a3) { GLAD_LAZY_RESOLVE(PFNGLVIEWPORTPROC, glViewport); return glad_glViewport(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glNewList(GLuint a0, GLenum a1) { GLAD_LAZY_RESOLVE(PFNGLNEWLISTPROC, glNewList); return glad_glNewList(a0, a1); }
+static void APIENTRY glad_lazy_glEndList() { GLAD_LAZY_RESOLVE(PFNGLENDLISTPROC, glEndList); return glad_glEndList(); }
+static void APIENTRY glad_lazy_glCallList(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLCALLLISTPROC, glCallList); return glad_glCallList(a0); }
+static void APIENTRY glad_lazy_glCallLists(GLsizei a0, GLenum a1, const void* a2) { GLAD_LAZY_RESOLVE(PFNGLCALLLISTSPROC, glCallLists); return glad_glCallLists(a0, a1, a2); }
+static void APIENTRY glad_lazy_glDeleteLists(GLuint a0, GLsizei a1) { GLAD_LAZY_RESOLVE(PFNGLDELETELISTSPROC, glDeleteLists); return glad_glDeleteLists(a0, a1); }
+static GLuint APIENTRY glad_lazy_glGenLists(GLsizei a0) { GLAD_LAZY_RESOLVE(PFNGLGENLISTSPROC, glGenLists); return glad_glGenLists(a0); }
+static void APIENTRY glad_lazy_glListBase(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLLISTBASEPROC, glListBase); return glad_glListBase(a0); }
+static void APIENTRY glad_lazy_glBegin(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLBEGINPROC, glBegin); return glad_glBegin(a0); }
+static void APIENTRY glad_lazy_glBitmap(GLsizei a0, GLsizei a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, const GLubyte* a6) { GLAD_LAZY_RESOLVE(PFNGLBITMAPPROC, glBitmap); return glad_glBitmap(a0, a1, a2, a3, a4, a5, a6); }
+static void APIENTRY glad_lazy_glColor3b(GLbyte a0, GLbyte a1, GLbyte a2) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3BPROC, glColor3b); return glad_glColor3b(a0, a1, a2); }
+static void APIENTRY glad_lazy_glColor3bv(const GLbyte* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3BVPROC, glColor3bv); return glad_glColor3bv(a0); }
+static void APIENTRY glad_lazy_glColor3d(GLdouble a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3DPROC, glColor3d); return glad_glColor3d(a0, a1, a2); }
+static void APIENTRY glad_lazy_glColor3dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3DVPROC, glColor3dv); return glad_glColor3dv(a0); }
+static void APIENTRY glad_lazy_glColor3f(GLfloat a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3FPROC, glColor3f); return glad_glColor3f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glColor3fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3FVPROC, glColor3fv); return glad_glColor3fv(a0); }
+static void APIENTRY glad_lazy_glColor3i(GLint a0, GLint a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3IPROC, glColor3i); return glad_glColor3i(a0, a1, a2); }
+static void APIENTRY glad_lazy_glColor3iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3IVPROC, glColor3iv); return glad_glColor3iv(a0); }
+static void APIENTRY glad_lazy_glColor3s(GLshort a0, GLshort a1, GLshort a2) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3SPROC, glColor3s); return glad_glColor3s(a0, a1, a2); }
+static void APIENTRY glad_lazy_glColor3sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3SVPROC, glColor3sv); return glad_glColor3sv(a0); }
+static void APIENTRY glad_lazy_glColor3ub(GLubyte a0, GLubyte a1, GLubyte a2) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3UBPROC, glColor3ub); return glad_glColor3ub(a0, a1, a2); }
+static void APIENTRY glad_lazy_glColor3ubv(const GLubyte* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3UBVPROC, glColor3ubv); return glad_glColor3ubv(a0); }
+static void APIENTRY glad_lazy_glColor3ui(GLuint a0, GLuint a1, GLuint a2) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3UIPROC, glColor3ui); return glad_glColor3ui(a0, a1, a2); }
+static void APIENTRY glad_lazy_glColor3uiv(const GLuint* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3UIVPROC, glColor3uiv); return glad_glColor3uiv(a0); }
+static void APIENTRY glad_lazy_glColor3us(GLushort a0, GLushort a1, GLushort a2) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3USPROC, glColor3us); return glad_glColor3us(a0, a1, a2); }
+static void APIENTRY glad_lazy_glColor3usv(const GLushort* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR3USVPROC, glColor3usv); return glad_glColor3usv(a0); }
+static void APIENTRY glad_lazy_glColor4b(GLbyte a0, GLbyte a1, GLbyte a2, GLbyte a3) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4BPROC, glColor4b); return glad_glColor4b(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glColor4bv(const GLbyte* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4BVPROC, glColor4bv); return glad_glColor4bv(a0); }
+static void APIENTRY glad_lazy_glColor4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4DPROC, glColor4d); return glad_glColor4d(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glColor4dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4DVPROC, glColor4dv); return glad_glColor4dv(a0); }
+static void APIENTRY glad_lazy_glColor4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4FPROC, glColor4f); return glad_glColor4f(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glColor4fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4FVPROC, glColor4fv); return glad_glColor4fv(a0); }
+static void APIENTRY glad_lazy_glColor4i(GLint a0, GLint a1, GLint a2, GLint a3) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4IPROC, glColor4i); return glad_glColor4i(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glColor4iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4IVPROC, glColor4iv); return glad_glColor4iv(a0); }
+static void APIENTRY glad_lazy_glColor4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4SPROC, glColor4s); return glad_glColor4s(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glColor4sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4SVPROC, glColor4sv); return glad_glColor4sv(a0); }
+static void APIENTRY glad_lazy_glColor4ub(GLubyte a0, GLubyte a1, GLubyte a2, GLubyte a3) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4UBPROC, glColor4ub); return glad_glColor4ub(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glColor4ubv(const GLubyte* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4UBVPROC, glColor4ubv); return glad_glColor4ubv(a0); }
+static void APIENTRY glad_lazy_glColor4ui(GLuint a0, GLuint a1, GLuint a2, GLuint a3) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4UIPROC, glColor4ui); return glad_glColor4ui(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glColor4uiv(const GLuint* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4UIVPROC, glColor4uiv); return glad_glColor4uiv(a0); }
+static void APIENTRY glad_lazy_glColor4us(GLushort a0, GLushort a1, GLushort a2, GLushort a3) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4USPROC, glColor4us); return glad_glColor4us(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glColor4usv(const GLushort* a0) { GLAD_LAZY_RESOLVE(PFNGLCOLOR4USVPROC, glColor4usv); return glad_glColor4usv(a0); }
+static void APIENTRY glad_lazy_glEdgeFlag(GLboolean a0) { GLAD_LAZY_RESOLVE(PFNGLEDGEFLAGPROC, glEdgeFlag); return glad_glEdgeFlag(a0); }
+static void APIENTRY glad_lazy_glEdgeFlagv(const GLboolean* a0) { GLAD_LAZY_RESOLVE(PFNGLEDGEFLAGVPROC, glEdgeFlagv); return glad_glEdgeFlagv(a0); }
+static void APIENTRY glad_lazy_glEnd() { GLAD_LAZY_RESOLVE(PFNGLENDPROC, glEnd); return glad_glEnd(); }
+static void APIENTRY glad_lazy_glIndexd(GLdouble a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXDPROC, glIndexd); return glad_glIndexd(a0); }
+static void APIENTRY glad_lazy_glIndexdv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXDVPROC, glIndexdv); return glad_glIndexdv(a0); }
+static void APIENTRY glad_lazy_glIndexf(GLfloat a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXFPROC, glIndexf); return glad_glIndexf(a0); }
+static void APIENTRY glad_lazy_glIndexfv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXFVPROC, glIndexfv); return glad_glIndexfv(a0); }
+static void APIENTRY glad_lazy_glIndexi(GLint a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXIPROC, glIndexi); return glad_glIndexi(a0); }
+static void APIENTRY glad_lazy_glIndexiv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXIVPROC, glIndexiv); return glad_glIndexiv(a0); }
+static void APIENTRY glad_lazy_glIndexs(GLshort a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXSPROC, glIndexs); return glad_glIndexs(a0); }
+static void APIENTRY glad_lazy_glIndexsv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXSVPROC, glIndexsv); return glad_glIndexsv(a0); }
+static void APIENTRY glad_lazy_glNormal3b(GLbyte a0, GLbyte a1, GLbyte a2) { GLAD_LAZY_RESOLVE(PFNGLNORMAL3BPROC, glNormal3b); return glad_glNormal3b(a0, a1, a2); }
+static void APIENTRY glad_lazy_glNormal3bv(const GLbyte* a0) { GLAD_LAZY_RESOLVE(PFNGLNORMAL3BVPROC, glNormal3bv); return glad_glNormal3bv(a0); }
+static void APIENTRY glad_lazy_glNormal3d(GLdouble a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLNORMAL3DPROC, glNormal3d); return glad_glNormal3d(a0, a1, a2); }
+static void APIENTRY glad_lazy_glNormal3dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLNORMAL3DVPROC, glNormal3dv); return glad_glNormal3dv(a0); }
+static void APIENTRY glad_lazy_glNormal3f(GLfloat a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLNORMAL3FPROC, glNormal3f); return glad_glNormal3f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glNormal3fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLNORMAL3FVPROC, glNormal3fv); return glad_glNormal3fv(a0); }
+static void APIENTRY glad_lazy_glNormal3i(GLint a0, GLint a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLNORMAL3IPROC, glNormal3i); return glad_glNormal3i(a0, a1, a2); }
+static void APIENTRY glad_lazy_glNormal3iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLNORMAL3IVPROC, glNormal3iv); return glad_glNormal3iv(a0); }
+static void APIENTRY glad_lazy_glNormal3s(GLshort a0, GLshort a1, GLshort a2) { GLAD_LAZY_RESOLVE(PFNGLNORMAL3SPROC, glNormal3s); return glad_glNormal3s(a0, a1, a2); }
+static void APIENTRY glad_lazy_glNormal3sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLNORMAL3SVPROC, glNormal3sv); return glad_glNormal3sv(a0); }
+static void APIENTRY glad_lazy_glRasterPos2d(GLdouble a0, GLdouble a1) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS2DPROC, glRasterPos2d); return glad_glRasterPos2d(a0, a1); }
+static void APIENTRY glad_lazy_glRasterPos2dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS2DVPROC, glRasterPos2dv); return glad_glRasterPos2dv(a0); }
+static void APIENTRY glad_lazy_glRasterPos2f(GLfloat a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS2FPROC, glRasterPos2f); return glad_glRasterPos2f(a0, a1); }
+static void APIENTRY glad_lazy_glRasterPos2fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS2FVPROC, glRasterPos2fv); return glad_glRasterPos2fv(a0); }
+static void APIENTRY glad_lazy_glRasterPos2i(GLint a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS2IPROC, glRasterPos2i); return glad_glRasterPos2i(a0, a1); }
+static void APIENTRY glad_lazy_glRasterPos2iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS2IVPROC, glRasterPos2iv); return glad_glRasterPos2iv(a0); }
+static void APIENTRY glad_lazy_glRasterPos2s(GLshort a0, GLshort a1) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS2SPROC, glRasterPos2s); return glad_glRasterPos2s(a0, a1); }
+static void APIENTRY glad_lazy_glRasterPos2sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS2SVPROC, glRasterPos2sv); return glad_glRasterPos2sv(a0); }
+static void APIENTRY glad_lazy_glRasterPos3d(GLdouble a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS3DPROC, glRasterPos3d); return glad_glRasterPos3d(a0, a1, a2); }
+static void APIENTRY glad_lazy_glRasterPos3dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS3DVPROC, glRasterPos3dv); return glad_glRasterPos3dv(a0); }
+static void APIENTRY glad_lazy_glRasterPos3f(GLfloat a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS3FPROC, glRasterPos3f); return glad_glRasterPos3f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glRasterPos3fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS3FVPROC, glRasterPos3fv); return glad_glRasterPos3fv(a0); }
+static void APIENTRY glad_lazy_glRasterPos3i(GLint a0, GLint a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS3IPROC, glRasterPos3i); return glad_glRasterPos3i(a0, a1, a2); }
+static void APIENTRY glad_lazy_glRasterPos3iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS3IVPROC, glRasterPos3iv); return glad_glRasterPos3iv(a0); }
+static void APIENTRY glad_lazy_glRasterPos3s(GLshort a0, GLshort a1, GLshort a2) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS3SPROC, glRasterPos3s); return glad_glRasterPos3s(a0, a1, a2); }
+static void APIENTRY glad_lazy_glRasterPos3sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS3SVPROC, glRasterPos3sv); return glad_glRasterPos3sv(a0); }
+static void APIENTRY glad_lazy_glRasterPos4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS4DPROC, glRasterPos4d); return glad_glRasterPos4d(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glRasterPos4dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS4DVPROC, glRasterPos4dv); return glad_glRasterPos4dv(a0); }
+static void APIENTRY glad_lazy_glRasterPos4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS4FPROC, glRasterPos4f); return glad_glRasterPos4f(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glRasterPos4fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS4FVPROC, glRasterPos4fv); return glad_glRasterPos4fv(a0); }
+static void APIENTRY glad_lazy_glRasterPos4i(GLint a0, GLint a1, GLint a2, GLint a3) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS4IPROC, glRasterPos4i); return glad_glRasterPos4i(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glRasterPos4iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS4IVPROC, glRasterPos4iv); return glad_glRasterPos4iv(a0); }
+static void APIENTRY glad_lazy_glRasterPos4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS4SPROC, glRasterPos4s); return glad_glRasterPos4s(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glRasterPos4sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLRASTERPOS4SVPROC, glRasterPos4sv); return glad_glRasterPos4sv(a0); }
+static void APIENTRY glad_lazy_glRectd(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { GLAD_LAZY_RESOLVE(PFNGLRECTDPROC, glRectd); return glad_glRectd(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glRectdv(const GLdouble* a0, const GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLRECTDVPROC, glRectdv); return glad_glRectdv(a0, a1); }
+static void APIENTRY glad_lazy_glRectf(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLRECTFPROC, glRectf); return glad_glRectf(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glRectfv(const GLfloat* a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLRECTFVPROC, glRectfv); return glad_glRectfv(a0, a1); }
+static void APIENTRY glad_lazy_glRecti(GLint a0, GLint a1, GLint a2, GLint a3) { GLAD_LAZY_RESOLVE(PFNGLRECTIPROC, glRecti); return glad_glRecti(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glRectiv(const GLint* a0, const GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLRECTIVPROC, glRectiv); return glad_glRectiv(a0, a1); }
+static void APIENTRY glad_lazy_glRects(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { GLAD_LAZY_RESOLVE(PFNGLRECTSPROC, glRects); return glad_glRects(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glRectsv(const GLshort* a0, const GLshort* a1) { GLAD_LAZY_RESOLVE(PFNGLRECTSVPROC, glRectsv); return glad_glRectsv(a0, a1); }
+static void APIENTRY glad_lazy_glTexCoord1d(GLdouble a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD1DPROC, glTexCoord1d); return glad_glTexCoord1d(a0); }
+static void APIENTRY glad_lazy_glTexCoord1dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD1DVPROC, glTexCoord1dv); return glad_glTexCoord1dv(a0); }
+static void APIENTRY glad_lazy_glTexCoord1f(GLfloat a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD1FPROC, glTexCoord1f); return glad_glTexCoord1f(a0); }
+static void APIENTRY glad_lazy_glTexCoord1fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD1FVPROC, glTexCoord1fv); return glad_glTexCoord1fv(a0); }
+static void APIENTRY glad_lazy_glTexCoord1i(GLint a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD1IPROC, glTexCoord1i); return glad_glTexCoord1i(a0); }
+static void APIENTRY glad_lazy_glTexCoord1iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD1IVPROC, glTexCoord1iv); return glad_glTexCoord1iv(a0); }
+static void APIENTRY glad_lazy_glTexCoord1s(GLshort a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD1SPROC, glTexCoord1s); return glad_glTexCoord1s(a0); }
+static void APIENTRY glad_lazy_glTexCoord1sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD1SVPROC, glTexCoord1sv); return glad_glTexCoord1sv(a0); }
+static void APIENTRY glad_lazy_glTexCoord2d(GLdouble a0, GLdouble a1) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD2DPROC, glTexCoord2d); return glad_glTexCoord2d(a0, a1); }
+static void APIENTRY glad_lazy_glTexCoord2dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD2DVPROC, glTexCoord2dv); return glad_glTexCoord2dv(a0); }
+static void APIENTRY glad_lazy_glTexCoord2f(GLfloat a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD2FPROC, glTexCoord2f); return glad_glTexCoord2f(a0, a1); }
+static void APIENTRY glad_lazy_glTexCoord2fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD2FVPROC, glTexCoord2fv); return glad_glTexCoord2fv(a0); }
+static void APIENTRY glad_lazy_glTexCoord2i(GLint a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD2IPROC, glTexCoord2i); return glad_glTexCoord2i(a0, a1); }
+static void APIENTRY glad_lazy_glTexCoord2iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD2IVPROC, glTexCoord2iv); return glad_glTexCoord2iv(a0); }
+static void APIENTRY glad_lazy_glTexCoord2s(GLshort a0, GLshort a1) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD2SPROC, glTexCoord2s); return glad_glTexCoord2s(a0, a1); }
+static void APIENTRY glad_lazy_glTexCoord2sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD2SVPROC, glTexCoord2sv); return glad_glTexCoord2sv(a0); }
+static void APIENTRY glad_lazy_glTexCoord3d(GLdouble a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD3DPROC, glTexCoord3d); return glad_glTexCoord3d(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexCoord3dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD3DVPROC, glTexCoord3dv); return glad_glTexCoord3dv(a0); }
+static void APIENTRY glad_lazy_glTexCoord3f(GLfloat a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD3FPROC, glTexCoord3f); return glad_glTexCoord3f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexCoord3fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD3FVPROC, glTexCoord3fv); return glad_glTexCoord3fv(a0); }
+static void APIENTRY glad_lazy_glTexCoord3i(GLint a0, GLint a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD3IPROC, glTexCoord3i); return glad_glTexCoord3i(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexCoord3iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD3IVPROC, glTexCoord3iv); return glad_glTexCoord3iv(a0); }
+static void APIENTRY glad_lazy_glTexCoord3s(GLshort a0, GLshort a1, GLshort a2) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD3SPROC, glTexCoord3s); return glad_glTexCoord3s(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexCoord3sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD3SVPROC, glTexCoord3sv); return glad_glTexCoord3sv(a0); }
+static void APIENTRY glad_lazy_glTexCoord4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD4DPROC, glTexCoord4d); return glad_glTexCoord4d(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glTexCoord4dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD4DVPROC, glTexCoord4dv); return glad_glTexCoord4dv(a0); }
+static void APIENTRY glad_lazy_glTexCoord4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD4FPROC, glTexCoord4f); return glad_glTexCoord4f(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glTexCoord4fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD4FVPROC, glTexCoord4fv); return glad_glTexCoord4fv(a0); }
+static void APIENTRY glad_lazy_glTexCoord4i(GLint a0, GLint a1, GLint a2, GLint a3) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD4IPROC, glTexCoord4i); return glad_glTexCoord4i(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glTexCoord4iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD4IVPROC, glTexCoord4iv); return glad_glTexCoord4iv(a0); }
+static void APIENTRY glad_lazy_glTexCoord4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD4SPROC, glTexCoord4s); return glad_glTexCoord4s(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glTexCoord4sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORD4SVPROC, glTexCoord4sv); return glad_glTexCoord4sv(a0); }
+static void APIENTRY glad_lazy_glVertex2d(GLdouble a0, GLdouble a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEX2DPROC, glVertex2d); return glad_glVertex2d(a0, a1); }
+static void APIENTRY glad_lazy_glVertex2dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX2DVPROC, glVertex2dv); return glad_glVertex2dv(a0); }
+static void APIENTRY glad_lazy_glVertex2f(GLfloat a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEX2FPROC, glVertex2f); return glad_glVertex2f(a0, a1); }
+static void APIENTRY glad_lazy_glVertex2fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX2FVPROC, glVertex2fv); return glad_glVertex2fv(a0); }
+static void APIENTRY glad_lazy_glVertex2i(GLint a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEX2IPROC, glVertex2i); return glad_glVertex2i(a0, a1); }
+static void APIENTRY glad_lazy_glVertex2iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX2IVPROC, glVertex2iv); return glad_glVertex2iv(a0); }
+static void APIENTRY glad_lazy_glVertex2s(GLshort a0, GLshort a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEX2SPROC, glVertex2s); return glad_glVertex2s(a0, a1); }
+static void APIENTRY glad_lazy_glVertex2sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX2SVPROC, glVertex2sv); return glad_glVertex2sv(a0); }
+static void APIENTRY glad_lazy_glVertex3d(GLdouble a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLVERTEX3DPROC, glVertex3d); return glad_glVertex3d(a0, a1, a2); }
+static void APIENTRY glad_lazy_glVertex3dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX3DVPROC, glVertex3dv); return glad_glVertex3dv(a0); }
+static void APIENTRY glad_lazy_glVertex3f(GLfloat a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLVERTEX3FPROC, glVertex3f); return glad_glVertex3f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glVertex3fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX3FVPROC, glVertex3fv); return glad_glVertex3fv(a0); }
+static void APIENTRY glad_lazy_glVertex3i(GLint a0, GLint a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLVERTEX3IPROC, glVertex3i); return glad_glVertex3i(a0, a1, a2); }
+static void APIENTRY glad_lazy_glVertex3iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX3IVPROC, glVertex3iv); return glad_glVertex3iv(a0); }
+static void APIENTRY glad_lazy_glVertex3s(GLshort a0, GLshort a1, GLshort a2) { GLAD_LAZY_RESOLVE(PFNGLVERTEX3SPROC, glVertex3s); return glad_glVertex3s(a0, a1, a2); }
+static void APIENTRY glad_lazy_glVertex3sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX3SVPROC, glVertex3sv); return glad_glVertex3sv(a0); }
+static void APIENTRY glad_lazy_glVertex4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { GLAD_LAZY_RESOLVE(PFNGLVERTEX4DPROC, glVertex4d); return glad_glVertex4d(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glVertex4dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX4DVPROC, glVertex4dv); return glad_glVertex4dv(a0); }
+static void APIENTRY glad_lazy_glVertex4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLVERTEX4FPROC, glVertex4f); return glad_glVertex4f(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glVertex4fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX4FVPROC, glVertex4fv); return glad_glVertex4fv(a0); }
+static void APIENTRY glad_lazy_glVertex4i(GLint a0, GLint a1, GLint a2, GLint a3) { GLAD_LAZY_RESOLVE(PFNGLVERTEX4IPROC, glVertex4i); return glad_glVertex4i(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glVertex4iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX4IVPROC, glVertex4iv); return glad_glVertex4iv(a0); }
+static void APIENTRY glad_lazy_glVertex4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { GLAD_LAZY_RESOLVE(PFNGLVERTEX4SPROC, glVertex4s); return glad_glVertex4s(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glVertex4sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLVERTEX4SVPROC, glVertex4sv); return glad_glVertex4sv(a0); }
+static void APIENTRY glad_lazy_glClipPlane(GLenum a0, const GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLCLIPPLANEPROC, glClipPlane); return glad_glClipPlane(a0, a1); }
+static void APIENTRY glad_lazy_glColorMaterial(GLenum a0, GLenum a1) { GLAD_LAZY_RESOLVE(PFNGLCOLORMATERIALPROC, glColorMaterial); return glad_glColorMaterial(a0, a1); }
+static void APIENTRY glad_lazy_glFogf(GLenum a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLFOGFPROC, glFogf); return glad_glFogf(a0, a1); }
+static void APIENTRY glad_lazy_glFogfv(GLenum a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLFOGFVPROC, glFogfv); return glad_glFogfv(a0, a1); }
+static void APIENTRY glad_lazy_glFogi(GLenum a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLFOGIPROC, glFogi); return glad_glFogi(a0, a1); }
+static void APIENTRY glad_lazy_glFogiv(GLenum a0, const GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLFOGIVPROC, glFogiv); return glad_glFogiv(a0, a1); }
+static void APIENTRY glad_lazy_glLightf(GLenum a0, GLenum a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLLIGHTFPROC, glLightf); return glad_glLightf(a0, a1, a2); }
+static void APIENTRY glad_lazy_glLightfv(GLenum a0, GLenum a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLLIGHTFVPROC, glLightfv); return glad_glLightfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glLighti(GLenum a0, GLenum a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLLIGHTIPROC, glLighti); return glad_glLighti(a0, a1, a2); }
+static void APIENTRY glad_lazy_glLightiv(GLenum a0, GLenum a1, const GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLLIGHTIVPROC, glLightiv); return glad_glLightiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glLightModelf(GLenum a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLLIGHTMODELFPROC, glLightModelf); return glad_glLightModelf(a0, a1); }
+static void APIENTRY glad_lazy_glLightModelfv(GLenum a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLLIGHTMODELFVPROC, glLightModelfv); return glad_glLightModelfv(a0, a1); }
+static void APIENTRY glad_lazy_glLightModeli(GLenum a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLLIGHTMODELIPROC, glLightModeli); return glad_glLightModeli(a0, a1); }
+static void APIENTRY glad_lazy_glLightModeliv(GLenum a0, const GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLLIGHTMODELIVPROC, glLightModeliv); return glad_glLightModeliv(a0, a1); }
+static void APIENTRY glad_lazy_glLineStipple(GLint a0, GLushort a1) { GLAD_LAZY_RESOLVE(PFNGLLINESTIPPLEPROC, glLineStipple); return glad_glLineStipple(a0, a1); }
+static void APIENTRY glad_lazy_glMaterialf(GLenum a0, GLenum a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLMATERIALFPROC, glMaterialf); return glad_glMaterialf(a0, a1, a2); }
+static void APIENTRY glad_lazy_glMaterialfv(GLenum a0, GLenum a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLMATERIALFVPROC, glMaterialfv); return glad_glMaterialfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glMateriali(GLenum a0, GLenum a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLMATERIALIPROC, glMateriali); return glad_glMateriali(a0, a1, a2); }
+static void APIENTRY glad_lazy_glMaterialiv(GLenum a0, GLenum a1, const GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLMATERIALIVPROC, glMaterialiv); return glad_glMaterialiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glPolygonStipple(const GLubyte* a0) { GLAD_LAZY_RESOLVE(PFNGLPOLYGONSTIPPLEPROC, glPolygonStipple); return glad_glPolygonStipple(a0); }
+static void APIENTRY glad_lazy_glShadeModel(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLSHADEMODELPROC, glShadeModel); return glad_glShadeModel(a0); }
+static void APIENTRY glad_lazy_glTexEnvf(GLenum a0, GLenum a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLTEXENVFPROC, glTexEnvf); return glad_glTexEnvf(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexEnvfv(GLenum a0, GLenum a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLTEXENVFVPROC, glTexEnvfv); return glad_glTexEnvfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexEnvi(GLenum a0, GLenum a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLTEXENVIPROC, glTexEnvi); return glad_glTexEnvi(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexEnviv(GLenum a0, GLenum a1, const GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLTEXENVIVPROC, glTexEnviv); return glad_glTexEnviv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexGend(GLenum a0, GLenum a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLTEXGENDPROC, glTexGend); return glad_glTexGend(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexGendv(GLenum a0, GLenum a1, const GLdouble* a2) { GLAD_LAZY_RESOLVE(PFNGLTEXGENDVPROC, glTexGendv); return glad_glTexGendv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexGenf(GLenum a0, GLenum a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLTEXGENFPROC, glTexGenf); return glad_glTexGenf(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexGenfv(GLenum a0, GLenum a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLTEXGENFVPROC, glTexGenfv); return glad_glTexGenfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexGeni(GLenum a0, GLenum a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLTEXGENIPROC, glTexGeni); return glad_glTexGeni(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexGeniv(GLenum a0, GLenum a1, const GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLTEXGENIVPROC, glTexGeniv); return glad_glTexGeniv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glFeedbackBuffer(GLsizei a0, GLenum a1, GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLFEEDBACKBUFFERPROC, glFeedbackBuffer); return glad_glFeedbackBuffer(a0, a1, a2); }
+static void APIENTRY glad_lazy_glSelectBuffer(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLSELECTBUFFERPROC, glSelectBuffer); return glad_glSelectBuffer(a0, a1); }
+static GLint APIENTRY glad_lazy_glRenderMode(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLRENDERMODEPROC, glRenderMode); return glad_glRenderMode(a0); }
+static void APIENTRY glad_lazy_glInitNames() { GLAD_LAZY_RESOLVE(PFNGLINITNAMESPROC, glInitNames); return glad_glInitNames(); }
+static void APIENTRY glad_lazy_glLoadName(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLLOADNAMEPROC, glLoadName); return glad_glLoadName(a0); }
+static void APIENTRY glad_lazy_glPassThrough(GLfloat a0) { GLAD_LAZY_RESOLVE(PFNGLPASSTHROUGHPROC, glPassThrough); return glad_glPassThrough(a0); }
+static void APIENTRY glad_lazy_glPopName() { GLAD_LAZY_RESOLVE(PFNGLPOPNAMEPROC, glPopName); return glad_glPopName(); }
+static void APIENTRY glad_lazy_glPushName(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLPUSHNAMEPROC, glPushName); return glad_glPushName(a0); }
+static void APIENTRY glad_lazy_glClearAccum(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLCLEARACCUMPROC, glClearAccum); return glad_glClearAccum(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glClearIndex(GLfloat a0) { GLAD_LAZY_RESOLVE(PFNGLCLEARINDEXPROC, glClearIndex); return glad_glClearIndex(a0); }
+static void APIENTRY glad_lazy_glIndexMask(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXMASKPROC, glIndexMask); return glad_glIndexMask(a0); }
+static void APIENTRY glad_lazy_glAccum(GLenum a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLACCUMPROC, glAccum); return glad_glAccum(a0, a1); }
+static void APIENTRY glad_lazy_glPopAttrib() { GLAD_LAZY_RESOLVE(PFNGLPOPATTRIBPROC, glPopAttrib); return glad_glPopAttrib(); }
+static void APIENTRY glad_lazy_glPushAttrib(GLbitfield a0) { GLAD_LAZY_RESOLVE(PFNGLPUSHATTRIBPROC, glPushAttrib); return glad_glPushAttrib(a0); }
+static void APIENTRY glad_lazy_glMap1d(GLenum a0, GLdouble a1, GLdouble a2, GLint a3, GLint a4, const GLdouble* a5) { GLAD_LAZY_RESOLVE(PFNGLMAP1DPROC, glMap1d); return glad_glMap1d(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glMap1f(GLenum a0, GLfloat a1, GLfloat a2, GLint a3, GLint a4, const GLfloat* a5) { GLAD_LAZY_RESOLVE(PFNGLMAP1FPROC, glMap1f); return glad_glMap1f(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glMap2d(GLenum a0, GLdouble a1, GLdouble a2, GLint a3, GLint a4, GLdouble a5, GLdouble a6, GLint a7, GLint a8, const GLdouble* a9) { GLAD_LAZY_RESOLVE(PFNGLMAP2DPROC, glMap2d); return glad_glMap2d(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static void APIENTRY glad_lazy_glMap2f(GLenum a0, GLfloat a1, GLfloat a2, GLint a3, GLint a4, GLfloat a5, GLfloat a6, GLint a7, GLint a8, const GLfloat* a9) { GLAD_LAZY_RESOLVE(PFNGLMAP2FPROC, glMap2f); return glad_glMap2f(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static void APIENTRY glad_lazy_glMapGrid1d(GLint a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLMAPGRID1DPROC, glMapGrid1d); return glad_glMapGrid1d(a0, a1, a2); }
+static void APIENTRY glad_lazy_glMapGrid1f(GLint a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLMAPGRID1FPROC, glMapGrid1f); return glad_glMapGrid1f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glMapGrid2d(GLint a0, GLdouble a1, GLdouble a2, GLint a3, GLdouble a4, GLdouble a5) { GLAD_LAZY_RESOLVE(PFNGLMAPGRID2DPROC, glMapGrid2d); return glad_glMapGrid2d(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glMapGrid2f(GLint a0, GLfloat a1, GLfloat a2, GLint a3, GLfloat a4, GLfloat a5) { GLAD_LAZY_RESOLVE(PFNGLMAPGRID2FPROC, glMapGrid2f); return glad_glMapGrid2f(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glEvalCoord1d(GLdouble a0) { GLAD_LAZY_RESOLVE(PFNGLEVALCOORD1DPROC, glEvalCoord1d); return glad_glEvalCoord1d(a0); }
+static void APIENTRY glad_lazy_glEvalCoord1dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLEVALCOORD1DVPROC, glEvalCoord1dv); return glad_glEvalCoord1dv(a0); }
+static void APIENTRY glad_lazy_glEvalCoord1f(GLfloat a0) { GLAD_LAZY_RESOLVE(PFNGLEVALCOORD1FPROC, glEvalCoord1f); return glad_glEvalCoord1f(a0); }
+static void APIENTRY glad_lazy_glEvalCoord1fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLEVALCOORD1FVPROC, glEvalCoord1fv); return glad_glEvalCoord1fv(a0); }
+static void APIENTRY glad_lazy_glEvalCoord2d(GLdouble a0, GLdouble a1) { GLAD_LAZY_RESOLVE(PFNGLEVALCOORD2DPROC, glEvalCoord2d); return glad_glEvalCoord2d(a0, a1); }
+static void APIENTRY glad_lazy_glEvalCoord2dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLEVALCOORD2DVPROC, glEvalCoord2dv); return glad_glEvalCoord2dv(a0); }
+static void APIENTRY glad_lazy_glEvalCoord2f(GLfloat a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLEVALCOORD2FPROC, glEvalCoord2f); return glad_glEvalCoord2f(a0, a1); }
+static void APIENTRY glad_lazy_glEvalCoord2fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLEVALCOORD2FVPROC, glEvalCoord2fv); return glad_glEvalCoord2fv(a0); }
+static void APIENTRY glad_lazy_glEvalMesh1(GLenum a0, GLint a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLEVALMESH1PROC, glEvalMesh1); return glad_glEvalMesh1(a0, a1, a2); }
+static void APIENTRY glad_lazy_glEvalPoint1(GLint a0) { GLAD_LAZY_RESOLVE(PFNGLEVALPOINT1PROC, glEvalPoint1); return glad_glEvalPoint1(a0); }
+static void APIENTRY glad_lazy_glEvalMesh2(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4) { GLAD_LAZY_RESOLVE(PFNGLEVALMESH2PROC, glEvalMesh2); return glad_glEvalMesh2(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glEvalPoint2(GLint a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLEVALPOINT2PROC, glEvalPoint2); return glad_glEvalPoint2(a0, a1); }
+static void APIENTRY glad_lazy_glAlphaFunc(GLenum a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLALPHAFUNCPROC, glAlphaFunc); return glad_glAlphaFunc(a0, a1); }
+static void APIENTRY glad_lazy_glPixelZoom(GLfloat a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLPIXELZOOMPROC, glPixelZoom); return glad_glPixelZoom(a0, a1); }
+static void APIENTRY glad_lazy_glPixelTransferf(GLenum a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLPIXELTRANSFERFPROC, glPixelTransferf); return glad_glPixelTransferf(a0, a1); }
+static void APIENTRY glad_lazy_glPixelTransferi(GLenum a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLPIXELTRANSFERIPROC, glPixelTransferi); return glad_glPixelTransferi(a0, a1); }
+static void APIENTRY glad_lazy_glPixelMapfv(GLenum a0, GLsizei a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLPIXELMAPFVPROC, glPixelMapfv); return glad_glPixelMapfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glPixelMapuiv(GLenum a0, GLsizei a1, const GLuint* a2) { GLAD_LAZY_RESOLVE(PFNGLPIXELMAPUIVPROC, glPixelMapuiv); return glad_glPixelMapuiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glPixelMapusv(GLenum a0, GLsizei a1, const GLushort* a2) { GLAD_LAZY_RESOLVE(PFNGLPIXELMAPUSVPROC, glPixelMapusv); return glad_glPixelMapusv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glCopyPixels(GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4) { GLAD_LAZY_RESOLVE(PFNGLCOPYPIXELSPROC, glCopyPixels); return glad_glCopyPixels(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glDrawPixels(GLsizei a0, GLsizei a1, GLenum a2, GLenum a3, const void* a4) { GLAD_LAZY_RESOLVE(PFNGLDRAWPIXELSPROC, glDrawPixels); return glad_glDrawPixels(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glGetClipPlane(GLenum a0, GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLGETCLIPPLANEPROC, glGetClipPlane); return glad_glGetClipPlane(a0, a1); }
+static void APIENTRY glad_lazy_glGetLightfv(GLenum a0, GLenum a1, GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLGETLIGHTFVPROC, glGetLightfv); return glad_glGetLightfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetLightiv(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETLIGHTIVPROC, glGetLightiv); return glad_glGetLightiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetMapdv(GLenum a0, GLenum a1, GLdouble* a2) { GLAD_LAZY_RESOLVE(PFNGLGETMAPDVPROC, glGetMapdv); return glad_glGetMapdv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetMapfv(GLenum a0, GLenum a1, GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLGETMAPFVPROC, glGetMapfv); return glad_glGetMapfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetMapiv(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETMAPIVPROC, glGetMapiv); return glad_glGetMapiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetMaterialfv(GLenum a0, GLenum a1, GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLGETMATERIALFVPROC, glGetMaterialfv); return glad_glGetMaterialfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetMaterialiv(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETMATERIALIVPROC, glGetMaterialiv); return glad_glGetMaterialiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetPixelMapfv(GLenum a0, GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLGETPIXELMAPFVPROC, glGetPixelMapfv); return glad_glGetPixelMapfv(a0, a1); }
+static void APIENTRY glad_lazy_glGetPixelMapuiv(GLenum a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGETPIXELMAPUIVPROC, glGetPixelMapuiv); return glad_glGetPixelMapuiv(a0, a1); }
+static void APIENTRY glad_lazy_glGetPixelMapusv(GLenum a0, GLushort* a1) { GLAD_LAZY_RESOLVE(PFNGLGETPIXELMAPUSVPROC, glGetPixelMapusv); return glad_glGetPixelMapusv(a0, a1); }
+static void APIENTRY glad_lazy_glGetPolygonStipple(GLubyte* a0) { GLAD_LAZY_RESOLVE(PFNGLGETPOLYGONSTIPPLEPROC, glGetPolygonStipple); return glad_glGetPolygonStipple(a0); }
+static void APIENTRY glad_lazy_glGetTexEnvfv(GLenum a0, GLenum a1, GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLGETTEXENVFVPROC, glGetTexEnvfv); return glad_glGetTexEnvfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetTexEnviv(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETTEXENVIVPROC, glGetTexEnviv); return glad_glGetTexEnviv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetTexGendv(GLenum a0, GLenum a1, GLdouble* a2) { GLAD_LAZY_RESOLVE(PFNGLGETTEXGENDVPROC, glGetTexGendv); return glad_glGetTexGendv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetTexGenfv(GLenum a0, GLenum a1, GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLGETTEXGENFVPROC, glGetTexGenfv); return glad_glGetTexGenfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetTexGeniv(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETTEXGENIVPROC, glGetTexGeniv); return glad_glGetTexGeniv(a0, a1, a2); }
+static GLboolean APIENTRY glad_lazy_glIsList(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISLISTPROC, glIsList); return glad_glIsList(a0); }
+static void APIENTRY glad_lazy_glFrustum(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5) { GLAD_LAZY_RESOLVE(PFNGLFRUSTUMPROC, glFrustum); return glad_glFrustum(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glLoadIdentity() { GLAD_LAZY_RESOLVE(PFNGLLOADIDENTITYPROC, glLoadIdentity); return glad_glLoadIdentity(); }
+static void APIENTRY glad_lazy_glLoadMatrixf(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLLOADMATRIXFPROC, glLoadMatrixf); return glad_glLoadMatrixf(a0); }
+static void APIENTRY glad_lazy_glLoadMatrixd(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLLOADMATRIXDPROC, glLoadMatrixd); return glad_glLoadMatrixd(a0); }
+static void APIENTRY glad_lazy_glMatrixMode(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLMATRIXMODEPROC, glMatrixMode); return glad_glMatrixMode(a0); }
+static void APIENTRY glad_lazy_glMultMatrixf(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLMULTMATRIXFPROC, glMultMatrixf); return glad_glMultMatrixf(a0); }
+static void APIENTRY glad_lazy_glMultMatrixd(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLMULTMATRIXDPROC, glMultMatrixd); return glad_glMultMatrixd(a0); }
+static void APIENTRY glad_lazy_glOrtho(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5) { GLAD_LAZY_RESOLVE(PFNGLORTHOPROC, glOrtho); return glad_glOrtho(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glPopMatrix() { GLAD_LAZY_RESOLVE(PFNGLPOPMATRIXPROC, glPopMatrix); return glad_glPopMatrix(); }
+static void APIENTRY glad_lazy_glPushMatrix() { GLAD_LAZY_RESOLVE(PFNGLPUSHMATRIXPROC, glPushMatrix); return glad_glPushMatrix(); }
+static void APIENTRY glad_lazy_glRotated(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { GLAD_LAZY_RESOLVE(PFNGLROTATEDPROC, glRotated); return glad_glRotated(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glRotatef(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLROTATEFPROC, glRotatef); return glad_glRotatef(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glScaled(GLdouble a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLSCALEDPROC, glScaled); return glad_glScaled(a0, a1, a2); }
+static void APIENTRY glad_lazy_glScalef(GLfloat a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLSCALEFPROC, glScalef); return glad_glScalef(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTranslated(GLdouble a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLTRANSLATEDPROC, glTranslated); return glad_glTranslated(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTranslatef(GLfloat a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLTRANSLATEFPROC, glTranslatef); return glad_glTranslatef(a0, a1, a2); }
+static void APIENTRY glad_lazy_glDrawArrays(GLenum a0, GLint a1, GLsizei a2) { GLAD_LAZY_RESOLVE(PFNGLDRAWARRAYSPROC, glDrawArrays); return glad_glDrawArrays(a0, a1, a2); }
+static void APIENTRY glad_lazy_glDrawElements(GLenum a0, GLsizei a1, GLenum a2, const void* a3) { GLAD_LAZY_RESOLVE(PFNGLDRAWELEMENTSPROC, glDrawElements); return glad_glDrawElements(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGetPointerv(GLenum a0, void** a1) { GLAD_LAZY_RESOLVE(PFNGLGETPOINTERVPROC, glGetPointerv); return glad_glGetPointerv(a0, a1); }
+static void APIENTRY glad_lazy_glPolygonOffset(GLfloat a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLPOLYGONOFFSETPROC, glPolygonOffset); return glad_glPolygonOffset(a0, a1); }
+static void APIENTRY glad_lazy_glCopyTexImage1D(GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLint a6) { GLAD_LAZY_RESOLVE(PFNGLCOPYTEXIMAGE1DPROC, glCopyTexImage1D); return glad_glCopyTexImage1D(a0, a1, a2, a3, a4, a5, a6); }
+static void APIENTRY glad_lazy_glCopyTexImage2D(GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLint a7) { GLAD_LAZY_RESOLVE(PFNGLCOPYTEXIMAGE2DPROC, glCopyTexImage2D); return glad_glCopyTexImage2D(a0, a1, a2, a3, a4, a5, a6, a7); }
+static void APIENTRY glad_lazy_glCopyTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5) { GLAD_LAZY_RESOLVE(PFNGLCOPYTEXSUBIMAGE1DPROC, glCopyTexSubImage1D); return glad_glCopyTexSubImage1D(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glCopyTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7) { GLAD_LAZY_RESOLVE(PFNGLCOPYTEXSUBIMAGE2DPROC, glCopyTexSubImage2D); return glad_glCopyTexSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7); }
+static void APIENTRY glad_lazy_glTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void* a6) { GLAD_LAZY_RESOLVE(PFNGLTEXSUBIMAGE1DPROC, glTexSubImage1D); return glad_glTexSubImage1D(a0, a1, a2, a3, a4, a5, a6); }
+static void APIENTRY glad_lazy_glTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void* a8) { GLAD_LAZY_RESOLVE(PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D); return glad_glTexSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static void APIENTRY glad_lazy_glBindTexture(GLenum a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLBINDTEXTUREPROC, glBindTexture); return glad_glBindTexture(a0, a1); }
+static void APIENTRY glad_lazy_glDeleteTextures(GLsizei a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLDELETETEXTURESPROC, glDeleteTextures); return glad_glDeleteTextures(a0, a1); }
+static void APIENTRY glad_lazy_glGenTextures(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGENTEXTURESPROC, glGenTextures); return glad_glGenTextures(a0, a1); }
+static GLboolean APIENTRY glad_lazy_glIsTexture(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISTEXTUREPROC, glIsTexture); return glad_glIsTexture(a0); }
+static void APIENTRY glad_lazy_glArrayElement(GLint a0) { GLAD_LAZY_RESOLVE(PFNGLARRAYELEMENTPROC, glArrayElement); return glad_glArrayElement(a0); }
+static void APIENTRY glad_lazy_glColorPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { GLAD_LAZY_RESOLVE(PFNGLCOLORPOINTERPROC, glColorPointer); return glad_glColorPointer(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glDisableClientState(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLDISABLECLIENTSTATEPROC, glDisableClientState); return glad_glDisableClientState(a0); }
+static void APIENTRY glad_lazy_glEdgeFlagPointer(GLsizei a0, const void* a1) { GLAD_LAZY_RESOLVE(PFNGLEDGEFLAGPOINTERPROC, glEdgeFlagPointer); return glad_glEdgeFlagPointer(a0, a1); }
+static void APIENTRY glad_lazy_glEnableClientState(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLENABLECLIENTSTATEPROC, glEnableClientState); return glad_glEnableClientState(a0); }
+static void APIENTRY glad_lazy_glIndexPointer(GLenum a0, GLsizei a1, const void* a2) { GLAD_LAZY_RESOLVE(PFNGLINDEXPOINTERPROC, glIndexPointer); return glad_glIndexPointer(a0, a1, a2); }
+static void APIENTRY glad_lazy_glInterleavedArrays(GLenum a0, GLsizei a1, const void* a2) { GLAD_LAZY_RESOLVE(PFNGLINTERLEAVEDARRAYSPROC, glInterleavedArrays); return glad_glInterleavedArrays(a0, a1, a2); }
+static void APIENTRY glad_lazy_glNormalPointer(GLenum a0, GLsizei a1, const void* a2) { GLAD_LAZY_RESOLVE(PFNGLNORMALPOINTERPROC, glNormalPointer); return glad_glNormalPointer(a0, a1, a2); }
+static void APIENTRY glad_lazy_glTexCoordPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { GLAD_LAZY_RESOLVE(PFNGLTEXCOORDPOINTERPROC, glTexCoordPointer); return glad_glTexCoordPointer(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glVertexPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { GLAD_LAZY_RESOLVE(PFNGLVERTEXPOINTERPROC, glVertexPointer); return glad_glVertexPointer(a0, a1, a2, a3); }
+static GLboolean APIENTRY glad_lazy_glAreTexturesResident(GLsizei a0, const GLuint* a1, GLboolean* a2) { GLAD_LAZY_RESOLVE(PFNGLARETEXTURESRESIDENTPROC, glAreTexturesResident); return glad_glAreTexturesResident(a0, a1, a2); }
+static void APIENTRY glad_lazy_glPrioritizeTextures(GLsizei a0, const GLuint* a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLPRIORITIZETEXTURESPROC, glPrioritizeTextures); return glad_glPrioritizeTextures(a0, a1, a2); }
+static void APIENTRY glad_lazy_glIndexub(GLubyte a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXUBPROC, glIndexub); return glad_glIndexub(a0); }
+static void APIENTRY glad_lazy_glIndexubv(const GLubyte* a0) { GLAD_LAZY_RESOLVE(PFNGLINDEXUBVPROC, glIndexubv); return glad_glIndexubv(a0); }
+static void APIENTRY glad_lazy_glPopClientAttrib() { GLAD_LAZY_RESOLVE(PFNGLPOPCLIENTATTRIBPROC, glPopClientAttrib); return glad_glPopClientAttrib(); }
+static void APIENTRY glad_lazy_glPushClientAttrib(GLbitfield a0) { GLAD_LAZY_RESOLVE(PFNGLPUSHCLIENTATTRIBPROC, glPushClientAttrib); return glad_glPushClientAttrib(a0); }
+static void APIENTRY glad_lazy_glDrawRangeElements(GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void* a5) { GLAD_LAZY_RESOLVE(PFNGLDRAWRANGEELEMENTSPROC, glDrawRangeElements); return glad_glDrawRangeElements(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glTexImage3D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void* a9) { GLAD_LAZY_RESOLVE(PFNGLTEXIMAGE3DPROC, glTexImage3D); return glad_glTexImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static void APIENTRY glad_lazy_glTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void* a10) { GLAD_LAZY_RESOLVE(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D); return glad_glTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); }
+static void APIENTRY glad_lazy_glCopyTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8) { GLAD_LAZY_RESOLVE(PFNGLCOPYTEXSUBIMAGE3DPROC, glCopyTexSubImage3D); return glad_glCopyTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static void APIENTRY glad_lazy_glActiveTexture(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLACTIVETEXTUREPROC, glActiveTexture); return glad_glActiveTexture(a0); }
+static void APIENTRY glad_lazy_glSampleCoverage(GLfloat a0, GLboolean a1) { GLAD_LAZY_RESOLVE(PFNGLSAMPLECOVERAGEPROC, glSampleCoverage); return glad_glSampleCoverage(a0, a1); }
+static void APIENTRY glad_lazy_glCompressedTexImage3D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void* a8) { GLAD_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXIMAGE3DPROC, glCompressedTexImage3D); return glad_glCompressedTexImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static void APIENTRY glad_lazy_glCompressedTexImage2D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const void* a7) { GLAD_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXIMAGE2DPROC, glCompressedTexImage2D); return glad_glCompressedTexImage2D(a0, a1, a2, a3, a4, a5, a6, a7); }
+static void APIENTRY glad_lazy_glCompressedTexImage1D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const void* a6) { GLAD_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXIMAGE1DPROC, glCompressedTexImage1D); return glad_glCompressedTexImage1D(a0, a1, a2, a3, a4, a5, a6); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void* a10) { GLAD_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D); return glad_glCompressedTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void* a8) { GLAD_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D); return glad_glCompressedTexSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static void APIENTRY glad_lazy_glCompressedTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void* a6) { GLAD_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, glCompressedTexSubImage1D); return glad_glCompressedTexSubImage1D(a0, a1, a2, a3, a4, a5, a6); }
+static void APIENTRY glad_lazy_glGetCompressedTexImage(GLenum a0, GLint a1, void* a2) { GLAD_LAZY_RESOLVE(PFNGLGETCOMPRESSEDTEXIMAGEPROC, glGetCompressedTexImage); return glad_glGetCompressedTexImage(a0, a1, a2); }
+static void APIENTRY glad_lazy_glClientActiveTexture(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLCLIENTACTIVETEXTUREPROC, glClientActiveTexture); return glad_glClientActiveTexture(a0); }
+static void APIENTRY glad_lazy_glMultiTexCoord1d(GLenum a0, GLdouble a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD1DPROC, glMultiTexCoord1d); return glad_glMultiTexCoord1d(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord1dv(GLenum a0, const GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD1DVPROC, glMultiTexCoord1dv); return glad_glMultiTexCoord1dv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord1f(GLenum a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD1FPROC, glMultiTexCoord1f); return glad_glMultiTexCoord1f(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord1fv(GLenum a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD1FVPROC, glMultiTexCoord1fv); return glad_glMultiTexCoord1fv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord1i(GLenum a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD1IPROC, glMultiTexCoord1i); return glad_glMultiTexCoord1i(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord1iv(GLenum a0, const GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD1IVPROC, glMultiTexCoord1iv); return glad_glMultiTexCoord1iv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord1s(GLenum a0, GLshort a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD1SPROC, glMultiTexCoord1s); return glad_glMultiTexCoord1s(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord1sv(GLenum a0, const GLshort* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD1SVPROC, glMultiTexCoord1sv); return glad_glMultiTexCoord1sv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord2d(GLenum a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD2DPROC, glMultiTexCoord2d); return glad_glMultiTexCoord2d(a0, a1, a2); }
+static void APIENTRY glad_lazy_glMultiTexCoord2dv(GLenum a0, const GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD2DVPROC, glMultiTexCoord2dv); return glad_glMultiTexCoord2dv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord2f(GLenum a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD2FPROC, glMultiTexCoord2f); return glad_glMultiTexCoord2f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glMultiTexCoord2fv(GLenum a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD2FVPROC, glMultiTexCoord2fv); return glad_glMultiTexCoord2fv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord2i(GLenum a0, GLint a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD2IPROC, glMultiTexCoord2i); return glad_glMultiTexCoord2i(a0, a1, a2); }
+static void APIENTRY glad_lazy_glMultiTexCoord2iv(GLenum a0, const GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD2IVPROC, glMultiTexCoord2iv); return glad_glMultiTexCoord2iv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord2s(GLenum a0, GLshort a1, GLshort a2) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD2SPROC, glMultiTexCoord2s); return glad_glMultiTexCoord2s(a0, a1, a2); }
+static void APIENTRY glad_lazy_glMultiTexCoord2sv(GLenum a0, const GLshort* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD2SVPROC, glMultiTexCoord2sv); return glad_glMultiTexCoord2sv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord3d(GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD3DPROC, glMultiTexCoord3d); return glad_glMultiTexCoord3d(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glMultiTexCoord3dv(GLenum a0, const GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD3DVPROC, glMultiTexCoord3dv); return glad_glMultiTexCoord3dv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord3f(GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD3FPROC, glMultiTexCoord3f); return glad_glMultiTexCoord3f(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glMultiTexCoord3fv(GLenum a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD3FVPROC, glMultiTexCoord3fv); return glad_glMultiTexCoord3fv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord3i(GLenum a0, GLint a1, GLint a2, GLint a3) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD3IPROC, glMultiTexCoord3i); return glad_glMultiTexCoord3i(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glMultiTexCoord3iv(GLenum a0, const GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD3IVPROC, glMultiTexCoord3iv); return glad_glMultiTexCoord3iv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord3s(GLenum a0, GLshort a1, GLshort a2, GLshort a3) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD3SPROC, glMultiTexCoord3s); return glad_glMultiTexCoord3s(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glMultiTexCoord3sv(GLenum a0, const GLshort* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD3SVPROC, glMultiTexCoord3sv); return glad_glMultiTexCoord3sv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord4d(GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD4DPROC, glMultiTexCoord4d); return glad_glMultiTexCoord4d(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glMultiTexCoord4dv(GLenum a0, const GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD4DVPROC, glMultiTexCoord4dv); return glad_glMultiTexCoord4dv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord4f(GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD4FPROC, glMultiTexCoord4f); return glad_glMultiTexCoord4f(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glMultiTexCoord4fv(GLenum a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD4FVPROC, glMultiTexCoord4fv); return glad_glMultiTexCoord4fv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord4i(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD4IPROC, glMultiTexCoord4i); return glad_glMultiTexCoord4i(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glMultiTexCoord4iv(GLenum a0, const GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD4IVPROC, glMultiTexCoord4iv); return glad_glMultiTexCoord4iv(a0, a1); }
+static void APIENTRY glad_lazy_glMultiTexCoord4s(GLenum a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD4SPROC, glMultiTexCoord4s); return glad_glMultiTexCoord4s(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glMultiTexCoord4sv(GLenum a0, const GLshort* a1) { GLAD_LAZY_RESOLVE(PFNGLMULTITEXCOORD4SVPROC, glMultiTexCoord4sv); return glad_glMultiTexCoord4sv(a0, a1); }
+static void APIENTRY glad_lazy_glLoadTransposeMatrixf(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLLOADTRANSPOSEMATRIXFPROC, glLoadTransposeMatrixf); return glad_glLoadTransposeMatrixf(a0); }
+static void APIENTRY glad_lazy_glLoadTransposeMatrixd(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLLOADTRANSPOSEMATRIXDPROC, glLoadTransposeMatrixd); return glad_glLoadTransposeMatrixd(a0); }
+static void APIENTRY glad_lazy_glMultTransposeMatrixf(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLMULTTRANSPOSEMATRIXFPROC, glMultTransposeMatrixf); return glad_glMultTransposeMatrixf(a0); }
+static void APIENTRY glad_lazy_glMultTransposeMatrixd(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLMULTTRANSPOSEMATRIXDPROC, glMultTransposeMatrixd); return glad_glMultTransposeMatrixd(a0); }
+static void APIENTRY glad_lazy_glBlendFuncSeparate(GLenum a0, GLenum a1, GLenum a2, GLenum a3) { GLAD_LAZY_RESOLVE(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate); return glad_glBlendFuncSeparate(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glMultiDrawArrays(GLenum a0, const GLint* a1, const GLsizei* a2, GLsizei a3) { GLAD_LAZY_RESOLVE(PFNGLMULTIDRAWARRAYSPROC, glMultiDrawArrays); return glad_glMultiDrawArrays(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glMultiDrawElements(GLenum a0, const GLsizei* a1, GLenum a2, const void** a3, GLsizei a4) { GLAD_LAZY_RESOLVE(PFNGLMULTIDRAWELEMENTSPROC, glMultiDrawElements); return glad_glMultiDrawElements(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glPointParameterf(GLenum a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLPOINTPARAMETERFPROC, glPointParameterf); return glad_glPointParameterf(a0, a1); }
+static void APIENTRY glad_lazy_glPointParameterfv(GLenum a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLPOINTPARAMETERFVPROC, glPointParameterfv); return glad_glPointParameterfv(a0, a1); }
+static void APIENTRY glad_lazy_glPointParameteri(GLenum a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLPOINTPARAMETERIPROC, glPointParameteri); return glad_glPointParameteri(a0, a1); }
+static void APIENTRY glad_lazy_glPointParameteriv(GLenum a0, const GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLPOINTPARAMETERIVPROC, glPointParameteriv); return glad_glPointParameteriv(a0, a1); }
+static void APIENTRY glad_lazy_glFogCoordf(GLfloat a0) { GLAD_LAZY_RESOLVE(PFNGLFOGCOORDFPROC, glFogCoordf); return glad_glFogCoordf(a0); }
+static void APIENTRY glad_lazy_glFogCoordfv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLFOGCOORDFVPROC, glFogCoordfv); return glad_glFogCoordfv(a0); }
+static void APIENTRY glad_lazy_glFogCoordd(GLdouble a0) { GLAD_LAZY_RESOLVE(PFNGLFOGCOORDDPROC, glFogCoordd); return glad_glFogCoordd(a0); }
+static void APIENTRY glad_lazy_glFogCoorddv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLFOGCOORDDVPROC, glFogCoorddv); return glad_glFogCoorddv(a0); }
+static void APIENTRY glad_lazy_glFogCoordPointer(GLenum a0, GLsizei a1, const void* a2) { GLAD_LAZY_RESOLVE(PFNGLFOGCOORDPOINTERPROC, glFogCoordPointer); return glad_glFogCoordPointer(a0, a1, a2); }
+static void APIENTRY glad_lazy_glSecondaryColor3b(GLbyte a0, GLbyte a1, GLbyte a2) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3BPROC, glSecondaryColor3b); return glad_glSecondaryColor3b(a0, a1, a2); }
+static void APIENTRY glad_lazy_glSecondaryColor3bv(const GLbyte* a0) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3BVPROC, glSecondaryColor3bv); return glad_glSecondaryColor3bv(a0); }
+static void APIENTRY glad_lazy_glSecondaryColor3d(GLdouble a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3DPROC, glSecondaryColor3d); return glad_glSecondaryColor3d(a0, a1, a2); }
+static void APIENTRY glad_lazy_glSecondaryColor3dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3DVPROC, glSecondaryColor3dv); return glad_glSecondaryColor3dv(a0); }
+static void APIENTRY glad_lazy_glSecondaryColor3f(GLfloat a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3FPROC, glSecondaryColor3f); return glad_glSecondaryColor3f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glSecondaryColor3fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3FVPROC, glSecondaryColor3fv); return glad_glSecondaryColor3fv(a0); }
+static void APIENTRY glad_lazy_glSecondaryColor3i(GLint a0, GLint a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3IPROC, glSecondaryColor3i); return glad_glSecondaryColor3i(a0, a1, a2); }
+static void APIENTRY glad_lazy_glSecondaryColor3iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3IVPROC, glSecondaryColor3iv); return glad_glSecondaryColor3iv(a0); }
+static void APIENTRY glad_lazy_glSecondaryColor3s(GLshort a0, GLshort a1, GLshort a2) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3SPROC, glSecondaryColor3s); return glad_glSecondaryColor3s(a0, a1, a2); }
+static void APIENTRY glad_lazy_glSecondaryColor3sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3SVPROC, glSecondaryColor3sv); return glad_glSecondaryColor3sv(a0); }
+static void APIENTRY glad_lazy_glSecondaryColor3ub(GLubyte a0, GLubyte a1, GLubyte a2) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3UBPROC, glSecondaryColor3ub); return glad_glSecondaryColor3ub(a0, a1, a2); }
+static void APIENTRY glad_lazy_glSecondaryColor3ubv(const GLubyte* a0) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3UBVPROC, glSecondaryColor3ubv); return glad_glSecondaryColor3ubv(a0); }
+static void APIENTRY glad_lazy_glSecondaryColor3ui(GLuint a0, GLuint a1, GLuint a2) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3UIPROC, glSecondaryColor3ui); return glad_glSecondaryColor3ui(a0, a1, a2); }
+static void APIENTRY glad_lazy_glSecondaryColor3uiv(const GLuint* a0) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3UIVPROC, glSecondaryColor3uiv); return glad_glSecondaryColor3uiv(a0); }
+static void APIENTRY glad_lazy_glSecondaryColor3us(GLushort a0, GLushort a1, GLushort a2) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3USPROC, glSecondaryColor3us); return glad_glSecondaryColor3us(a0, a1, a2); }
+static void APIENTRY glad_lazy_glSecondaryColor3usv(const GLushort* a0) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3USVPROC, glSecondaryColor3usv); return glad_glSecondaryColor3usv(a0); }
+static void APIENTRY glad_lazy_glSecondaryColorPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { GLAD_LAZY_RESOLVE(PFNGLSECONDARYCOLORPOINTERPROC, glSecondaryColorPointer); return glad_glSecondaryColorPointer(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glWindowPos2d(GLdouble a0, GLdouble a1) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS2DPROC, glWindowPos2d); return glad_glWindowPos2d(a0, a1); }
+static void APIENTRY glad_lazy_glWindowPos2dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS2DVPROC, glWindowPos2dv); return glad_glWindowPos2dv(a0); }
+static void APIENTRY glad_lazy_glWindowPos2f(GLfloat a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS2FPROC, glWindowPos2f); return glad_glWindowPos2f(a0, a1); }
+static void APIENTRY glad_lazy_glWindowPos2fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS2FVPROC, glWindowPos2fv); return glad_glWindowPos2fv(a0); }
+static void APIENTRY glad_lazy_glWindowPos2i(GLint a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS2IPROC, glWindowPos2i); return glad_glWindowPos2i(a0, a1); }
+static void APIENTRY glad_lazy_glWindowPos2iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS2IVPROC, glWindowPos2iv); return glad_glWindowPos2iv(a0); }
+static void APIENTRY glad_lazy_glWindowPos2s(GLshort a0, GLshort a1) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS2SPROC, glWindowPos2s); return glad_glWindowPos2s(a0, a1); }
+static void APIENTRY glad_lazy_glWindowPos2sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS2SVPROC, glWindowPos2sv); return glad_glWindowPos2sv(a0); }
+static void APIENTRY glad_lazy_glWindowPos3d(GLdouble a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS3DPROC, glWindowPos3d); return glad_glWindowPos3d(a0, a1, a2); }
+static void APIENTRY glad_lazy_glWindowPos3dv(const GLdouble* a0) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS3DVPROC, glWindowPos3dv); return glad_glWindowPos3dv(a0); }
+static void APIENTRY glad_lazy_glWindowPos3f(GLfloat a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS3FPROC, glWindowPos3f); return glad_glWindowPos3f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glWindowPos3fv(const GLfloat* a0) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS3FVPROC, glWindowPos3fv); return glad_glWindowPos3fv(a0); }
+static void APIENTRY glad_lazy_glWindowPos3i(GLint a0, GLint a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS3IPROC, glWindowPos3i); return glad_glWindowPos3i(a0, a1, a2); }
+static void APIENTRY glad_lazy_glWindowPos3iv(const GLint* a0) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS3IVPROC, glWindowPos3iv); return glad_glWindowPos3iv(a0); }
+static void APIENTRY glad_lazy_glWindowPos3s(GLshort a0, GLshort a1, GLshort a2) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS3SPROC, glWindowPos3s); return glad_glWindowPos3s(a0, a1, a2); }
+static void APIENTRY glad_lazy_glWindowPos3sv(const GLshort* a0) { GLAD_LAZY_RESOLVE(PFNGLWINDOWPOS3SVPROC, glWindowPos3sv); return glad_glWindowPos3sv(a0); }
+static void APIENTRY glad_lazy_glBlendColor(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLBLENDCOLORPROC, glBlendColor); return glad_glBlendColor(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glBlendEquation(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLBLENDEQUATIONPROC, glBlendEquation); return glad_glBlendEquation(a0); }
+static void APIENTRY glad_lazy_glGenQueries(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGENQUERIESPROC, glGenQueries); return glad_glGenQueries(a0, a1); }
+static void APIENTRY glad_lazy_glDeleteQueries(GLsizei a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLDELETEQUERIESPROC, glDeleteQueries); return glad_glDeleteQueries(a0, a1); }
+static GLboolean APIENTRY glad_lazy_glIsQuery(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISQUERYPROC, glIsQuery); return glad_glIsQuery(a0); }
+static void APIENTRY glad_lazy_glBeginQuery(GLenum a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLBEGINQUERYPROC, glBeginQuery); return glad_glBeginQuery(a0, a1); }
+static void APIENTRY glad_lazy_glEndQuery(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLENDQUERYPROC, glEndQuery); return glad_glEndQuery(a0); }
+static void APIENTRY glad_lazy_glGetQueryiv(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETQUERYIVPROC, glGetQueryiv); return glad_glGetQueryiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetQueryObjectiv(GLuint a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETQUERYOBJECTIVPROC, glGetQueryObjectiv); return glad_glGetQueryObjectiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetQueryObjectuiv(GLuint a0, GLenum a1, GLuint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv); return glad_glGetQueryObjectuiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glBindBuffer(GLenum a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLBINDBUFFERPROC, glBindBuffer); return glad_glBindBuffer(a0, a1); }
+static void APIENTRY glad_lazy_glDeleteBuffers(GLsizei a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLDELETEBUFFERSPROC, glDeleteBuffers); return glad_glDeleteBuffers(a0, a1); }
+static void APIENTRY glad_lazy_glGenBuffers(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGENBUFFERSPROC, glGenBuffers); return glad_glGenBuffers(a0, a1); }
+static GLboolean APIENTRY glad_lazy_glIsBuffer(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISBUFFERPROC, glIsBuffer); return glad_glIsBuffer(a0); }
+static void APIENTRY glad_lazy_glBufferData(GLenum a0, GLsizeiptr a1, const void* a2, GLenum a3) { GLAD_LAZY_RESOLVE(PFNGLBUFFERDATAPROC, glBufferData); return glad_glBufferData(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glBufferSubData(GLenum a0, GLintptr a1, GLsizeiptr a2, const void* a3) { GLAD_LAZY_RESOLVE(PFNGLBUFFERSUBDATAPROC, glBufferSubData); return glad_glBufferSubData(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGetBufferSubData(GLenum a0, GLintptr a1, GLsizeiptr a2, void* a3) { GLAD_LAZY_RESOLVE(PFNGLGETBUFFERSUBDATAPROC, glGetBufferSubData); return glad_glGetBufferSubData(a0, a1, a2, a3); }
+static void* APIENTRY glad_lazy_glMapBuffer(GLenum a0, GLenum a1) { GLAD_LAZY_RESOLVE(PFNGLMAPBUFFERPROC, glMapBuffer); return glad_glMapBuffer(a0, a1); }
+static GLboolean APIENTRY glad_lazy_glUnmapBuffer(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLUNMAPBUFFERPROC, glUnmapBuffer); return glad_glUnmapBuffer(a0); }
+static void APIENTRY glad_lazy_glGetBufferParameteriv(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETBUFFERPARAMETERIVPROC, glGetBufferParameteriv); return glad_glGetBufferParameteriv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetBufferPointerv(GLenum a0, GLenum a1, void** a2) { GLAD_LAZY_RESOLVE(PFNGLGETBUFFERPOINTERVPROC, glGetBufferPointerv); return glad_glGetBufferPointerv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glBlendEquationSeparate(GLenum a0, GLenum a1) { GLAD_LAZY_RESOLVE(PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate); return glad_glBlendEquationSeparate(a0, a1); }
+static void APIENTRY glad_lazy_glDrawBuffers(GLsizei a0, const GLenum* a1) { GLAD_LAZY_RESOLVE(PFNGLDRAWBUFFERSPROC, glDrawBuffers); return glad_glDrawBuffers(a0, a1); }
+static void APIENTRY glad_lazy_glStencilOpSeparate(GLenum a0, GLenum a1, GLenum a2, GLenum a3) { GLAD_LAZY_RESOLVE(PFNGLSTENCILOPSEPARATEPROC, glStencilOpSeparate); return glad_glStencilOpSeparate(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glStencilFuncSeparate(GLenum a0, GLenum a1, GLint a2, GLuint a3) { GLAD_LAZY_RESOLVE(PFNGLSTENCILFUNCSEPARATEPROC, glStencilFuncSeparate); return glad_glStencilFuncSeparate(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glStencilMaskSeparate(GLenum a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLSTENCILMASKSEPARATEPROC, glStencilMaskSeparate); return glad_glStencilMaskSeparate(a0, a1); }
+static void APIENTRY glad_lazy_glAttachShader(GLuint a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLATTACHSHADERPROC, glAttachShader); return glad_glAttachShader(a0, a1); }
+static void APIENTRY glad_lazy_glBindAttribLocation(GLuint a0, GLuint a1, const GLchar* a2) { GLAD_LAZY_RESOLVE(PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation); return glad_glBindAttribLocation(a0, a1, a2); }
+static void APIENTRY glad_lazy_glCompileShader(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLCOMPILESHADERPROC, glCompileShader); return glad_glCompileShader(a0); }
+static GLuint APIENTRY glad_lazy_glCreateProgram() { GLAD_LAZY_RESOLVE(PFNGLCREATEPROGRAMPROC, glCreateProgram); return glad_glCreateProgram(); }
+static GLuint APIENTRY glad_lazy_glCreateShader(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLCREATESHADERPROC, glCreateShader); return glad_glCreateShader(a0); }
+static void APIENTRY glad_lazy_glDeleteProgram(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLDELETEPROGRAMPROC, glDeleteProgram); return glad_glDeleteProgram(a0); }
+static void APIENTRY glad_lazy_glDeleteShader(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLDELETESHADERPROC, glDeleteShader); return glad_glDeleteShader(a0); }
+static void APIENTRY glad_lazy_glDetachShader(GLuint a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLDETACHSHADERPROC, glDetachShader); return glad_glDetachShader(a0, a1); }
+static void APIENTRY glad_lazy_glDisableVertexAttribArray(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray); return glad_glDisableVertexAttribArray(a0); }
+static void APIENTRY glad_lazy_glEnableVertexAttribArray(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray); return glad_glEnableVertexAttribArray(a0); }
+static void APIENTRY glad_lazy_glGetActiveAttrib(GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint* a4, GLenum* a5, GLchar* a6) { GLAD_LAZY_RESOLVE(PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib); return glad_glGetActiveAttrib(a0, a1, a2, a3, a4, a5, a6); }
+static void APIENTRY glad_lazy_glGetActiveUniform(GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint* a4, GLenum* a5, GLchar* a6) { GLAD_LAZY_RESOLVE(PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform); return glad_glGetActiveUniform(a0, a1, a2, a3, a4, a5, a6); }
+static void APIENTRY glad_lazy_glGetAttachedShaders(GLuint a0, GLsizei a1, GLsizei* a2, GLuint* a3) { GLAD_LAZY_RESOLVE(PFNGLGETATTACHEDSHADERSPROC, glGetAttachedShaders); return glad_glGetAttachedShaders(a0, a1, a2, a3); }
+static GLint APIENTRY glad_lazy_glGetAttribLocation(GLuint a0, const GLchar* a1) { GLAD_LAZY_RESOLVE(PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation); return glad_glGetAttribLocation(a0, a1); }
+static void APIENTRY glad_lazy_glGetProgramiv(GLuint a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETPROGRAMIVPROC, glGetProgramiv); return glad_glGetProgramiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetProgramInfoLog(GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3) { GLAD_LAZY_RESOLVE(PFNGLGETPROGRAMINFOLOGPROC, glGetProgramInfoLog); return glad_glGetProgramInfoLog(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGetShaderiv(GLuint a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETSHADERIVPROC, glGetShaderiv); return glad_glGetShaderiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetShaderInfoLog(GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3) { GLAD_LAZY_RESOLVE(PFNGLGETSHADERINFOLOGPROC, glGetShaderInfoLog); return glad_glGetShaderInfoLog(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGetShaderSource(GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3) { GLAD_LAZY_RESOLVE(PFNGLGETSHADERSOURCEPROC, glGetShaderSource); return glad_glGetShaderSource(a0, a1, a2, a3); }
+static GLint APIENTRY glad_lazy_glGetUniformLocation(GLuint a0, const GLchar* a1) { GLAD_LAZY_RESOLVE(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation); return glad_glGetUniformLocation(a0, a1); }
+static void APIENTRY glad_lazy_glGetUniformfv(GLuint a0, GLint a1, GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLGETUNIFORMFVPROC, glGetUniformfv); return glad_glGetUniformfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetUniformiv(GLuint a0, GLint a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETUNIFORMIVPROC, glGetUniformiv); return glad_glGetUniformiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetVertexAttribdv(GLuint a0, GLenum a1, GLdouble* a2) { GLAD_LAZY_RESOLVE(PFNGLGETVERTEXATTRIBDVPROC, glGetVertexAttribdv); return glad_glGetVertexAttribdv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetVertexAttribfv(GLuint a0, GLenum a1, GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLGETVERTEXATTRIBFVPROC, glGetVertexAttribfv); return glad_glGetVertexAttribfv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetVertexAttribiv(GLuint a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETVERTEXATTRIBIVPROC, glGetVertexAttribiv); return glad_glGetVertexAttribiv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetVertexAttribPointerv(GLuint a0, GLenum a1, void** a2) { GLAD_LAZY_RESOLVE(PFNGLGETVERTEXATTRIBPOINTERVPROC, glGetVertexAttribPointerv); return glad_glGetVertexAttribPointerv(a0, a1, a2); }
+static GLboolean APIENTRY glad_lazy_glIsProgram(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISPROGRAMPROC, glIsProgram); return glad_glIsProgram(a0); }
+static GLboolean APIENTRY glad_lazy_glIsShader(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISSHADERPROC, glIsShader); return glad_glIsShader(a0); }
+static void APIENTRY glad_lazy_glLinkProgram(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLLINKPROGRAMPROC, glLinkProgram); return glad_glLinkProgram(a0); }
+static void APIENTRY glad_lazy_glShaderSource(GLuint a0, GLsizei a1, const GLchar** a2, const GLint* a3) { GLAD_LAZY_RESOLVE(PFNGLSHADERSOURCEPROC, glShaderSource); return glad_glShaderSource(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glUseProgram(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLUSEPROGRAMPROC, glUseProgram); return glad_glUseProgram(a0); }
+static void APIENTRY glad_lazy_glUniform1f(GLint a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM1FPROC, glUniform1f); return glad_glUniform1f(a0, a1); }
+static void APIENTRY glad_lazy_glUniform2f(GLint a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM2FPROC, glUniform2f); return glad_glUniform2f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glUniform3f(GLint a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM3FPROC, glUniform3f); return glad_glUniform3f(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glUniform4f(GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM4FPROC, glUniform4f); return glad_glUniform4f(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glUniform1i(GLint a0, GLint a1) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM1IPROC, glUniform1i); return glad_glUniform1i(a0, a1); }
+static void APIENTRY glad_lazy_glUniform2i(GLint a0, GLint a1, GLint a2) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM2IPROC, glUniform2i); return glad_glUniform2i(a0, a1, a2); }
+static void APIENTRY glad_lazy_glUniform3i(GLint a0, GLint a1, GLint a2, GLint a3) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM3IPROC, glUniform3i); return glad_glUniform3i(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glUniform4i(GLint a0, GLint a1, GLint a2, GLint a3, GLint a4) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM4IPROC, glUniform4i); return glad_glUniform4i(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glUniform1fv(GLint a0, GLsizei a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM1FVPROC, glUniform1fv); return glad_glUniform1fv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glUniform2fv(GLint a0, GLsizei a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM2FVPROC, glUniform2fv); return glad_glUniform2fv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glUniform3fv(GLint a0, GLsizei a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM3FVPROC, glUniform3fv); return glad_glUniform3fv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glUniform4fv(GLint a0, GLsizei a1, const GLfloat* a2) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM4FVPROC, glUniform4fv); return glad_glUniform4fv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glUniform1iv(GLint a0, GLsizei a1, const GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM1IVPROC, glUniform1iv); return glad_glUniform1iv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glUniform2iv(GLint a0, GLsizei a1, const GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM2IVPROC, glUniform2iv); return glad_glUniform2iv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glUniform3iv(GLint a0, GLsizei a1, const GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM3IVPROC, glUniform3iv); return glad_glUniform3iv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glUniform4iv(GLint a0, GLsizei a1, const GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLUNIFORM4IVPROC, glUniform4iv); return glad_glUniform4iv(a0, a1, a2); }
+static void APIENTRY glad_lazy_glUniformMatrix2fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3) { GLAD_LAZY_RESOLVE(PFNGLUNIFORMMATRIX2FVPROC, glUniformMatrix2fv); return glad_glUniformMatrix2fv(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glUniformMatrix3fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3) { GLAD_LAZY_RESOLVE(PFNGLUNIFORMMATRIX3FVPROC, glUniformMatrix3fv); return glad_glUniformMatrix3fv(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glUniformMatrix4fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3) { GLAD_LAZY_RESOLVE(PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv); return glad_glUniformMatrix4fv(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glValidateProgram(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLVALIDATEPROGRAMPROC, glValidateProgram); return glad_glValidateProgram(a0); }
+static void APIENTRY glad_lazy_glVertexAttrib1d(GLuint a0, GLdouble a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB1DPROC, glVertexAttrib1d); return glad_glVertexAttrib1d(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib1dv(GLuint a0, const GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB1DVPROC, glVertexAttrib1dv); return glad_glVertexAttrib1dv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib1f(GLuint a0, GLfloat a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB1FPROC, glVertexAttrib1f); return glad_glVertexAttrib1f(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib1fv(GLuint a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB1FVPROC, glVertexAttrib1fv); return glad_glVertexAttrib1fv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib1s(GLuint a0, GLshort a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB1SPROC, glVertexAttrib1s); return glad_glVertexAttrib1s(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib1sv(GLuint a0, const GLshort* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB1SVPROC, glVertexAttrib1sv); return glad_glVertexAttrib1sv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib2d(GLuint a0, GLdouble a1, GLdouble a2) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB2DPROC, glVertexAttrib2d); return glad_glVertexAttrib2d(a0, a1, a2); }
+static void APIENTRY glad_lazy_glVertexAttrib2dv(GLuint a0, const GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB2DVPROC, glVertexAttrib2dv); return glad_glVertexAttrib2dv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib2f(GLuint a0, GLfloat a1, GLfloat a2) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB2FPROC, glVertexAttrib2f); return glad_glVertexAttrib2f(a0, a1, a2); }
+static void APIENTRY glad_lazy_glVertexAttrib2fv(GLuint a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv); return glad_glVertexAttrib2fv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib2s(GLuint a0, GLshort a1, GLshort a2) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB2SPROC, glVertexAttrib2s); return glad_glVertexAttrib2s(a0, a1, a2); }
+static void APIENTRY glad_lazy_glVertexAttrib2sv(GLuint a0, const GLshort* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB2SVPROC, glVertexAttrib2sv); return glad_glVertexAttrib2sv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib3d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB3DPROC, glVertexAttrib3d); return glad_glVertexAttrib3d(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glVertexAttrib3dv(GLuint a0, const GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB3DVPROC, glVertexAttrib3dv); return glad_glVertexAttrib3dv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib3f(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB3FPROC, glVertexAttrib3f); return glad_glVertexAttrib3f(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glVertexAttrib3fv(GLuint a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv); return glad_glVertexAttrib3fv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib3s(GLuint a0, GLshort a1, GLshort a2, GLshort a3) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB3SPROC, glVertexAttrib3s); return glad_glVertexAttrib3s(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glVertexAttrib3sv(GLuint a0, const GLshort* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB3SVPROC, glVertexAttrib3sv); return glad_glVertexAttrib3sv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nbv(GLuint a0, const GLbyte* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NBVPROC, glVertexAttrib4Nbv); return glad_glVertexAttrib4Nbv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4Niv(GLuint a0, const GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NIVPROC, glVertexAttrib4Niv); return glad_glVertexAttrib4Niv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nsv(GLuint a0, const GLshort* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NSVPROC, glVertexAttrib4Nsv); return glad_glVertexAttrib4Nsv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nub(GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NUBPROC, glVertexAttrib4Nub); return glad_glVertexAttrib4Nub(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nubv(GLuint a0, const GLubyte* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NUBVPROC, glVertexAttrib4Nubv); return glad_glVertexAttrib4Nubv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nuiv(GLuint a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NUIVPROC, glVertexAttrib4Nuiv); return glad_glVertexAttrib4Nuiv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4Nusv(GLuint a0, const GLushort* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NUSVPROC, glVertexAttrib4Nusv); return glad_glVertexAttrib4Nusv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4bv(GLuint a0, const GLbyte* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4BVPROC, glVertexAttrib4bv); return glad_glVertexAttrib4bv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4DPROC, glVertexAttrib4d); return glad_glVertexAttrib4d(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glVertexAttrib4dv(GLuint a0, const GLdouble* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4DVPROC, glVertexAttrib4dv); return glad_glVertexAttrib4dv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4f(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4FPROC, glVertexAttrib4f); return glad_glVertexAttrib4f(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glVertexAttrib4fv(GLuint a0, const GLfloat* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv); return glad_glVertexAttrib4fv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4iv(GLuint a0, const GLint* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4IVPROC, glVertexAttrib4iv); return glad_glVertexAttrib4iv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4s(GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4SPROC, glVertexAttrib4s); return glad_glVertexAttrib4s(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glVertexAttrib4sv(GLuint a0, const GLshort* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4SVPROC, glVertexAttrib4sv); return glad_glVertexAttrib4sv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4ubv(GLuint a0, const GLubyte* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4UBVPROC, glVertexAttrib4ubv); return glad_glVertexAttrib4ubv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4uiv(GLuint a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4UIVPROC, glVertexAttrib4uiv); return glad_glVertexAttrib4uiv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttrib4usv(GLuint a0, const GLushort* a1) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIB4USVPROC, glVertexAttrib4usv); return glad_glVertexAttrib4usv(a0, a1); }
+static void APIENTRY glad_lazy_glVertexAttribPointer(GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const void* a5) { GLAD_LAZY_RESOLVE(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer); return glad_glVertexAttribPointer(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glBindBufferARB(GLenum a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLBINDBUFFERARBPROC, glBindBufferARB); return glad_glBindBufferARB(a0, a1); }
+static void APIENTRY glad_lazy_glDeleteBuffersARB(GLsizei a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLDELETEBUFFERSARBPROC, glDeleteBuffersARB); return glad_glDeleteBuffersARB(a0, a1); }
+static void APIENTRY glad_lazy_glGenBuffersARB(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGENBUFFERSARBPROC, glGenBuffersARB); return glad_glGenBuffersARB(a0, a1); }
+static GLboolean APIENTRY glad_lazy_glIsBufferARB(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISBUFFERARBPROC, glIsBufferARB); return glad_glIsBufferARB(a0); }
+static void APIENTRY glad_lazy_glBufferDataARB(GLenum a0, GLsizeiptrARB a1, const void* a2, GLenum a3) { GLAD_LAZY_RESOLVE(PFNGLBUFFERDATAARBPROC, glBufferDataARB); return glad_glBufferDataARB(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glBufferSubDataARB(GLenum a0, GLintptrARB a1, GLsizeiptrARB a2, const void* a3) { GLAD_LAZY_RESOLVE(PFNGLBUFFERSUBDATAARBPROC, glBufferSubDataARB); return glad_glBufferSubDataARB(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGetBufferSubDataARB(GLenum a0, GLintptrARB a1, GLsizeiptrARB a2, void* a3) { GLAD_LAZY_RESOLVE(PFNGLGETBUFFERSUBDATAARBPROC, glGetBufferSubDataARB); return glad_glGetBufferSubDataARB(a0, a1, a2, a3); }
+static void* APIENTRY glad_lazy_glMapBufferARB(GLenum a0, GLenum a1) { GLAD_LAZY_RESOLVE(PFNGLMAPBUFFERARBPROC, glMapBufferARB); return glad_glMapBufferARB(a0, a1); }
+static GLboolean APIENTRY glad_lazy_glUnmapBufferARB(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLUNMAPBUFFERARBPROC, glUnmapBufferARB); return glad_glUnmapBufferARB(a0); }
+static void APIENTRY glad_lazy_glGetBufferParameterivARB(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETBUFFERPARAMETERIVARBPROC, glGetBufferParameterivARB); return glad_glGetBufferParameterivARB(a0, a1, a2); }
+static void APIENTRY glad_lazy_glGetBufferPointervARB(GLenum a0, GLenum a1, void** a2) { GLAD_LAZY_RESOLVE(PFNGLGETBUFFERPOINTERVARBPROC, glGetBufferPointervARB); return glad_glGetBufferPointervARB(a0, a1, a2); }
+static void APIENTRY glad_lazy_glBindVertexArray(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray); return glad_glBindVertexArray(a0); }
+static void APIENTRY glad_lazy_glDeleteVertexArrays(GLsizei a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays); return glad_glDeleteVertexArrays(a0, a1); }
+static void APIENTRY glad_lazy_glGenVertexArrays(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays); return glad_glGenVertexArrays(a0, a1); }
+static GLboolean APIENTRY glad_lazy_glIsVertexArray(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISVERTEXARRAYPROC, glIsVertexArray); return glad_glIsVertexArray(a0); }
+static GLboolean APIENTRY glad_lazy_glIsRenderbuffer(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISRENDERBUFFERPROC, glIsRenderbuffer); return glad_glIsRenderbuffer(a0); }
+static void APIENTRY glad_lazy_glBindRenderbuffer(GLenum a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer); return glad_glBindRenderbuffer(a0, a1); }
+static void APIENTRY glad_lazy_glDeleteRenderbuffers(GLsizei a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers); return glad_glDeleteRenderbuffers(a0, a1); }
+static void APIENTRY glad_lazy_glGenRenderbuffers(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers); return glad_glGenRenderbuffers(a0, a1); }
+static void APIENTRY glad_lazy_glRenderbufferStorage(GLenum a0, GLenum a1, GLsizei a2, GLsizei a3) { GLAD_LAZY_RESOLVE(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage); return glad_glRenderbufferStorage(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGetRenderbufferParameteriv(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETRENDERBUFFERPARAMETERIVPROC, glGetRenderbufferParameteriv); return glad_glGetRenderbufferParameteriv(a0, a1, a2); }
+static GLboolean APIENTRY glad_lazy_glIsFramebuffer(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISFRAMEBUFFERPROC, glIsFramebuffer); return glad_glIsFramebuffer(a0); }
+static void APIENTRY glad_lazy_glBindFramebuffer(GLenum a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer); return glad_glBindFramebuffer(a0, a1); }
+static void APIENTRY glad_lazy_glDeleteFramebuffers(GLsizei a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers); return glad_glDeleteFramebuffers(a0, a1); }
+static void APIENTRY glad_lazy_glGenFramebuffers(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers); return glad_glGenFramebuffers(a0, a1); }
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatus(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLCHECKFRAMEBUFFERSTATUSPROC, glCheckFramebufferStatus); return glad_glCheckFramebufferStatus(a0); }
+static void APIENTRY glad_lazy_glFramebufferTexture1D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { GLAD_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE1DPROC, glFramebufferTexture1D); return glad_glFramebufferTexture1D(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glFramebufferTexture2D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { GLAD_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D); return glad_glFramebufferTexture2D(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glFramebufferTexture3D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5) { GLAD_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE3DPROC, glFramebufferTexture3D); return glad_glFramebufferTexture3D(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glFramebufferRenderbuffer(GLenum a0, GLenum a1, GLenum a2, GLuint a3) { GLAD_LAZY_RESOLVE(PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer); return glad_glFramebufferRenderbuffer(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameteriv(GLenum a0, GLenum a1, GLenum a2, GLint* a3) { GLAD_LAZY_RESOLVE(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetFramebufferAttachmentParameteriv); return glad_glGetFramebufferAttachmentParameteriv(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGenerateMipmap(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap); return glad_glGenerateMipmap(a0); }
+static void APIENTRY glad_lazy_glBlitFramebuffer(GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9) { GLAD_LAZY_RESOLVE(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer); return glad_glBlitFramebuffer(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static void APIENTRY glad_lazy_glRenderbufferStorageMultisample(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4) { GLAD_LAZY_RESOLVE(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample); return glad_glRenderbufferStorageMultisample(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glFramebufferTextureLayer(GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4) { GLAD_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer); return glad_glFramebufferTextureLayer(a0, a1, a2, a3, a4); }
+static GLboolean APIENTRY glad_lazy_glIsRenderbufferEXT(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISRENDERBUFFEREXTPROC, glIsRenderbufferEXT); return glad_glIsRenderbufferEXT(a0); }
+static void APIENTRY glad_lazy_glBindRenderbufferEXT(GLenum a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLBINDRENDERBUFFEREXTPROC, glBindRenderbufferEXT); return glad_glBindRenderbufferEXT(a0, a1); }
+static void APIENTRY glad_lazy_glDeleteRenderbuffersEXT(GLsizei a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLDELETERENDERBUFFERSEXTPROC, glDeleteRenderbuffersEXT); return glad_glDeleteRenderbuffersEXT(a0, a1); }
+static void APIENTRY glad_lazy_glGenRenderbuffersEXT(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGENRENDERBUFFERSEXTPROC, glGenRenderbuffersEXT); return glad_glGenRenderbuffersEXT(a0, a1); }
+static void APIENTRY glad_lazy_glRenderbufferStorageEXT(GLenum a0, GLenum a1, GLsizei a2, GLsizei a3) { GLAD_LAZY_RESOLVE(PFNGLRENDERBUFFERSTORAGEEXTPROC, glRenderbufferStorageEXT); return glad_glRenderbufferStorageEXT(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGetRenderbufferParameterivEXT(GLenum a0, GLenum a1, GLint* a2) { GLAD_LAZY_RESOLVE(PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC, glGetRenderbufferParameterivEXT); return glad_glGetRenderbufferParameterivEXT(a0, a1, a2); }
+static GLboolean APIENTRY glad_lazy_glIsFramebufferEXT(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISFRAMEBUFFEREXTPROC, glIsFramebufferEXT); return glad_glIsFramebufferEXT(a0); }
+static void APIENTRY glad_lazy_glBindFramebufferEXT(GLenum a0, GLuint a1) { GLAD_LAZY_RESOLVE(PFNGLBINDFRAMEBUFFEREXTPROC, glBindFramebufferEXT); return glad_glBindFramebufferEXT(a0, a1); }
+static void APIENTRY glad_lazy_glDeleteFramebuffersEXT(GLsizei a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLDELETEFRAMEBUFFERSEXTPROC, glDeleteFramebuffersEXT); return glad_glDeleteFramebuffersEXT(a0, a1); }
+static void APIENTRY glad_lazy_glGenFramebuffersEXT(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGENFRAMEBUFFERSEXTPROC, glGenFramebuffersEXT); return glad_glGenFramebuffersEXT(a0, a1); }
+static GLenum APIENTRY glad_lazy_glCheckFramebufferStatusEXT(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC, glCheckFramebufferStatusEXT); return glad_glCheckFramebufferStatusEXT(a0); }
+static void APIENTRY glad_lazy_glFramebufferTexture1DEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { GLAD_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE1DEXTPROC, glFramebufferTexture1DEXT); return glad_glFramebufferTexture1DEXT(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glFramebufferTexture2DEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { GLAD_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE2DEXTPROC, glFramebufferTexture2DEXT); return glad_glFramebufferTexture2DEXT(a0, a1, a2, a3, a4); }
+static void APIENTRY glad_lazy_glFramebufferTexture3DEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5) { GLAD_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE3DEXTPROC, glFramebufferTexture3DEXT); return glad_glFramebufferTexture3DEXT(a0, a1, a2, a3, a4, a5); }
+static void APIENTRY glad_lazy_glFramebufferRenderbufferEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3) { GLAD_LAZY_RESOLVE(PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC, glFramebufferRenderbufferEXT); return glad_glFramebufferRenderbufferEXT(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGetFramebufferAttachmentParameterivEXT(GLenum a0, GLenum a1, GLenum a2, GLint* a3) { GLAD_LAZY_RESOLVE(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC, glGetFramebufferAttachmentParameterivEXT); return glad_glGetFramebufferAttachmentParameterivEXT(a0, a1, a2, a3); }
+static void APIENTRY glad_lazy_glGenerateMipmapEXT(GLenum a0) { GLAD_LAZY_RESOLVE(PFNGLGENERATEMIPMAPEXTPROC, glGenerateMipmapEXT); return glad_glGenerateMipmapEXT(a0); }
+static void APIENTRY glad_lazy_glBindVertexArrayAPPLE(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLBINDVERTEXARRAYAPPLEPROC, glBindVertexArrayAPPLE); return glad_glBindVertexArrayAPPLE(a0); }
+static void APIENTRY glad_lazy_glDeleteVertexArraysAPPLE(GLsizei a0, const GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLDELETEVERTEXARRAYSAPPLEPROC, glDeleteVertexArraysAPPLE); return glad_glDeleteVertexArraysAPPLE(a0, a1); }
+static void APIENTRY glad_lazy_glGenVertexArraysAPPLE(GLsizei a0, GLuint* a1) { GLAD_LAZY_RESOLVE(PFNGLGENVERTEXARRAYSAPPLEPROC, glGenVertexArraysAPPLE); return glad_glGenVertexArraysAPPLE(a0, a1); }
+static GLboolean APIENTRY glad_lazy_glIsVertexArrayAPPLE(GLuint a0) { GLAD_LAZY_RESOLVE(PFNGLISVERTEXARRAYAPPLEPROC, glIsVertexArrayAPPLE); return glad_glIsVertexArrayAPPLE(a0); }
+
+typedef struct {
+    const char *name;
+    void *proc;
+} glad_lazy_proc;
+
+/* sorted by name, for bsearch */
+static const glad_lazy_proc glad_lazy_procs[] = {
+    { "glAccum", (void*)&glad_lazy_glAccum },
+    { "glActiveTexture", (void*)&glad_lazy_glActiveTexture },
+    { "glAlphaFunc", (void*)&glad_lazy_glAlphaFunc },
+    { "glAreTexturesResident", (void*)&glad_lazy_glAreTexturesResident },
+    { "glArrayElement", (void*)&glad_lazy_glArrayElement },
+    { "glAttachShader", (void*)&glad_lazy_glAttachShader },
+    { "glBegin", (void*)&glad_lazy_glBegin },
+    { "glBeginQuery", (void*)&glad_lazy_glBeginQuery },
+    { "glBindAttribLocation", (void*)&glad_lazy_glBindAttribLocation },
+    { "glBindBuffer", (void*)&glad_lazy_glBindBuffer },
+    { "glBindBufferARB", (void*)&glad_lazy_glBindBufferARB },
+    { "glBindFramebuffer", (void*)&glad_lazy_glBindFramebuffer },
+    { "glBindFramebufferEXT", (void*)&glad_lazy_glBindFramebufferEXT },
+    { "glBindRenderbuffer", (void*)&glad_lazy_glBindRenderbuffer },
+    { "glBindRenderbufferEXT", (void*)&glad_lazy_glBindRenderbufferEXT },
+    { "glBindTexture", (void*)&glad_lazy_glBindTexture },
+    { "glBindVertexArray", (void*)&glad_lazy_glBindVertexArray },
+    { "glBindVertexArrayAPPLE", (void*)&glad_lazy_glBindVertexArrayAPPLE },
+    { "glBitmap", (void*)&glad_lazy_glBitmap },
+    { "glBlendColor", (void*)&glad_lazy_glBlendColor },
+    { "glBlendEquation", (void*)&glad_lazy_glBlendEquation },
+    { "glBlendEquationSeparate", (void*)&glad_lazy_glBlendEquationSeparate },
+    { "glBlendFunc", (void*)&glad_lazy_glBlendFunc },
+    { "glBlendFuncSeparate", (void*)&glad_lazy_glBlendFuncSeparate },
+    { "glBlitFramebuffer", (void*)&glad_lazy_glBlitFramebuffer },
+    { "glBufferData", (void*)&glad_lazy_glBufferData },
+    { "glBufferDataARB", (void*)&glad_lazy_glBufferDataARB },
+    { "glBufferSubData", (void*)&glad_lazy_glBufferSubData },
+    { "glBufferSubDataARB", (void*)&glad_lazy_glBufferSubDataARB },
+    { "glCallList", (void*)&glad_lazy_glCallList },
+    { "glCallLists", (void*)&glad_lazy_glCallLists },
+    { "glCheckFramebufferStatus", (void*)&glad_lazy_glCheckFramebufferStatus },
+    { "glCheckFramebufferStatusEXT", (void*)&glad_lazy_glCheckFramebufferStatusEXT },
+    { "glClear", (void*)&glad_lazy_glClear },
+    { "glClearAccum", (void*)&glad_lazy_glClearAccum },
+    { "glClearColor", (void*)&glad_lazy_glClearColor },
+    { "glClearDepth", (void*)&glad_lazy_glClearDepth },
+    { "glClearIndex", (void*)&glad_lazy_glClearIndex },
+    { "glClearStencil", (void*)&glad_lazy_glClearStencil },
+    { "glClientActiveTexture", (void*)&glad_lazy_glClientActiveTexture },
+    { "glClipPlane", (void*)&glad_lazy_glClipPlane },
+    { "glColor3b", (void*)&glad_lazy_glColor3b },
+    { "glColor3bv", (void*)&glad_lazy_glColor3bv },
+    { "glColor3d", (void*)&glad_lazy_glColor3d },
+    { "glColor3dv", (void*)&glad_lazy_glColor3dv },
+    { "glColor3f", (void*)&glad_lazy_glColor3f },
+    { "glColor3fv", (void*)&glad_lazy_glColor3fv },
+    { "glColor3i", (void*)&glad_lazy_glColor3i },
+    { "glColor3iv", (void*)&glad_lazy_glColor3iv },
+    { "glColor3s", (void*)&glad_lazy_glColor3s },
+    { "glColor3sv", (void*)&glad_lazy_glColor3sv },
+    { "glColor3ub", (void*)&glad_lazy_glColor3ub },
+    { "glColor3ubv", (void*)&glad_lazy_glColor3ubv },
+    { "glColor3ui", (void*)&glad_lazy_glColor3ui },
+    { "glColor3uiv", (void*)&glad_lazy_glColor3uiv },
+    { "glColor3us", (void*)&glad_lazy_glColor3us },
+    { "glColor3usv", (void*)&glad_lazy_glColor3usv },
+    { "glColor4b", (void*)&glad_lazy_glColor4b },
+    { "glColor4bv", (void*)&glad_lazy_glColor4bv },
+    { "glColor4d", (void*)&glad_lazy_glColor4d },
+    { "glColor4dv", (void*)&glad_lazy_glColor4dv },
+    { "glColor4f", (void*)&glad_lazy_glColor4f },
+    { "glColor4fv", (void*)&glad_lazy_glColor4fv },
+    { "glColor4i", (void*)&glad_lazy_glColor4i },
+    { "glColor4iv", (void*)&glad_lazy_glColor4iv },
+    { "glColor4s", (void*)&glad_lazy_glColor4s },
+    { "glColor4sv", (void*)&glad_lazy_glColor4sv },
+    { "glColor4ub", (void*)&glad_lazy_glColor4ub },
+    { "glColor4ubv", (void*)&glad_lazy_glColor4ubv },
+    { "glColor4ui", (void*)&glad_lazy_glColor4ui },
+    { "glColor4uiv", (void*)&glad_lazy_glColor4uiv },
+    { "glColor4us", (void*)&glad_lazy_glColor4us },
+    { "glColor4usv", (void*)&glad_lazy_glColor4usv },
+    { "glColorMask", (void*)&glad_lazy_glColorMask },
+    { "glColorMaterial", (void*)&glad_lazy_glColorMaterial },
+    { "glColorPointer", (void*)&glad_lazy_glColorPointer },
+    { "glCompileShader", (void*)&glad_lazy_glCompileShader },
+    { "glCompressedTexImage1D", (void*)&glad_lazy_glCompressedTexImage1D },
+    { "glCompressedTexImage2D", (void*)&glad_lazy_glCompressedTexImage2D },
+    { "glCompressedTexImage3D", (void*)&glad_lazy_glCompressedTexImage3D },
+    { "glCompressedTexSubImage1D", (void*)&glad_lazy_glCompressedTexSubImage1D },
+    { "glCompressedTexSubImage2D", (void*)&glad_lazy_glCompressedTexSubImage2D },
+    { "glCompressedTexSubImage3D", (void*)&glad_lazy_glCompressedTexSubImage3D },
+    { "glCopyPixels", (void*)&glad_lazy_glCopyPixels },
+    { "glCopyTexImage1D", (void*)&glad_lazy_glCopyTexImage1D },
+    { "glCopyTexImage2D", (void*)&glad_lazy_glCopyTexImage2D },
+    { "glCopyTexSubImage1D", (void*)&glad_lazy_glCopyTexSubImage1D },
+    { "glCopyTexSubImage2D", (void*)&glad_lazy_glCopyTexSubImage2D },
+    { "glCopyTexSubImage3D", (void*)&glad_lazy_glCopyTexSubImage3D },
+    { "glCreateProgram", (void*)&glad_lazy_glCreateProgram },
+    { "glCreateShader", (void*)&glad_lazy_glCreateShader },
+    { "glCullFace", (void*)&glad_lazy_glCullFace },
+    { "glDeleteBuffers", (void*)&glad_lazy_glDeleteBuffers },
+    { "glDeleteBuffersARB", (void*)&glad_lazy_glDeleteBuffersARB },
+    { "glDeleteFramebuffers", (void*)&glad_lazy_glDeleteFramebuffers },
+    { "glDeleteFramebuffersEXT", (void*)&glad_lazy_glDeleteFramebuffersEXT },
+    { "glDeleteLists", (void*)&glad_lazy_glDeleteLists },
+    { "glDeleteProgram", (void*)&glad_lazy_glDeleteProgram },
+    { "glDeleteQueries", (void*)&glad_lazy_glDeleteQueries },
+    { "glDeleteRenderbuffers", (void*)&glad_lazy_glDeleteRenderbuffers },
+    { "glDeleteRenderbuffersEXT", (void*)&glad_lazy_glDeleteRenderbuffersEXT },
+    { "glDeleteShader", (void*)&glad_lazy_glDeleteShader },
+    { "glDeleteTextures", (void*)&glad_lazy_glDeleteTextures },
+    { "glDeleteVertexArrays", (void*)&glad_lazy_glDeleteVertexArrays },
+    { "glDeleteVertexArraysAPPLE", (void*)&glad_lazy_glDeleteVertexArraysAPPLE },
+    { "glDepthFunc", (void*)&glad_lazy_glDepthFunc },
+    { "glDepthMask", (void*)&glad_lazy_glDepthMask },
+    { "glDepthRange", (void*)&glad_lazy_glDepthRange },
+    { "glDetachShader", (void*)&glad_lazy_glDetachShader },
+    { "glDisable", (void*)&glad_lazy_glDisable },
+    { "glDisableClientState", (void*)&glad_lazy_glDisableClientState },
+    { "glDisableVertexAttribArray", (void*)&glad_lazy_glDisableVertexAttribArray },
+    { "glDrawArrays", (void*)&glad_lazy_glDrawArrays },
+    { "glDrawBuffer", (void*)&glad_lazy_glDrawBuffer },
+    { "glDrawBuffers", (void*)&glad_lazy_glDrawBuffers },
+    { "glDrawElements", (void*)&glad_lazy_glDrawElements },
+    { "glDrawPixels", (void*)&glad_lazy_glDrawPixels },
+    { "glDrawRangeElements", (void*)&glad_lazy_glDrawRangeElements },
+    { "glEdgeFlag", (void*)&glad_lazy_glEdgeFlag },
+    { "glEdgeFlagPointer", (void*)&glad_lazy_glEdgeFlagPointer },
+    { "glEdgeFlagv", (void*)&glad_lazy_glEdgeFlagv },
+    { "glEnable", (void*)&glad_lazy_glEnable },
+    { "glEnableClientState", (void*)&glad_lazy_glEnableClientState },
+    { "glEnableVertexAttribArray", (void*)&glad_lazy_glEnableVertexAttribArray },
+    { "glEnd", (void*)&glad_lazy_glEnd },
+    { "glEndList", (void*)&glad_lazy_glEndList },
+    { "glEndQuery", (void*)&glad_lazy_glEndQuery },
+    { "glEvalCoord1d", (void*)&glad_lazy_glEvalCoord1d },
+    { "glEvalCoord1dv", (void*)&glad_lazy_glEvalCoord1dv },
+    { "glEvalCoord1f", (void*)&glad_lazy_glEvalCoord1f },
+    { "glEvalCoord1fv", (void*)&glad_lazy_glEvalCoord1fv },
+    { "glEvalCoord2d", (void*)&glad_lazy_glEvalCoord2d },
+    { "glEvalCoord2dv", (void*)&glad_lazy_glEvalCoord2dv },
+    { "glEvalCoord2f", (void*)&glad_lazy_glEvalCoord2f },
+    { "glEvalCoord2fv", (void*)&glad_lazy_glEvalCoord2fv },
+    { "glEvalMesh1", (void*)&glad_lazy_glEvalMesh1 },
+    { "glEvalMesh2", (void*)&glad_lazy_glEvalMesh2 },
+    { "glEvalPoint1", (void*)&glad_lazy_glEvalPoint1 },
+    { "glEvalPoint2", (void*)&glad_lazy_glEvalPoint2 },
+    { "glFeedbackBuffer", (void*)&glad_lazy_glFeedbackBuffer },
+    { "glFinish", (void*)&glad_lazy_glFinish },
+    { "glFlush", (void*)&glad_lazy_glFlush },
+    { "glFogCoordPointer", (void*)&glad_lazy_glFogCoordPointer },
+    { "glFogCoordd", (void*)&glad_lazy_glFogCoordd },
+    { "glFogCoorddv", (void*)&glad_lazy_glFogCoorddv },
+    { "glFogCoordf", (void*)&glad_lazy_glFogCoordf },
+    { "glFogCoordfv", (void*)&glad_lazy_glFogCoordfv },
+    { "glFogf", (void*)&glad_lazy_glFogf },
+    { "glFogfv", (void*)&glad_lazy_glFogfv },
+    { "glFogi", (void*)&glad_lazy_glFogi },
+    { "glFogiv", (void*)&glad_lazy_glFogiv },
+    { "glFramebufferRenderbuffer", (void*)&glad_lazy_glFramebufferRenderbuffer },
+    { "glFramebufferRenderbufferEXT", (void*)&glad_lazy_glFramebufferRenderbufferEXT },
+    { "glFramebufferTexture1D", (void*)&glad_lazy_glFramebufferTexture1D },
+    { "glFramebufferTexture1DEXT", (void*)&glad_lazy_glFramebufferTexture1DEXT },
+    { "glFramebufferTexture2D", (void*)&glad_lazy_glFramebufferTexture2D },
+    { "glFramebufferTexture2DEXT", (void*)&glad_lazy_glFramebufferTexture2DEXT },
+    { "glFramebufferTexture3D", (void*)&glad_lazy_glFramebufferTexture3D },
+    { "glFramebufferTexture3DEXT", (void*)&glad_lazy_glFramebufferTexture3DEXT },
+    { "glFramebufferTextureLayer", (void*)&glad_lazy_glFramebufferTextureLayer },
+    { "glFrontFace", (void*)&glad_lazy_glFrontFace },
+    { "glFrustum", (void*)&glad_lazy_glFrustum },
+    { "glGenBuffers", (void*)&glad_lazy_glGenBuffers },
+    { "glGenBuffersARB", (void*)&glad_lazy_glGenBuffersARB },
+    { "glGenFramebuffers", (void*)&glad_lazy_glGenFramebuffers },
+    { "glGenFramebuffersEXT", (void*)&glad_lazy_glGenFramebuffersEXT },
+    { "glGenLists", (void*)&glad_lazy_glGenLists },
+    { "glGenQueries", (void*)&glad_lazy_glGenQueries },
+    { "glGenRenderbuffers", (void*)&glad_lazy_glGenRenderbuffers },
+    { "glGenRenderbuffersEXT", (void*)&glad_lazy_glGenRenderbuffersEXT },
+    { "glGenTextures", (void*)&glad_lazy_glGenTextures },
+    { "glGenVertexArrays", (void*)&glad_lazy_glGenVertexArrays },
+    { "glGenVertexArraysAPPLE", (void*)&glad_lazy_glGenVertexArraysAPPLE },
+    { "glGenerateMipmap", (void*)&glad_lazy_glGenerateMipmap },
+    { "glGenerateMipmapEXT", (void*)&glad_lazy_glGenerateMipmapEXT },
+    { "glGetActiveAttrib", (void*)&glad_lazy_glGetActiveAttrib },
+    { "glGetActiveUniform", (void*)&glad_lazy_glGetActiveUniform },
+    { "glGetAttachedShaders", (void*)&glad_lazy_glGetAttachedShaders },
+    { "glGetAttribLocation", (void*)&glad_lazy_glGetAttribLocation },
+    { "glGetBooleanv", (void*)&glad_lazy_glGetBooleanv },
+    { "glGetBufferParameteriv", (void*)&glad_lazy_glGetBufferParameteriv },
+    { "glGetBufferParameterivARB", (void*)&glad_lazy_glGetBufferParameterivARB },
+    { "glGetBufferPointerv", (void*)&glad_lazy_glGetBufferPointerv },
+    { "glGetBufferPointervARB", (void*)&glad_lazy_glGetBufferPointervARB },
+    { "glGetBufferSubData", (void*)&glad_lazy_glGetBufferSubData },
+    { "glGetBufferSubDataARB", (void*)&glad_lazy_glGetBufferSubDataARB },
+    { "glGetClipPlane", (void*)&glad_lazy_glGetClipPlane },
+    { "glGetCompressedTexImage", (void*)&glad_lazy_glGetCompressedTexImage },
+    { "glGetDoublev", (void*)&glad_lazy_glGetDoublev },
+    { "glGetError", (void*)&glad_lazy_glGetError },
+    { "glGetFloatv", (void*)&glad_lazy_glGetFloatv },
+    { "glGetFramebufferAttachmentParameteriv", (void*)&glad_lazy_glGetFramebufferAttachmentParameteriv },
+    { "glGetFramebufferAttachmentParameterivEXT", (void*)&glad_lazy_glGetFramebufferAttachmentParameterivEXT },
+    { "glGetIntegerv", (void*)&glad_lazy_glGetIntegerv },
+    { "glGetLightfv", (void*)&glad_lazy_glGetLightfv },
+    { "glGetLightiv", (void*)&glad_lazy_glGetLightiv },
+    { "glGetMapdv", (void*)&glad_lazy_glGetMapdv },
+    { "glGetMapfv", (void*)&glad_lazy_glGetMapfv },
+    { "glGetMapiv", (void*)&glad_lazy_glGetMapiv },
+    { "glGetMaterialfv", (void*)&glad_lazy_glGetMaterialfv },
+    { "glGetMaterialiv", (void*)&glad_lazy_glGetMaterialiv },
+    { "glGetPixelMapfv", (void*)&glad_lazy_glGetPixelMapfv },
+    { "glGetPixelMapuiv", (void*)&glad_lazy_glGetPixelMapuiv },
+    { "glGetPixelMapusv", (void*)&glad_lazy_glGetPixelMapusv },
+    { "glGetPointerv", (void*)&glad_lazy_glGetPointerv },
+    { "glGetPolygonStipple", (void*)&glad_lazy_glGetPolygonStipple },
+    { "glGetProgramInfoLog", (void*)&glad_lazy_glGetProgramInfoLog },
+    { "glGetProgramiv", (void*)&glad_lazy_glGetProgramiv },
+    { "glGetQueryObjectiv", (void*)&glad_lazy_glGetQueryObjectiv },
+    { "glGetQueryObjectuiv", (void*)&glad_lazy_glGetQueryObjectuiv },
+    { "glGetQueryiv", (void*)&glad_lazy_glGetQueryiv },
+    { "glGetRenderbufferParameteriv", (void*)&glad_lazy_glGetRenderbufferParameteriv },
+    { "glGetRenderbufferParameterivEXT", (void*)&glad_lazy_glGetRenderbufferParameterivEXT },
+    { "glGetShaderInfoLog", (void*)&glad_lazy_glGetShaderInfoLog },
+    { "glGetShaderSource", (void*)&glad_lazy_glGetShaderSource },
+    { "glGetShaderiv", (void*)&glad_lazy_glGetShaderiv },
+    { "glGetString", (void*)&glad_lazy_glGetString },
+    { "glGetTexEnvfv", (void*)&glad_lazy_glGetTexEnvfv },
+    { "glGetTexEnviv", (void*)&glad_lazy_glGetTexEnviv },
+    { "glGetTexGendv", (void*)&glad_lazy_glGetTexGendv },
+    { "glGetTexGenfv", (void*)&glad_lazy_glGetTexGenfv },
+    { "glGetTexGeniv", (void*)&glad_lazy_glGetTexGeniv },
+    { "glGetTexImage", (void*)&glad_lazy_glGetTexImage },
+    { "glGetTexLevelParameterfv", (void*)&glad_lazy_glGetTexLevelParameterfv },
+    { "glGetTexLevelParameteriv", (void*)&glad_lazy_glGetTexLevelParameteriv },
+    { "glGetTexParameterfv", (void*)&glad_lazy_glGetTexParameterfv },
+    { "glGetTexParameteriv", (void*)&glad_lazy_glGetTexParameteriv },
+    { "glGetUniformLocation", (void*)&glad_lazy_glGetUniformLocation },
+    { "glGetUniformfv", (void*)&glad_lazy_glGetUniformfv },
+    { "glGetUniformiv", (void*)&glad_lazy_glGetUniformiv },
+    { "glGetVertexAttribPointerv", (void*)&glad_lazy_glGetVertexAttribPointerv },
+    { "glGetVertexAttribdv", (void*)&glad_lazy_glGetVertexAttribdv },
+    { "glGetVertexAttribfv", (void*)&glad_lazy_glGetVertexAttribfv },
+    { "glGetVertexAttribiv", (void*)&glad_lazy_glGetVertexAttribiv },
+    { "glHint", (void*)&glad_lazy_glHint },
+    { "glIndexMask", (void*)&glad_lazy_glIndexMask },
+    { "glIndexPointer", (void*)&glad_lazy_glIndexPointer },
+    { "glIndexd", (void*)&glad_lazy_glIndexd },
+    { "glIndexdv", (void*)&glad_lazy_glIndexdv },
+    { "glIndexf", (void*)&glad_lazy_glIndexf },
+    { "glIndexfv", (void*)&glad_lazy_glIndexfv },
+    { "glIndexi", (void*)&glad_lazy_glIndexi },
+    { "glIndexiv", (void*)&glad_lazy_glIndexiv },
+    { "glIndexs", (void*)&glad_lazy_glIndexs },
+    { "glIndexsv", (void*)&glad_lazy_glIndexsv },
+    { "glIndexub", (void*)&glad_lazy_glIndexub },
+    { "glIndexubv", (void*)&glad_lazy_glIndexubv },
+    { "glInitNames", (void*)&glad_lazy_glInitNames },
+    { "glInterleavedArrays", (void*)&glad_lazy_glInterleavedArrays },
+    { "glIsBuffer", (void*)&glad_lazy_glIsBuffer },
+    { "glIsBufferARB", (void*)&glad_lazy_glIsBufferARB },
+    { "glIsEnabled", (void*)&glad_lazy_glIsEnabled },
+    { "glIsFramebuffer", (void*)&glad_lazy_glIsFramebuffer },
+    { "glIsFramebufferEXT", (void*)&glad_lazy_glIsFramebufferEXT },
+    { "glIsList", (void*)&glad_lazy_glIsList },
+    { "glIsProgram", (void*)&glad_lazy_glIsProgram },
+    { "glIsQuery", (void*)&glad_lazy_glIsQuery },
+    { "glIsRenderbuffer", (void*)&glad_lazy_glIsRenderbuffer },
+    { "glIsRenderbufferEXT", (void*)&glad_lazy_glIsRenderbufferEXT },
+    { "glIsShader", (void*)&glad_lazy_glIsShader },
+    { "glIsTexture", (void*)&glad_lazy_glIsTexture },
+    { "glIsVertexArray", (void*)&glad_lazy_glIsVertexArray },
+    { "glIsVertexArrayAPPLE", (void*)&glad_lazy_glIsVertexArrayAPPLE },
+    { "glLightModelf", (void*)&glad_lazy_glLightModelf },
+    { "glLightModelfv", (void*)&glad_lazy_glLightModelfv },
+    { "glLightModeli", (void*)&glad_lazy_glLightModeli },
+    { "glLightModeliv", (void*)&glad_lazy_glLightModeliv },
+    { "glLightf", (void*)&glad_lazy_glLightf },
+    { "glLightfv", (void*)&glad_lazy_glLightfv },
+    { "glLighti", (void*)&glad_lazy_glLighti },
+    { "glLightiv", (void*)&glad_lazy_glLightiv },
+    { "glLineStipple", (void*)&glad_lazy_glLineStipple },
+    { "glLineWidth", (void*)&glad_lazy_glLineWidth },
+    { "glLinkProgram", (void*)&glad_lazy_glLinkProgram },
+    { "glListBase", (void*)&glad_lazy_glListBase },
+    { "glLoadIdentity", (void*)&glad_lazy_glLoadIdentity },
+    { "glLoadMatrixd", (void*)&glad_lazy_glLoadMatrixd },
+    { "glLoadMatrixf", (void*)&glad_lazy_glLoadMatrixf },
+    { "glLoadName", (void*)&glad_lazy_glLoadName },
+    { "glLoadTransposeMatrixd", (void*)&glad_lazy_glLoadTransposeMatrixd },
+    { "glLoadTransposeMatrixf", (void*)&glad_lazy_glLoadTransposeMatrixf },
+    { "glLogicOp", (void*)&glad_lazy_glLogicOp },
+    { "glMap1d", (void*)&glad_lazy_glMap1d },
+    { "glMap1f", (void*)&glad_lazy_glMap1f },
+    { "glMap2d", (void*)&glad_lazy_glMap2d },
+    { "glMap2f", (void*)&glad_lazy_glMap2f },
+    { "glMapBuffer", (void*)&glad_lazy_glMapBuffer },
+    { "glMapBufferARB", (void*)&glad_lazy_glMapBufferARB },
+    { "glMapGrid1d", (void*)&glad_lazy_glMapGrid1d },
+    { "glMapGrid1f", (void*)&glad_lazy_glMapGrid1f },
+    { "glMapGrid2d", (void*)&glad_lazy_glMapGrid2d },
+    { "glMapGrid2f", (void*)&glad_lazy_glMapGrid2f },
+    { "glMaterialf", (void*)&glad_lazy_glMaterialf },
+    { "glMaterialfv", (void*)&glad_lazy_glMaterialfv },
+    { "glMateriali", (void*)&glad_lazy_glMateriali },
+    { "glMaterialiv", (void*)&glad_lazy_glMaterialiv },
+    { "glMatrixMode", (void*)&glad_lazy_glMatrixMode },
+    { "glMultMatrixd", (void*)&glad_lazy_glMultMatrixd },
+    { "glMultMatrixf", (void*)&glad_lazy_glMultMatrixf },
+    { "glMultTransposeMatrixd", (void*)&glad_lazy_glMultTransposeMatrixd },
+    { "glMultTransposeMatrixf", (void*)&glad_lazy_glMultTransposeMatrixf },
+    { "glMultiDrawArrays", (void*)&glad_lazy_glMultiDrawArrays },
+    { "glMultiDrawElements", (void*)&glad_lazy_glMultiDrawElements },
+    { "glMultiTexCoord1d", (void*)&glad_lazy_glMultiTexCoord1d },
+    { "glMultiTexCoord1dv", (void*)&glad_lazy_glMultiTexCoord1dv },
+    { "glMultiTexCoord1f", (void*)&glad_lazy_glMultiTexCoord1f },
+    { "glMultiTexCoord1fv", (void*)&glad_lazy_glMultiTexCoord1fv },
+    { "glMultiTexCoord1i", (void*)&glad_lazy_glMultiTexCoord1i },
+    { "glMultiTexCoord1iv", (void*)&glad_lazy_glMultiTexCoord1iv },
+    { "glMultiTexCoord1s", (void*)&glad_lazy_glMultiTexCoord1s },
+    { "glMultiTexCoord1sv", (void*)&glad_lazy_glMultiTexCoord1sv },
+    { "glMultiTexCoord2d", (void*)&glad_lazy_glMultiTexCoord2d },
+    { "glMultiTexCoord2dv", (void*)&glad_lazy_glMultiTexCoord2dv },
+    { "glMultiTexCoord2f", (void*)&glad_lazy_glMultiTexCoord2f },
+    { "glMultiTexCoord2fv", (void*)&glad_lazy_glMultiTexCoord2fv },
+    { "glMultiTexCoord2i", (void*)&glad_lazy_glMultiTexCoord2i },
+    { "glMultiTexCoord2iv", (void*)&glad_lazy_glMultiTexCoord2iv },
+    { "glMultiTexCoord2s", (void*)&glad_lazy_glMultiTexCoord2s },
+    { "glMultiTexCoord2sv", (void*)&glad_lazy_glMultiTexCoord2sv },
+    { "glMultiTexCoord3d", (void*)&glad_lazy_glMultiTexCoord3d },
+    { "glMultiTexCoord3dv", (void*)&glad_lazy_glMultiTexCoord3dv },
+    { "glMultiTexCoord3f", (void*)&glad_lazy_glMultiTexCoord3f },
+    { "glMultiTexCoord3fv", (void*)&glad_lazy_glMultiTexCoord3fv },
+    { "glMultiTexCoord3i", (void*)&glad_lazy_glMultiTexCoord3i },
+    { "glMultiTexCoord3iv", (void*)&glad_lazy_glMultiTexCoord3iv },
+    { "glMultiTexCoord3s", (void*)&glad_lazy_glMultiTexCoord3s },
+    { "glMultiTexCoord3sv", (void*)&glad_lazy_glMultiTexCoord3sv },
+    { "glMultiTexCoord4d", (void*)&glad_lazy_glMultiTexCoord4d },
+    { "glMultiTexCoord4dv", (void*)&glad_lazy_glMultiTexCoord4dv },
+    { "glMultiTexCoord4f", (void*)&glad_lazy_glMultiTexCoord4f },
+    { "glMultiTexCoord4fv", (void*)&glad_lazy_glMultiTexCoord4fv },
+    { "glMultiTexCoord4i", (void*)&glad_lazy_glMultiTexCoord4i },
+    { "glMultiTexCoord4iv", (void*)&glad_lazy_glMultiTexCoord4iv },
+    { "glMultiTexCoord4s", (void*)&glad_lazy_glMultiTexCoord4s },
+    { "glMultiTexCoord4sv", (void*)&glad_lazy_glMultiTexCoord4sv },
+    { "glNewList", (void*)&glad_lazy_glNewList },
+    { "glNormal3b", (void*)&glad_lazy_glNormal3b },
+    { "glNormal3bv", (void*)&glad_lazy_glNormal3bv },
+    { "glNormal3d", (void*)&glad_lazy_glNormal3d },
+    { "glNormal3dv", (void*)&glad_lazy_glNormal3dv },
+    { "glNormal3f", (void*)&glad_lazy_glNormal3f },
+    { "glNormal3fv", (void*)&glad_lazy_glNormal3fv },
+    { "glNormal3i", (void*)&glad_lazy_glNormal3i },
+    { "glNormal3iv", (void*)&glad_lazy_glNormal3iv },
+    { "glNormal3s", (void*)&glad_lazy_glNormal3s },
+    { "glNormal3sv", (void*)&glad_lazy_glNormal3sv },
+    { "glNormalPointer", (void*)&glad_lazy_glNormalPointer },
+    { "glOrtho", (void*)&glad_lazy_glOrtho },
+    { "glPassThrough", (void*)&glad_lazy_glPassThrough },
+    { "glPixelMapfv", (void*)&glad_lazy_glPixelMapfv },
+    { "glPixelMapuiv", (void*)&glad_lazy_glPixelMapuiv },
+    { "glPixelMapusv", (void*)&glad_lazy_glPixelMapusv },
+    { "glPixelStoref", (void*)&glad_lazy_glPixelStoref },
+    { "glPixelStorei", (void*)&glad_lazy_glPixelStorei },
+    { "glPixelTransferf", (void*)&glad_lazy_glPixelTransferf },
+    { "glPixelTransferi", (void*)&glad_lazy_glPixelTransferi },
+    { "glPixelZoom", (void*)&glad_lazy_glPixelZoom },
+    { "glPointParameterf", (void*)&glad_lazy_glPointParameterf },
+    { "glPointParameterfv", (void*)&glad_lazy_glPointParameterfv },
+    { "glPointParameteri", (void*)&glad_lazy_glPointParameteri },
+    { "glPointParameteriv", (void*)&glad_lazy_glPointParameteriv },
+    { "glPointSize", (void*)&glad_lazy_glPointSize },
+    { "glPolygonMode", (void*)&glad_lazy_glPolygonMode },
+    { "glPolygonOffset", (void*)&glad_lazy_glPolygonOffset },
+    { "glPolygonStipple", (void*)&glad_lazy_glPolygonStipple },
+    { "glPopAttrib", (void*)&glad_lazy_glPopAttrib },
+    { "glPopClientAttrib", (void*)&glad_lazy_glPopClientAttrib },
+    { "glPopMatrix", (void*)&glad_lazy_glPopMatrix },
+    { "glPopName", (void*)&glad_lazy_glPopName },
+    { "glPrioritizeTextures", (void*)&glad_lazy_glPrioritizeTextures },
+    { "glPushAttrib", (void*)&glad_lazy_glPushAttrib },
+    { "glPushClientAttrib", (void*)&glad_lazy_glPushClientAttrib },
+    { "glPushMatrix", (void*)&glad_lazy_glPushMatrix },
+    { "glPushName", (void*)&glad_lazy_glPushName },
+    { "glRasterPos2d", (void*)&glad_lazy_glRasterPos2d },
+    { "glRasterPos2dv", (void*)&glad_lazy_glRasterPos2dv },
+    { "glRasterPos2f", (void*)&glad_lazy_glRasterPos2f },
+    { "glRasterPos2fv", (void*)&glad_lazy_glRasterPos2fv },
+    { "glRasterPos2i", (void*)&glad_lazy_glRasterPos2i },
+    { "glRasterPos2iv", (void*)&glad_lazy_glRasterPos2iv },
+    { "glRasterPos2s", (void*)&glad_lazy_glRasterPos2s },
+    { "glRasterPos2sv", (void*)&glad_lazy_glRasterPos2sv },
+    { "glRasterPos3d", (void*)&glad_lazy_glRasterPos3d },
+    { "glRasterPos3dv", (void*)&glad_lazy_glRasterPos3dv },
+    { "glRasterPos3f", (void*)&glad_lazy_glRasterPos3f },
+    { "glRasterPos3fv", (void*)&glad_lazy_glRasterPos3fv },
+    { "glRasterPos3i", (void*)&glad_lazy_glRasterPos3i },
+    { "glRasterPos3iv", (void*)&glad_lazy_glRasterPos3iv },
+    { "glRasterPos3s", (void*)&glad_lazy_glRasterPos3s },
+    { "glRasterPos3sv", (void*)&glad_lazy_glRasterPos3sv },
+    { "glRasterPos4d", (void*)&glad_lazy_glRasterPos4d },
+    { "glRasterPos4dv", (void*)&glad_lazy_glRasterPos4dv },
+    { "glRasterPos4f", (void*)&glad_lazy_glRasterPos4f },
+    { "glRasterPos4fv", (void*)&glad_lazy_glRasterPos4fv },
+    { "glRasterPos4i", (void*)&glad_lazy_glRasterPos4i },
+    { "glRasterPos4iv", (void*)&glad_lazy_glRasterPos4iv },
+    { "glRasterPos4s", (void*)&glad_lazy_glRasterPos4s },
+    { "glRasterPos4sv", (void*)&glad_lazy_glRasterPos4sv },
+    { "glReadBuffer", (void*)&glad_lazy_glReadBuffer },
+    { "glReadPixels", (void*)&glad_lazy_glReadPixels },
+    { "glRectd", (void*)&glad_lazy_glRectd },
+    { "glRectdv", (void*)&glad_lazy_glRectdv },
+    { "glRectf", (void*)&glad_lazy_glRectf },
+    { "glRectfv", (void*)&glad_lazy_glRectfv },
+    { "glRecti", (void*)&glad_lazy_glRecti },
+    { "glRectiv", (void*)&glad_lazy_glRectiv },
+    { "glRects", (void*)&glad_lazy_glRects },
+    { "glRectsv", (void*)&glad_lazy_glRectsv },
+    { "glRenderMode", (void*)&glad_lazy_glRenderMode },
+    { "glRenderbufferStorage", (void*)&glad_lazy_glRenderbufferStorage },
+    { "glRenderbufferStorageEXT", (void*)&glad_lazy_glRenderbufferStorageEXT },
+    { "glRenderbufferStorageMultisample", (void*)&glad_lazy_glRenderbufferStorageMultisample },
+    { "glRotated", (void*)&glad_lazy_glRotated },
+    { "glRotatef", (void*)&glad_lazy_glRotatef },
+    { "glSampleCoverage", (void*)&glad_lazy_glSampleCoverage },
+    { "glScaled", (void*)&glad_lazy_glScaled },
+    { "glScalef", (void*)&glad_lazy_glScalef },
+    { "glScissor", (void*)&glad_lazy_glScissor },
+    { "glSecondaryColor3b", (void*)&glad_lazy_glSecondaryColor3b },
+    { "glSecondaryColor3bv", (void*)&glad_lazy_glSecondaryColor3bv },
+    { "glSecondaryColor3d", (void*)&glad_lazy_glSecondaryColor3d },
+    { "glSecondaryColor3dv", (void*)&glad_lazy_glSecondaryColor3dv },
+    { "glSecondaryColor3f", (void*)&glad_lazy_glSecondaryColor3f },
+    { "glSecondaryColor3fv", (void*)&glad_lazy_glSecondaryColor3fv },
+    { "glSecondaryColor3i", (void*)&glad_lazy_glSecondaryColor3i },
+    { "glSecondaryColor3iv", (void*)&glad_lazy_glSecondaryColor3iv },
+    { "glSecondaryColor3s", (void*)&glad_lazy_glSecondaryColor3s },
+    { "glSecondaryColor3sv", (void*)&glad_lazy_glSecondaryColor3sv },
+    { "glSecondaryColor3ub", (void*)&glad_lazy_glSecondaryColor3ub },
+    { "glSecondaryColor3ubv", (void*)&glad_lazy_glSecondaryColor3ubv },
+    { "glSecondaryColor3ui", (void*)&glad_lazy_glSecondaryColor3ui },
+    { "glSecondaryColor3uiv", (void*)&glad_lazy_glSecondaryColor3uiv },
+    { "glSecondaryColor3us", (void*)&glad_lazy_glSecondaryColor3us },
+    { "glSecondaryColor3usv", (void*)&glad_lazy_glSecondaryColor3usv },
+    { "glSecondaryColorPointer", (void*)&glad_lazy_glSecondaryColorPointer },
+    { "glSelectBuffer", (void*)&glad_lazy_glSelectBuffer },
+    { "glShadeModel", (void*)&glad_lazy_glShadeModel },
+    { "glShaderSource", (void*)&glad_lazy_glShaderSource },
+    { "glStencilFunc", (void*)&glad_lazy_glStencilFunc },
+    { "glStencilFuncSeparate", (void*)&glad_lazy_glStencilFuncSeparate },
+    { "glStencilMask", (void*)&glad_lazy_glStencilMask },
+    { "glStencilMaskSeparate", (void*)&glad_lazy_glStencilMaskSeparate },
+    { "glStencilOp", (void*)&glad_lazy_glStencilOp },
+    { "glStencilOpSeparate", (void*)&glad_lazy_glStencilOpSeparate },
+    { "glTexCoord1d", (void*)&glad_lazy_glTexCoord1d },
+    { "glTexCoord1dv", (void*)&glad_lazy_glTexCoord1dv },
+    { "glTexCoord1f", (void*)&glad_lazy_glTexCoord1f },
+    { "glTexCoord1fv", (void*)&glad_lazy_glTexCoord1fv },
+    { "glTexCoord1i", (void*)&glad_lazy_glTexCoord1i },
+    { "glTexCoord1iv", (void*)&glad_lazy_glTexCoord1iv },
+    { "glTexCoord1s", (void*)&glad_lazy_glTexCoord1s },
+    { "glTexCoord1sv", (void*)&glad_lazy_glTexCoord1sv },
+    { "glTexCoord2d", (void*)&glad_lazy_glTexCoord2d },
+    { "glTexCoord2dv", (void*)&glad_lazy_glTexCoord2dv },
+    { "glTexCoord2f", (void*)&glad_lazy_glTexCoord2f },
+    { "glTexCoord2fv", (void*)&glad_lazy_glTexCoord2fv },
+    { "glTexCoord2i", (void*)&glad_lazy_glTexCoord2i },
+    { "glTexCoord2iv", (void*)&glad_lazy_glTexCoord2iv },
+    { "glTexCoord2s", (void*)&glad_lazy_glTexCoord2s },
+    { "glTexCoord2sv", (void*)&glad_lazy_glTexCoord2sv },
+    { "glTexCoord3d", (void*)&glad_lazy_glTexCoord3d },
+    { "glTexCoord3dv", (void*)&glad_lazy_glTexCoord3dv },
+    { "glTexCoord3f", (void*)&glad_lazy_glTexCoord3f },
+    { "glTexCoord3fv", (void*)&glad_lazy_glTexCoord3fv },
+    { "glTexCoord3i", (void*)&glad_lazy_glTexCoord3i },
+    { "glTexCoord3iv", (void*)&glad_lazy_glTexCoord3iv },
+    { "glTexCoord3s", (void*)&glad_lazy_glTexCoord3s },
+    { "glTexCoord3sv", (void*)&glad_lazy_glTexCoord3sv },
+    { "glTexCoord4d", (void*)&glad_lazy_glTexCoord4d },
+    { "glTexCoord4dv", (void*)&glad_lazy_glTexCoord4dv },
+    { "glTexCoord4f", (void*)&glad_lazy_glTexCoord4f },
+    { "glTexCoord4fv", (void*)&glad_lazy_glTexCoord4fv },
+    { "glTexCoord4i", (void*)&glad_lazy_glTexCoord4i },
+    { "glTexCoord4iv", (void*)&glad_lazy_glTexCoord4iv },
+    { "glTexCoord4s", (void*)&glad_lazy_glTexCoord4s },
+    { "glTexCoord4sv", (void*)&glad_lazy_glTexCoord4sv },
+    { "glTexCoordPointer", (void*)&glad_lazy_glTexCoordPointer },
+    { "glTexEnvf", (void*)&glad_lazy_glTexEnvf },
+    { "glTexEnvfv", (void*)&glad_lazy_glTexEnvfv },
+    { "glTexEnvi", (void*)&glad_lazy_glTexEnvi },
+    { "glTexEnviv", (void*)&glad_lazy_glTexEnviv },
+    { "glTexGend", (void*)&glad_lazy_glTexGend },
+    { "glTexGendv", (void*)&glad_lazy_glTexGendv },
+    { "glTexGenf", (void*)&glad_lazy_glTexGenf },
+    { "glTexGenfv", (void*)&glad_lazy_glTexGenfv },
+    { "glTexGeni", (void*)&glad_lazy_glTexGeni },
+    { "glTexGeniv", (void*)&glad_lazy_glTexGeniv },
+    { "glTexImage1D", (void*)&glad_lazy_glTexImage1D },
+    { "glTexImage2D", (void*)&glad_lazy_glTexImage2D },
+    { "glTexImage3D", (void*)&glad_lazy_glTexImage3D },
+    { "glTexParameterf", (void*)&glad_lazy_glTexParameterf },
+    { "glTexParameterfv", (void*)&glad_lazy_glTexParameterfv },
+    { "glTexParameteri", (void*)&glad_lazy_glTexParameteri },
+    { "glTexParameteriv", (void*)&glad_lazy_glTexParameteriv },
+    { "glTexSubImage1D", (void*)&glad_lazy_glTexSubImage1D },
+    { "glTexSubImage2D", (void*)&glad_lazy_glTexSubImage2D },
+    { "glTexSubImage3D", (void*)&glad_lazy_glTexSubImage3D },
+    { "glTranslated", (void*)&glad_lazy_glTranslated },
+    { "glTranslatef", (void*)&glad_lazy_glTranslatef },
+    { "glUniform1f", (void*)&glad_lazy_glUniform1f },
+    { "glUniform1fv", (void*)&glad_lazy_glUniform1fv },
+    { "glUniform1i", (void*)&glad_lazy_glUniform1i },
+    { "glUniform1iv", (void*)&glad_lazy_glUniform1iv },
+    { "glUniform2f", (void*)&glad_lazy_glUniform2f },
+    { "glUniform2fv", (void*)&glad_lazy_glUniform2fv },
+    { "glUniform2i", (void*)&glad_lazy_glUniform2i },
+    { "glUniform2iv", (void*)&glad_lazy_glUniform2iv },
+    { "glUniform3f", (void*)&glad_lazy_glUniform3f },
+    { "glUniform3fv", (void*)&glad_lazy_glUniform3fv },
+    { "glUniform3i", (void*)&glad_lazy_glUniform3i },
+    { "glUniform3iv", (void*)&glad_lazy_glUniform3iv },
+    { "glUniform4f", (void*)&glad_lazy_glUniform4f },
+    { "glUniform4fv", (void*)&glad_lazy_glUniform4fv },
+    { "glUniform4i", (void*)&glad_lazy_glUniform4i },
+    { "glUniform4iv", (void*)&glad_lazy_glUniform4iv },
+    { "glUniformMatrix2fv", (void*)&glad_lazy_glUniformMatrix2fv },
+    { "glUniformMatrix3fv", (void*)&glad_lazy_glUniformMatrix3fv },
+    { "glUniformMatrix4fv", (void*)&glad_lazy_glUniformMatrix4fv },
+    { "glUnmapBuffer", (void*)&glad_lazy_glUnmapBuffer },
+    { "glUnmapBufferARB", (void*)&glad_lazy_glUnmapBufferARB },
+    { "glUseProgram", (void*)&glad_lazy_glUseProgram },
+    { "glValidateProgram", (void*)&glad_lazy_glValidateProgram },
+    { "glVertex2d", (void*)&glad_lazy_glVertex2d },
+    { "glVertex2dv", (void*)&glad_lazy_glVertex2dv },
+    { "glVertex2f", (void*)&glad_lazy_glVertex2f },
+    { "glVertex2fv", (void*)&glad_lazy_glVertex2fv },
+    { "glVertex2i", (void*)&glad_lazy_glVertex2i },
+    { "glVertex2iv", (void*)&glad_lazy_glVertex2iv },
+    { "glVertex2s", (void*)&glad_lazy_glVertex2s },
+    { "glVertex2sv", (void*)&glad_lazy_glVertex2sv },
+    { "glVertex3d", (void*)&glad_lazy_glVertex3d },
+    { "glVertex3dv", (void*)&glad_lazy_glVertex3dv },
+    { "glVertex3f", (void*)&glad_lazy_glVertex3f },
+    { "glVertex3fv", (void*)&glad_lazy_glVertex3fv },
+    { "glVertex3i", (void*)&glad_lazy_glVertex3i },
+    { "glVertex3iv", (void*)&glad_lazy_glVertex3iv },
+    { "glVertex3s", (void*)&glad_lazy_glVertex3s },
+    { "glVertex3sv", (void*)&glad_lazy_glVertex3sv },
+    { "glVertex4d", (void*)&glad_lazy_glVertex4d },
+    { "glVertex4dv", (void*)&glad_lazy_glVertex4dv },
+    { "glVertex4f", (void*)&glad_lazy_glVertex4f },
+    { "glVertex4fv", (void*)&glad_lazy_glVertex4fv },
+    { "glVertex4i", (void*)&glad_lazy_glVertex4i },
+    { "glVertex4iv", (void*)&glad_lazy_glVertex4iv },
+    { "glVertex4s", (void*)&glad_lazy_glVertex4s },
+    { "glVertex4sv", (void*)&glad_lazy_glVertex4sv },
+    { "glVertexAttrib1d", (void*)&glad_lazy_glVertexAttrib1d },
+    { "glVertexAttrib1dv", (void*)&glad_lazy_glVertexAttrib1dv },
+    { "glVertexAttrib1f", (void*)&glad_lazy_glVertexAttrib1f },
+    { "glVertexAttrib1fv", (void*)&glad_lazy_glVertexAttrib1fv },
+    { "glVertexAttrib1s", (void*)&glad_lazy_glVertexAttrib1s },
+    { "glVertexAttrib1sv", (void*)&glad_lazy_glVertexAttrib1sv },
+    { "glVertexAttrib2d", (void*)&glad_lazy_glVertexAttrib2d },
+    { "glVertexAttrib2dv", (void*)&glad_lazy_glVertexAttrib2dv },
+    { "glVertexAttrib2f", (void*)&glad_lazy_glVertexAttrib2f },
+    { "glVertexAttrib2fv", (void*)&glad_lazy_glVertexAttrib2fv },
+    { "glVertexAttrib2s", (void*)&glad_lazy_glVertexAttrib2s },
+    { "glVertexAttrib2sv", (void*)&glad_lazy_glVertexAttrib2sv },
+    { "glVertexAttrib3d", (void*)&glad_lazy_glVertexAttrib3d },
+    { "glVertexAttrib3dv", (void*)&glad_lazy_glVertexAttrib3dv },
+    { "glVertexAttrib3f", (void*)&glad_lazy_glVertexAttrib3f },
+    { "glVertexAttrib3fv", (void*)&glad_lazy_glVertexAttrib3fv },
+    { "glVertexAttrib3s", (void*)&glad_lazy_glVertexAttrib3s },
+    { "glVertexAttrib3sv", (void*)&glad_lazy_glVertexAttrib3sv },
+    { "glVertexAttrib4Nbv", (void*)&glad_lazy_glVertexAttrib4Nbv },
+    { "glVertexAttrib4Niv", (void*)&glad_lazy_glVertexAttrib4Niv },
+    { "glVertexAttrib4Nsv", (void*)&glad_lazy_glVertexAttrib4Nsv },
+    { "glVertexAttrib4Nub", (void*)&glad_lazy_glVertexAttrib4Nub },
+    { "glVertexAttrib4Nubv", (void*)&glad_lazy_glVertexAttrib4Nubv },
+    { "glVertexAttrib4Nuiv", (void*)&glad_lazy_glVertexAttrib4Nuiv },
+    { "glVertexAttrib4Nusv", (void*)&glad_lazy_glVertexAttrib4Nusv },
+    { "glVertexAttrib4bv", (void*)&glad_lazy_glVertexAttrib4bv },
+    { "glVertexAttrib4d", (void*)&glad_lazy_glVertexAttrib4d },
+    { "glVertexAttrib4dv", (void*)&glad_lazy_glVertexAttrib4dv },
+    { "glVertexAttrib4f", (void*)&glad_lazy_glVertexAttrib4f },
+    { "glVertexAttrib4fv", (void*)&glad_lazy_glVertexAttrib4fv },
+    { "glVertexAttrib4iv", (void*)&glad_lazy_glVertexAttrib4iv },
+    { "glVertexAttrib4s", (void*)&glad_lazy_glVertexAttrib4s },
+    { "glVertexAttrib4sv", (void*)&glad_lazy_glVertexAttrib4sv },
+    { "glVertexAttrib4ubv", (void*)&glad_lazy_glVertexAttrib4ubv },
+    { "glVertexAttrib4uiv", (void*)&glad_lazy_glVertexAttrib4uiv },
+    { "glVertexAttrib4usv", (void*)&glad_lazy_glVertexAttrib4usv },
+    { "glVertexAttribPointer", (void*)&glad_lazy_glVertexAttribPointer },
+    { "glVertexPointer", (void*)&glad_lazy_glVertexPointer },
+    { "glViewport", (void*)&glad_lazy_glViewport },
+    { "glWindowPos2d", (void*)&glad_lazy_glWindowPos2d },
+    { "glWindowPos2dv", (void*)&glad_lazy_glWindowPos2dv },
+    { "glWindowPos2f", (void*)&glad_lazy_glWindowPos2f },
+    { "glWindowPos2fv", (void*)&glad_lazy_glWindowPos2fv },
+    { "glWindowPos2i", (void*)&glad_lazy_glWindowPos2i },
+    { "glWindowPos2iv", (void*)&glad_lazy_glWindowPos2iv },
+    { "glWindowPos2s", (void*)&glad_lazy_glWindowPos2s },
+    { "glWindowPos2sv", (void*)&glad_lazy_glWindowPos2sv },
+    { "glWindowPos3d", (void*)&glad_lazy_glWindowPos3d },
+    { "glWindowPos3dv", (void*)&glad_lazy_glWindowPos3dv },
+    { "glWindowPos3f", (void*)&glad_lazy_glWindowPos3f },
+    { "glWindowPos3fv", (void*)&glad_lazy_glWindowPos3fv },
+    { "glWindowPos3i", (void*)&glad_lazy_glWindowPos3i },
+    { "glWindowPos3iv", (void*)&glad_lazy_glWindowPos3iv },
+    { "glWindowPos3s", (void*)&glad_lazy_glWindowPos3s },
+    { "glWindowPos3sv", (void*)&glad_lazy_glWindowPos3sv },
+};
+
+static int glad_lazy_compare(const void *key, const void *elem) {
+    return strcmp((const char*)key, ((const glad_lazy_proc*)elem)->name);
+}
+
+/* the loader passed to the load_GL_* functions: returns the trampoline of a function */
+static void* get_lazy_proc(const char *namez) {
+    const glad_lazy_proc *p = (const glad_lazy_proc*)bsearch(namez, glad_lazy_procs,
+        sizeof(glad_lazy_procs) / sizeof(glad_lazy_procs[0]), sizeof(glad_lazy_procs[0]), glad_lazy_compare);
+    return p ? p->proc : NULL;
+}
+#endif /* OFX_OPENGL_LAZY_LOAD */
+
+#ifdef DEBUG
+/* Debug wrappers: in debug builds, each loaded glad_gl* pointer (except glGetError) is replaced by a
+ * wrapper which calls the pre callback, the function, and the post callback.
+ * This is compiled out in release builds. */
+static void glad_default_callback(const char *name, void *funcptr, int len_args, ...) {
+    (void)name;
+    (void)funcptr;
+    (void)len_args;
+}
+
+static GLADcallback _pre_call_callback = glad_default_callback;
+static GLADcallback _post_call_callback = glad_default_callback;
+
+void glad_set_pre_callback(GLADcallback cb) {
+    _pre_call_callback = cb ? cb : glad_default_callback;
+}
+
+void glad_set_post_callback(GLADcallback cb) {
+    _post_call_callback = cb ? cb : glad_default_callback;
+}
+
+static PFNGLCULLFACEPROC glad_debug_real_glCullFace;
+static void APIENTRY glad_debug_glCullFace(GLenum a0) { _pre_call_callback("glCullFace", (void*)glad_debug_real_glCullFace, 1, a0); glad_debug_real_glCullFace(a0); _post_call_callback("glCullFace", (void*)glad_debug_real_glCullFace, 1, a0); }
+static PFNGLFRONTFACEPROC glad_debug_real_glFrontFace;
+static void APIENTRY glad_debug_glFrontFace(GLenum a0) { _pre_call_callback("glFrontFace", (void*)glad_debug_real_glFrontFace, 1, a0); glad_debug_real_glFrontFace(a0); _post_call_callback("glFrontFace", (void*)glad_debug_real_glFrontFace, 1, a0); }
+static PFNGLHINTPROC glad_debug_real_glHint;
+static void APIENTRY glad_debug_glHint(GLenum a0, GLenum a1) { _pre_call_callback("glHint", (void*)glad_debug_real_glHint, 2, a0, a1); glad_debug_real_glHint(a0, a1); _post_call_callback("glHint", (void*)glad_debug_real_glHint, 2, a0, a1); }
+static PFNGLLINEWIDTHPROC glad_debug_real_glLineWidth;
+static void APIENTRY glad_debug_glLineWidth(GLfloat a0) { _pre_call_callback("glLineWidth", (void*)glad_debug_real_glLineWidth, 1, a0); glad_debug_real_glLineWidth(a0); _post_call_callback("glLineWidth", (void*)glad_debug_real_glLineWidth, 1, a0); }
+static PFNGLPOINTSIZEPROC glad_debug_real_glPointSize;
+static void APIENTRY glad_debug_glPointSize(GLfloat a0) { _pre_call_callback("glPointSize", (void*)glad_debug_real_glPointSize, 1, a0); glad_debug_real_glPointSize(a0); _post_call_callback("glPointSize", (void*)glad_debug_real_glPointSize, 1, a0); }
+static PFNGLPOLYGONMODEPROC glad_debug_real_glPolygonMode;
+static void APIENTRY glad_debug_glPolygonMode(GLenum a0, GLenum a1) { _pre_call_callback("glPolygonMode", (void*)glad_debug_real_glPolygonMode, 2, a0, a1); glad_debug_real_glPolygonMode(a0, a1); _post_call_callback("glPolygonMode", (void*)glad_debug_real_glPolygonMode, 2, a0, a1); }
+static PFNGLSCISSORPROC glad_debug_real_glScissor;
+static void APIENTRY glad_debug_glScissor(GLint a0, GLint a1, GLsizei a2, GLsizei a3) { _pre_call_callback("glScissor", (void*)glad_debug_real_glScissor, 4, a0, a1, a2, a3); glad_debug_real_glScissor(a0, a1, a2, a3); _post_call_callback("glScissor", (void*)glad_debug_real_glScissor, 4, a0, a1, a2, a3); }
+static PFNGLTEXPARAMETERFPROC glad_debug_real_glTexParameterf;
+static void APIENTRY glad_debug_glTexParameterf(GLenum a0, GLenum a1, GLfloat a2) { _pre_call_callback("glTexParameterf", (void*)glad_debug_real_glTexParameterf, 3, a0, a1, a2); glad_debug_real_glTexParameterf(a0, a1, a2); _post_call_callback("glTexParameterf", (void*)glad_debug_real_glTexParameterf, 3, a0, a1, a2); }
+static PFNGLTEXPARAMETERFVPROC glad_debug_real_glTexParameterfv;
+static void APIENTRY glad_debug_glTexParameterfv(GLenum a0, GLenum a1, const GLfloat* a2) { _pre_call_callback("glTexParameterfv", (void*)glad_debug_real_glTexParameterfv, 3, a0, a1, a2); glad_debug_real_glTexParameterfv(a0, a1, a2); _post_call_callback("glTexParameterfv", (void*)glad_debug_real_glTexParameterfv, 3, a0, a1, a2); }
+static PFNGLTEXPARAMETERIPROC glad_debug_real_glTexParameteri;
+static void APIENTRY glad_debug_glTexParameteri(GLenum a0, GLenum a1, GLint a2) { _pre_call_callback("glTexParameteri", (void*)glad_debug_real_glTexParameteri, 3, a0, a1, a2); glad_debug_real_glTexParameteri(a0, a1, a2); _post_call_callback("glTexParameteri", (void*)glad_debug_real_glTexParameteri, 3, a0, a1, a2); }
+static PFNGLTEXPARAMETERIVPROC glad_debug_real_glTexParameteriv;
+static void APIENTRY glad_debug_glTexParameteriv(GLenum a0, GLenum a1, const GLint* a2) { _pre_call_callback("glTexParameteriv", (void*)glad_debug_real_glTexParameteriv, 3, a0, a1, a2); glad_debug_real_glTexParameteriv(a0, a1, a2); _post_call_callback("glTexParameteriv", (void*)glad_debug_real_glTexParameteriv, 3, a0, a1, a2); }
+static PFNGLTEXIMAGE1DPROC glad_debug_real_glTexImage1D;
+static void APIENTRY glad_debug_glTexImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLint a4, GLenum a5, GLenum a6, const void* a7) { _pre_call_callback("glTexImage1D", (void*)glad_debug_real_glTexImage1D, 8, a0, a1, a2, a3, a4, a5, a6, a7); glad_debug_real_glTexImage1D(a0, a1, a2, a3, a4, a5, a6, a7); _post_call_callback("glTexImage1D", (void*)glad_debug_real_glTexImage1D, 8, a0, a1, a2, a3, a4, a5, a6, a7); }
+static PFNGLTEXIMAGE2DPROC glad_debug_real_glTexImage2D;
+static void APIENTRY glad_debug_glTexImage2D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const void* a8) { _pre_call_callback("glTexImage2D", (void*)glad_debug_real_glTexImage2D, 9, a0, a1, a2, a3, a4, a5, a6, a7, a8); glad_debug_real_glTexImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8); _post_call_callback("glTexImage2D", (void*)glad_debug_real_glTexImage2D, 9, a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static PFNGLDRAWBUFFERPROC glad_debug_real_glDrawBuffer;
+static void APIENTRY glad_debug_glDrawBuffer(GLenum a0) { _pre_call_callback("glDrawBuffer", (void*)glad_debug_real_glDrawBuffer, 1, a0); glad_debug_real_glDrawBuffer(a0); _post_call_callback("glDrawBuffer", (void*)glad_debug_real_glDrawBuffer, 1, a0); }
+static PFNGLCLEARPROC glad_debug_real_glClear;
+static void APIENTRY glad_debug_glClear(GLbitfield a0) { _pre_call_callback("glClear", (void*)glad_debug_real_glClear, 1, a0); glad_debug_real_glClear(a0); _post_call_callback("glClear", (void*)glad_debug_real_glClear, 1, a0); }
+static PFNGLCLEARCOLORPROC glad_debug_real_glClearColor;
+static void APIENTRY glad_debug_glClearColor(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glClearColor", (void*)glad_debug_real_glClearColor, 4, a0, a1, a2, a3); glad_debug_real_glClearColor(a0, a1, a2, a3); _post_call_callback("glClearColor", (void*)glad_debug_real_glClearColor, 4, a0, a1, a2, a3); }
+static PFNGLCLEARSTENCILPROC glad_debug_real_glClearStencil;
+static void APIENTRY glad_debug_glClearStencil(GLint a0) { _pre_call_callback("glClearStencil", (void*)glad_debug_real_glClearStencil, 1, a0); glad_debug_real_glClearStencil(a0); _post_call_callback("glClearStencil", (void*)glad_debug_real_glClearStencil, 1, a0); }
+static PFNGLCLEARDEPTHPROC glad_debug_real_glClearDepth;
+static void APIENTRY glad_debug_glClearDepth(GLdouble a0) { _pre_call_callback("glClearDepth", (void*)glad_debug_real_glClearDepth, 1, a0); glad_debug_real_glClearDepth(a0); _post_call_callback("glClearDepth", (void*)glad_debug_real_glClearDepth, 1, a0); }
+static PFNGLSTENCILMASKPROC glad_debug_real_glStencilMask;
+static void APIENTRY glad_debug_glStencilMask(GLuint a0) { _pre_call_callback("glStencilMask", (void*)glad_debug_real_glStencilMask, 1, a0); glad_debug_real_glStencilMask(a0); _post_call_callback("glStencilMask", (void*)glad_debug_real_glStencilMask, 1, a0); }
+static PFNGLCOLORMASKPROC glad_debug_real_glColorMask;
+static void APIENTRY glad_debug_glColorMask(GLboolean a0, GLboolean a1, GLboolean a2, GLboolean a3) { _pre_call_callback("glColorMask", (void*)glad_debug_real_glColorMask, 4, a0, a1, a2, a3); glad_debug_real_glColorMask(a0, a1, a2, a3); _post_call_callback("glColorMask", (void*)glad_debug_real_glColorMask, 4, a0, a1, a2, a3); }
+static PFNGLDEPTHMASKPROC glad_debug_real_glDepthMask;
+static void APIENTRY glad_debug_glDepthMask(GLboolean a0) { _pre_call_callback("glDepthMask", (void*)glad_debug_real_glDepthMask, 1, a0); glad_debug_real_glDepthMask(a0); _post_call_callback("glDepthMask", (void*)glad_debug_real_glDepthMask, 1, a0); }
+static PFNGLDISABLEPROC glad_debug_real_glDisable;
+static void APIENTRY glad_debug_glDisable(GLenum a0) { _pre_call_callback("glDisable", (void*)glad_debug_real_glDisable, 1, a0); glad_debug_real_glDisable(a0); _post_call_callback("glDisable", (void*)glad_debug_real_glDisable, 1, a0); }
+static PFNGLENABLEPROC glad_debug_real_glEnable;
+static void APIENTRY glad_debug_glEnable(GLenum a0) { _pre_call_callback("glEnable", (void*)glad_debug_real_glEnable, 1, a0); glad_debug_real_glEnable(a0); _post_call_callback("glEnable", (void*)glad_debug_real_glEnable, 1, a0); }
+static PFNGLFINISHPROC glad_debug_real_glFinish;
+static void APIENTRY glad_debug_glFinish() { _pre_call_callback("glFinish", (void*)glad_debug_real_glFinish, 0); glad_debug_real_glFinish(); _post_call_callback("glFinish", (void*)glad_debug_real_glFinish, 0); }
+static PFNGLFLUSHPROC glad_debug_real_glFlush;
+static void APIENTRY glad_debug_glFlush() { _pre_call_callback("glFlush", (void*)glad_debug_real_glFlush, 0); glad_debug_real_glFlush(); _post_call_callback("glFlush", (void*)glad_debug_real_glFlush, 0); }
+static PFNGLBLENDFUNCPROC glad_debug_real_glBlendFunc;
+static void APIENTRY glad_debug_glBlendFunc(GLenum a0, GLenum a1) { _pre_call_callback("glBlendFunc", (void*)glad_debug_real_glBlendFunc, 2, a0, a1); glad_debug_real_glBlendFunc(a0, a1); _post_call_callback("glBlendFunc", (void*)glad_debug_real_glBlendFunc, 2, a0, a1); }
+static PFNGLLOGICOPPROC glad_debug_real_glLogicOp;
+static void APIENTRY glad_debug_glLogicOp(GLenum a0) { _pre_call_callback("glLogicOp", (void*)glad_debug_real_glLogicOp, 1, a0); glad_debug_real_glLogicOp(a0); _post_call_callback("glLogicOp", (void*)glad_debug_real_glLogicOp, 1, a0); }
+static PFNGLSTENCILFUNCPROC glad_debug_real_glStencilFunc;
+static void APIENTRY glad_debug_glStencilFunc(GLenum a0, GLint a1, GLuint a2) { _pre_call_callback("glStencilFunc", (void*)glad_debug_real_glStencilFunc, 3, a0, a1, a2); glad_debug_real_glStencilFunc(a0, a1, a2); _post_call_callback("glStencilFunc", (void*)glad_debug_real_glStencilFunc, 3, a0, a1, a2); }
+static PFNGLSTENCILOPPROC glad_debug_real_glStencilOp;
+static void APIENTRY glad_debug_glStencilOp(GLenum a0, GLenum a1, GLenum a2) { _pre_call_callback("glStencilOp", (void*)glad_debug_real_glStencilOp, 3, a0, a1, a2); glad_debug_real_glStencilOp(a0, a1, a2); _post_call_callback("glStencilOp", (void*)glad_debug_real_glStencilOp, 3, a0, a1, a2); }
+static PFNGLDEPTHFUNCPROC glad_debug_real_glDepthFunc;
+static void APIENTRY glad_debug_glDepthFunc(GLenum a0) { _pre_call_callback("glDepthFunc", (void*)glad_debug_real_glDepthFunc, 1, a0); glad_debug_real_glDepthFunc(a0); _post_call_callback("glDepthFunc", (void*)glad_debug_real_glDepthFunc, 1, a0); }
+static PFNGLPIXELSTOREFPROC glad_debug_real_glPixelStoref;
+static void APIENTRY glad_debug_glPixelStoref(GLenum a0, GLfloat a1) { _pre_call_callback("glPixelStoref", (void*)glad_debug_real_glPixelStoref, 2, a0, a1); glad_debug_real_glPixelStoref(a0, a1); _post_call_callback("glPixelStoref", (void*)glad_debug_real_glPixelStoref, 2, a0, a1); }
+static PFNGLPIXELSTOREIPROC glad_debug_real_glPixelStorei;
+static void APIENTRY glad_debug_glPixelStorei(GLenum a0, GLint a1) { _pre_call_callback("glPixelStorei", (void*)glad_debug_real_glPixelStorei, 2, a0, a1); glad_debug_real_glPixelStorei(a0, a1); _post_call_callback("glPixelStorei", (void*)glad_debug_real_glPixelStorei, 2, a0, a1); }
+static PFNGLREADBUFFERPROC glad_debug_real_glReadBuffer;
+static void APIENTRY glad_debug_glReadBuffer(GLenum a0) { _pre_call_callback("glReadBuffer", (void*)glad_debug_real_glReadBuffer, 1, a0); glad_debug_real_glReadBuffer(a0); _post_call_callback("glReadBuffer", (void*)glad_debug_real_glReadBuffer, 1, a0); }
+static PFNGLREADPIXELSPROC glad_debug_real_glReadPixels;
+static void APIENTRY glad_debug_glReadPixels(GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, void* a6) { _pre_call_callback("glReadPixels", (void*)glad_debug_real_glReadPixels, 7, a0, a1, a2, a3, a4, a5, a6); glad_debug_real_glReadPixels(a0, a1, a2, a3, a4, a5, a6); _post_call_callback("glReadPixels", (void*)glad_debug_real_glReadPixels, 7, a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLGETBOOLEANVPROC glad_debug_real_glGetBooleanv;
+static void APIENTRY glad_debug_glGetBooleanv(GLenum a0, GLboolean* a1) { _pre_call_callback("glGetBooleanv", (void*)glad_debug_real_glGetBooleanv, 2, a0, a1); glad_debug_real_glGetBooleanv(a0, a1); _post_call_callback("glGetBooleanv", (void*)glad_debug_real_glGetBooleanv, 2, a0, a1); }
+static PFNGLGETDOUBLEVPROC glad_debug_real_glGetDoublev;
+static void APIENTRY glad_debug_glGetDoublev(GLenum a0, GLdouble* a1) { _pre_call_callback("glGetDoublev", (void*)glad_debug_real_glGetDoublev, 2, a0, a1); glad_debug_real_glGetDoublev(a0, a1); _post_call_callback("glGetDoublev", (void*)glad_debug_real_glGetDoublev, 2, a0, a1); }
+static PFNGLGETFLOATVPROC glad_debug_real_glGetFloatv;
+static void APIENTRY glad_debug_glGetFloatv(GLenum a0, GLfloat* a1) { _pre_call_callback("glGetFloatv", (void*)glad_debug_real_glGetFloatv, 2, a0, a1); glad_debug_real_glGetFloatv(a0, a1); _post_call_callback("glGetFloatv", (void*)glad_debug_real_glGetFloatv, 2, a0, a1); }
+static PFNGLGETINTEGERVPROC glad_debug_real_glGetIntegerv;
+static void APIENTRY glad_debug_glGetIntegerv(GLenum a0, GLint* a1) { _pre_call_callback("glGetIntegerv", (void*)glad_debug_real_glGetIntegerv, 2, a0, a1); glad_debug_real_glGetIntegerv(a0, a1); _post_call_callback("glGetIntegerv", (void*)glad_debug_real_glGetIntegerv, 2, a0, a1); }
+static PFNGLGETSTRINGPROC glad_debug_real_glGetString;
+static const GLubyte* APIENTRY glad_debug_glGetString(GLenum a0) { const GLubyte* ret; _pre_call_callback("glGetString", (void*)glad_debug_real_glGetString, 1, a0); ret = glad_debug_real_glGetString(a0); _post_call_callback("glGetString", (void*)glad_debug_real_glGetString, 1, a0); return ret; }
+static PFNGLGETTEXIMAGEPROC glad_debug_real_glGetTexImage;
+static void APIENTRY glad_debug_glGetTexImage(GLenum a0, GLint a1, GLenum a2, GLenum a3, void* a4) { _pre_call_callback("glGetTexImage", (void*)glad_debug_real_glGetTexImage, 5, a0, a1, a2, a3, a4); glad_debug_real_glGetTexImage(a0, a1, a2, a3, a4); _post_call_callback("glGetTexImage", (void*)glad_debug_real_glGetTexImage, 5, a0, a1, a2, a3, a4); }
+static PFNGLGETTEXPARAMETERFVPROC glad_debug_real_glGetTexParameterfv;
+static void APIENTRY glad_debug_glGetTexParameterfv(GLenum a0, GLenum a1, GLfloat* a2) { _pre_call_callback("glGetTexParameterfv", (void*)glad_debug_real_glGetTexParameterfv, 3, a0, a1, a2); glad_debug_real_glGetTexParameterfv(a0, a1, a2); _post_call_callback("glGetTexParameterfv", (void*)glad_debug_real_glGetTexParameterfv, 3, a0, a1, a2); }
+static PFNGLGETTEXPARAMETERIVPROC glad_debug_real_glGetTexParameteriv;
+static void APIENTRY glad_debug_glGetTexParameteriv(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetTexParameteriv", (void*)glad_debug_real_glGetTexParameteriv, 3, a0, a1, a2); glad_debug_real_glGetTexParameteriv(a0, a1, a2); _post_call_callback("glGetTexParameteriv", (void*)glad_debug_real_glGetTexParameteriv, 3, a0, a1, a2); }
+static PFNGLGETTEXLEVELPARAMETERFVPROC glad_debug_real_glGetTexLevelParameterfv;
+static void APIENTRY glad_debug_glGetTexLevelParameterfv(GLenum a0, GLint a1, GLenum a2, GLfloat* a3) { _pre_call_callback("glGetTexLevelParameterfv", (void*)glad_debug_real_glGetTexLevelParameterfv, 4, a0, a1, a2, a3); glad_debug_real_glGetTexLevelParameterfv(a0, a1, a2, a3); _post_call_callback("glGetTexLevelParameterfv", (void*)glad_debug_real_glGetTexLevelParameterfv, 4, a0, a1, a2, a3); }
+static PFNGLGETTEXLEVELPARAMETERIVPROC glad_debug_real_glGetTexLevelParameteriv;
+static void APIENTRY glad_debug_glGetTexLevelParameteriv(GLenum a0, GLint a1, GLenum a2, GLint* a3) { _pre_call_callback("glGetTexLevelParameteriv", (void*)glad_debug_real_glGetTexLevelParameteriv, 4, a0, a1, a2, a3); glad_debug_real_glGetTexLevelParameteriv(a0, a1, a2, a3); _post_call_callback("glGetTexLevelParameteriv", (void*)glad_debug_real_glGetTexLevelParameteriv, 4, a0, a1, a2, a3); }
+static PFNGLISENABLEDPROC glad_debug_real_glIsEnabled;
+static GLboolean APIENTRY glad_debug_glIsEnabled(GLenum a0) { GLboolean ret; _pre_call_callback("glIsEnabled", (void*)glad_debug_real_glIsEnabled, 1, a0); ret = glad_debug_real_glIsEnabled(a0); _post_call_callback("glIsEnabled", (void*)glad_debug_real_glIsEnabled, 1, a0); return ret; }
+static PFNGLDEPTHRANGEPROC glad_debug_real_glDepthRange;
+static void APIENTRY glad_debug_glDepthRange(GLdouble a0, GLdouble a1) { _pre_call_callback("glDepthRange", (void*)glad_debug_real_glDepthRange, 2, a0, a1); glad_debug_real_glDepthRange(a0, a1); _post_call_callback("glDepthRange", (void*)glad_debug_real_glDepthRange, 2, a0, a1); }
+static PFNGLVIEWPORTPROC glad_debug_real_glViewport;
+static void APIENTRY glad_debug_glViewport(GLint a0, GLint a1, GLsizei a2, GLsizei a3) { _pre_call_callback("glViewport", (void*)glad_debug_real_glViewport, 4, a0, a1, a2, a3); glad_debug_real_glViewport(a0, a1, a2, a3); _post_call_callback("glViewport", (void*)glad_debug_real_glViewport, 4, a0, a1, a2, a3); }
+static PFNGLNEWLISTPROC glad_debug_real_glNewList;
+static void APIENTRY glad_debug_glNewList(GLuint a0, GLenum a1) { _pre_call_callback("glNewList", (void*)glad_debug_real_glNewList, 2, a0, a1); glad_debug_real_glNewList(a0, a1); _post_call_callback("glNewList", (void*)glad_debug_real_glNewList, 2, a0, a1); }
+static PFNGLENDLISTPROC glad_debug_real_glEndList;
+static void APIENTRY glad_debug_glEndList() { _pre_call_callback("glEndList", (void*)glad_debug_real_glEndList, 0); glad_debug_real_glEndList(); _post_call_callback("glEndList", (void*)glad_debug_real_glEndList, 0); }
+static PFNGLCALLLISTPROC glad_debug_real_glCallList;
+static void APIENTRY glad_debug_glCallList(GLuint a0) { _pre_call_callback("glCallList", (void*)glad_debug_real_glCallList, 1, a0); glad_debug_real_glCallList(a0); _post_call_callback("glCallList", (void*)glad_debug_real_glCallList, 1, a0); }
+static PFNGLCALLLISTSPROC glad_debug_real_glCallLists;
+static void APIENTRY glad_debug_glCallLists(GLsizei a0, GLenum a1, const void* a2) { _pre_call_callback("glCallLists", (void*)glad_debug_real_glCallLists, 3, a0, a1, a2); glad_debug_real_glCallLists(a0, a1, a2); _post_call_callback("glCallLists", (void*)glad_debug_real_glCallLists, 3, a0, a1, a2); }
+static PFNGLDELETELISTSPROC glad_debug_real_glDeleteLists;
+static void APIENTRY glad_debug_glDeleteLists(GLuint a0, GLsizei a1) { _pre_call_callback("glDeleteLists", (void*)glad_debug_real_glDeleteLists, 2, a0, a1); glad_debug_real_glDeleteLists(a0, a1); _post_call_callback("glDeleteLists", (void*)glad_debug_real_glDeleteLists, 2, a0, a1); }
+static PFNGLGENLISTSPROC glad_debug_real_glGenLists;
+static GLuint APIENTRY glad_debug_glGenLists(GLsizei a0) { GLuint ret; _pre_call_callback("glGenLists", (void*)glad_debug_real_glGenLists, 1, a0); ret = glad_debug_real_glGenLists(a0); _post_call_callback("glGenLists", (void*)glad_debug_real_glGenLists, 1, a0); return ret; }
+static PFNGLLISTBASEPROC glad_debug_real_glListBase;
+static void APIENTRY glad_debug_glListBase(GLuint a0) { _pre_call_callback("glListBase", (void*)glad_debug_real_glListBase, 1, a0); glad_debug_real_glListBase(a0); _post_call_callback("glListBase", (void*)glad_debug_real_glListBase, 1, a0); }
+static PFNGLBEGINPROC glad_debug_real_glBegin;
+static void APIENTRY glad_debug_glBegin(GLenum a0) { _pre_call_callback("glBegin", (void*)glad_debug_real_glBegin, 1, a0); glad_debug_real_glBegin(a0); _post_call_callback("glBegin", (void*)glad_debug_real_glBegin, 1, a0); }
+static PFNGLBITMAPPROC glad_debug_real_glBitmap;
+static void APIENTRY glad_debug_glBitmap(GLsizei a0, GLsizei a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, const GLubyte* a6) { _pre_call_callback("glBitmap", (void*)glad_debug_real_glBitmap, 7, a0, a1, a2, a3, a4, a5, a6); glad_debug_real_glBitmap(a0, a1, a2, a3, a4, a5, a6); _post_call_callback("glBitmap", (void*)glad_debug_real_glBitmap, 7, a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLCOLOR3BPROC glad_debug_real_glColor3b;
+static void APIENTRY glad_debug_glColor3b(GLbyte a0, GLbyte a1, GLbyte a2) { _pre_call_callback("glColor3b", (void*)glad_debug_real_glColor3b, 3, a0, a1, a2); glad_debug_real_glColor3b(a0, a1, a2); _post_call_callback("glColor3b", (void*)glad_debug_real_glColor3b, 3, a0, a1, a2); }
+static PFNGLCOLOR3BVPROC glad_debug_real_glColor3bv;
+static void APIENTRY glad_debug_glColor3bv(const GLbyte* a0) { _pre_call_callback("glColor3bv", (void*)glad_debug_real_glColor3bv, 1, a0); glad_debug_real_glColor3bv(a0); _post_call_callback("glColor3bv", (void*)glad_debug_real_glColor3bv, 1, a0); }
+static PFNGLCOLOR3DPROC glad_debug_real_glColor3d;
+static void APIENTRY glad_debug_glColor3d(GLdouble a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glColor3d", (void*)glad_debug_real_glColor3d, 3, a0, a1, a2); glad_debug_real_glColor3d(a0, a1, a2); _post_call_callback("glColor3d", (void*)glad_debug_real_glColor3d, 3, a0, a1, a2); }
+static PFNGLCOLOR3DVPROC glad_debug_real_glColor3dv;
+static void APIENTRY glad_debug_glColor3dv(const GLdouble* a0) { _pre_call_callback("glColor3dv", (void*)glad_debug_real_glColor3dv, 1, a0); glad_debug_real_glColor3dv(a0); _post_call_callback("glColor3dv", (void*)glad_debug_real_glColor3dv, 1, a0); }
+static PFNGLCOLOR3FPROC glad_debug_real_glColor3f;
+static void APIENTRY glad_debug_glColor3f(GLfloat a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glColor3f", (void*)glad_debug_real_glColor3f, 3, a0, a1, a2); glad_debug_real_glColor3f(a0, a1, a2); _post_call_callback("glColor3f", (void*)glad_debug_real_glColor3f, 3, a0, a1, a2); }
+static PFNGLCOLOR3FVPROC glad_debug_real_glColor3fv;
+static void APIENTRY glad_debug_glColor3fv(const GLfloat* a0) { _pre_call_callback("glColor3fv", (void*)glad_debug_real_glColor3fv, 1, a0); glad_debug_real_glColor3fv(a0); _post_call_callback("glColor3fv", (void*)glad_debug_real_glColor3fv, 1, a0); }
+static PFNGLCOLOR3IPROC glad_debug_real_glColor3i;
+static void APIENTRY glad_debug_glColor3i(GLint a0, GLint a1, GLint a2) { _pre_call_callback("glColor3i", (void*)glad_debug_real_glColor3i, 3, a0, a1, a2); glad_debug_real_glColor3i(a0, a1, a2); _post_call_callback("glColor3i", (void*)glad_debug_real_glColor3i, 3, a0, a1, a2); }
+static PFNGLCOLOR3IVPROC glad_debug_real_glColor3iv;
+static void APIENTRY glad_debug_glColor3iv(const GLint* a0) { _pre_call_callback("glColor3iv", (void*)glad_debug_real_glColor3iv, 1, a0); glad_debug_real_glColor3iv(a0); _post_call_callback("glColor3iv", (void*)glad_debug_real_glColor3iv, 1, a0); }
+static PFNGLCOLOR3SPROC glad_debug_real_glColor3s;
+static void APIENTRY glad_debug_glColor3s(GLshort a0, GLshort a1, GLshort a2) { _pre_call_callback("glColor3s", (void*)glad_debug_real_glColor3s, 3, a0, a1, a2); glad_debug_real_glColor3s(a0, a1, a2); _post_call_callback("glColor3s", (void*)glad_debug_real_glColor3s, 3, a0, a1, a2); }
+static PFNGLCOLOR3SVPROC glad_debug_real_glColor3sv;
+static void APIENTRY glad_debug_glColor3sv(const GLshort* a0) { _pre_call_callback("glColor3sv", (void*)glad_debug_real_glColor3sv, 1, a0); glad_debug_real_glColor3sv(a0); _post_call_callback("glColor3sv", (void*)glad_debug_real_glColor3sv, 1, a0); }
+static PFNGLCOLOR3UBPROC glad_debug_real_glColor3ub;
+static void APIENTRY glad_debug_glColor3ub(GLubyte a0, GLubyte a1, GLubyte a2) { _pre_call_callback("glColor3ub", (void*)glad_debug_real_glColor3ub, 3, a0, a1, a2); glad_debug_real_glColor3ub(a0, a1, a2); _post_call_callback("glColor3ub", (void*)glad_debug_real_glColor3ub, 3, a0, a1, a2); }
+static PFNGLCOLOR3UBVPROC glad_debug_real_glColor3ubv;
+static void APIENTRY glad_debug_glColor3ubv(const GLubyte* a0) { _pre_call_callback("glColor3ubv", (void*)glad_debug_real_glColor3ubv, 1, a0); glad_debug_real_glColor3ubv(a0); _post_call_callback("glColor3ubv", (void*)glad_debug_real_glColor3ubv, 1, a0); }
+static PFNGLCOLOR3UIPROC glad_debug_real_glColor3ui;
+static void APIENTRY glad_debug_glColor3ui(GLuint a0, GLuint a1, GLuint a2) { _pre_call_callback("glColor3ui", (void*)glad_debug_real_glColor3ui, 3, a0, a1, a2); glad_debug_real_glColor3ui(a0, a1, a2); _post_call_callback("glColor3ui", (void*)glad_debug_real_glColor3ui, 3, a0, a1, a2); }
+static PFNGLCOLOR3UIVPROC glad_debug_real_glColor3uiv;
+static void APIENTRY glad_debug_glColor3uiv(const GLuint* a0) { _pre_call_callback("glColor3uiv", (void*)glad_debug_real_glColor3uiv, 1, a0); glad_debug_real_glColor3uiv(a0); _post_call_callback("glColor3uiv", (void*)glad_debug_real_glColor3uiv, 1, a0); }
+static PFNGLCOLOR3USPROC glad_debug_real_glColor3us;
+static void APIENTRY glad_debug_glColor3us(GLushort a0, GLushort a1, GLushort a2) { _pre_call_callback("glColor3us", (void*)glad_debug_real_glColor3us, 3, a0, a1, a2); glad_debug_real_glColor3us(a0, a1, a2); _post_call_callback("glColor3us", (void*)glad_debug_real_glColor3us, 3, a0, a1, a2); }
+static PFNGLCOLOR3USVPROC glad_debug_real_glColor3usv;
+static void APIENTRY glad_debug_glColor3usv(const GLushort* a0) { _pre_call_callback("glColor3usv", (void*)glad_debug_real_glColor3usv, 1, a0); glad_debug_real_glColor3usv(a0); _post_call_callback("glColor3usv", (void*)glad_debug_real_glColor3usv, 1, a0); }
+static PFNGLCOLOR4BPROC glad_debug_real_glColor4b;
+static void APIENTRY glad_debug_glColor4b(GLbyte a0, GLbyte a1, GLbyte a2, GLbyte a3) { _pre_call_callback("glColor4b", (void*)glad_debug_real_glColor4b, 4, a0, a1, a2, a3); glad_debug_real_glColor4b(a0, a1, a2, a3); _post_call_callback("glColor4b", (void*)glad_debug_real_glColor4b, 4, a0, a1, a2, a3); }
+static PFNGLCOLOR4BVPROC glad_debug_real_glColor4bv;
+static void APIENTRY glad_debug_glColor4bv(const GLbyte* a0) { _pre_call_callback("glColor4bv", (void*)glad_debug_real_glColor4bv, 1, a0); glad_debug_real_glColor4bv(a0); _post_call_callback("glColor4bv", (void*)glad_debug_real_glColor4bv, 1, a0); }
+static PFNGLCOLOR4DPROC glad_debug_real_glColor4d;
+static void APIENTRY glad_debug_glColor4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { _pre_call_callback("glColor4d", (void*)glad_debug_real_glColor4d, 4, a0, a1, a2, a3); glad_debug_real_glColor4d(a0, a1, a2, a3); _post_call_callback("glColor4d", (void*)glad_debug_real_glColor4d, 4, a0, a1, a2, a3); }
+static PFNGLCOLOR4DVPROC glad_debug_real_glColor4dv;
+static void APIENTRY glad_debug_glColor4dv(const GLdouble* a0) { _pre_call_callback("glColor4dv", (void*)glad_debug_real_glColor4dv, 1, a0); glad_debug_real_glColor4dv(a0); _post_call_callback("glColor4dv", (void*)glad_debug_real_glColor4dv, 1, a0); }
+static PFNGLCOLOR4FPROC glad_debug_real_glColor4f;
+static void APIENTRY glad_debug_glColor4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glColor4f", (void*)glad_debug_real_glColor4f, 4, a0, a1, a2, a3); glad_debug_real_glColor4f(a0, a1, a2, a3); _post_call_callback("glColor4f", (void*)glad_debug_real_glColor4f, 4, a0, a1, a2, a3); }
+static PFNGLCOLOR4FVPROC glad_debug_real_glColor4fv;
+static void APIENTRY glad_debug_glColor4fv(const GLfloat* a0) { _pre_call_callback("glColor4fv", (void*)glad_debug_real_glColor4fv, 1, a0); glad_debug_real_glColor4fv(a0); _post_call_callback("glColor4fv", (void*)glad_debug_real_glColor4fv, 1, a0); }
+static PFNGLCOLOR4IPROC glad_debug_real_glColor4i;
+static void APIENTRY glad_debug_glColor4i(GLint a0, GLint a1, GLint a2, GLint a3) { _pre_call_callback("glColor4i", (void*)glad_debug_real_glColor4i, 4, a0, a1, a2, a3); glad_debug_real_glColor4i(a0, a1, a2, a3); _post_call_callback("glColor4i", (void*)glad_debug_real_glColor4i, 4, a0, a1, a2, a3); }
+static PFNGLCOLOR4IVPROC glad_debug_real_glColor4iv;
+static void APIENTRY glad_debug_glColor4iv(const GLint* a0) { _pre_call_callback("glColor4iv", (void*)glad_debug_real_glColor4iv, 1, a0); glad_debug_real_glColor4iv(a0); _post_call_callback("glColor4iv", (void*)glad_debug_real_glColor4iv, 1, a0); }
+static PFNGLCOLOR4SPROC glad_debug_real_glColor4s;
+static void APIENTRY glad_debug_glColor4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { _pre_call_callback("glColor4s", (void*)glad_debug_real_glColor4s, 4, a0, a1, a2, a3); glad_debug_real_glColor4s(a0, a1, a2, a3); _post_call_callback("glColor4s", (void*)glad_debug_real_glColor4s, 4, a0, a1, a2, a3); }
+static PFNGLCOLOR4SVPROC glad_debug_real_glColor4sv;
+static void APIENTRY glad_debug_glColor4sv(const GLshort* a0) { _pre_call_callback("glColor4sv", (void*)glad_debug_real_glColor4sv, 1, a0); glad_debug_real_glColor4sv(a0); _post_call_callback("glColor4sv", (void*)glad_debug_real_glColor4sv, 1, a0); }
+static PFNGLCOLOR4UBPROC glad_debug_real_glColor4ub;
+static void APIENTRY glad_debug_glColor4ub(GLubyte a0, GLubyte a1, GLubyte a2, GLubyte a3) { _pre_call_callback("glColor4ub", (void*)glad_debug_real_glColor4ub, 4, a0, a1, a2, a3); glad_debug_real_glColor4ub(a0, a1, a2, a3); _post_call_callback("glColor4ub", (void*)glad_debug_real_glColor4ub, 4, a0, a1, a2, a3); }
+static PFNGLCOLOR4UBVPROC glad_debug_real_glColor4ubv;
+static void APIENTRY glad_debug_glColor4ubv(const GLubyte* a0) { _pre_call_callback("glColor4ubv", (void*)glad_debug_real_glColor4ubv, 1, a0); glad_debug_real_glColor4ubv(a0); _post_call_callback("glColor4ubv", (void*)glad_debug_real_glColor4ubv, 1, a0); }
+static PFNGLCOLOR4UIPROC glad_debug_real_glColor4ui;
+static void APIENTRY glad_debug_glColor4ui(GLuint a0, GLuint a1, GLuint a2, GLuint a3) { _pre_call_callback("glColor4ui", (void*)glad_debug_real_glColor4ui, 4, a0, a1, a2, a3); glad_debug_real_glColor4ui(a0, a1, a2, a3); _post_call_callback("glColor4ui", (void*)glad_debug_real_glColor4ui, 4, a0, a1, a2, a3); }
+static PFNGLCOLOR4UIVPROC glad_debug_real_glColor4uiv;
+static void APIENTRY glad_debug_glColor4uiv(const GLuint* a0) { _pre_call_callback("glColor4uiv", (void*)glad_debug_real_glColor4uiv, 1, a0); glad_debug_real_glColor4uiv(a0); _post_call_callback("glColor4uiv", (void*)glad_debug_real_glColor4uiv, 1, a0); }
+static PFNGLCOLOR4USPROC glad_debug_real_glColor4us;
+static void APIENTRY glad_debug_glColor4us(GLushort a0, GLushort a1, GLushort a2, GLushort a3) { _pre_call_callback("glColor4us", (void*)glad_debug_real_glColor4us, 4, a0, a1, a2, a3); glad_debug_real_glColor4us(a0, a1, a2, a3); _post_call_callback("glColor4us", (void*)glad_debug_real_glColor4us, 4, a0, a1, a2, a3); }
+static PFNGLCOLOR4USVPROC glad_debug_real_glColor4usv;
+static void APIENTRY glad_debug_glColor4usv(const GLushort* a0) { _pre_call_callback("glColor4usv", (void*)glad_debug_real_glColor4usv, 1, a0); glad_debug_real_glColor4usv(a0); _post_call_callback("glColor4usv", (void*)glad_debug_real_glColor4usv, 1, a0); }
+static PFNGLEDGEFLAGPROC glad_debug_real_glEdgeFlag;
+static void APIENTRY glad_debug_glEdgeFlag(GLboolean a0) { _pre_call_callback("glEdgeFlag", (void*)glad_debug_real_glEdgeFlag, 1, a0); glad_debug_real_glEdgeFlag(a0); _post_call_callback("glEdgeFlag", (void*)glad_debug_real_glEdgeFlag, 1, a0); }
+static PFNGLEDGEFLAGVPROC glad_debug_real_glEdgeFlagv;
+static void APIENTRY glad_debug_glEdgeFlagv(const GLboolean* a0) { _pre_call_callback("glEdgeFlagv", (void*)glad_debug_real_glEdgeFlagv, 1, a0); glad_debug_real_glEdgeFlagv(a0); _post_call_callback("glEdgeFlagv", (void*)glad_debug_real_glEdgeFlagv, 1, a0); }
+static PFNGLENDPROC glad_debug_real_glEnd;
+static void APIENTRY glad_debug_glEnd() { _pre_call_callback("glEnd", (void*)glad_debug_real_glEnd, 0); glad_debug_real_glEnd(); _post_call_callback("glEnd", (void*)glad_debug_real_glEnd, 0); }
+static PFNGLINDEXDPROC glad_debug_real_glIndexd;
+static void APIENTRY glad_debug_glIndexd(GLdouble a0) { _pre_call_callback("glIndexd", (void*)glad_debug_real_glIndexd, 1, a0); glad_debug_real_glIndexd(a0); _post_call_callback("glIndexd", (void*)glad_debug_real_glIndexd, 1, a0); }
+static PFNGLINDEXDVPROC glad_debug_real_glIndexdv;
+static void APIENTRY glad_debug_glIndexdv(const GLdouble* a0) { _pre_call_callback("glIndexdv", (void*)glad_debug_real_glIndexdv, 1, a0); glad_debug_real_glIndexdv(a0); _post_call_callback("glIndexdv", (void*)glad_debug_real_glIndexdv, 1, a0); }
+static PFNGLINDEXFPROC glad_debug_real_glIndexf;
+static void APIENTRY glad_debug_glIndexf(GLfloat a0) { _pre_call_callback("glIndexf", (void*)glad_debug_real_glIndexf, 1, a0); glad_debug_real_glIndexf(a0); _post_call_callback("glIndexf", (void*)glad_debug_real_glIndexf, 1, a0); }
+static PFNGLINDEXFVPROC glad_debug_real_glIndexfv;
+static void APIENTRY glad_debug_glIndexfv(const GLfloat* a0) { _pre_call_callback("glIndexfv", (void*)glad_debug_real_glIndexfv, 1, a0); glad_debug_real_glIndexfv(a0); _post_call_callback("glIndexfv", (void*)glad_debug_real_glIndexfv, 1, a0); }
+static PFNGLINDEXIPROC glad_debug_real_glIndexi;
+static void APIENTRY glad_debug_glIndexi(GLint a0) { _pre_call_callback("glIndexi", (void*)glad_debug_real_glIndexi, 1, a0); glad_debug_real_glIndexi(a0); _post_call_callback("glIndexi", (void*)glad_debug_real_glIndexi, 1, a0); }
+static PFNGLINDEXIVPROC glad_debug_real_glIndexiv;
+static void APIENTRY glad_debug_glIndexiv(const GLint* a0) { _pre_call_callback("glIndexiv", (void*)glad_debug_real_glIndexiv, 1, a0); glad_debug_real_glIndexiv(a0); _post_call_callback("glIndexiv", (void*)glad_debug_real_glIndexiv, 1, a0); }
+static PFNGLINDEXSPROC glad_debug_real_glIndexs;
+static void APIENTRY glad_debug_glIndexs(GLshort a0) { _pre_call_callback("glIndexs", (void*)glad_debug_real_glIndexs, 1, a0); glad_debug_real_glIndexs(a0); _post_call_callback("glIndexs", (void*)glad_debug_real_glIndexs, 1, a0); }
+static PFNGLINDEXSVPROC glad_debug_real_glIndexsv;
+static void APIENTRY glad_debug_glIndexsv(const GLshort* a0) { _pre_call_callback("glIndexsv", (void*)glad_debug_real_glIndexsv, 1, a0); glad_debug_real_glIndexsv(a0); _post_call_callback("glIndexsv", (void*)glad_debug_real_glIndexsv, 1, a0); }
+static PFNGLNORMAL3BPROC glad_debug_real_glNormal3b;
+static void APIENTRY glad_debug_glNormal3b(GLbyte a0, GLbyte a1, GLbyte a2) { _pre_call_callback("glNormal3b", (void*)glad_debug_real_glNormal3b, 3, a0, a1, a2); glad_debug_real_glNormal3b(a0, a1, a2); _post_call_callback("glNormal3b", (void*)glad_debug_real_glNormal3b, 3, a0, a1, a2); }
+static PFNGLNORMAL3BVPROC glad_debug_real_glNormal3bv;
+static void APIENTRY glad_debug_glNormal3bv(const GLbyte* a0) { _pre_call_callback("glNormal3bv", (void*)glad_debug_real_glNormal3bv, 1, a0); glad_debug_real_glNormal3bv(a0); _post_call_callback("glNormal3bv", (void*)glad_debug_real_glNormal3bv, 1, a0); }
+static PFNGLNORMAL3DPROC glad_debug_real_glNormal3d;
+static void APIENTRY glad_debug_glNormal3d(GLdouble a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glNormal3d", (void*)glad_debug_real_glNormal3d, 3, a0, a1, a2); glad_debug_real_glNormal3d(a0, a1, a2); _post_call_callback("glNormal3d", (void*)glad_debug_real_glNormal3d, 3, a0, a1, a2); }
+static PFNGLNORMAL3DVPROC glad_debug_real_glNormal3dv;
+static void APIENTRY glad_debug_glNormal3dv(const GLdouble* a0) { _pre_call_callback("glNormal3dv", (void*)glad_debug_real_glNormal3dv, 1, a0); glad_debug_real_glNormal3dv(a0); _post_call_callback("glNormal3dv", (void*)glad_debug_real_glNormal3dv, 1, a0); }
+static PFNGLNORMAL3FPROC glad_debug_real_glNormal3f;
+static void APIENTRY glad_debug_glNormal3f(GLfloat a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glNormal3f", (void*)glad_debug_real_glNormal3f, 3, a0, a1, a2); glad_debug_real_glNormal3f(a0, a1, a2); _post_call_callback("glNormal3f", (void*)glad_debug_real_glNormal3f, 3, a0, a1, a2); }
+static PFNGLNORMAL3FVPROC glad_debug_real_glNormal3fv;
+static void APIENTRY glad_debug_glNormal3fv(const GLfloat* a0) { _pre_call_callback("glNormal3fv", (void*)glad_debug_real_glNormal3fv, 1, a0); glad_debug_real_glNormal3fv(a0); _post_call_callback("glNormal3fv", (void*)glad_debug_real_glNormal3fv, 1, a0); }
+static PFNGLNORMAL3IPROC glad_debug_real_glNormal3i;
+static void APIENTRY glad_debug_glNormal3i(GLint a0, GLint a1, GLint a2) { _pre_call_callback("glNormal3i", (void*)glad_debug_real_glNormal3i, 3, a0, a1, a2); glad_debug_real_glNormal3i(a0, a1, a2); _post_call_callback("glNormal3i", (void*)glad_debug_real_glNormal3i, 3, a0, a1, a2); }
+static PFNGLNORMAL3IVPROC glad_debug_real_glNormal3iv;
+static void APIENTRY glad_debug_glNormal3iv(const GLint* a0) { _pre_call_callback("glNormal3iv", (void*)glad_debug_real_glNormal3iv, 1, a0); glad_debug_real_glNormal3iv(a0); _post_call_callback("glNormal3iv", (void*)glad_debug_real_glNormal3iv, 1, a0); }
+static PFNGLNORMAL3SPROC glad_debug_real_glNormal3s;
+static void APIENTRY glad_debug_glNormal3s(GLshort a0, GLshort a1, GLshort a2) { _pre_call_callback("glNormal3s", (void*)glad_debug_real_glNormal3s, 3, a0, a1, a2); glad_debug_real_glNormal3s(a0, a1, a2); _post_call_callback("glNormal3s", (void*)glad_debug_real_glNormal3s, 3, a0, a1, a2); }
+static PFNGLNORMAL3SVPROC glad_debug_real_glNormal3sv;
+static void APIENTRY glad_debug_glNormal3sv(const GLshort* a0) { _pre_call_callback("glNormal3sv", (void*)glad_debug_real_glNormal3sv, 1, a0); glad_debug_real_glNormal3sv(a0); _post_call_callback("glNormal3sv", (void*)glad_debug_real_glNormal3sv, 1, a0); }
+static PFNGLRASTERPOS2DPROC glad_debug_real_glRasterPos2d;
+static void APIENTRY glad_debug_glRasterPos2d(GLdouble a0, GLdouble a1) { _pre_call_callback("glRasterPos2d", (void*)glad_debug_real_glRasterPos2d, 2, a0, a1); glad_debug_real_glRasterPos2d(a0, a1); _post_call_callback("glRasterPos2d", (void*)glad_debug_real_glRasterPos2d, 2, a0, a1); }
+static PFNGLRASTERPOS2DVPROC glad_debug_real_glRasterPos2dv;
+static void APIENTRY glad_debug_glRasterPos2dv(const GLdouble* a0) { _pre_call_callback("glRasterPos2dv", (void*)glad_debug_real_glRasterPos2dv, 1, a0); glad_debug_real_glRasterPos2dv(a0); _post_call_callback("glRasterPos2dv", (void*)glad_debug_real_glRasterPos2dv, 1, a0); }
+static PFNGLRASTERPOS2FPROC glad_debug_real_glRasterPos2f;
+static void APIENTRY glad_debug_glRasterPos2f(GLfloat a0, GLfloat a1) { _pre_call_callback("glRasterPos2f", (void*)glad_debug_real_glRasterPos2f, 2, a0, a1); glad_debug_real_glRasterPos2f(a0, a1); _post_call_callback("glRasterPos2f", (void*)glad_debug_real_glRasterPos2f, 2, a0, a1); }
+static PFNGLRASTERPOS2FVPROC glad_debug_real_glRasterPos2fv;
+static void APIENTRY glad_debug_glRasterPos2fv(const GLfloat* a0) { _pre_call_callback("glRasterPos2fv", (void*)glad_debug_real_glRasterPos2fv, 1, a0); glad_debug_real_glRasterPos2fv(a0); _post_call_callback("glRasterPos2fv", (void*)glad_debug_real_glRasterPos2fv, 1, a0); }
+static PFNGLRASTERPOS2IPROC glad_debug_real_glRasterPos2i;
+static void APIENTRY glad_debug_glRasterPos2i(GLint a0, GLint a1) { _pre_call_callback("glRasterPos2i", (void*)glad_debug_real_glRasterPos2i, 2, a0, a1); glad_debug_real_glRasterPos2i(a0, a1); _post_call_callback("glRasterPos2i", (void*)glad_debug_real_glRasterPos2i, 2, a0, a1); }
+static PFNGLRASTERPOS2IVPROC glad_debug_real_glRasterPos2iv;
+static void APIENTRY glad_debug_glRasterPos2iv(const GLint* a0) { _pre_call_callback("glRasterPos2iv", (void*)glad_debug_real_glRasterPos2iv, 1, a0); glad_debug_real_glRasterPos2iv(a0); _post_call_callback("glRasterPos2iv", (void*)glad_debug_real_glRasterPos2iv, 1, a0); }
+static PFNGLRASTERPOS2SPROC glad_debug_real_glRasterPos2s;
+static void APIENTRY glad_debug_glRasterPos2s(GLshort a0, GLshort a1) { _pre_call_callback("glRasterPos2s", (void*)glad_debug_real_glRasterPos2s, 2, a0, a1); glad_debug_real_glRasterPos2s(a0, a1); _post_call_callback("glRasterPos2s", (void*)glad_debug_real_glRasterPos2s, 2, a0, a1); }
+static PFNGLRASTERPOS2SVPROC glad_debug_real_glRasterPos2sv;
+static void APIENTRY glad_debug_glRasterPos2sv(const GLshort* a0) { _pre_call_callback("glRasterPos2sv", (void*)glad_debug_real_glRasterPos2sv, 1, a0); glad_debug_real_glRasterPos2sv(a0); _post_call_callback("glRasterPos2sv", (void*)glad_debug_real_glRasterPos2sv, 1, a0); }
+static PFNGLRASTERPOS3DPROC glad_debug_real_glRasterPos3d;
+static void APIENTRY glad_debug_glRasterPos3d(GLdouble a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glRasterPos3d", (void*)glad_debug_real_glRasterPos3d, 3, a0, a1, a2); glad_debug_real_glRasterPos3d(a0, a1, a2); _post_call_callback("glRasterPos3d", (void*)glad_debug_real_glRasterPos3d, 3, a0, a1, a2); }
+static PFNGLRASTERPOS3DVPROC glad_debug_real_glRasterPos3dv;
+static void APIENTRY glad_debug_glRasterPos3dv(const GLdouble* a0) { _pre_call_callback("glRasterPos3dv", (void*)glad_debug_real_glRasterPos3dv, 1, a0); glad_debug_real_glRasterPos3dv(a0); _post_call_callback("glRasterPos3dv", (void*)glad_debug_real_glRasterPos3dv, 1, a0); }
+static PFNGLRASTERPOS3FPROC glad_debug_real_glRasterPos3f;
+static void APIENTRY glad_debug_glRasterPos3f(GLfloat a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glRasterPos3f", (void*)glad_debug_real_glRasterPos3f, 3, a0, a1, a2); glad_debug_real_glRasterPos3f(a0, a1, a2); _post_call_callback("glRasterPos3f", (void*)glad_debug_real_glRasterPos3f, 3, a0, a1, a2); }
+static PFNGLRASTERPOS3FVPROC glad_debug_real_glRasterPos3fv;
+static void APIENTRY glad_debug_glRasterPos3fv(const GLfloat* a0) { _pre_call_callback("glRasterPos3fv", (void*)glad_debug_real_glRasterPos3fv, 1, a0); glad_debug_real_glRasterPos3fv(a0); _post_call_callback("glRasterPos3fv", (void*)glad_debug_real_glRasterPos3fv, 1, a0); }
+static PFNGLRASTERPOS3IPROC glad_debug_real_glRasterPos3i;
+static void APIENTRY glad_debug_glRasterPos3i(GLint a0, GLint a1, GLint a2) { _pre_call_callback("glRasterPos3i", (void*)glad_debug_real_glRasterPos3i, 3, a0, a1, a2); glad_debug_real_glRasterPos3i(a0, a1, a2); _post_call_callback("glRasterPos3i", (void*)glad_debug_real_glRasterPos3i, 3, a0, a1, a2); }
+static PFNGLRASTERPOS3IVPROC glad_debug_real_glRasterPos3iv;
+static void APIENTRY glad_debug_glRasterPos3iv(const GLint* a0) { _pre_call_callback("glRasterPos3iv", (void*)glad_debug_real_glRasterPos3iv, 1, a0); glad_debug_real_glRasterPos3iv(a0); _post_call_callback("glRasterPos3iv", (void*)glad_debug_real_glRasterPos3iv, 1, a0); }
+static PFNGLRASTERPOS3SPROC glad_debug_real_glRasterPos3s;
+static void APIENTRY glad_debug_glRasterPos3s(GLshort a0, GLshort a1, GLshort a2) { _pre_call_callback("glRasterPos3s", (void*)glad_debug_real_glRasterPos3s, 3, a0, a1, a2); glad_debug_real_glRasterPos3s(a0, a1, a2); _post_call_callback("glRasterPos3s", (void*)glad_debug_real_glRasterPos3s, 3, a0, a1, a2); }
+static PFNGLRASTERPOS3SVPROC glad_debug_real_glRasterPos3sv;
+static void APIENTRY glad_debug_glRasterPos3sv(const GLshort* a0) { _pre_call_callback("glRasterPos3sv", (void*)glad_debug_real_glRasterPos3sv, 1, a0); glad_debug_real_glRasterPos3sv(a0); _post_call_callback("glRasterPos3sv", (void*)glad_debug_real_glRasterPos3sv, 1, a0); }
+static PFNGLRASTERPOS4DPROC glad_debug_real_glRasterPos4d;
+static void APIENTRY glad_debug_glRasterPos4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { _pre_call_callback("glRasterPos4d", (void*)glad_debug_real_glRasterPos4d, 4, a0, a1, a2, a3); glad_debug_real_glRasterPos4d(a0, a1, a2, a3); _post_call_callback("glRasterPos4d", (void*)glad_debug_real_glRasterPos4d, 4, a0, a1, a2, a3); }
+static PFNGLRASTERPOS4DVPROC glad_debug_real_glRasterPos4dv;
+static void APIENTRY glad_debug_glRasterPos4dv(const GLdouble* a0) { _pre_call_callback("glRasterPos4dv", (void*)glad_debug_real_glRasterPos4dv, 1, a0); glad_debug_real_glRasterPos4dv(a0); _post_call_callback("glRasterPos4dv", (void*)glad_debug_real_glRasterPos4dv, 1, a0); }
+static PFNGLRASTERPOS4FPROC glad_debug_real_glRasterPos4f;
+static void APIENTRY glad_debug_glRasterPos4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glRasterPos4f", (void*)glad_debug_real_glRasterPos4f, 4, a0, a1, a2, a3); glad_debug_real_glRasterPos4f(a0, a1, a2, a3); _post_call_callback("glRasterPos4f", (void*)glad_debug_real_glRasterPos4f, 4, a0, a1, a2, a3); }
+static PFNGLRASTERPOS4FVPROC glad_debug_real_glRasterPos4fv;
+static void APIENTRY glad_debug_glRasterPos4fv(const GLfloat* a0) { _pre_call_callback("glRasterPos4fv", (void*)glad_debug_real_glRasterPos4fv, 1, a0); glad_debug_real_glRasterPos4fv(a0); _post_call_callback("glRasterPos4fv", (void*)glad_debug_real_glRasterPos4fv, 1, a0); }
+static PFNGLRASTERPOS4IPROC glad_debug_real_glRasterPos4i;
+static void APIENTRY glad_debug_glRasterPos4i(GLint a0, GLint a1, GLint a2, GLint a3) { _pre_call_callback("glRasterPos4i", (void*)glad_debug_real_glRasterPos4i, 4, a0, a1, a2, a3); glad_debug_real_glRasterPos4i(a0, a1, a2, a3); _post_call_callback("glRasterPos4i", (void*)glad_debug_real_glRasterPos4i, 4, a0, a1, a2, a3); }
+static PFNGLRASTERPOS4IVPROC glad_debug_real_glRasterPos4iv;
+static void APIENTRY glad_debug_glRasterPos4iv(const GLint* a0) { _pre_call_callback("glRasterPos4iv", (void*)glad_debug_real_glRasterPos4iv, 1, a0); glad_debug_real_glRasterPos4iv(a0); _post_call_callback("glRasterPos4iv", (void*)glad_debug_real_glRasterPos4iv, 1, a0); }
+static PFNGLRASTERPOS4SPROC glad_debug_real_glRasterPos4s;
+static void APIENTRY glad_debug_glRasterPos4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { _pre_call_callback("glRasterPos4s", (void*)glad_debug_real_glRasterPos4s, 4, a0, a1, a2, a3); glad_debug_real_glRasterPos4s(a0, a1, a2, a3); _post_call_callback("glRasterPos4s", (void*)glad_debug_real_glRasterPos4s, 4, a0, a1, a2, a3); }
+static PFNGLRASTERPOS4SVPROC glad_debug_real_glRasterPos4sv;
+static void APIENTRY glad_debug_glRasterPos4sv(const GLshort* a0) { _pre_call_callback("glRasterPos4sv", (void*)glad_debug_real_glRasterPos4sv, 1, a0); glad_debug_real_glRasterPos4sv(a0); _post_call_callback("glRasterPos4sv", (void*)glad_debug_real_glRasterPos4sv, 1, a0); }
+static PFNGLRECTDPROC glad_debug_real_glRectd;
+static void APIENTRY glad_debug_glRectd(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { _pre_call_callback("glRectd", (void*)glad_debug_real_glRectd, 4, a0, a1, a2, a3); glad_debug_real_glRectd(a0, a1, a2, a3); _post_call_callback("glRectd", (void*)glad_debug_real_glRectd, 4, a0, a1, a2, a3); }
+static PFNGLRECTDVPROC glad_debug_real_glRectdv;
+static void APIENTRY glad_debug_glRectdv(const GLdouble* a0, const GLdouble* a1) { _pre_call_callback("glRectdv", (void*)glad_debug_real_glRectdv, 2, a0, a1); glad_debug_real_glRectdv(a0, a1); _post_call_callback("glRectdv", (void*)glad_debug_real_glRectdv, 2, a0, a1); }
+static PFNGLRECTFPROC glad_debug_real_glRectf;
+static void APIENTRY glad_debug_glRectf(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glRectf", (void*)glad_debug_real_glRectf, 4, a0, a1, a2, a3); glad_debug_real_glRectf(a0, a1, a2, a3); _post_call_callback("glRectf", (void*)glad_debug_real_glRectf, 4, a0, a1, a2, a3); }
+static PFNGLRECTFVPROC glad_debug_real_glRectfv;
+static void APIENTRY glad_debug_glRectfv(const GLfloat* a0, const GLfloat* a1) { _pre_call_callback("glRectfv", (void*)glad_debug_real_glRectfv, 2, a0, a1); glad_debug_real_glRectfv(a0, a1); _post_call_callback("glRectfv", (void*)glad_debug_real_glRectfv, 2, a0, a1); }
+static PFNGLRECTIPROC glad_debug_real_glRecti;
+static void APIENTRY glad_debug_glRecti(GLint a0, GLint a1, GLint a2, GLint a3) { _pre_call_callback("glRecti", (void*)glad_debug_real_glRecti, 4, a0, a1, a2, a3); glad_debug_real_glRecti(a0, a1, a2, a3); _post_call_callback("glRecti", (void*)glad_debug_real_glRecti, 4, a0, a1, a2, a3); }
+static PFNGLRECTIVPROC glad_debug_real_glRectiv;
+static void APIENTRY glad_debug_glRectiv(const GLint* a0, const GLint* a1) { _pre_call_callback("glRectiv", (void*)glad_debug_real_glRectiv, 2, a0, a1); glad_debug_real_glRectiv(a0, a1); _post_call_callback("glRectiv", (void*)glad_debug_real_glRectiv, 2, a0, a1); }
+static PFNGLRECTSPROC glad_debug_real_glRects;
+static void APIENTRY glad_debug_glRects(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { _pre_call_callback("glRects", (void*)glad_debug_real_glRects, 4, a0, a1, a2, a3); glad_debug_real_glRects(a0, a1, a2, a3); _post_call_callback("glRects", (void*)glad_debug_real_glRects, 4, a0, a1, a2, a3); }
+static PFNGLRECTSVPROC glad_debug_real_glRectsv;
+static void APIENTRY glad_debug_glRectsv(const GLshort* a0, const GLshort* a1) { _pre_call_callback("glRectsv", (void*)glad_debug_real_glRectsv, 2, a0, a1); glad_debug_real_glRectsv(a0, a1); _post_call_callback("glRectsv", (void*)glad_debug_real_glRectsv, 2, a0, a1); }
+static PFNGLTEXCOORD1DPROC glad_debug_real_glTexCoord1d;
+static void APIENTRY glad_debug_glTexCoord1d(GLdouble a0) { _pre_call_callback("glTexCoord1d", (void*)glad_debug_real_glTexCoord1d, 1, a0); glad_debug_real_glTexCoord1d(a0); _post_call_callback("glTexCoord1d", (void*)glad_debug_real_glTexCoord1d, 1, a0); }
+static PFNGLTEXCOORD1DVPROC glad_debug_real_glTexCoord1dv;
+static void APIENTRY glad_debug_glTexCoord1dv(const GLdouble* a0) { _pre_call_callback("glTexCoord1dv", (void*)glad_debug_real_glTexCoord1dv, 1, a0); glad_debug_real_glTexCoord1dv(a0); _post_call_callback("glTexCoord1dv", (void*)glad_debug_real_glTexCoord1dv, 1, a0); }
+static PFNGLTEXCOORD1FPROC glad_debug_real_glTexCoord1f;
+static void APIENTRY glad_debug_glTexCoord1f(GLfloat a0) { _pre_call_callback("glTexCoord1f", (void*)glad_debug_real_glTexCoord1f, 1, a0); glad_debug_real_glTexCoord1f(a0); _post_call_callback("glTexCoord1f", (void*)glad_debug_real_glTexCoord1f, 1, a0); }
+static PFNGLTEXCOORD1FVPROC glad_debug_real_glTexCoord1fv;
+static void APIENTRY glad_debug_glTexCoord1fv(const GLfloat* a0) { _pre_call_callback("glTexCoord1fv", (void*)glad_debug_real_glTexCoord1fv, 1, a0); glad_debug_real_glTexCoord1fv(a0); _post_call_callback("glTexCoord1fv", (void*)glad_debug_real_glTexCoord1fv, 1, a0); }
+static PFNGLTEXCOORD1IPROC glad_debug_real_glTexCoord1i;
+static void APIENTRY glad_debug_glTexCoord1i(GLint a0) { _pre_call_callback("glTexCoord1i", (void*)glad_debug_real_glTexCoord1i, 1, a0); glad_debug_real_glTexCoord1i(a0); _post_call_callback("glTexCoord1i", (void*)glad_debug_real_glTexCoord1i, 1, a0); }
+static PFNGLTEXCOORD1IVPROC glad_debug_real_glTexCoord1iv;
+static void APIENTRY glad_debug_glTexCoord1iv(const GLint* a0) { _pre_call_callback("glTexCoord1iv", (void*)glad_debug_real_glTexCoord1iv, 1, a0); glad_debug_real_glTexCoord1iv(a0); _post_call_callback("glTexCoord1iv", (void*)glad_debug_real_glTexCoord1iv, 1, a0); }
+static PFNGLTEXCOORD1SPROC glad_debug_real_glTexCoord1s;
+static void APIENTRY glad_debug_glTexCoord1s(GLshort a0) { _pre_call_callback("glTexCoord1s", (void*)glad_debug_real_glTexCoord1s, 1, a0); glad_debug_real_glTexCoord1s(a0); _post_call_callback("glTexCoord1s", (void*)glad_debug_real_glTexCoord1s, 1, a0); }
+static PFNGLTEXCOORD1SVPROC glad_debug_real_glTexCoord1sv;
+static void APIENTRY glad_debug_glTexCoord1sv(const GLshort* a0) { _pre_call_callback("glTexCoord1sv", (void*)glad_debug_real_glTexCoord1sv, 1, a0); glad_debug_real_glTexCoord1sv(a0); _post_call_callback("glTexCoord1sv", (void*)glad_debug_real_glTexCoord1sv, 1, a0); }
+static PFNGLTEXCOORD2DPROC glad_debug_real_glTexCoord2d;
+static void APIENTRY glad_debug_glTexCoord2d(GLdouble a0, GLdouble a1) { _pre_call_callback("glTexCoord2d", (void*)glad_debug_real_glTexCoord2d, 2, a0, a1); glad_debug_real_glTexCoord2d(a0, a1); _post_call_callback("glTexCoord2d", (void*)glad_debug_real_glTexCoord2d, 2, a0, a1); }
+static PFNGLTEXCOORD2DVPROC glad_debug_real_glTexCoord2dv;
+static void APIENTRY glad_debug_glTexCoord2dv(const GLdouble* a0) { _pre_call_callback("glTexCoord2dv", (void*)glad_debug_real_glTexCoord2dv, 1, a0); glad_debug_real_glTexCoord2dv(a0); _post_call_callback("glTexCoord2dv", (void*)glad_debug_real_glTexCoord2dv, 1, a0); }
+static PFNGLTEXCOORD2FPROC glad_debug_real_glTexCoord2f;
+static void APIENTRY glad_debug_glTexCoord2f(GLfloat a0, GLfloat a1) { _pre_call_callback("glTexCoord2f", (void*)glad_debug_real_glTexCoord2f, 2, a0, a1); glad_debug_real_glTexCoord2f(a0, a1); _post_call_callback("glTexCoord2f", (void*)glad_debug_real_glTexCoord2f, 2, a0, a1); }
+static PFNGLTEXCOORD2FVPROC glad_debug_real_glTexCoord2fv;
+static void APIENTRY glad_debug_glTexCoord2fv(const GLfloat* a0) { _pre_call_callback("glTexCoord2fv", (void*)glad_debug_real_glTexCoord2fv, 1, a0); glad_debug_real_glTexCoord2fv(a0); _post_call_callback("glTexCoord2fv", (void*)glad_debug_real_glTexCoord2fv, 1, a0); }
+static PFNGLTEXCOORD2IPROC glad_debug_real_glTexCoord2i;
+static void APIENTRY glad_debug_glTexCoord2i(GLint a0, GLint a1) { _pre_call_callback("glTexCoord2i", (void*)glad_debug_real_glTexCoord2i, 2, a0, a1); glad_debug_real_glTexCoord2i(a0, a1); _post_call_callback("glTexCoord2i", (void*)glad_debug_real_glTexCoord2i, 2, a0, a1); }
+static PFNGLTEXCOORD2IVPROC glad_debug_real_glTexCoord2iv;
+static void APIENTRY glad_debug_glTexCoord2iv(const GLint* a0) { _pre_call_callback("glTexCoord2iv", (void*)glad_debug_real_glTexCoord2iv, 1, a0); glad_debug_real_glTexCoord2iv(a0); _post_call_callback("glTexCoord2iv", (void*)glad_debug_real_glTexCoord2iv, 1, a0); }
+static PFNGLTEXCOORD2SPROC glad_debug_real_glTexCoord2s;
+static void APIENTRY glad_debug_glTexCoord2s(GLshort a0, GLshort a1) { _pre_call_callback("glTexCoord2s", (void*)glad_debug_real_glTexCoord2s, 2, a0, a1); glad_debug_real_glTexCoord2s(a0, a1); _post_call_callback("glTexCoord2s", (void*)glad_debug_real_glTexCoord2s, 2, a0, a1); }
+static PFNGLTEXCOORD2SVPROC glad_debug_real_glTexCoord2sv;
+static void APIENTRY glad_debug_glTexCoord2sv(const GLshort* a0) { _pre_call_callback("glTexCoord2sv", (void*)glad_debug_real_glTexCoord2sv, 1, a0); glad_debug_real_glTexCoord2sv(a0); _post_call_callback("glTexCoord2sv", (void*)glad_debug_real_glTexCoord2sv, 1, a0); }
+static PFNGLTEXCOORD3DPROC glad_debug_real_glTexCoord3d;
+static void APIENTRY glad_debug_glTexCoord3d(GLdouble a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glTexCoord3d", (void*)glad_debug_real_glTexCoord3d, 3, a0, a1, a2); glad_debug_real_glTexCoord3d(a0, a1, a2); _post_call_callback("glTexCoord3d", (void*)glad_debug_real_glTexCoord3d, 3, a0, a1, a2); }
+static PFNGLTEXCOORD3DVPROC glad_debug_real_glTexCoord3dv;
+static void APIENTRY glad_debug_glTexCoord3dv(const GLdouble* a0) { _pre_call_callback("glTexCoord3dv", (void*)glad_debug_real_glTexCoord3dv, 1, a0); glad_debug_real_glTexCoord3dv(a0); _post_call_callback("glTexCoord3dv", (void*)glad_debug_real_glTexCoord3dv, 1, a0); }
+static PFNGLTEXCOORD3FPROC glad_debug_real_glTexCoord3f;
+static void APIENTRY glad_debug_glTexCoord3f(GLfloat a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glTexCoord3f", (void*)glad_debug_real_glTexCoord3f, 3, a0, a1, a2); glad_debug_real_glTexCoord3f(a0, a1, a2); _post_call_callback("glTexCoord3f", (void*)glad_debug_real_glTexCoord3f, 3, a0, a1, a2); }
+static PFNGLTEXCOORD3FVPROC glad_debug_real_glTexCoord3fv;
+static void APIENTRY glad_debug_glTexCoord3fv(const GLfloat* a0) { _pre_call_callback("glTexCoord3fv", (void*)glad_debug_real_glTexCoord3fv, 1, a0); glad_debug_real_glTexCoord3fv(a0); _post_call_callback("glTexCoord3fv", (void*)glad_debug_real_glTexCoord3fv, 1, a0); }
+static PFNGLTEXCOORD3IPROC glad_debug_real_glTexCoord3i;
+static void APIENTRY glad_debug_glTexCoord3i(GLint a0, GLint a1, GLint a2) { _pre_call_callback("glTexCoord3i", (void*)glad_debug_real_glTexCoord3i, 3, a0, a1, a2); glad_debug_real_glTexCoord3i(a0, a1, a2); _post_call_callback("glTexCoord3i", (void*)glad_debug_real_glTexCoord3i, 3, a0, a1, a2); }
+static PFNGLTEXCOORD3IVPROC glad_debug_real_glTexCoord3iv;
+static void APIENTRY glad_debug_glTexCoord3iv(const GLint* a0) { _pre_call_callback("glTexCoord3iv", (void*)glad_debug_real_glTexCoord3iv, 1, a0); glad_debug_real_glTexCoord3iv(a0); _post_call_callback("glTexCoord3iv", (void*)glad_debug_real_glTexCoord3iv, 1, a0); }
+static PFNGLTEXCOORD3SPROC glad_debug_real_glTexCoord3s;
+static void APIENTRY glad_debug_glTexCoord3s(GLshort a0, GLshort a1, GLshort a2) { _pre_call_callback("glTexCoord3s", (void*)glad_debug_real_glTexCoord3s, 3, a0, a1, a2); glad_debug_real_glTexCoord3s(a0, a1, a2); _post_call_callback("glTexCoord3s", (void*)glad_debug_real_glTexCoord3s, 3, a0, a1, a2); }
+static PFNGLTEXCOORD3SVPROC glad_debug_real_glTexCoord3sv;
+static void APIENTRY glad_debug_glTexCoord3sv(const GLshort* a0) { _pre_call_callback("glTexCoord3sv", (void*)glad_debug_real_glTexCoord3sv, 1, a0); glad_debug_real_glTexCoord3sv(a0); _post_call_callback("glTexCoord3sv", (void*)glad_debug_real_glTexCoord3sv, 1, a0); }
+static PFNGLTEXCOORD4DPROC glad_debug_real_glTexCoord4d;
+static void APIENTRY glad_debug_glTexCoord4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { _pre_call_callback("glTexCoord4d", (void*)glad_debug_real_glTexCoord4d, 4, a0, a1, a2, a3); glad_debug_real_glTexCoord4d(a0, a1, a2, a3); _post_call_callback("glTexCoord4d", (void*)glad_debug_real_glTexCoord4d, 4, a0, a1, a2, a3); }
+static PFNGLTEXCOORD4DVPROC glad_debug_real_glTexCoord4dv;
+static void APIENTRY glad_debug_glTexCoord4dv(const GLdouble* a0) { _pre_call_callback("glTexCoord4dv", (void*)glad_debug_real_glTexCoord4dv, 1, a0); glad_debug_real_glTexCoord4dv(a0); _post_call_callback("glTexCoord4dv", (void*)glad_debug_real_glTexCoord4dv, 1, a0); }
+static PFNGLTEXCOORD4FPROC glad_debug_real_glTexCoord4f;
+static void APIENTRY glad_debug_glTexCoord4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glTexCoord4f", (void*)glad_debug_real_glTexCoord4f, 4, a0, a1, a2, a3); glad_debug_real_glTexCoord4f(a0, a1, a2, a3); _post_call_callback("glTexCoord4f", (void*)glad_debug_real_glTexCoord4f, 4, a0, a1, a2, a3); }
+static PFNGLTEXCOORD4FVPROC glad_debug_real_glTexCoord4fv;
+static void APIENTRY glad_debug_glTexCoord4fv(const GLfloat* a0) { _pre_call_callback("glTexCoord4fv", (void*)glad_debug_real_glTexCoord4fv, 1, a0); glad_debug_real_glTexCoord4fv(a0); _post_call_callback("glTexCoord4fv", (void*)glad_debug_real_glTexCoord4fv, 1, a0); }
+static PFNGLTEXCOORD4IPROC glad_debug_real_glTexCoord4i;
+static void APIENTRY glad_debug_glTexCoord4i(GLint a0, GLint a1, GLint a2, GLint a3) { _pre_call_callback("glTexCoord4i", (void*)glad_debug_real_glTexCoord4i, 4, a0, a1, a2, a3); glad_debug_real_glTexCoord4i(a0, a1, a2, a3); _post_call_callback("glTexCoord4i", (void*)glad_debug_real_glTexCoord4i, 4, a0, a1, a2, a3); }
+static PFNGLTEXCOORD4IVPROC glad_debug_real_glTexCoord4iv;
+static void APIENTRY glad_debug_glTexCoord4iv(const GLint* a0) { _pre_call_callback("glTexCoord4iv", (void*)glad_debug_real_glTexCoord4iv, 1, a0); glad_debug_real_glTexCoord4iv(a0); _post_call_callback("glTexCoord4iv", (void*)glad_debug_real_glTexCoord4iv, 1, a0); }
+static PFNGLTEXCOORD4SPROC glad_debug_real_glTexCoord4s;
+static void APIENTRY glad_debug_glTexCoord4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { _pre_call_callback("glTexCoord4s", (void*)glad_debug_real_glTexCoord4s, 4, a0, a1, a2, a3); glad_debug_real_glTexCoord4s(a0, a1, a2, a3); _post_call_callback("glTexCoord4s", (void*)glad_debug_real_glTexCoord4s, 4, a0, a1, a2, a3); }
+static PFNGLTEXCOORD4SVPROC glad_debug_real_glTexCoord4sv;
+static void APIENTRY glad_debug_glTexCoord4sv(const GLshort* a0) { _pre_call_callback("glTexCoord4sv", (void*)glad_debug_real_glTexCoord4sv, 1, a0); glad_debug_real_glTexCoord4sv(a0); _post_call_callback("glTexCoord4sv", (void*)glad_debug_real_glTexCoord4sv, 1, a0); }
+static PFNGLVERTEX2DPROC glad_debug_real_glVertex2d;
+static void APIENTRY glad_debug_glVertex2d(GLdouble a0, GLdouble a1) { _pre_call_callback("glVertex2d", (void*)glad_debug_real_glVertex2d, 2, a0, a1); glad_debug_real_glVertex2d(a0, a1); _post_call_callback("glVertex2d", (void*)glad_debug_real_glVertex2d, 2, a0, a1); }
+static PFNGLVERTEX2DVPROC glad_debug_real_glVertex2dv;
+static void APIENTRY glad_debug_glVertex2dv(const GLdouble* a0) { _pre_call_callback("glVertex2dv", (void*)glad_debug_real_glVertex2dv, 1, a0); glad_debug_real_glVertex2dv(a0); _post_call_callback("glVertex2dv", (void*)glad_debug_real_glVertex2dv, 1, a0); }
+static PFNGLVERTEX2FPROC glad_debug_real_glVertex2f;
+static void APIENTRY glad_debug_glVertex2f(GLfloat a0, GLfloat a1) { _pre_call_callback("glVertex2f", (void*)glad_debug_real_glVertex2f, 2, a0, a1); glad_debug_real_glVertex2f(a0, a1); _post_call_callback("glVertex2f", (void*)glad_debug_real_glVertex2f, 2, a0, a1); }
+static PFNGLVERTEX2FVPROC glad_debug_real_glVertex2fv;
+static void APIENTRY glad_debug_glVertex2fv(const GLfloat* a0) { _pre_call_callback("glVertex2fv", (void*)glad_debug_real_glVertex2fv, 1, a0); glad_debug_real_glVertex2fv(a0); _post_call_callback("glVertex2fv", (void*)glad_debug_real_glVertex2fv, 1, a0); }
+static PFNGLVERTEX2IPROC glad_debug_real_glVertex2i;
+static void APIENTRY glad_debug_glVertex2i(GLint a0, GLint a1) { _pre_call_callback("glVertex2i", (void*)glad_debug_real_glVertex2i, 2, a0, a1); glad_debug_real_glVertex2i(a0, a1); _post_call_callback("glVertex2i", (void*)glad_debug_real_glVertex2i, 2, a0, a1); }
+static PFNGLVERTEX2IVPROC glad_debug_real_glVertex2iv;
+static void APIENTRY glad_debug_glVertex2iv(const GLint* a0) { _pre_call_callback("glVertex2iv", (void*)glad_debug_real_glVertex2iv, 1, a0); glad_debug_real_glVertex2iv(a0); _post_call_callback("glVertex2iv", (void*)glad_debug_real_glVertex2iv, 1, a0); }
+static PFNGLVERTEX2SPROC glad_debug_real_glVertex2s;
+static void APIENTRY glad_debug_glVertex2s(GLshort a0, GLshort a1) { _pre_call_callback("glVertex2s", (void*)glad_debug_real_glVertex2s, 2, a0, a1); glad_debug_real_glVertex2s(a0, a1); _post_call_callback("glVertex2s", (void*)glad_debug_real_glVertex2s, 2, a0, a1); }
+static PFNGLVERTEX2SVPROC glad_debug_real_glVertex2sv;
+static void APIENTRY glad_debug_glVertex2sv(const GLshort* a0) { _pre_call_callback("glVertex2sv", (void*)glad_debug_real_glVertex2sv, 1, a0); glad_debug_real_glVertex2sv(a0); _post_call_callback("glVertex2sv", (void*)glad_debug_real_glVertex2sv, 1, a0); }
+static PFNGLVERTEX3DPROC glad_debug_real_glVertex3d;
+static void APIENTRY glad_debug_glVertex3d(GLdouble a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glVertex3d", (void*)glad_debug_real_glVertex3d, 3, a0, a1, a2); glad_debug_real_glVertex3d(a0, a1, a2); _post_call_callback("glVertex3d", (void*)glad_debug_real_glVertex3d, 3, a0, a1, a2); }
+static PFNGLVERTEX3DVPROC glad_debug_real_glVertex3dv;
+static void APIENTRY glad_debug_glVertex3dv(const GLdouble* a0) { _pre_call_callback("glVertex3dv", (void*)glad_debug_real_glVertex3dv, 1, a0); glad_debug_real_glVertex3dv(a0); _post_call_callback("glVertex3dv", (void*)glad_debug_real_glVertex3dv, 1, a0); }
+static PFNGLVERTEX3FPROC glad_debug_real_glVertex3f;
+static void APIENTRY glad_debug_glVertex3f(GLfloat a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glVertex3f", (void*)glad_debug_real_glVertex3f, 3, a0, a1, a2); glad_debug_real_glVertex3f(a0, a1, a2); _post_call_callback("glVertex3f", (void*)glad_debug_real_glVertex3f, 3, a0, a1, a2); }
+static PFNGLVERTEX3FVPROC glad_debug_real_glVertex3fv;
+static void APIENTRY glad_debug_glVertex3fv(const GLfloat* a0) { _pre_call_callback("glVertex3fv", (void*)glad_debug_real_glVertex3fv, 1, a0); glad_debug_real_glVertex3fv(a0); _post_call_callback("glVertex3fv", (void*)glad_debug_real_glVertex3fv, 1, a0); }
+static PFNGLVERTEX3IPROC glad_debug_real_glVertex3i;
+static void APIENTRY glad_debug_glVertex3i(GLint a0, GLint a1, GLint a2) { _pre_call_callback("glVertex3i", (void*)glad_debug_real_glVertex3i, 3, a0, a1, a2); glad_debug_real_glVertex3i(a0, a1, a2); _post_call_callback("glVertex3i", (void*)glad_debug_real_glVertex3i, 3, a0, a1, a2); }
+static PFNGLVERTEX3IVPROC glad_debug_real_glVertex3iv;
+static void APIENTRY glad_debug_glVertex3iv(const GLint* a0) { _pre_call_callback("glVertex3iv", (void*)glad_debug_real_glVertex3iv, 1, a0); glad_debug_real_glVertex3iv(a0); _post_call_callback("glVertex3iv", (void*)glad_debug_real_glVertex3iv, 1, a0); }
+static PFNGLVERTEX3SPROC glad_debug_real_glVertex3s;
+static void APIENTRY glad_debug_glVertex3s(GLshort a0, GLshort a1, GLshort a2) { _pre_call_callback("glVertex3s", (void*)glad_debug_real_glVertex3s, 3, a0, a1, a2); glad_debug_real_glVertex3s(a0, a1, a2); _post_call_callback("glVertex3s", (void*)glad_debug_real_glVertex3s, 3, a0, a1, a2); }
+static PFNGLVERTEX3SVPROC glad_debug_real_glVertex3sv;
+static void APIENTRY glad_debug_glVertex3sv(const GLshort* a0) { _pre_call_callback("glVertex3sv", (void*)glad_debug_real_glVertex3sv, 1, a0); glad_debug_real_glVertex3sv(a0); _post_call_callback("glVertex3sv", (void*)glad_debug_real_glVertex3sv, 1, a0); }
+static PFNGLVERTEX4DPROC glad_debug_real_glVertex4d;
+static void APIENTRY glad_debug_glVertex4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { _pre_call_callback("glVertex4d", (void*)glad_debug_real_glVertex4d, 4, a0, a1, a2, a3); glad_debug_real_glVertex4d(a0, a1, a2, a3); _post_call_callback("glVertex4d", (void*)glad_debug_real_glVertex4d, 4, a0, a1, a2, a3); }
+static PFNGLVERTEX4DVPROC glad_debug_real_glVertex4dv;
+static void APIENTRY glad_debug_glVertex4dv(const GLdouble* a0) { _pre_call_callback("glVertex4dv", (void*)glad_debug_real_glVertex4dv, 1, a0); glad_debug_real_glVertex4dv(a0); _post_call_callback("glVertex4dv", (void*)glad_debug_real_glVertex4dv, 1, a0); }
+static PFNGLVERTEX4FPROC glad_debug_real_glVertex4f;
+static void APIENTRY glad_debug_glVertex4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glVertex4f", (void*)glad_debug_real_glVertex4f, 4, a0, a1, a2, a3); glad_debug_real_glVertex4f(a0, a1, a2, a3); _post_call_callback("glVertex4f", (void*)glad_debug_real_glVertex4f, 4, a0, a1, a2, a3); }
+static PFNGLVERTEX4FVPROC glad_debug_real_glVertex4fv;
+static void APIENTRY glad_debug_glVertex4fv(const GLfloat* a0) { _pre_call_callback("glVertex4fv", (void*)glad_debug_real_glVertex4fv, 1, a0); glad_debug_real_glVertex4fv(a0); _post_call_callback("glVertex4fv", (void*)glad_debug_real_glVertex4fv, 1, a0); }
+static PFNGLVERTEX4IPROC glad_debug_real_glVertex4i;
+static void APIENTRY glad_debug_glVertex4i(GLint a0, GLint a1, GLint a2, GLint a3) { _pre_call_callback("glVertex4i", (void*)glad_debug_real_glVertex4i, 4, a0, a1, a2, a3); glad_debug_real_glVertex4i(a0, a1, a2, a3); _post_call_callback("glVertex4i", (void*)glad_debug_real_glVertex4i, 4, a0, a1, a2, a3); }
+static PFNGLVERTEX4IVPROC glad_debug_real_glVertex4iv;
+static void APIENTRY glad_debug_glVertex4iv(const GLint* a0) { _pre_call_callback("glVertex4iv", (void*)glad_debug_real_glVertex4iv, 1, a0); glad_debug_real_glVertex4iv(a0); _post_call_callback("glVertex4iv", (void*)glad_debug_real_glVertex4iv, 1, a0); }
+static PFNGLVERTEX4SPROC glad_debug_real_glVertex4s;
+static void APIENTRY glad_debug_glVertex4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { _pre_call_callback("glVertex4s", (void*)glad_debug_real_glVertex4s, 4, a0, a1, a2, a3); glad_debug_real_glVertex4s(a0, a1, a2, a3); _post_call_callback("glVertex4s", (void*)glad_debug_real_glVertex4s, 4, a0, a1, a2, a3); }
+static PFNGLVERTEX4SVPROC glad_debug_real_glVertex4sv;
+static void APIENTRY glad_debug_glVertex4sv(const GLshort* a0) { _pre_call_callback("glVertex4sv", (void*)glad_debug_real_glVertex4sv, 1, a0); glad_debug_real_glVertex4sv(a0); _post_call_callback("glVertex4sv", (void*)glad_debug_real_glVertex4sv, 1, a0); }
+static PFNGLCLIPPLANEPROC glad_debug_real_glClipPlane;
+static void APIENTRY glad_debug_glClipPlane(GLenum a0, const GLdouble* a1) { _pre_call_callback("glClipPlane", (void*)glad_debug_real_glClipPlane, 2, a0, a1); glad_debug_real_glClipPlane(a0, a1); _post_call_callback("glClipPlane", (void*)glad_debug_real_glClipPlane, 2, a0, a1); }
+static PFNGLCOLORMATERIALPROC glad_debug_real_glColorMaterial;
+static void APIENTRY glad_debug_glColorMaterial(GLenum a0, GLenum a1) { _pre_call_callback("glColorMaterial", (void*)glad_debug_real_glColorMaterial, 2, a0, a1); glad_debug_real_glColorMaterial(a0, a1); _post_call_callback("glColorMaterial", (void*)glad_debug_real_glColorMaterial, 2, a0, a1); }
+static PFNGLFOGFPROC glad_debug_real_glFogf;
+static void APIENTRY glad_debug_glFogf(GLenum a0, GLfloat a1) { _pre_call_callback("glFogf", (void*)glad_debug_real_glFogf, 2, a0, a1); glad_debug_real_glFogf(a0, a1); _post_call_callback("glFogf", (void*)glad_debug_real_glFogf, 2, a0, a1); }
+static PFNGLFOGFVPROC glad_debug_real_glFogfv;
+static void APIENTRY glad_debug_glFogfv(GLenum a0, const GLfloat* a1) { _pre_call_callback("glFogfv", (void*)glad_debug_real_glFogfv, 2, a0, a1); glad_debug_real_glFogfv(a0, a1); _post_call_callback("glFogfv", (void*)glad_debug_real_glFogfv, 2, a0, a1); }
+static PFNGLFOGIPROC glad_debug_real_glFogi;
+static void APIENTRY glad_debug_glFogi(GLenum a0, GLint a1) { _pre_call_callback("glFogi", (void*)glad_debug_real_glFogi, 2, a0, a1); glad_debug_real_glFogi(a0, a1); _post_call_callback("glFogi", (void*)glad_debug_real_glFogi, 2, a0, a1); }
+static PFNGLFOGIVPROC glad_debug_real_glFogiv;
+static void APIENTRY glad_debug_glFogiv(GLenum a0, const GLint* a1) { _pre_call_callback("glFogiv", (void*)glad_debug_real_glFogiv, 2, a0, a1); glad_debug_real_glFogiv(a0, a1); _post_call_callback("glFogiv", (void*)glad_debug_real_glFogiv, 2, a0, a1); }
+static PFNGLLIGHTFPROC glad_debug_real_glLightf;
+static void APIENTRY glad_debug_glLightf(GLenum a0, GLenum a1, GLfloat a2) { _pre_call_callback("glLightf", (void*)glad_debug_real_glLightf, 3, a0, a1, a2); glad_debug_real_glLightf(a0, a1, a2); _post_call_callback("glLightf", (void*)glad_debug_real_glLightf, 3, a0, a1, a2); }
+static PFNGLLIGHTFVPROC glad_debug_real_glLightfv;
+static void APIENTRY glad_debug_glLightfv(GLenum a0, GLenum a1, const GLfloat* a2) { _pre_call_callback("glLightfv", (void*)glad_debug_real_glLightfv, 3, a0, a1, a2); glad_debug_real_glLightfv(a0, a1, a2); _post_call_callback("glLightfv", (void*)glad_debug_real_glLightfv, 3, a0, a1, a2); }
+static PFNGLLIGHTIPROC glad_debug_real_glLighti;
+static void APIENTRY glad_debug_glLighti(GLenum a0, GLenum a1, GLint a2) { _pre_call_callback("glLighti", (void*)glad_debug_real_glLighti, 3, a0, a1, a2); glad_debug_real_glLighti(a0, a1, a2); _post_call_callback("glLighti", (void*)glad_debug_real_glLighti, 3, a0, a1, a2); }
+static PFNGLLIGHTIVPROC glad_debug_real_glLightiv;
+static void APIENTRY glad_debug_glLightiv(GLenum a0, GLenum a1, const GLint* a2) { _pre_call_callback("glLightiv", (void*)glad_debug_real_glLightiv, 3, a0, a1, a2); glad_debug_real_glLightiv(a0, a1, a2); _post_call_callback("glLightiv", (void*)glad_debug_real_glLightiv, 3, a0, a1, a2); }
+static PFNGLLIGHTMODELFPROC glad_debug_real_glLightModelf;
+static void APIENTRY glad_debug_glLightModelf(GLenum a0, GLfloat a1) { _pre_call_callback("glLightModelf", (void*)glad_debug_real_glLightModelf, 2, a0, a1); glad_debug_real_glLightModelf(a0, a1); _post_call_callback("glLightModelf", (void*)glad_debug_real_glLightModelf, 2, a0, a1); }
+static PFNGLLIGHTMODELFVPROC glad_debug_real_glLightModelfv;
+static void APIENTRY glad_debug_glLightModelfv(GLenum a0, const GLfloat* a1) { _pre_call_callback("glLightModelfv", (void*)glad_debug_real_glLightModelfv, 2, a0, a1); glad_debug_real_glLightModelfv(a0, a1); _post_call_callback("glLightModelfv", (void*)glad_debug_real_glLightModelfv, 2, a0, a1); }
+static PFNGLLIGHTMODELIPROC glad_debug_real_glLightModeli;
+static void APIENTRY glad_debug_glLightModeli(GLenum a0, GLint a1) { _pre_call_callback("glLightModeli", (void*)glad_debug_real_glLightModeli, 2, a0, a1); glad_debug_real_glLightModeli(a0, a1); _post_call_callback("glLightModeli", (void*)glad_debug_real_glLightModeli, 2, a0, a1); }
+static PFNGLLIGHTMODELIVPROC glad_debug_real_glLightModeliv;
+static void APIENTRY glad_debug_glLightModeliv(GLenum a0, const GLint* a1) { _pre_call_callback("glLightModeliv", (void*)glad_debug_real_glLightModeliv, 2, a0, a1); glad_debug_real_glLightModeliv(a0, a1); _post_call_callback("glLightModeliv", (void*)glad_debug_real_glLightModeliv, 2, a0, a1); }
+static PFNGLLINESTIPPLEPROC glad_debug_real_glLineStipple;
+static void APIENTRY glad_debug_glLineStipple(GLint a0, GLushort a1) { _pre_call_callback("glLineStipple", (void*)glad_debug_real_glLineStipple, 2, a0, a1); glad_debug_real_glLineStipple(a0, a1); _post_call_callback("glLineStipple", (void*)glad_debug_real_glLineStipple, 2, a0, a1); }
+static PFNGLMATERIALFPROC glad_debug_real_glMaterialf;
+static void APIENTRY glad_debug_glMaterialf(GLenum a0, GLenum a1, GLfloat a2) { _pre_call_callback("glMaterialf", (void*)glad_debug_real_glMaterialf, 3, a0, a1, a2); glad_debug_real_glMaterialf(a0, a1, a2); _post_call_callback("glMaterialf", (void*)glad_debug_real_glMaterialf, 3, a0, a1, a2); }
+static PFNGLMATERIALFVPROC glad_debug_real_glMaterialfv;
+static void APIENTRY glad_debug_glMaterialfv(GLenum a0, GLenum a1, const GLfloat* a2) { _pre_call_callback("glMaterialfv", (void*)glad_debug_real_glMaterialfv, 3, a0, a1, a2); glad_debug_real_glMaterialfv(a0, a1, a2); _post_call_callback("glMaterialfv", (void*)glad_debug_real_glMaterialfv, 3, a0, a1, a2); }
+static PFNGLMATERIALIPROC glad_debug_real_glMateriali;
+static void APIENTRY glad_debug_glMateriali(GLenum a0, GLenum a1, GLint a2) { _pre_call_callback("glMateriali", (void*)glad_debug_real_glMateriali, 3, a0, a1, a2); glad_debug_real_glMateriali(a0, a1, a2); _post_call_callback("glMateriali", (void*)glad_debug_real_glMateriali, 3, a0, a1, a2); }
+static PFNGLMATERIALIVPROC glad_debug_real_glMaterialiv;
+static void APIENTRY glad_debug_glMaterialiv(GLenum a0, GLenum a1, const GLint* a2) { _pre_call_callback("glMaterialiv", (void*)glad_debug_real_glMaterialiv, 3, a0, a1, a2); glad_debug_real_glMaterialiv(a0, a1, a2); _post_call_callback("glMaterialiv", (void*)glad_debug_real_glMaterialiv, 3, a0, a1, a2); }
+static PFNGLPOLYGONSTIPPLEPROC glad_debug_real_glPolygonStipple;
+static void APIENTRY glad_debug_glPolygonStipple(const GLubyte* a0) { _pre_call_callback("glPolygonStipple", (void*)glad_debug_real_glPolygonStipple, 1, a0); glad_debug_real_glPolygonStipple(a0); _post_call_callback("glPolygonStipple", (void*)glad_debug_real_glPolygonStipple, 1, a0); }
+static PFNGLSHADEMODELPROC glad_debug_real_glShadeModel;
+static void APIENTRY glad_debug_glShadeModel(GLenum a0) { _pre_call_callback("glShadeModel", (void*)glad_debug_real_glShadeModel, 1, a0); glad_debug_real_glShadeModel(a0); _post_call_callback("glShadeModel", (void*)glad_debug_real_glShadeModel, 1, a0); }
+static PFNGLTEXENVFPROC glad_debug_real_glTexEnvf;
+static void APIENTRY glad_debug_glTexEnvf(GLenum a0, GLenum a1, GLfloat a2) { _pre_call_callback("glTexEnvf", (void*)glad_debug_real_glTexEnvf, 3, a0, a1, a2); glad_debug_real_glTexEnvf(a0, a1, a2); _post_call_callback("glTexEnvf", (void*)glad_debug_real_glTexEnvf, 3, a0, a1, a2); }
+static PFNGLTEXENVFVPROC glad_debug_real_glTexEnvfv;
+static void APIENTRY glad_debug_glTexEnvfv(GLenum a0, GLenum a1, const GLfloat* a2) { _pre_call_callback("glTexEnvfv", (void*)glad_debug_real_glTexEnvfv, 3, a0, a1, a2); glad_debug_real_glTexEnvfv(a0, a1, a2); _post_call_callback("glTexEnvfv", (void*)glad_debug_real_glTexEnvfv, 3, a0, a1, a2); }
+static PFNGLTEXENVIPROC glad_debug_real_glTexEnvi;
+static void APIENTRY glad_debug_glTexEnvi(GLenum a0, GLenum a1, GLint a2) { _pre_call_callback("glTexEnvi", (void*)glad_debug_real_glTexEnvi, 3, a0, a1, a2); glad_debug_real_glTexEnvi(a0, a1, a2); _post_call_callback("glTexEnvi", (void*)glad_debug_real_glTexEnvi, 3, a0, a1, a2); }
+static PFNGLTEXENVIVPROC glad_debug_real_glTexEnviv;
+static void APIENTRY glad_debug_glTexEnviv(GLenum a0, GLenum a1, const GLint* a2) { _pre_call_callback("glTexEnviv", (void*)glad_debug_real_glTexEnviv, 3, a0, a1, a2); glad_debug_real_glTexEnviv(a0, a1, a2); _post_call_callback("glTexEnviv", (void*)glad_debug_real_glTexEnviv, 3, a0, a1, a2); }
+static PFNGLTEXGENDPROC glad_debug_real_glTexGend;
+static void APIENTRY glad_debug_glTexGend(GLenum a0, GLenum a1, GLdouble a2) { _pre_call_callback("glTexGend", (void*)glad_debug_real_glTexGend, 3, a0, a1, a2); glad_debug_real_glTexGend(a0, a1, a2); _post_call_callback("glTexGend", (void*)glad_debug_real_glTexGend, 3, a0, a1, a2); }
+static PFNGLTEXGENDVPROC glad_debug_real_glTexGendv;
+static void APIENTRY glad_debug_glTexGendv(GLenum a0, GLenum a1, const GLdouble* a2) { _pre_call_callback("glTexGendv", (void*)glad_debug_real_glTexGendv, 3, a0, a1, a2); glad_debug_real_glTexGendv(a0, a1, a2); _post_call_callback("glTexGendv", (void*)glad_debug_real_glTexGendv, 3, a0, a1, a2); }
+static PFNGLTEXGENFPROC glad_debug_real_glTexGenf;
+static void APIENTRY glad_debug_glTexGenf(GLenum a0, GLenum a1, GLfloat a2) { _pre_call_callback("glTexGenf", (void*)glad_debug_real_glTexGenf, 3, a0, a1, a2); glad_debug_real_glTexGenf(a0, a1, a2); _post_call_callback("glTexGenf", (void*)glad_debug_real_glTexGenf, 3, a0, a1, a2); }
+static PFNGLTEXGENFVPROC glad_debug_real_glTexGenfv;
+static void APIENTRY glad_debug_glTexGenfv(GLenum a0, GLenum a1, const GLfloat* a2) { _pre_call_callback("glTexGenfv", (void*)glad_debug_real_glTexGenfv, 3, a0, a1, a2); glad_debug_real_glTexGenfv(a0, a1, a2); _post_call_callback("glTexGenfv", (void*)glad_debug_real_glTexGenfv, 3, a0, a1, a2); }
+static PFNGLTEXGENIPROC glad_debug_real_glTexGeni;
+static void APIENTRY glad_debug_glTexGeni(GLenum a0, GLenum a1, GLint a2) { _pre_call_callback("glTexGeni", (void*)glad_debug_real_glTexGeni, 3, a0, a1, a2); glad_debug_real_glTexGeni(a0, a1, a2); _post_call_callback("glTexGeni", (void*)glad_debug_real_glTexGeni, 3, a0, a1, a2); }
+static PFNGLTEXGENIVPROC glad_debug_real_glTexGeniv;
+static void APIENTRY glad_debug_glTexGeniv(GLenum a0, GLenum a1, const GLint* a2) { _pre_call_callback("glTexGeniv", (void*)glad_debug_real_glTexGeniv, 3, a0, a1, a2); glad_debug_real_glTexGeniv(a0, a1, a2); _post_call_callback("glTexGeniv", (void*)glad_debug_real_glTexGeniv, 3, a0, a1, a2); }
+static PFNGLFEEDBACKBUFFERPROC glad_debug_real_glFeedbackBuffer;
+static void APIENTRY glad_debug_glFeedbackBuffer(GLsizei a0, GLenum a1, GLfloat* a2) { _pre_call_callback("glFeedbackBuffer", (void*)glad_debug_real_glFeedbackBuffer, 3, a0, a1, a2); glad_debug_real_glFeedbackBuffer(a0, a1, a2); _post_call_callback("glFeedbackBuffer", (void*)glad_debug_real_glFeedbackBuffer, 3, a0, a1, a2); }
+static PFNGLSELECTBUFFERPROC glad_debug_real_glSelectBuffer;
+static void APIENTRY glad_debug_glSelectBuffer(GLsizei a0, GLuint* a1) { _pre_call_callback("glSelectBuffer", (void*)glad_debug_real_glSelectBuffer, 2, a0, a1); glad_debug_real_glSelectBuffer(a0, a1); _post_call_callback("glSelectBuffer", (void*)glad_debug_real_glSelectBuffer, 2, a0, a1); }
+static PFNGLRENDERMODEPROC glad_debug_real_glRenderMode;
+static GLint APIENTRY glad_debug_glRenderMode(GLenum a0) { GLint ret; _pre_call_callback("glRenderMode", (void*)glad_debug_real_glRenderMode, 1, a0); ret = glad_debug_real_glRenderMode(a0); _post_call_callback("glRenderMode", (void*)glad_debug_real_glRenderMode, 1, a0); return ret; }
+static PFNGLINITNAMESPROC glad_debug_real_glInitNames;
+static void APIENTRY glad_debug_glInitNames() { _pre_call_callback("glInitNames", (void*)glad_debug_real_glInitNames, 0); glad_debug_real_glInitNames(); _post_call_callback("glInitNames", (void*)glad_debug_real_glInitNames, 0); }
+static PFNGLLOADNAMEPROC glad_debug_real_glLoadName;
+static void APIENTRY glad_debug_glLoadName(GLuint a0) { _pre_call_callback("glLoadName", (void*)glad_debug_real_glLoadName, 1, a0); glad_debug_real_glLoadName(a0); _post_call_callback("glLoadName", (void*)glad_debug_real_glLoadName, 1, a0); }
+static PFNGLPASSTHROUGHPROC glad_debug_real_glPassThrough;
+static void APIENTRY glad_debug_glPassThrough(GLfloat a0) { _pre_call_callback("glPassThrough", (void*)glad_debug_real_glPassThrough, 1, a0); glad_debug_real_glPassThrough(a0); _post_call_callback("glPassThrough", (void*)glad_debug_real_glPassThrough, 1, a0); }
+static PFNGLPOPNAMEPROC glad_debug_real_glPopName;
+static void APIENTRY glad_debug_glPopName() { _pre_call_callback("glPopName", (void*)glad_debug_real_glPopName, 0); glad_debug_real_glPopName(); _post_call_callback("glPopName", (void*)glad_debug_real_glPopName, 0); }
+static PFNGLPUSHNAMEPROC glad_debug_real_glPushName;
+static void APIENTRY glad_debug_glPushName(GLuint a0) { _pre_call_callback("glPushName", (void*)glad_debug_real_glPushName, 1, a0); glad_debug_real_glPushName(a0); _post_call_callback("glPushName", (void*)glad_debug_real_glPushName, 1, a0); }
+static PFNGLCLEARACCUMPROC glad_debug_real_glClearAccum;
+static void APIENTRY glad_debug_glClearAccum(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glClearAccum", (void*)glad_debug_real_glClearAccum, 4, a0, a1, a2, a3); glad_debug_real_glClearAccum(a0, a1, a2, a3); _post_call_callback("glClearAccum", (void*)glad_debug_real_glClearAccum, 4, a0, a1, a2, a3); }
+static PFNGLCLEARINDEXPROC glad_debug_real_glClearIndex;
+static void APIENTRY glad_debug_glClearIndex(GLfloat a0) { _pre_call_callback("glClearIndex", (void*)glad_debug_real_glClearIndex, 1, a0); glad_debug_real_glClearIndex(a0); _post_call_callback("glClearIndex", (void*)glad_debug_real_glClearIndex, 1, a0); }
+static PFNGLINDEXMASKPROC glad_debug_real_glIndexMask;
+static void APIENTRY glad_debug_glIndexMask(GLuint a0) { _pre_call_callback("glIndexMask", (void*)glad_debug_real_glIndexMask, 1, a0); glad_debug_real_glIndexMask(a0); _post_call_callback("glIndexMask", (void*)glad_debug_real_glIndexMask, 1, a0); }
+static PFNGLACCUMPROC glad_debug_real_glAccum;
+static void APIENTRY glad_debug_glAccum(GLenum a0, GLfloat a1) { _pre_call_callback("glAccum", (void*)glad_debug_real_glAccum, 2, a0, a1); glad_debug_real_glAccum(a0, a1); _post_call_callback("glAccum", (void*)glad_debug_real_glAccum, 2, a0, a1); }
+static PFNGLPOPATTRIBPROC glad_debug_real_glPopAttrib;
+static void APIENTRY glad_debug_glPopAttrib() { _pre_call_callback("glPopAttrib", (void*)glad_debug_real_glPopAttrib, 0); glad_debug_real_glPopAttrib(); _post_call_callback("glPopAttrib", (void*)glad_debug_real_glPopAttrib, 0); }
+static PFNGLPUSHATTRIBPROC glad_debug_real_glPushAttrib;
+static void APIENTRY glad_debug_glPushAttrib(GLbitfield a0) { _pre_call_callback("glPushAttrib", (void*)glad_debug_real_glPushAttrib, 1, a0); glad_debug_real_glPushAttrib(a0); _post_call_callback("glPushAttrib", (void*)glad_debug_real_glPushAttrib, 1, a0); }
+static PFNGLMAP1DPROC glad_debug_real_glMap1d;
+static void APIENTRY glad_debug_glMap1d(GLenum a0, GLdouble a1, GLdouble a2, GLint a3, GLint a4, const GLdouble* a5) { _pre_call_callback("glMap1d", (void*)glad_debug_real_glMap1d, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glMap1d(a0, a1, a2, a3, a4, a5); _post_call_callback("glMap1d", (void*)glad_debug_real_glMap1d, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLMAP1FPROC glad_debug_real_glMap1f;
+static void APIENTRY glad_debug_glMap1f(GLenum a0, GLfloat a1, GLfloat a2, GLint a3, GLint a4, const GLfloat* a5) { _pre_call_callback("glMap1f", (void*)glad_debug_real_glMap1f, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glMap1f(a0, a1, a2, a3, a4, a5); _post_call_callback("glMap1f", (void*)glad_debug_real_glMap1f, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLMAP2DPROC glad_debug_real_glMap2d;
+static void APIENTRY glad_debug_glMap2d(GLenum a0, GLdouble a1, GLdouble a2, GLint a3, GLint a4, GLdouble a5, GLdouble a6, GLint a7, GLint a8, const GLdouble* a9) { _pre_call_callback("glMap2d", (void*)glad_debug_real_glMap2d, 10, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); glad_debug_real_glMap2d(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); _post_call_callback("glMap2d", (void*)glad_debug_real_glMap2d, 10, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static PFNGLMAP2FPROC glad_debug_real_glMap2f;
+static void APIENTRY glad_debug_glMap2f(GLenum a0, GLfloat a1, GLfloat a2, GLint a3, GLint a4, GLfloat a5, GLfloat a6, GLint a7, GLint a8, const GLfloat* a9) { _pre_call_callback("glMap2f", (void*)glad_debug_real_glMap2f, 10, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); glad_debug_real_glMap2f(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); _post_call_callback("glMap2f", (void*)glad_debug_real_glMap2f, 10, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static PFNGLMAPGRID1DPROC glad_debug_real_glMapGrid1d;
+static void APIENTRY glad_debug_glMapGrid1d(GLint a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glMapGrid1d", (void*)glad_debug_real_glMapGrid1d, 3, a0, a1, a2); glad_debug_real_glMapGrid1d(a0, a1, a2); _post_call_callback("glMapGrid1d", (void*)glad_debug_real_glMapGrid1d, 3, a0, a1, a2); }
+static PFNGLMAPGRID1FPROC glad_debug_real_glMapGrid1f;
+static void APIENTRY glad_debug_glMapGrid1f(GLint a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glMapGrid1f", (void*)glad_debug_real_glMapGrid1f, 3, a0, a1, a2); glad_debug_real_glMapGrid1f(a0, a1, a2); _post_call_callback("glMapGrid1f", (void*)glad_debug_real_glMapGrid1f, 3, a0, a1, a2); }
+static PFNGLMAPGRID2DPROC glad_debug_real_glMapGrid2d;
+static void APIENTRY glad_debug_glMapGrid2d(GLint a0, GLdouble a1, GLdouble a2, GLint a3, GLdouble a4, GLdouble a5) { _pre_call_callback("glMapGrid2d", (void*)glad_debug_real_glMapGrid2d, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glMapGrid2d(a0, a1, a2, a3, a4, a5); _post_call_callback("glMapGrid2d", (void*)glad_debug_real_glMapGrid2d, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLMAPGRID2FPROC glad_debug_real_glMapGrid2f;
+static void APIENTRY glad_debug_glMapGrid2f(GLint a0, GLfloat a1, GLfloat a2, GLint a3, GLfloat a4, GLfloat a5) { _pre_call_callback("glMapGrid2f", (void*)glad_debug_real_glMapGrid2f, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glMapGrid2f(a0, a1, a2, a3, a4, a5); _post_call_callback("glMapGrid2f", (void*)glad_debug_real_glMapGrid2f, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLEVALCOORD1DPROC glad_debug_real_glEvalCoord1d;
+static void APIENTRY glad_debug_glEvalCoord1d(GLdouble a0) { _pre_call_callback("glEvalCoord1d", (void*)glad_debug_real_glEvalCoord1d, 1, a0); glad_debug_real_glEvalCoord1d(a0); _post_call_callback("glEvalCoord1d", (void*)glad_debug_real_glEvalCoord1d, 1, a0); }
+static PFNGLEVALCOORD1DVPROC glad_debug_real_glEvalCoord1dv;
+static void APIENTRY glad_debug_glEvalCoord1dv(const GLdouble* a0) { _pre_call_callback("glEvalCoord1dv", (void*)glad_debug_real_glEvalCoord1dv, 1, a0); glad_debug_real_glEvalCoord1dv(a0); _post_call_callback("glEvalCoord1dv", (void*)glad_debug_real_glEvalCoord1dv, 1, a0); }
+static PFNGLEVALCOORD1FPROC glad_debug_real_glEvalCoord1f;
+static void APIENTRY glad_debug_glEvalCoord1f(GLfloat a0) { _pre_call_callback("glEvalCoord1f", (void*)glad_debug_real_glEvalCoord1f, 1, a0); glad_debug_real_glEvalCoord1f(a0); _post_call_callback("glEvalCoord1f", (void*)glad_debug_real_glEvalCoord1f, 1, a0); }
+static PFNGLEVALCOORD1FVPROC glad_debug_real_glEvalCoord1fv;
+static void APIENTRY glad_debug_glEvalCoord1fv(const GLfloat* a0) { _pre_call_callback("glEvalCoord1fv", (void*)glad_debug_real_glEvalCoord1fv, 1, a0); glad_debug_real_glEvalCoord1fv(a0); _post_call_callback("glEvalCoord1fv", (void*)glad_debug_real_glEvalCoord1fv, 1, a0); }
+static PFNGLEVALCOORD2DPROC glad_debug_real_glEvalCoord2d;
+static void APIENTRY glad_debug_glEvalCoord2d(GLdouble a0, GLdouble a1) { _pre_call_callback("glEvalCoord2d", (void*)glad_debug_real_glEvalCoord2d, 2, a0, a1); glad_debug_real_glEvalCoord2d(a0, a1); _post_call_callback("glEvalCoord2d", (void*)glad_debug_real_glEvalCoord2d, 2, a0, a1); }
+static PFNGLEVALCOORD2DVPROC glad_debug_real_glEvalCoord2dv;
+static void APIENTRY glad_debug_glEvalCoord2dv(const GLdouble* a0) { _pre_call_callback("glEvalCoord2dv", (void*)glad_debug_real_glEvalCoord2dv, 1, a0); glad_debug_real_glEvalCoord2dv(a0); _post_call_callback("glEvalCoord2dv", (void*)glad_debug_real_glEvalCoord2dv, 1, a0); }
+static PFNGLEVALCOORD2FPROC glad_debug_real_glEvalCoord2f;
+static void APIENTRY glad_debug_glEvalCoord2f(GLfloat a0, GLfloat a1) { _pre_call_callback("glEvalCoord2f", (void*)glad_debug_real_glEvalCoord2f, 2, a0, a1); glad_debug_real_glEvalCoord2f(a0, a1); _post_call_callback("glEvalCoord2f", (void*)glad_debug_real_glEvalCoord2f, 2, a0, a1); }
+static PFNGLEVALCOORD2FVPROC glad_debug_real_glEvalCoord2fv;
+static void APIENTRY glad_debug_glEvalCoord2fv(const GLfloat* a0) { _pre_call_callback("glEvalCoord2fv", (void*)glad_debug_real_glEvalCoord2fv, 1, a0); glad_debug_real_glEvalCoord2fv(a0); _post_call_callback("glEvalCoord2fv", (void*)glad_debug_real_glEvalCoord2fv, 1, a0); }
+static PFNGLEVALMESH1PROC glad_debug_real_glEvalMesh1;
+static void APIENTRY glad_debug_glEvalMesh1(GLenum a0, GLint a1, GLint a2) { _pre_call_callback("glEvalMesh1", (void*)glad_debug_real_glEvalMesh1, 3, a0, a1, a2); glad_debug_real_glEvalMesh1(a0, a1, a2); _post_call_callback("glEvalMesh1", (void*)glad_debug_real_glEvalMesh1, 3, a0, a1, a2); }
+static PFNGLEVALPOINT1PROC glad_debug_real_glEvalPoint1;
+static void APIENTRY glad_debug_glEvalPoint1(GLint a0) { _pre_call_callback("glEvalPoint1", (void*)glad_debug_real_glEvalPoint1, 1, a0); glad_debug_real_glEvalPoint1(a0); _post_call_callback("glEvalPoint1", (void*)glad_debug_real_glEvalPoint1, 1, a0); }
+static PFNGLEVALMESH2PROC glad_debug_real_glEvalMesh2;
+static void APIENTRY glad_debug_glEvalMesh2(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4) { _pre_call_callback("glEvalMesh2", (void*)glad_debug_real_glEvalMesh2, 5, a0, a1, a2, a3, a4); glad_debug_real_glEvalMesh2(a0, a1, a2, a3, a4); _post_call_callback("glEvalMesh2", (void*)glad_debug_real_glEvalMesh2, 5, a0, a1, a2, a3, a4); }
+static PFNGLEVALPOINT2PROC glad_debug_real_glEvalPoint2;
+static void APIENTRY glad_debug_glEvalPoint2(GLint a0, GLint a1) { _pre_call_callback("glEvalPoint2", (void*)glad_debug_real_glEvalPoint2, 2, a0, a1); glad_debug_real_glEvalPoint2(a0, a1); _post_call_callback("glEvalPoint2", (void*)glad_debug_real_glEvalPoint2, 2, a0, a1); }
+static PFNGLALPHAFUNCPROC glad_debug_real_glAlphaFunc;
+static void APIENTRY glad_debug_glAlphaFunc(GLenum a0, GLfloat a1) { _pre_call_callback("glAlphaFunc", (void*)glad_debug_real_glAlphaFunc, 2, a0, a1); glad_debug_real_glAlphaFunc(a0, a1); _post_call_callback("glAlphaFunc", (void*)glad_debug_real_glAlphaFunc, 2, a0, a1); }
+static PFNGLPIXELZOOMPROC glad_debug_real_glPixelZoom;
+static void APIENTRY glad_debug_glPixelZoom(GLfloat a0, GLfloat a1) { _pre_call_callback("glPixelZoom", (void*)glad_debug_real_glPixelZoom, 2, a0, a1); glad_debug_real_glPixelZoom(a0, a1); _post_call_callback("glPixelZoom", (void*)glad_debug_real_glPixelZoom, 2, a0, a1); }
+static PFNGLPIXELTRANSFERFPROC glad_debug_real_glPixelTransferf;
+static void APIENTRY glad_debug_glPixelTransferf(GLenum a0, GLfloat a1) { _pre_call_callback("glPixelTransferf", (void*)glad_debug_real_glPixelTransferf, 2, a0, a1); glad_debug_real_glPixelTransferf(a0, a1); _post_call_callback("glPixelTransferf", (void*)glad_debug_real_glPixelTransferf, 2, a0, a1); }
+static PFNGLPIXELTRANSFERIPROC glad_debug_real_glPixelTransferi;
+static void APIENTRY glad_debug_glPixelTransferi(GLenum a0, GLint a1) { _pre_call_callback("glPixelTransferi", (void*)glad_debug_real_glPixelTransferi, 2, a0, a1); glad_debug_real_glPixelTransferi(a0, a1); _post_call_callback("glPixelTransferi", (void*)glad_debug_real_glPixelTransferi, 2, a0, a1); }
+static PFNGLPIXELMAPFVPROC glad_debug_real_glPixelMapfv;
+static void APIENTRY glad_debug_glPixelMapfv(GLenum a0, GLsizei a1, const GLfloat* a2) { _pre_call_callback("glPixelMapfv", (void*)glad_debug_real_glPixelMapfv, 3, a0, a1, a2); glad_debug_real_glPixelMapfv(a0, a1, a2); _post_call_callback("glPixelMapfv", (void*)glad_debug_real_glPixelMapfv, 3, a0, a1, a2); }
+static PFNGLPIXELMAPUIVPROC glad_debug_real_glPixelMapuiv;
+static void APIENTRY glad_debug_glPixelMapuiv(GLenum a0, GLsizei a1, const GLuint* a2) { _pre_call_callback("glPixelMapuiv", (void*)glad_debug_real_glPixelMapuiv, 3, a0, a1, a2); glad_debug_real_glPixelMapuiv(a0, a1, a2); _post_call_callback("glPixelMapuiv", (void*)glad_debug_real_glPixelMapuiv, 3, a0, a1, a2); }
+static PFNGLPIXELMAPUSVPROC glad_debug_real_glPixelMapusv;
+static void APIENTRY glad_debug_glPixelMapusv(GLenum a0, GLsizei a1, const GLushort* a2) { _pre_call_callback("glPixelMapusv", (void*)glad_debug_real_glPixelMapusv, 3, a0, a1, a2); glad_debug_real_glPixelMapusv(a0, a1, a2); _post_call_callback("glPixelMapusv", (void*)glad_debug_real_glPixelMapusv, 3, a0, a1, a2); }
+static PFNGLCOPYPIXELSPROC glad_debug_real_glCopyPixels;
+static void APIENTRY glad_debug_glCopyPixels(GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4) { _pre_call_callback("glCopyPixels", (void*)glad_debug_real_glCopyPixels, 5, a0, a1, a2, a3, a4); glad_debug_real_glCopyPixels(a0, a1, a2, a3, a4); _post_call_callback("glCopyPixels", (void*)glad_debug_real_glCopyPixels, 5, a0, a1, a2, a3, a4); }
+static PFNGLDRAWPIXELSPROC glad_debug_real_glDrawPixels;
+static void APIENTRY glad_debug_glDrawPixels(GLsizei a0, GLsizei a1, GLenum a2, GLenum a3, const void* a4) { _pre_call_callback("glDrawPixels", (void*)glad_debug_real_glDrawPixels, 5, a0, a1, a2, a3, a4); glad_debug_real_glDrawPixels(a0, a1, a2, a3, a4); _post_call_callback("glDrawPixels", (void*)glad_debug_real_glDrawPixels, 5, a0, a1, a2, a3, a4); }
+static PFNGLGETCLIPPLANEPROC glad_debug_real_glGetClipPlane;
+static void APIENTRY glad_debug_glGetClipPlane(GLenum a0, GLdouble* a1) { _pre_call_callback("glGetClipPlane", (void*)glad_debug_real_glGetClipPlane, 2, a0, a1); glad_debug_real_glGetClipPlane(a0, a1); _post_call_callback("glGetClipPlane", (void*)glad_debug_real_glGetClipPlane, 2, a0, a1); }
+static PFNGLGETLIGHTFVPROC glad_debug_real_glGetLightfv;
+static void APIENTRY glad_debug_glGetLightfv(GLenum a0, GLenum a1, GLfloat* a2) { _pre_call_callback("glGetLightfv", (void*)glad_debug_real_glGetLightfv, 3, a0, a1, a2); glad_debug_real_glGetLightfv(a0, a1, a2); _post_call_callback("glGetLightfv", (void*)glad_debug_real_glGetLightfv, 3, a0, a1, a2); }
+static PFNGLGETLIGHTIVPROC glad_debug_real_glGetLightiv;
+static void APIENTRY glad_debug_glGetLightiv(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetLightiv", (void*)glad_debug_real_glGetLightiv, 3, a0, a1, a2); glad_debug_real_glGetLightiv(a0, a1, a2); _post_call_callback("glGetLightiv", (void*)glad_debug_real_glGetLightiv, 3, a0, a1, a2); }
+static PFNGLGETMAPDVPROC glad_debug_real_glGetMapdv;
+static void APIENTRY glad_debug_glGetMapdv(GLenum a0, GLenum a1, GLdouble* a2) { _pre_call_callback("glGetMapdv", (void*)glad_debug_real_glGetMapdv, 3, a0, a1, a2); glad_debug_real_glGetMapdv(a0, a1, a2); _post_call_callback("glGetMapdv", (void*)glad_debug_real_glGetMapdv, 3, a0, a1, a2); }
+static PFNGLGETMAPFVPROC glad_debug_real_glGetMapfv;
+static void APIENTRY glad_debug_glGetMapfv(GLenum a0, GLenum a1, GLfloat* a2) { _pre_call_callback("glGetMapfv", (void*)glad_debug_real_glGetMapfv, 3, a0, a1, a2); glad_debug_real_glGetMapfv(a0, a1, a2); _post_call_callback("glGetMapfv", (void*)glad_debug_real_glGetMapfv, 3, a0, a1, a2); }
+static PFNGLGETMAPIVPROC glad_debug_real_glGetMapiv;
+static void APIENTRY glad_debug_glGetMapiv(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetMapiv", (void*)glad_debug_real_glGetMapiv, 3, a0, a1, a2); glad_debug_real_glGetMapiv(a0, a1, a2); _post_call_callback("glGetMapiv", (void*)glad_debug_real_glGetMapiv, 3, a0, a1, a2); }
+static PFNGLGETMATERIALFVPROC glad_debug_real_glGetMaterialfv;
+static void APIENTRY glad_debug_glGetMaterialfv(GLenum a0, GLenum a1, GLfloat* a2) { _pre_call_callback("glGetMaterialfv", (void*)glad_debug_real_glGetMaterialfv, 3, a0, a1, a2); glad_debug_real_glGetMaterialfv(a0, a1, a2); _post_call_callback("glGetMaterialfv", (void*)glad_debug_real_glGetMaterialfv, 3, a0, a1, a2); }
+static PFNGLGETMATERIALIVPROC glad_debug_real_glGetMaterialiv;
+static void APIENTRY glad_debug_glGetMaterialiv(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetMaterialiv", (void*)glad_debug_real_glGetMaterialiv, 3, a0, a1, a2); glad_debug_real_glGetMaterialiv(a0, a1, a2); _post_call_callback("glGetMaterialiv", (void*)glad_debug_real_glGetMaterialiv, 3, a0, a1, a2); }
+static PFNGLGETPIXELMAPFVPROC glad_debug_real_glGetPixelMapfv;
+static void APIENTRY glad_debug_glGetPixelMapfv(GLenum a0, GLfloat* a1) { _pre_call_callback("glGetPixelMapfv", (void*)glad_debug_real_glGetPixelMapfv, 2, a0, a1); glad_debug_real_glGetPixelMapfv(a0, a1); _post_call_callback("glGetPixelMapfv", (void*)glad_debug_real_glGetPixelMapfv, 2, a0, a1); }
+static PFNGLGETPIXELMAPUIVPROC glad_debug_real_glGetPixelMapuiv;
+static void APIENTRY glad_debug_glGetPixelMapuiv(GLenum a0, GLuint* a1) { _pre_call_callback("glGetPixelMapuiv", (void*)glad_debug_real_glGetPixelMapuiv, 2, a0, a1); glad_debug_real_glGetPixelMapuiv(a0, a1); _post_call_callback("glGetPixelMapuiv", (void*)glad_debug_real_glGetPixelMapuiv, 2, a0, a1); }
+static PFNGLGETPIXELMAPUSVPROC glad_debug_real_glGetPixelMapusv;
+static void APIENTRY glad_debug_glGetPixelMapusv(GLenum a0, GLushort* a1) { _pre_call_callback("glGetPixelMapusv", (void*)glad_debug_real_glGetPixelMapusv, 2, a0, a1); glad_debug_real_glGetPixelMapusv(a0, a1); _post_call_callback("glGetPixelMapusv", (void*)glad_debug_real_glGetPixelMapusv, 2, a0, a1); }
+static PFNGLGETPOLYGONSTIPPLEPROC glad_debug_real_glGetPolygonStipple;
+static void APIENTRY glad_debug_glGetPolygonStipple(GLubyte* a0) { _pre_call_callback("glGetPolygonStipple", (void*)glad_debug_real_glGetPolygonStipple, 1, a0); glad_debug_real_glGetPolygonStipple(a0); _post_call_callback("glGetPolygonStipple", (void*)glad_debug_real_glGetPolygonStipple, 1, a0); }
+static PFNGLGETTEXENVFVPROC glad_debug_real_glGetTexEnvfv;
+static void APIENTRY glad_debug_glGetTexEnvfv(GLenum a0, GLenum a1, GLfloat* a2) { _pre_call_callback("glGetTexEnvfv", (void*)glad_debug_real_glGetTexEnvfv, 3, a0, a1, a2); glad_debug_real_glGetTexEnvfv(a0, a1, a2); _post_call_callback("glGetTexEnvfv", (void*)glad_debug_real_glGetTexEnvfv, 3, a0, a1, a2); }
+static PFNGLGETTEXENVIVPROC glad_debug_real_glGetTexEnviv;
+static void APIENTRY glad_debug_glGetTexEnviv(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetTexEnviv", (void*)glad_debug_real_glGetTexEnviv, 3, a0, a1, a2); glad_debug_real_glGetTexEnviv(a0, a1, a2); _post_call_callback("glGetTexEnviv", (void*)glad_debug_real_glGetTexEnviv, 3, a0, a1, a2); }
+static PFNGLGETTEXGENDVPROC glad_debug_real_glGetTexGendv;
+static void APIENTRY glad_debug_glGetTexGendv(GLenum a0, GLenum a1, GLdouble* a2) { _pre_call_callback("glGetTexGendv", (void*)glad_debug_real_glGetTexGendv, 3, a0, a1, a2); glad_debug_real_glGetTexGendv(a0, a1, a2); _post_call_callback("glGetTexGendv", (void*)glad_debug_real_glGetTexGendv, 3, a0, a1, a2); }
+static PFNGLGETTEXGENFVPROC glad_debug_real_glGetTexGenfv;
+static void APIENTRY glad_debug_glGetTexGenfv(GLenum a0, GLenum a1, GLfloat* a2) { _pre_call_callback("glGetTexGenfv", (void*)glad_debug_real_glGetTexGenfv, 3, a0, a1, a2); glad_debug_real_glGetTexGenfv(a0, a1, a2); _post_call_callback("glGetTexGenfv", (void*)glad_debug_real_glGetTexGenfv, 3, a0, a1, a2); }
+static PFNGLGETTEXGENIVPROC glad_debug_real_glGetTexGeniv;
+static void APIENTRY glad_debug_glGetTexGeniv(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetTexGeniv", (void*)glad_debug_real_glGetTexGeniv, 3, a0, a1, a2); glad_debug_real_glGetTexGeniv(a0, a1, a2); _post_call_callback("glGetTexGeniv", (void*)glad_debug_real_glGetTexGeniv, 3, a0, a1, a2); }
+static PFNGLISLISTPROC glad_debug_real_glIsList;
+static GLboolean APIENTRY glad_debug_glIsList(GLuint a0) { GLboolean ret; _pre_call_callback("glIsList", (void*)glad_debug_real_glIsList, 1, a0); ret = glad_debug_real_glIsList(a0); _post_call_callback("glIsList", (void*)glad_debug_real_glIsList, 1, a0); return ret; }
+static PFNGLFRUSTUMPROC glad_debug_real_glFrustum;
+static void APIENTRY glad_debug_glFrustum(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5) { _pre_call_callback("glFrustum", (void*)glad_debug_real_glFrustum, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glFrustum(a0, a1, a2, a3, a4, a5); _post_call_callback("glFrustum", (void*)glad_debug_real_glFrustum, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLLOADIDENTITYPROC glad_debug_real_glLoadIdentity;
+static void APIENTRY glad_debug_glLoadIdentity() { _pre_call_callback("glLoadIdentity", (void*)glad_debug_real_glLoadIdentity, 0); glad_debug_real_glLoadIdentity(); _post_call_callback("glLoadIdentity", (void*)glad_debug_real_glLoadIdentity, 0); }
+static PFNGLLOADMATRIXFPROC glad_debug_real_glLoadMatrixf;
+static void APIENTRY glad_debug_glLoadMatrixf(const GLfloat* a0) { _pre_call_callback("glLoadMatrixf", (void*)glad_debug_real_glLoadMatrixf, 1, a0); glad_debug_real_glLoadMatrixf(a0); _post_call_callback("glLoadMatrixf", (void*)glad_debug_real_glLoadMatrixf, 1, a0); }
+static PFNGLLOADMATRIXDPROC glad_debug_real_glLoadMatrixd;
+static void APIENTRY glad_debug_glLoadMatrixd(const GLdouble* a0) { _pre_call_callback("glLoadMatrixd", (void*)glad_debug_real_glLoadMatrixd, 1, a0); glad_debug_real_glLoadMatrixd(a0); _post_call_callback("glLoadMatrixd", (void*)glad_debug_real_glLoadMatrixd, 1, a0); }
+static PFNGLMATRIXMODEPROC glad_debug_real_glMatrixMode;
+static void APIENTRY glad_debug_glMatrixMode(GLenum a0) { _pre_call_callback("glMatrixMode", (void*)glad_debug_real_glMatrixMode, 1, a0); glad_debug_real_glMatrixMode(a0); _post_call_callback("glMatrixMode", (void*)glad_debug_real_glMatrixMode, 1, a0); }
+static PFNGLMULTMATRIXFPROC glad_debug_real_glMultMatrixf;
+static void APIENTRY glad_debug_glMultMatrixf(const GLfloat* a0) { _pre_call_callback("glMultMatrixf", (void*)glad_debug_real_glMultMatrixf, 1, a0); glad_debug_real_glMultMatrixf(a0); _post_call_callback("glMultMatrixf", (void*)glad_debug_real_glMultMatrixf, 1, a0); }
+static PFNGLMULTMATRIXDPROC glad_debug_real_glMultMatrixd;
+static void APIENTRY glad_debug_glMultMatrixd(const GLdouble* a0) { _pre_call_callback("glMultMatrixd", (void*)glad_debug_real_glMultMatrixd, 1, a0); glad_debug_real_glMultMatrixd(a0); _post_call_callback("glMultMatrixd", (void*)glad_debug_real_glMultMatrixd, 1, a0); }
+static PFNGLORTHOPROC glad_debug_real_glOrtho;
+static void APIENTRY glad_debug_glOrtho(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5) { _pre_call_callback("glOrtho", (void*)glad_debug_real_glOrtho, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glOrtho(a0, a1, a2, a3, a4, a5); _post_call_callback("glOrtho", (void*)glad_debug_real_glOrtho, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLPOPMATRIXPROC glad_debug_real_glPopMatrix;
+static void APIENTRY glad_debug_glPopMatrix() { _pre_call_callback("glPopMatrix", (void*)glad_debug_real_glPopMatrix, 0); glad_debug_real_glPopMatrix(); _post_call_callback("glPopMatrix", (void*)glad_debug_real_glPopMatrix, 0); }
+static PFNGLPUSHMATRIXPROC glad_debug_real_glPushMatrix;
+static void APIENTRY glad_debug_glPushMatrix() { _pre_call_callback("glPushMatrix", (void*)glad_debug_real_glPushMatrix, 0); glad_debug_real_glPushMatrix(); _post_call_callback("glPushMatrix", (void*)glad_debug_real_glPushMatrix, 0); }
+static PFNGLROTATEDPROC glad_debug_real_glRotated;
+static void APIENTRY glad_debug_glRotated(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { _pre_call_callback("glRotated", (void*)glad_debug_real_glRotated, 4, a0, a1, a2, a3); glad_debug_real_glRotated(a0, a1, a2, a3); _post_call_callback("glRotated", (void*)glad_debug_real_glRotated, 4, a0, a1, a2, a3); }
+static PFNGLROTATEFPROC glad_debug_real_glRotatef;
+static void APIENTRY glad_debug_glRotatef(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glRotatef", (void*)glad_debug_real_glRotatef, 4, a0, a1, a2, a3); glad_debug_real_glRotatef(a0, a1, a2, a3); _post_call_callback("glRotatef", (void*)glad_debug_real_glRotatef, 4, a0, a1, a2, a3); }
+static PFNGLSCALEDPROC glad_debug_real_glScaled;
+static void APIENTRY glad_debug_glScaled(GLdouble a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glScaled", (void*)glad_debug_real_glScaled, 3, a0, a1, a2); glad_debug_real_glScaled(a0, a1, a2); _post_call_callback("glScaled", (void*)glad_debug_real_glScaled, 3, a0, a1, a2); }
+static PFNGLSCALEFPROC glad_debug_real_glScalef;
+static void APIENTRY glad_debug_glScalef(GLfloat a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glScalef", (void*)glad_debug_real_glScalef, 3, a0, a1, a2); glad_debug_real_glScalef(a0, a1, a2); _post_call_callback("glScalef", (void*)glad_debug_real_glScalef, 3, a0, a1, a2); }
+static PFNGLTRANSLATEDPROC glad_debug_real_glTranslated;
+static void APIENTRY glad_debug_glTranslated(GLdouble a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glTranslated", (void*)glad_debug_real_glTranslated, 3, a0, a1, a2); glad_debug_real_glTranslated(a0, a1, a2); _post_call_callback("glTranslated", (void*)glad_debug_real_glTranslated, 3, a0, a1, a2); }
+static PFNGLTRANSLATEFPROC glad_debug_real_glTranslatef;
+static void APIENTRY glad_debug_glTranslatef(GLfloat a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glTranslatef", (void*)glad_debug_real_glTranslatef, 3, a0, a1, a2); glad_debug_real_glTranslatef(a0, a1, a2); _post_call_callback("glTranslatef", (void*)glad_debug_real_glTranslatef, 3, a0, a1, a2); }
+static PFNGLDRAWARRAYSPROC glad_debug_real_glDrawArrays;
+static void APIENTRY glad_debug_glDrawArrays(GLenum a0, GLint a1, GLsizei a2) { _pre_call_callback("glDrawArrays", (void*)glad_debug_real_glDrawArrays, 3, a0, a1, a2); glad_debug_real_glDrawArrays(a0, a1, a2); _post_call_callback("glDrawArrays", (void*)glad_debug_real_glDrawArrays, 3, a0, a1, a2); }
+static PFNGLDRAWELEMENTSPROC glad_debug_real_glDrawElements;
+static void APIENTRY glad_debug_glDrawElements(GLenum a0, GLsizei a1, GLenum a2, const void* a3) { _pre_call_callback("glDrawElements", (void*)glad_debug_real_glDrawElements, 4, a0, a1, a2, a3); glad_debug_real_glDrawElements(a0, a1, a2, a3); _post_call_callback("glDrawElements", (void*)glad_debug_real_glDrawElements, 4, a0, a1, a2, a3); }
+static PFNGLGETPOINTERVPROC glad_debug_real_glGetPointerv;
+static void APIENTRY glad_debug_glGetPointerv(GLenum a0, void** a1) { _pre_call_callback("glGetPointerv", (void*)glad_debug_real_glGetPointerv, 2, a0, a1); glad_debug_real_glGetPointerv(a0, a1); _post_call_callback("glGetPointerv", (void*)glad_debug_real_glGetPointerv, 2, a0, a1); }
+static PFNGLPOLYGONOFFSETPROC glad_debug_real_glPolygonOffset;
+static void APIENTRY glad_debug_glPolygonOffset(GLfloat a0, GLfloat a1) { _pre_call_callback("glPolygonOffset", (void*)glad_debug_real_glPolygonOffset, 2, a0, a1); glad_debug_real_glPolygonOffset(a0, a1); _post_call_callback("glPolygonOffset", (void*)glad_debug_real_glPolygonOffset, 2, a0, a1); }
+static PFNGLCOPYTEXIMAGE1DPROC glad_debug_real_glCopyTexImage1D;
+static void APIENTRY glad_debug_glCopyTexImage1D(GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLint a6) { _pre_call_callback("glCopyTexImage1D", (void*)glad_debug_real_glCopyTexImage1D, 7, a0, a1, a2, a3, a4, a5, a6); glad_debug_real_glCopyTexImage1D(a0, a1, a2, a3, a4, a5, a6); _post_call_callback("glCopyTexImage1D", (void*)glad_debug_real_glCopyTexImage1D, 7, a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLCOPYTEXIMAGE2DPROC glad_debug_real_glCopyTexImage2D;
+static void APIENTRY glad_debug_glCopyTexImage2D(GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLint a7) { _pre_call_callback("glCopyTexImage2D", (void*)glad_debug_real_glCopyTexImage2D, 8, a0, a1, a2, a3, a4, a5, a6, a7); glad_debug_real_glCopyTexImage2D(a0, a1, a2, a3, a4, a5, a6, a7); _post_call_callback("glCopyTexImage2D", (void*)glad_debug_real_glCopyTexImage2D, 8, a0, a1, a2, a3, a4, a5, a6, a7); }
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_debug_real_glCopyTexSubImage1D;
+static void APIENTRY glad_debug_glCopyTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5) { _pre_call_callback("glCopyTexSubImage1D", (void*)glad_debug_real_glCopyTexSubImage1D, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glCopyTexSubImage1D(a0, a1, a2, a3, a4, a5); _post_call_callback("glCopyTexSubImage1D", (void*)glad_debug_real_glCopyTexSubImage1D, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_debug_real_glCopyTexSubImage2D;
+static void APIENTRY glad_debug_glCopyTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7) { _pre_call_callback("glCopyTexSubImage2D", (void*)glad_debug_real_glCopyTexSubImage2D, 8, a0, a1, a2, a3, a4, a5, a6, a7); glad_debug_real_glCopyTexSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7); _post_call_callback("glCopyTexSubImage2D", (void*)glad_debug_real_glCopyTexSubImage2D, 8, a0, a1, a2, a3, a4, a5, a6, a7); }
+static PFNGLTEXSUBIMAGE1DPROC glad_debug_real_glTexSubImage1D;
+static void APIENTRY glad_debug_glTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void* a6) { _pre_call_callback("glTexSubImage1D", (void*)glad_debug_real_glTexSubImage1D, 7, a0, a1, a2, a3, a4, a5, a6); glad_debug_real_glTexSubImage1D(a0, a1, a2, a3, a4, a5, a6); _post_call_callback("glTexSubImage1D", (void*)glad_debug_real_glTexSubImage1D, 7, a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLTEXSUBIMAGE2DPROC glad_debug_real_glTexSubImage2D;
+static void APIENTRY glad_debug_glTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void* a8) { _pre_call_callback("glTexSubImage2D", (void*)glad_debug_real_glTexSubImage2D, 9, a0, a1, a2, a3, a4, a5, a6, a7, a8); glad_debug_real_glTexSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8); _post_call_callback("glTexSubImage2D", (void*)glad_debug_real_glTexSubImage2D, 9, a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static PFNGLBINDTEXTUREPROC glad_debug_real_glBindTexture;
+static void APIENTRY glad_debug_glBindTexture(GLenum a0, GLuint a1) { _pre_call_callback("glBindTexture", (void*)glad_debug_real_glBindTexture, 2, a0, a1); glad_debug_real_glBindTexture(a0, a1); _post_call_callback("glBindTexture", (void*)glad_debug_real_glBindTexture, 2, a0, a1); }
+static PFNGLDELETETEXTURESPROC glad_debug_real_glDeleteTextures;
+static void APIENTRY glad_debug_glDeleteTextures(GLsizei a0, const GLuint* a1) { _pre_call_callback("glDeleteTextures", (void*)glad_debug_real_glDeleteTextures, 2, a0, a1); glad_debug_real_glDeleteTextures(a0, a1); _post_call_callback("glDeleteTextures", (void*)glad_debug_real_glDeleteTextures, 2, a0, a1); }
+static PFNGLGENTEXTURESPROC glad_debug_real_glGenTextures;
+static void APIENTRY glad_debug_glGenTextures(GLsizei a0, GLuint* a1) { _pre_call_callback("glGenTextures", (void*)glad_debug_real_glGenTextures, 2, a0, a1); glad_debug_real_glGenTextures(a0, a1); _post_call_callback("glGenTextures", (void*)glad_debug_real_glGenTextures, 2, a0, a1); }
+static PFNGLISTEXTUREPROC glad_debug_real_glIsTexture;
+static GLboolean APIENTRY glad_debug_glIsTexture(GLuint a0) { GLboolean ret; _pre_call_callback("glIsTexture", (void*)glad_debug_real_glIsTexture, 1, a0); ret = glad_debug_real_glIsTexture(a0); _post_call_callback("glIsTexture", (void*)glad_debug_real_glIsTexture, 1, a0); return ret; }
+static PFNGLARRAYELEMENTPROC glad_debug_real_glArrayElement;
+static void APIENTRY glad_debug_glArrayElement(GLint a0) { _pre_call_callback("glArrayElement", (void*)glad_debug_real_glArrayElement, 1, a0); glad_debug_real_glArrayElement(a0); _post_call_callback("glArrayElement", (void*)glad_debug_real_glArrayElement, 1, a0); }
+static PFNGLCOLORPOINTERPROC glad_debug_real_glColorPointer;
+static void APIENTRY glad_debug_glColorPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { _pre_call_callback("glColorPointer", (void*)glad_debug_real_glColorPointer, 4, a0, a1, a2, a3); glad_debug_real_glColorPointer(a0, a1, a2, a3); _post_call_callback("glColorPointer", (void*)glad_debug_real_glColorPointer, 4, a0, a1, a2, a3); }
+static PFNGLDISABLECLIENTSTATEPROC glad_debug_real_glDisableClientState;
+static void APIENTRY glad_debug_glDisableClientState(GLenum a0) { _pre_call_callback("glDisableClientState", (void*)glad_debug_real_glDisableClientState, 1, a0); glad_debug_real_glDisableClientState(a0); _post_call_callback("glDisableClientState", (void*)glad_debug_real_glDisableClientState, 1, a0); }
+static PFNGLEDGEFLAGPOINTERPROC glad_debug_real_glEdgeFlagPointer;
+static void APIENTRY glad_debug_glEdgeFlagPointer(GLsizei a0, const void* a1) { _pre_call_callback("glEdgeFlagPointer", (void*)glad_debug_real_glEdgeFlagPointer, 2, a0, a1); glad_debug_real_glEdgeFlagPointer(a0, a1); _post_call_callback("glEdgeFlagPointer", (void*)glad_debug_real_glEdgeFlagPointer, 2, a0, a1); }
+static PFNGLENABLECLIENTSTATEPROC glad_debug_real_glEnableClientState;
+static void APIENTRY glad_debug_glEnableClientState(GLenum a0) { _pre_call_callback("glEnableClientState", (void*)glad_debug_real_glEnableClientState, 1, a0); glad_debug_real_glEnableClientState(a0); _post_call_callback("glEnableClientState", (void*)glad_debug_real_glEnableClientState, 1, a0); }
+static PFNGLINDEXPOINTERPROC glad_debug_real_glIndexPointer;
+static void APIENTRY glad_debug_glIndexPointer(GLenum a0, GLsizei a1, const void* a2) { _pre_call_callback("glIndexPointer", (void*)glad_debug_real_glIndexPointer, 3, a0, a1, a2); glad_debug_real_glIndexPointer(a0, a1, a2); _post_call_callback("glIndexPointer", (void*)glad_debug_real_glIndexPointer, 3, a0, a1, a2); }
+static PFNGLINTERLEAVEDARRAYSPROC glad_debug_real_glInterleavedArrays;
+static void APIENTRY glad_debug_glInterleavedArrays(GLenum a0, GLsizei a1, const void* a2) { _pre_call_callback("glInterleavedArrays", (void*)glad_debug_real_glInterleavedArrays, 3, a0, a1, a2); glad_debug_real_glInterleavedArrays(a0, a1, a2); _post_call_callback("glInterleavedArrays", (void*)glad_debug_real_glInterleavedArrays, 3, a0, a1, a2); }
+static PFNGLNORMALPOINTERPROC glad_debug_real_glNormalPointer;
+static void APIENTRY glad_debug_glNormalPointer(GLenum a0, GLsizei a1, const void* a2) { _pre_call_callback("glNormalPointer", (void*)glad_debug_real_glNormalPointer, 3, a0, a1, a2); glad_debug_real_glNormalPointer(a0, a1, a2); _post_call_callback("glNormalPointer", (void*)glad_debug_real_glNormalPointer, 3, a0, a1, a2); }
+static PFNGLTEXCOORDPOINTERPROC glad_debug_real_glTexCoordPointer;
+static void APIENTRY glad_debug_glTexCoordPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { _pre_call_callback("glTexCoordPointer", (void*)glad_debug_real_glTexCoordPointer, 4, a0, a1, a2, a3); glad_debug_real_glTexCoordPointer(a0, a1, a2, a3); _post_call_callback("glTexCoordPointer", (void*)glad_debug_real_glTexCoordPointer, 4, a0, a1, a2, a3); }
+static PFNGLVERTEXPOINTERPROC glad_debug_real_glVertexPointer;
+static void APIENTRY glad_debug_glVertexPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { _pre_call_callback("glVertexPointer", (void*)glad_debug_real_glVertexPointer, 4, a0, a1, a2, a3); glad_debug_real_glVertexPointer(a0, a1, a2, a3); _post_call_callback("glVertexPointer", (void*)glad_debug_real_glVertexPointer, 4, a0, a1, a2, a3); }
+static PFNGLARETEXTURESRESIDENTPROC glad_debug_real_glAreTexturesResident;
+static GLboolean APIENTRY glad_debug_glAreTexturesResident(GLsizei a0, const GLuint* a1, GLboolean* a2) { GLboolean ret; _pre_call_callback("glAreTexturesResident", (void*)glad_debug_real_glAreTexturesResident, 3, a0, a1, a2); ret = glad_debug_real_glAreTexturesResident(a0, a1, a2); _post_call_callback("glAreTexturesResident", (void*)glad_debug_real_glAreTexturesResident, 3, a0, a1, a2); return ret; }
+static PFNGLPRIORITIZETEXTURESPROC glad_debug_real_glPrioritizeTextures;
+static void APIENTRY glad_debug_glPrioritizeTextures(GLsizei a0, const GLuint* a1, const GLfloat* a2) { _pre_call_callback("glPrioritizeTextures", (void*)glad_debug_real_glPrioritizeTextures, 3, a0, a1, a2); glad_debug_real_glPrioritizeTextures(a0, a1, a2); _post_call_callback("glPrioritizeTextures", (void*)glad_debug_real_glPrioritizeTextures, 3, a0, a1, a2); }
+static PFNGLINDEXUBPROC glad_debug_real_glIndexub;
+static void APIENTRY glad_debug_glIndexub(GLubyte a0) { _pre_call_callback("glIndexub", (void*)glad_debug_real_glIndexub, 1, a0); glad_debug_real_glIndexub(a0); _post_call_callback("glIndexub", (void*)glad_debug_real_glIndexub, 1, a0); }
+static PFNGLINDEXUBVPROC glad_debug_real_glIndexubv;
+static void APIENTRY glad_debug_glIndexubv(const GLubyte* a0) { _pre_call_callback("glIndexubv", (void*)glad_debug_real_glIndexubv, 1, a0); glad_debug_real_glIndexubv(a0); _post_call_callback("glIndexubv", (void*)glad_debug_real_glIndexubv, 1, a0); }
+static PFNGLPOPCLIENTATTRIBPROC glad_debug_real_glPopClientAttrib;
+static void APIENTRY glad_debug_glPopClientAttrib() { _pre_call_callback("glPopClientAttrib", (void*)glad_debug_real_glPopClientAttrib, 0); glad_debug_real_glPopClientAttrib(); _post_call_callback("glPopClientAttrib", (void*)glad_debug_real_glPopClientAttrib, 0); }
+static PFNGLPUSHCLIENTATTRIBPROC glad_debug_real_glPushClientAttrib;
+static void APIENTRY glad_debug_glPushClientAttrib(GLbitfield a0) { _pre_call_callback("glPushClientAttrib", (void*)glad_debug_real_glPushClientAttrib, 1, a0); glad_debug_real_glPushClientAttrib(a0); _post_call_callback("glPushClientAttrib", (void*)glad_debug_real_glPushClientAttrib, 1, a0); }
+static PFNGLDRAWRANGEELEMENTSPROC glad_debug_real_glDrawRangeElements;
+static void APIENTRY glad_debug_glDrawRangeElements(GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void* a5) { _pre_call_callback("glDrawRangeElements", (void*)glad_debug_real_glDrawRangeElements, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glDrawRangeElements(a0, a1, a2, a3, a4, a5); _post_call_callback("glDrawRangeElements", (void*)glad_debug_real_glDrawRangeElements, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLTEXIMAGE3DPROC glad_debug_real_glTexImage3D;
+static void APIENTRY glad_debug_glTexImage3D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void* a9) { _pre_call_callback("glTexImage3D", (void*)glad_debug_real_glTexImage3D, 10, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); glad_debug_real_glTexImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); _post_call_callback("glTexImage3D", (void*)glad_debug_real_glTexImage3D, 10, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static PFNGLTEXSUBIMAGE3DPROC glad_debug_real_glTexSubImage3D;
+static void APIENTRY glad_debug_glTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void* a10) { _pre_call_callback("glTexSubImage3D", (void*)glad_debug_real_glTexSubImage3D, 11, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); glad_debug_real_glTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); _post_call_callback("glTexSubImage3D", (void*)glad_debug_real_glTexSubImage3D, 11, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); }
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_debug_real_glCopyTexSubImage3D;
+static void APIENTRY glad_debug_glCopyTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8) { _pre_call_callback("glCopyTexSubImage3D", (void*)glad_debug_real_glCopyTexSubImage3D, 9, a0, a1, a2, a3, a4, a5, a6, a7, a8); glad_debug_real_glCopyTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8); _post_call_callback("glCopyTexSubImage3D", (void*)glad_debug_real_glCopyTexSubImage3D, 9, a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static PFNGLACTIVETEXTUREPROC glad_debug_real_glActiveTexture;
+static void APIENTRY glad_debug_glActiveTexture(GLenum a0) { _pre_call_callback("glActiveTexture", (void*)glad_debug_real_glActiveTexture, 1, a0); glad_debug_real_glActiveTexture(a0); _post_call_callback("glActiveTexture", (void*)glad_debug_real_glActiveTexture, 1, a0); }
+static PFNGLSAMPLECOVERAGEPROC glad_debug_real_glSampleCoverage;
+static void APIENTRY glad_debug_glSampleCoverage(GLfloat a0, GLboolean a1) { _pre_call_callback("glSampleCoverage", (void*)glad_debug_real_glSampleCoverage, 2, a0, a1); glad_debug_real_glSampleCoverage(a0, a1); _post_call_callback("glSampleCoverage", (void*)glad_debug_real_glSampleCoverage, 2, a0, a1); }
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_debug_real_glCompressedTexImage3D;
+static void APIENTRY glad_debug_glCompressedTexImage3D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void* a8) { _pre_call_callback("glCompressedTexImage3D", (void*)glad_debug_real_glCompressedTexImage3D, 9, a0, a1, a2, a3, a4, a5, a6, a7, a8); glad_debug_real_glCompressedTexImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8); _post_call_callback("glCompressedTexImage3D", (void*)glad_debug_real_glCompressedTexImage3D, 9, a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_debug_real_glCompressedTexImage2D;
+static void APIENTRY glad_debug_glCompressedTexImage2D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const void* a7) { _pre_call_callback("glCompressedTexImage2D", (void*)glad_debug_real_glCompressedTexImage2D, 8, a0, a1, a2, a3, a4, a5, a6, a7); glad_debug_real_glCompressedTexImage2D(a0, a1, a2, a3, a4, a5, a6, a7); _post_call_callback("glCompressedTexImage2D", (void*)glad_debug_real_glCompressedTexImage2D, 8, a0, a1, a2, a3, a4, a5, a6, a7); }
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_debug_real_glCompressedTexImage1D;
+static void APIENTRY glad_debug_glCompressedTexImage1D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const void* a6) { _pre_call_callback("glCompressedTexImage1D", (void*)glad_debug_real_glCompressedTexImage1D, 7, a0, a1, a2, a3, a4, a5, a6); glad_debug_real_glCompressedTexImage1D(a0, a1, a2, a3, a4, a5, a6); _post_call_callback("glCompressedTexImage1D", (void*)glad_debug_real_glCompressedTexImage1D, 7, a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_debug_real_glCompressedTexSubImage3D;
+static void APIENTRY glad_debug_glCompressedTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void* a10) { _pre_call_callback("glCompressedTexSubImage3D", (void*)glad_debug_real_glCompressedTexSubImage3D, 11, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); glad_debug_real_glCompressedTexSubImage3D(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); _post_call_callback("glCompressedTexSubImage3D", (void*)glad_debug_real_glCompressedTexSubImage3D, 11, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); }
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_debug_real_glCompressedTexSubImage2D;
+static void APIENTRY glad_debug_glCompressedTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void* a8) { _pre_call_callback("glCompressedTexSubImage2D", (void*)glad_debug_real_glCompressedTexSubImage2D, 9, a0, a1, a2, a3, a4, a5, a6, a7, a8); glad_debug_real_glCompressedTexSubImage2D(a0, a1, a2, a3, a4, a5, a6, a7, a8); _post_call_callback("glCompressedTexSubImage2D", (void*)glad_debug_real_glCompressedTexSubImage2D, 9, a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_debug_real_glCompressedTexSubImage1D;
+static void APIENTRY glad_debug_glCompressedTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void* a6) { _pre_call_callback("glCompressedTexSubImage1D", (void*)glad_debug_real_glCompressedTexSubImage1D, 7, a0, a1, a2, a3, a4, a5, a6); glad_debug_real_glCompressedTexSubImage1D(a0, a1, a2, a3, a4, a5, a6); _post_call_callback("glCompressedTexSubImage1D", (void*)glad_debug_real_glCompressedTexSubImage1D, 7, a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_debug_real_glGetCompressedTexImage;
+static void APIENTRY glad_debug_glGetCompressedTexImage(GLenum a0, GLint a1, void* a2) { _pre_call_callback("glGetCompressedTexImage", (void*)glad_debug_real_glGetCompressedTexImage, 3, a0, a1, a2); glad_debug_real_glGetCompressedTexImage(a0, a1, a2); _post_call_callback("glGetCompressedTexImage", (void*)glad_debug_real_glGetCompressedTexImage, 3, a0, a1, a2); }
+static PFNGLCLIENTACTIVETEXTUREPROC glad_debug_real_glClientActiveTexture;
+static void APIENTRY glad_debug_glClientActiveTexture(GLenum a0) { _pre_call_callback("glClientActiveTexture", (void*)glad_debug_real_glClientActiveTexture, 1, a0); glad_debug_real_glClientActiveTexture(a0); _post_call_callback("glClientActiveTexture", (void*)glad_debug_real_glClientActiveTexture, 1, a0); }
+static PFNGLMULTITEXCOORD1DPROC glad_debug_real_glMultiTexCoord1d;
+static void APIENTRY glad_debug_glMultiTexCoord1d(GLenum a0, GLdouble a1) { _pre_call_callback("glMultiTexCoord1d", (void*)glad_debug_real_glMultiTexCoord1d, 2, a0, a1); glad_debug_real_glMultiTexCoord1d(a0, a1); _post_call_callback("glMultiTexCoord1d", (void*)glad_debug_real_glMultiTexCoord1d, 2, a0, a1); }
+static PFNGLMULTITEXCOORD1DVPROC glad_debug_real_glMultiTexCoord1dv;
+static void APIENTRY glad_debug_glMultiTexCoord1dv(GLenum a0, const GLdouble* a1) { _pre_call_callback("glMultiTexCoord1dv", (void*)glad_debug_real_glMultiTexCoord1dv, 2, a0, a1); glad_debug_real_glMultiTexCoord1dv(a0, a1); _post_call_callback("glMultiTexCoord1dv", (void*)glad_debug_real_glMultiTexCoord1dv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD1FPROC glad_debug_real_glMultiTexCoord1f;
+static void APIENTRY glad_debug_glMultiTexCoord1f(GLenum a0, GLfloat a1) { _pre_call_callback("glMultiTexCoord1f", (void*)glad_debug_real_glMultiTexCoord1f, 2, a0, a1); glad_debug_real_glMultiTexCoord1f(a0, a1); _post_call_callback("glMultiTexCoord1f", (void*)glad_debug_real_glMultiTexCoord1f, 2, a0, a1); }
+static PFNGLMULTITEXCOORD1FVPROC glad_debug_real_glMultiTexCoord1fv;
+static void APIENTRY glad_debug_glMultiTexCoord1fv(GLenum a0, const GLfloat* a1) { _pre_call_callback("glMultiTexCoord1fv", (void*)glad_debug_real_glMultiTexCoord1fv, 2, a0, a1); glad_debug_real_glMultiTexCoord1fv(a0, a1); _post_call_callback("glMultiTexCoord1fv", (void*)glad_debug_real_glMultiTexCoord1fv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD1IPROC glad_debug_real_glMultiTexCoord1i;
+static void APIENTRY glad_debug_glMultiTexCoord1i(GLenum a0, GLint a1) { _pre_call_callback("glMultiTexCoord1i", (void*)glad_debug_real_glMultiTexCoord1i, 2, a0, a1); glad_debug_real_glMultiTexCoord1i(a0, a1); _post_call_callback("glMultiTexCoord1i", (void*)glad_debug_real_glMultiTexCoord1i, 2, a0, a1); }
+static PFNGLMULTITEXCOORD1IVPROC glad_debug_real_glMultiTexCoord1iv;
+static void APIENTRY glad_debug_glMultiTexCoord1iv(GLenum a0, const GLint* a1) { _pre_call_callback("glMultiTexCoord1iv", (void*)glad_debug_real_glMultiTexCoord1iv, 2, a0, a1); glad_debug_real_glMultiTexCoord1iv(a0, a1); _post_call_callback("glMultiTexCoord1iv", (void*)glad_debug_real_glMultiTexCoord1iv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD1SPROC glad_debug_real_glMultiTexCoord1s;
+static void APIENTRY glad_debug_glMultiTexCoord1s(GLenum a0, GLshort a1) { _pre_call_callback("glMultiTexCoord1s", (void*)glad_debug_real_glMultiTexCoord1s, 2, a0, a1); glad_debug_real_glMultiTexCoord1s(a0, a1); _post_call_callback("glMultiTexCoord1s", (void*)glad_debug_real_glMultiTexCoord1s, 2, a0, a1); }
+static PFNGLMULTITEXCOORD1SVPROC glad_debug_real_glMultiTexCoord1sv;
+static void APIENTRY glad_debug_glMultiTexCoord1sv(GLenum a0, const GLshort* a1) { _pre_call_callback("glMultiTexCoord1sv", (void*)glad_debug_real_glMultiTexCoord1sv, 2, a0, a1); glad_debug_real_glMultiTexCoord1sv(a0, a1); _post_call_callback("glMultiTexCoord1sv", (void*)glad_debug_real_glMultiTexCoord1sv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD2DPROC glad_debug_real_glMultiTexCoord2d;
+static void APIENTRY glad_debug_glMultiTexCoord2d(GLenum a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glMultiTexCoord2d", (void*)glad_debug_real_glMultiTexCoord2d, 3, a0, a1, a2); glad_debug_real_glMultiTexCoord2d(a0, a1, a2); _post_call_callback("glMultiTexCoord2d", (void*)glad_debug_real_glMultiTexCoord2d, 3, a0, a1, a2); }
+static PFNGLMULTITEXCOORD2DVPROC glad_debug_real_glMultiTexCoord2dv;
+static void APIENTRY glad_debug_glMultiTexCoord2dv(GLenum a0, const GLdouble* a1) { _pre_call_callback("glMultiTexCoord2dv", (void*)glad_debug_real_glMultiTexCoord2dv, 2, a0, a1); glad_debug_real_glMultiTexCoord2dv(a0, a1); _post_call_callback("glMultiTexCoord2dv", (void*)glad_debug_real_glMultiTexCoord2dv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD2FPROC glad_debug_real_glMultiTexCoord2f;
+static void APIENTRY glad_debug_glMultiTexCoord2f(GLenum a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glMultiTexCoord2f", (void*)glad_debug_real_glMultiTexCoord2f, 3, a0, a1, a2); glad_debug_real_glMultiTexCoord2f(a0, a1, a2); _post_call_callback("glMultiTexCoord2f", (void*)glad_debug_real_glMultiTexCoord2f, 3, a0, a1, a2); }
+static PFNGLMULTITEXCOORD2FVPROC glad_debug_real_glMultiTexCoord2fv;
+static void APIENTRY glad_debug_glMultiTexCoord2fv(GLenum a0, const GLfloat* a1) { _pre_call_callback("glMultiTexCoord2fv", (void*)glad_debug_real_glMultiTexCoord2fv, 2, a0, a1); glad_debug_real_glMultiTexCoord2fv(a0, a1); _post_call_callback("glMultiTexCoord2fv", (void*)glad_debug_real_glMultiTexCoord2fv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD2IPROC glad_debug_real_glMultiTexCoord2i;
+static void APIENTRY glad_debug_glMultiTexCoord2i(GLenum a0, GLint a1, GLint a2) { _pre_call_callback("glMultiTexCoord2i", (void*)glad_debug_real_glMultiTexCoord2i, 3, a0, a1, a2); glad_debug_real_glMultiTexCoord2i(a0, a1, a2); _post_call_callback("glMultiTexCoord2i", (void*)glad_debug_real_glMultiTexCoord2i, 3, a0, a1, a2); }
+static PFNGLMULTITEXCOORD2IVPROC glad_debug_real_glMultiTexCoord2iv;
+static void APIENTRY glad_debug_glMultiTexCoord2iv(GLenum a0, const GLint* a1) { _pre_call_callback("glMultiTexCoord2iv", (void*)glad_debug_real_glMultiTexCoord2iv, 2, a0, a1); glad_debug_real_glMultiTexCoord2iv(a0, a1); _post_call_callback("glMultiTexCoord2iv", (void*)glad_debug_real_glMultiTexCoord2iv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD2SPROC glad_debug_real_glMultiTexCoord2s;
+static void APIENTRY glad_debug_glMultiTexCoord2s(GLenum a0, GLshort a1, GLshort a2) { _pre_call_callback("glMultiTexCoord2s", (void*)glad_debug_real_glMultiTexCoord2s, 3, a0, a1, a2); glad_debug_real_glMultiTexCoord2s(a0, a1, a2); _post_call_callback("glMultiTexCoord2s", (void*)glad_debug_real_glMultiTexCoord2s, 3, a0, a1, a2); }
+static PFNGLMULTITEXCOORD2SVPROC glad_debug_real_glMultiTexCoord2sv;
+static void APIENTRY glad_debug_glMultiTexCoord2sv(GLenum a0, const GLshort* a1) { _pre_call_callback("glMultiTexCoord2sv", (void*)glad_debug_real_glMultiTexCoord2sv, 2, a0, a1); glad_debug_real_glMultiTexCoord2sv(a0, a1); _post_call_callback("glMultiTexCoord2sv", (void*)glad_debug_real_glMultiTexCoord2sv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD3DPROC glad_debug_real_glMultiTexCoord3d;
+static void APIENTRY glad_debug_glMultiTexCoord3d(GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3) { _pre_call_callback("glMultiTexCoord3d", (void*)glad_debug_real_glMultiTexCoord3d, 4, a0, a1, a2, a3); glad_debug_real_glMultiTexCoord3d(a0, a1, a2, a3); _post_call_callback("glMultiTexCoord3d", (void*)glad_debug_real_glMultiTexCoord3d, 4, a0, a1, a2, a3); }
+static PFNGLMULTITEXCOORD3DVPROC glad_debug_real_glMultiTexCoord3dv;
+static void APIENTRY glad_debug_glMultiTexCoord3dv(GLenum a0, const GLdouble* a1) { _pre_call_callback("glMultiTexCoord3dv", (void*)glad_debug_real_glMultiTexCoord3dv, 2, a0, a1); glad_debug_real_glMultiTexCoord3dv(a0, a1); _post_call_callback("glMultiTexCoord3dv", (void*)glad_debug_real_glMultiTexCoord3dv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD3FPROC glad_debug_real_glMultiTexCoord3f;
+static void APIENTRY glad_debug_glMultiTexCoord3f(GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glMultiTexCoord3f", (void*)glad_debug_real_glMultiTexCoord3f, 4, a0, a1, a2, a3); glad_debug_real_glMultiTexCoord3f(a0, a1, a2, a3); _post_call_callback("glMultiTexCoord3f", (void*)glad_debug_real_glMultiTexCoord3f, 4, a0, a1, a2, a3); }
+static PFNGLMULTITEXCOORD3FVPROC glad_debug_real_glMultiTexCoord3fv;
+static void APIENTRY glad_debug_glMultiTexCoord3fv(GLenum a0, const GLfloat* a1) { _pre_call_callback("glMultiTexCoord3fv", (void*)glad_debug_real_glMultiTexCoord3fv, 2, a0, a1); glad_debug_real_glMultiTexCoord3fv(a0, a1); _post_call_callback("glMultiTexCoord3fv", (void*)glad_debug_real_glMultiTexCoord3fv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD3IPROC glad_debug_real_glMultiTexCoord3i;
+static void APIENTRY glad_debug_glMultiTexCoord3i(GLenum a0, GLint a1, GLint a2, GLint a3) { _pre_call_callback("glMultiTexCoord3i", (void*)glad_debug_real_glMultiTexCoord3i, 4, a0, a1, a2, a3); glad_debug_real_glMultiTexCoord3i(a0, a1, a2, a3); _post_call_callback("glMultiTexCoord3i", (void*)glad_debug_real_glMultiTexCoord3i, 4, a0, a1, a2, a3); }
+static PFNGLMULTITEXCOORD3IVPROC glad_debug_real_glMultiTexCoord3iv;
+static void APIENTRY glad_debug_glMultiTexCoord3iv(GLenum a0, const GLint* a1) { _pre_call_callback("glMultiTexCoord3iv", (void*)glad_debug_real_glMultiTexCoord3iv, 2, a0, a1); glad_debug_real_glMultiTexCoord3iv(a0, a1); _post_call_callback("glMultiTexCoord3iv", (void*)glad_debug_real_glMultiTexCoord3iv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD3SPROC glad_debug_real_glMultiTexCoord3s;
+static void APIENTRY glad_debug_glMultiTexCoord3s(GLenum a0, GLshort a1, GLshort a2, GLshort a3) { _pre_call_callback("glMultiTexCoord3s", (void*)glad_debug_real_glMultiTexCoord3s, 4, a0, a1, a2, a3); glad_debug_real_glMultiTexCoord3s(a0, a1, a2, a3); _post_call_callback("glMultiTexCoord3s", (void*)glad_debug_real_glMultiTexCoord3s, 4, a0, a1, a2, a3); }
+static PFNGLMULTITEXCOORD3SVPROC glad_debug_real_glMultiTexCoord3sv;
+static void APIENTRY glad_debug_glMultiTexCoord3sv(GLenum a0, const GLshort* a1) { _pre_call_callback("glMultiTexCoord3sv", (void*)glad_debug_real_glMultiTexCoord3sv, 2, a0, a1); glad_debug_real_glMultiTexCoord3sv(a0, a1); _post_call_callback("glMultiTexCoord3sv", (void*)glad_debug_real_glMultiTexCoord3sv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD4DPROC glad_debug_real_glMultiTexCoord4d;
+static void APIENTRY glad_debug_glMultiTexCoord4d(GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4) { _pre_call_callback("glMultiTexCoord4d", (void*)glad_debug_real_glMultiTexCoord4d, 5, a0, a1, a2, a3, a4); glad_debug_real_glMultiTexCoord4d(a0, a1, a2, a3, a4); _post_call_callback("glMultiTexCoord4d", (void*)glad_debug_real_glMultiTexCoord4d, 5, a0, a1, a2, a3, a4); }
+static PFNGLMULTITEXCOORD4DVPROC glad_debug_real_glMultiTexCoord4dv;
+static void APIENTRY glad_debug_glMultiTexCoord4dv(GLenum a0, const GLdouble* a1) { _pre_call_callback("glMultiTexCoord4dv", (void*)glad_debug_real_glMultiTexCoord4dv, 2, a0, a1); glad_debug_real_glMultiTexCoord4dv(a0, a1); _post_call_callback("glMultiTexCoord4dv", (void*)glad_debug_real_glMultiTexCoord4dv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD4FPROC glad_debug_real_glMultiTexCoord4f;
+static void APIENTRY glad_debug_glMultiTexCoord4f(GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4) { _pre_call_callback("glMultiTexCoord4f", (void*)glad_debug_real_glMultiTexCoord4f, 5, a0, a1, a2, a3, a4); glad_debug_real_glMultiTexCoord4f(a0, a1, a2, a3, a4); _post_call_callback("glMultiTexCoord4f", (void*)glad_debug_real_glMultiTexCoord4f, 5, a0, a1, a2, a3, a4); }
+static PFNGLMULTITEXCOORD4FVPROC glad_debug_real_glMultiTexCoord4fv;
+static void APIENTRY glad_debug_glMultiTexCoord4fv(GLenum a0, const GLfloat* a1) { _pre_call_callback("glMultiTexCoord4fv", (void*)glad_debug_real_glMultiTexCoord4fv, 2, a0, a1); glad_debug_real_glMultiTexCoord4fv(a0, a1); _post_call_callback("glMultiTexCoord4fv", (void*)glad_debug_real_glMultiTexCoord4fv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD4IPROC glad_debug_real_glMultiTexCoord4i;
+static void APIENTRY glad_debug_glMultiTexCoord4i(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4) { _pre_call_callback("glMultiTexCoord4i", (void*)glad_debug_real_glMultiTexCoord4i, 5, a0, a1, a2, a3, a4); glad_debug_real_glMultiTexCoord4i(a0, a1, a2, a3, a4); _post_call_callback("glMultiTexCoord4i", (void*)glad_debug_real_glMultiTexCoord4i, 5, a0, a1, a2, a3, a4); }
+static PFNGLMULTITEXCOORD4IVPROC glad_debug_real_glMultiTexCoord4iv;
+static void APIENTRY glad_debug_glMultiTexCoord4iv(GLenum a0, const GLint* a1) { _pre_call_callback("glMultiTexCoord4iv", (void*)glad_debug_real_glMultiTexCoord4iv, 2, a0, a1); glad_debug_real_glMultiTexCoord4iv(a0, a1); _post_call_callback("glMultiTexCoord4iv", (void*)glad_debug_real_glMultiTexCoord4iv, 2, a0, a1); }
+static PFNGLMULTITEXCOORD4SPROC glad_debug_real_glMultiTexCoord4s;
+static void APIENTRY glad_debug_glMultiTexCoord4s(GLenum a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4) { _pre_call_callback("glMultiTexCoord4s", (void*)glad_debug_real_glMultiTexCoord4s, 5, a0, a1, a2, a3, a4); glad_debug_real_glMultiTexCoord4s(a0, a1, a2, a3, a4); _post_call_callback("glMultiTexCoord4s", (void*)glad_debug_real_glMultiTexCoord4s, 5, a0, a1, a2, a3, a4); }
+static PFNGLMULTITEXCOORD4SVPROC glad_debug_real_glMultiTexCoord4sv;
+static void APIENTRY glad_debug_glMultiTexCoord4sv(GLenum a0, const GLshort* a1) { _pre_call_callback("glMultiTexCoord4sv", (void*)glad_debug_real_glMultiTexCoord4sv, 2, a0, a1); glad_debug_real_glMultiTexCoord4sv(a0, a1); _post_call_callback("glMultiTexCoord4sv", (void*)glad_debug_real_glMultiTexCoord4sv, 2, a0, a1); }
+static PFNGLLOADTRANSPOSEMATRIXFPROC glad_debug_real_glLoadTransposeMatrixf;
+static void APIENTRY glad_debug_glLoadTransposeMatrixf(const GLfloat* a0) { _pre_call_callback("glLoadTransposeMatrixf", (void*)glad_debug_real_glLoadTransposeMatrixf, 1, a0); glad_debug_real_glLoadTransposeMatrixf(a0); _post_call_callback("glLoadTransposeMatrixf", (void*)glad_debug_real_glLoadTransposeMatrixf, 1, a0); }
+static PFNGLLOADTRANSPOSEMATRIXDPROC glad_debug_real_glLoadTransposeMatrixd;
+static void APIENTRY glad_debug_glLoadTransposeMatrixd(const GLdouble* a0) { _pre_call_callback("glLoadTransposeMatrixd", (void*)glad_debug_real_glLoadTransposeMatrixd, 1, a0); glad_debug_real_glLoadTransposeMatrixd(a0); _post_call_callback("glLoadTransposeMatrixd", (void*)glad_debug_real_glLoadTransposeMatrixd, 1, a0); }
+static PFNGLMULTTRANSPOSEMATRIXFPROC glad_debug_real_glMultTransposeMatrixf;
+static void APIENTRY glad_debug_glMultTransposeMatrixf(const GLfloat* a0) { _pre_call_callback("glMultTransposeMatrixf", (void*)glad_debug_real_glMultTransposeMatrixf, 1, a0); glad_debug_real_glMultTransposeMatrixf(a0); _post_call_callback("glMultTransposeMatrixf", (void*)glad_debug_real_glMultTransposeMatrixf, 1, a0); }
+static PFNGLMULTTRANSPOSEMATRIXDPROC glad_debug_real_glMultTransposeMatrixd;
+static void APIENTRY glad_debug_glMultTransposeMatrixd(const GLdouble* a0) { _pre_call_callback("glMultTransposeMatrixd", (void*)glad_debug_real_glMultTransposeMatrixd, 1, a0); glad_debug_real_glMultTransposeMatrixd(a0); _post_call_callback("glMultTransposeMatrixd", (void*)glad_debug_real_glMultTransposeMatrixd, 1, a0); }
+static PFNGLBLENDFUNCSEPARATEPROC glad_debug_real_glBlendFuncSeparate;
+static void APIENTRY glad_debug_glBlendFuncSeparate(GLenum a0, GLenum a1, GLenum a2, GLenum a3) { _pre_call_callback("glBlendFuncSeparate", (void*)glad_debug_real_glBlendFuncSeparate, 4, a0, a1, a2, a3); glad_debug_real_glBlendFuncSeparate(a0, a1, a2, a3); _post_call_callback("glBlendFuncSeparate", (void*)glad_debug_real_glBlendFuncSeparate, 4, a0, a1, a2, a3); }
+static PFNGLMULTIDRAWARRAYSPROC glad_debug_real_glMultiDrawArrays;
+static void APIENTRY glad_debug_glMultiDrawArrays(GLenum a0, const GLint* a1, const GLsizei* a2, GLsizei a3) { _pre_call_callback("glMultiDrawArrays", (void*)glad_debug_real_glMultiDrawArrays, 4, a0, a1, a2, a3); glad_debug_real_glMultiDrawArrays(a0, a1, a2, a3); _post_call_callback("glMultiDrawArrays", (void*)glad_debug_real_glMultiDrawArrays, 4, a0, a1, a2, a3); }
+static PFNGLMULTIDRAWELEMENTSPROC glad_debug_real_glMultiDrawElements;
+static void APIENTRY glad_debug_glMultiDrawElements(GLenum a0, const GLsizei* a1, GLenum a2, const void** a3, GLsizei a4) { _pre_call_callback("glMultiDrawElements", (void*)glad_debug_real_glMultiDrawElements, 5, a0, a1, a2, a3, a4); glad_debug_real_glMultiDrawElements(a0, a1, a2, a3, a4); _post_call_callback("glMultiDrawElements", (void*)glad_debug_real_glMultiDrawElements, 5, a0, a1, a2, a3, a4); }
+static PFNGLPOINTPARAMETERFPROC glad_debug_real_glPointParameterf;
+static void APIENTRY glad_debug_glPointParameterf(GLenum a0, GLfloat a1) { _pre_call_callback("glPointParameterf", (void*)glad_debug_real_glPointParameterf, 2, a0, a1); glad_debug_real_glPointParameterf(a0, a1); _post_call_callback("glPointParameterf", (void*)glad_debug_real_glPointParameterf, 2, a0, a1); }
+static PFNGLPOINTPARAMETERFVPROC glad_debug_real_glPointParameterfv;
+static void APIENTRY glad_debug_glPointParameterfv(GLenum a0, const GLfloat* a1) { _pre_call_callback("glPointParameterfv", (void*)glad_debug_real_glPointParameterfv, 2, a0, a1); glad_debug_real_glPointParameterfv(a0, a1); _post_call_callback("glPointParameterfv", (void*)glad_debug_real_glPointParameterfv, 2, a0, a1); }
+static PFNGLPOINTPARAMETERIPROC glad_debug_real_glPointParameteri;
+static void APIENTRY glad_debug_glPointParameteri(GLenum a0, GLint a1) { _pre_call_callback("glPointParameteri", (void*)glad_debug_real_glPointParameteri, 2, a0, a1); glad_debug_real_glPointParameteri(a0, a1); _post_call_callback("glPointParameteri", (void*)glad_debug_real_glPointParameteri, 2, a0, a1); }
+static PFNGLPOINTPARAMETERIVPROC glad_debug_real_glPointParameteriv;
+static void APIENTRY glad_debug_glPointParameteriv(GLenum a0, const GLint* a1) { _pre_call_callback("glPointParameteriv", (void*)glad_debug_real_glPointParameteriv, 2, a0, a1); glad_debug_real_glPointParameteriv(a0, a1); _post_call_callback("glPointParameteriv", (void*)glad_debug_real_glPointParameteriv, 2, a0, a1); }
+static PFNGLFOGCOORDFPROC glad_debug_real_glFogCoordf;
+static void APIENTRY glad_debug_glFogCoordf(GLfloat a0) { _pre_call_callback("glFogCoordf", (void*)glad_debug_real_glFogCoordf, 1, a0); glad_debug_real_glFogCoordf(a0); _post_call_callback("glFogCoordf", (void*)glad_debug_real_glFogCoordf, 1, a0); }
+static PFNGLFOGCOORDFVPROC glad_debug_real_glFogCoordfv;
+static void APIENTRY glad_debug_glFogCoordfv(const GLfloat* a0) { _pre_call_callback("glFogCoordfv", (void*)glad_debug_real_glFogCoordfv, 1, a0); glad_debug_real_glFogCoordfv(a0); _post_call_callback("glFogCoordfv", (void*)glad_debug_real_glFogCoordfv, 1, a0); }
+static PFNGLFOGCOORDDPROC glad_debug_real_glFogCoordd;
+static void APIENTRY glad_debug_glFogCoordd(GLdouble a0) { _pre_call_callback("glFogCoordd", (void*)glad_debug_real_glFogCoordd, 1, a0); glad_debug_real_glFogCoordd(a0); _post_call_callback("glFogCoordd", (void*)glad_debug_real_glFogCoordd, 1, a0); }
+static PFNGLFOGCOORDDVPROC glad_debug_real_glFogCoorddv;
+static void APIENTRY glad_debug_glFogCoorddv(const GLdouble* a0) { _pre_call_callback("glFogCoorddv", (void*)glad_debug_real_glFogCoorddv, 1, a0); glad_debug_real_glFogCoorddv(a0); _post_call_callback("glFogCoorddv", (void*)glad_debug_real_glFogCoorddv, 1, a0); }
+static PFNGLFOGCOORDPOINTERPROC glad_debug_real_glFogCoordPointer;
+static void APIENTRY glad_debug_glFogCoordPointer(GLenum a0, GLsizei a1, const void* a2) { _pre_call_callback("glFogCoordPointer", (void*)glad_debug_real_glFogCoordPointer, 3, a0, a1, a2); glad_debug_real_glFogCoordPointer(a0, a1, a2); _post_call_callback("glFogCoordPointer", (void*)glad_debug_real_glFogCoordPointer, 3, a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3BPROC glad_debug_real_glSecondaryColor3b;
+static void APIENTRY glad_debug_glSecondaryColor3b(GLbyte a0, GLbyte a1, GLbyte a2) { _pre_call_callback("glSecondaryColor3b", (void*)glad_debug_real_glSecondaryColor3b, 3, a0, a1, a2); glad_debug_real_glSecondaryColor3b(a0, a1, a2); _post_call_callback("glSecondaryColor3b", (void*)glad_debug_real_glSecondaryColor3b, 3, a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3BVPROC glad_debug_real_glSecondaryColor3bv;
+static void APIENTRY glad_debug_glSecondaryColor3bv(const GLbyte* a0) { _pre_call_callback("glSecondaryColor3bv", (void*)glad_debug_real_glSecondaryColor3bv, 1, a0); glad_debug_real_glSecondaryColor3bv(a0); _post_call_callback("glSecondaryColor3bv", (void*)glad_debug_real_glSecondaryColor3bv, 1, a0); }
+static PFNGLSECONDARYCOLOR3DPROC glad_debug_real_glSecondaryColor3d;
+static void APIENTRY glad_debug_glSecondaryColor3d(GLdouble a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glSecondaryColor3d", (void*)glad_debug_real_glSecondaryColor3d, 3, a0, a1, a2); glad_debug_real_glSecondaryColor3d(a0, a1, a2); _post_call_callback("glSecondaryColor3d", (void*)glad_debug_real_glSecondaryColor3d, 3, a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3DVPROC glad_debug_real_glSecondaryColor3dv;
+static void APIENTRY glad_debug_glSecondaryColor3dv(const GLdouble* a0) { _pre_call_callback("glSecondaryColor3dv", (void*)glad_debug_real_glSecondaryColor3dv, 1, a0); glad_debug_real_glSecondaryColor3dv(a0); _post_call_callback("glSecondaryColor3dv", (void*)glad_debug_real_glSecondaryColor3dv, 1, a0); }
+static PFNGLSECONDARYCOLOR3FPROC glad_debug_real_glSecondaryColor3f;
+static void APIENTRY glad_debug_glSecondaryColor3f(GLfloat a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glSecondaryColor3f", (void*)glad_debug_real_glSecondaryColor3f, 3, a0, a1, a2); glad_debug_real_glSecondaryColor3f(a0, a1, a2); _post_call_callback("glSecondaryColor3f", (void*)glad_debug_real_glSecondaryColor3f, 3, a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3FVPROC glad_debug_real_glSecondaryColor3fv;
+static void APIENTRY glad_debug_glSecondaryColor3fv(const GLfloat* a0) { _pre_call_callback("glSecondaryColor3fv", (void*)glad_debug_real_glSecondaryColor3fv, 1, a0); glad_debug_real_glSecondaryColor3fv(a0); _post_call_callback("glSecondaryColor3fv", (void*)glad_debug_real_glSecondaryColor3fv, 1, a0); }
+static PFNGLSECONDARYCOLOR3IPROC glad_debug_real_glSecondaryColor3i;
+static void APIENTRY glad_debug_glSecondaryColor3i(GLint a0, GLint a1, GLint a2) { _pre_call_callback("glSecondaryColor3i", (void*)glad_debug_real_glSecondaryColor3i, 3, a0, a1, a2); glad_debug_real_glSecondaryColor3i(a0, a1, a2); _post_call_callback("glSecondaryColor3i", (void*)glad_debug_real_glSecondaryColor3i, 3, a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3IVPROC glad_debug_real_glSecondaryColor3iv;
+static void APIENTRY glad_debug_glSecondaryColor3iv(const GLint* a0) { _pre_call_callback("glSecondaryColor3iv", (void*)glad_debug_real_glSecondaryColor3iv, 1, a0); glad_debug_real_glSecondaryColor3iv(a0); _post_call_callback("glSecondaryColor3iv", (void*)glad_debug_real_glSecondaryColor3iv, 1, a0); }
+static PFNGLSECONDARYCOLOR3SPROC glad_debug_real_glSecondaryColor3s;
+static void APIENTRY glad_debug_glSecondaryColor3s(GLshort a0, GLshort a1, GLshort a2) { _pre_call_callback("glSecondaryColor3s", (void*)glad_debug_real_glSecondaryColor3s, 3, a0, a1, a2); glad_debug_real_glSecondaryColor3s(a0, a1, a2); _post_call_callback("glSecondaryColor3s", (void*)glad_debug_real_glSecondaryColor3s, 3, a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3SVPROC glad_debug_real_glSecondaryColor3sv;
+static void APIENTRY glad_debug_glSecondaryColor3sv(const GLshort* a0) { _pre_call_callback("glSecondaryColor3sv", (void*)glad_debug_real_glSecondaryColor3sv, 1, a0); glad_debug_real_glSecondaryColor3sv(a0); _post_call_callback("glSecondaryColor3sv", (void*)glad_debug_real_glSecondaryColor3sv, 1, a0); }
+static PFNGLSECONDARYCOLOR3UBPROC glad_debug_real_glSecondaryColor3ub;
+static void APIENTRY glad_debug_glSecondaryColor3ub(GLubyte a0, GLubyte a1, GLubyte a2) { _pre_call_callback("glSecondaryColor3ub", (void*)glad_debug_real_glSecondaryColor3ub, 3, a0, a1, a2); glad_debug_real_glSecondaryColor3ub(a0, a1, a2); _post_call_callback("glSecondaryColor3ub", (void*)glad_debug_real_glSecondaryColor3ub, 3, a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3UBVPROC glad_debug_real_glSecondaryColor3ubv;
+static void APIENTRY glad_debug_glSecondaryColor3ubv(const GLubyte* a0) { _pre_call_callback("glSecondaryColor3ubv", (void*)glad_debug_real_glSecondaryColor3ubv, 1, a0); glad_debug_real_glSecondaryColor3ubv(a0); _post_call_callback("glSecondaryColor3ubv", (void*)glad_debug_real_glSecondaryColor3ubv, 1, a0); }
+static PFNGLSECONDARYCOLOR3UIPROC glad_debug_real_glSecondaryColor3ui;
+static void APIENTRY glad_debug_glSecondaryColor3ui(GLuint a0, GLuint a1, GLuint a2) { _pre_call_callback("glSecondaryColor3ui", (void*)glad_debug_real_glSecondaryColor3ui, 3, a0, a1, a2); glad_debug_real_glSecondaryColor3ui(a0, a1, a2); _post_call_callback("glSecondaryColor3ui", (void*)glad_debug_real_glSecondaryColor3ui, 3, a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3UIVPROC glad_debug_real_glSecondaryColor3uiv;
+static void APIENTRY glad_debug_glSecondaryColor3uiv(const GLuint* a0) { _pre_call_callback("glSecondaryColor3uiv", (void*)glad_debug_real_glSecondaryColor3uiv, 1, a0); glad_debug_real_glSecondaryColor3uiv(a0); _post_call_callback("glSecondaryColor3uiv", (void*)glad_debug_real_glSecondaryColor3uiv, 1, a0); }
+static PFNGLSECONDARYCOLOR3USPROC glad_debug_real_glSecondaryColor3us;
+static void APIENTRY glad_debug_glSecondaryColor3us(GLushort a0, GLushort a1, GLushort a2) { _pre_call_callback("glSecondaryColor3us", (void*)glad_debug_real_glSecondaryColor3us, 3, a0, a1, a2); glad_debug_real_glSecondaryColor3us(a0, a1, a2); _post_call_callback("glSecondaryColor3us", (void*)glad_debug_real_glSecondaryColor3us, 3, a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3USVPROC glad_debug_real_glSecondaryColor3usv;
+static void APIENTRY glad_debug_glSecondaryColor3usv(const GLushort* a0) { _pre_call_callback("glSecondaryColor3usv", (void*)glad_debug_real_glSecondaryColor3usv, 1, a0); glad_debug_real_glSecondaryColor3usv(a0); _post_call_callback("glSecondaryColor3usv", (void*)glad_debug_real_glSecondaryColor3usv, 1, a0); }
+static PFNGLSECONDARYCOLORPOINTERPROC glad_debug_real_glSecondaryColorPointer;
+static void APIENTRY glad_debug_glSecondaryColorPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { _pre_call_callback("glSecondaryColorPointer", (void*)glad_debug_real_glSecondaryColorPointer, 4, a0, a1, a2, a3); glad_debug_real_glSecondaryColorPointer(a0, a1, a2, a3); _post_call_callback("glSecondaryColorPointer", (void*)glad_debug_real_glSecondaryColorPointer, 4, a0, a1, a2, a3); }
+static PFNGLWINDOWPOS2DPROC glad_debug_real_glWindowPos2d;
+static void APIENTRY glad_debug_glWindowPos2d(GLdouble a0, GLdouble a1) { _pre_call_callback("glWindowPos2d", (void*)glad_debug_real_glWindowPos2d, 2, a0, a1); glad_debug_real_glWindowPos2d(a0, a1); _post_call_callback("glWindowPos2d", (void*)glad_debug_real_glWindowPos2d, 2, a0, a1); }
+static PFNGLWINDOWPOS2DVPROC glad_debug_real_glWindowPos2dv;
+static void APIENTRY glad_debug_glWindowPos2dv(const GLdouble* a0) { _pre_call_callback("glWindowPos2dv", (void*)glad_debug_real_glWindowPos2dv, 1, a0); glad_debug_real_glWindowPos2dv(a0); _post_call_callback("glWindowPos2dv", (void*)glad_debug_real_glWindowPos2dv, 1, a0); }
+static PFNGLWINDOWPOS2FPROC glad_debug_real_glWindowPos2f;
+static void APIENTRY glad_debug_glWindowPos2f(GLfloat a0, GLfloat a1) { _pre_call_callback("glWindowPos2f", (void*)glad_debug_real_glWindowPos2f, 2, a0, a1); glad_debug_real_glWindowPos2f(a0, a1); _post_call_callback("glWindowPos2f", (void*)glad_debug_real_glWindowPos2f, 2, a0, a1); }
+static PFNGLWINDOWPOS2FVPROC glad_debug_real_glWindowPos2fv;
+static void APIENTRY glad_debug_glWindowPos2fv(const GLfloat* a0) { _pre_call_callback("glWindowPos2fv", (void*)glad_debug_real_glWindowPos2fv, 1, a0); glad_debug_real_glWindowPos2fv(a0); _post_call_callback("glWindowPos2fv", (void*)glad_debug_real_glWindowPos2fv, 1, a0); }
+static PFNGLWINDOWPOS2IPROC glad_debug_real_glWindowPos2i;
+static void APIENTRY glad_debug_glWindowPos2i(GLint a0, GLint a1) { _pre_call_callback("glWindowPos2i", (void*)glad_debug_real_glWindowPos2i, 2, a0, a1); glad_debug_real_glWindowPos2i(a0, a1); _post_call_callback("glWindowPos2i", (void*)glad_debug_real_glWindowPos2i, 2, a0, a1); }
+static PFNGLWINDOWPOS2IVPROC glad_debug_real_glWindowPos2iv;
+static void APIENTRY glad_debug_glWindowPos2iv(const GLint* a0) { _pre_call_callback("glWindowPos2iv", (void*)glad_debug_real_glWindowPos2iv, 1, a0); glad_debug_real_glWindowPos2iv(a0); _post_call_callback("glWindowPos2iv", (void*)glad_debug_real_glWindowPos2iv, 1, a0); }
+static PFNGLWINDOWPOS2SPROC glad_debug_real_glWindowPos2s;
+static void APIENTRY glad_debug_glWindowPos2s(GLshort a0, GLshort a1) { _pre_call_callback("glWindowPos2s", (void*)glad_debug_real_glWindowPos2s, 2, a0, a1); glad_debug_real_glWindowPos2s(a0, a1); _post_call_callback("glWindowPos2s", (void*)glad_debug_real_glWindowPos2s, 2, a0, a1); }
+static PFNGLWINDOWPOS2SVPROC glad_debug_real_glWindowPos2sv;
+static void APIENTRY glad_debug_glWindowPos2sv(const GLshort* a0) { _pre_call_callback("glWindowPos2sv", (void*)glad_debug_real_glWindowPos2sv, 1, a0); glad_debug_real_glWindowPos2sv(a0); _post_call_callback("glWindowPos2sv", (void*)glad_debug_real_glWindowPos2sv, 1, a0); }
+static PFNGLWINDOWPOS3DPROC glad_debug_real_glWindowPos3d;
+static void APIENTRY glad_debug_glWindowPos3d(GLdouble a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glWindowPos3d", (void*)glad_debug_real_glWindowPos3d, 3, a0, a1, a2); glad_debug_real_glWindowPos3d(a0, a1, a2); _post_call_callback("glWindowPos3d", (void*)glad_debug_real_glWindowPos3d, 3, a0, a1, a2); }
+static PFNGLWINDOWPOS3DVPROC glad_debug_real_glWindowPos3dv;
+static void APIENTRY glad_debug_glWindowPos3dv(const GLdouble* a0) { _pre_call_callback("glWindowPos3dv", (void*)glad_debug_real_glWindowPos3dv, 1, a0); glad_debug_real_glWindowPos3dv(a0); _post_call_callback("glWindowPos3dv", (void*)glad_debug_real_glWindowPos3dv, 1, a0); }
+static PFNGLWINDOWPOS3FPROC glad_debug_real_glWindowPos3f;
+static void APIENTRY glad_debug_glWindowPos3f(GLfloat a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glWindowPos3f", (void*)glad_debug_real_glWindowPos3f, 3, a0, a1, a2); glad_debug_real_glWindowPos3f(a0, a1, a2); _post_call_callback("glWindowPos3f", (void*)glad_debug_real_glWindowPos3f, 3, a0, a1, a2); }
+static PFNGLWINDOWPOS3FVPROC glad_debug_real_glWindowPos3fv;
+static void APIENTRY glad_debug_glWindowPos3fv(const GLfloat* a0) { _pre_call_callback("glWindowPos3fv", (void*)glad_debug_real_glWindowPos3fv, 1, a0); glad_debug_real_glWindowPos3fv(a0); _post_call_callback("glWindowPos3fv", (void*)glad_debug_real_glWindowPos3fv, 1, a0); }
+static PFNGLWINDOWPOS3IPROC glad_debug_real_glWindowPos3i;
+static void APIENTRY glad_debug_glWindowPos3i(GLint a0, GLint a1, GLint a2) { _pre_call_callback("glWindowPos3i", (void*)glad_debug_real_glWindowPos3i, 3, a0, a1, a2); glad_debug_real_glWindowPos3i(a0, a1, a2); _post_call_callback("glWindowPos3i", (void*)glad_debug_real_glWindowPos3i, 3, a0, a1, a2); }
+static PFNGLWINDOWPOS3IVPROC glad_debug_real_glWindowPos3iv;
+static void APIENTRY glad_debug_glWindowPos3iv(const GLint* a0) { _pre_call_callback("glWindowPos3iv", (void*)glad_debug_real_glWindowPos3iv, 1, a0); glad_debug_real_glWindowPos3iv(a0); _post_call_callback("glWindowPos3iv", (void*)glad_debug_real_glWindowPos3iv, 1, a0); }
+static PFNGLWINDOWPOS3SPROC glad_debug_real_glWindowPos3s;
+static void APIENTRY glad_debug_glWindowPos3s(GLshort a0, GLshort a1, GLshort a2) { _pre_call_callback("glWindowPos3s", (void*)glad_debug_real_glWindowPos3s, 3, a0, a1, a2); glad_debug_real_glWindowPos3s(a0, a1, a2); _post_call_callback("glWindowPos3s", (void*)glad_debug_real_glWindowPos3s, 3, a0, a1, a2); }
+static PFNGLWINDOWPOS3SVPROC glad_debug_real_glWindowPos3sv;
+static void APIENTRY glad_debug_glWindowPos3sv(const GLshort* a0) { _pre_call_callback("glWindowPos3sv", (void*)glad_debug_real_glWindowPos3sv, 1, a0); glad_debug_real_glWindowPos3sv(a0); _post_call_callback("glWindowPos3sv", (void*)glad_debug_real_glWindowPos3sv, 1, a0); }
+static PFNGLBLENDCOLORPROC glad_debug_real_glBlendColor;
+static void APIENTRY glad_debug_glBlendColor(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glBlendColor", (void*)glad_debug_real_glBlendColor, 4, a0, a1, a2, a3); glad_debug_real_glBlendColor(a0, a1, a2, a3); _post_call_callback("glBlendColor", (void*)glad_debug_real_glBlendColor, 4, a0, a1, a2, a3); }
+static PFNGLBLENDEQUATIONPROC glad_debug_real_glBlendEquation;
+static void APIENTRY glad_debug_glBlendEquation(GLenum a0) { _pre_call_callback("glBlendEquation", (void*)glad_debug_real_glBlendEquation, 1, a0); glad_debug_real_glBlendEquation(a0); _post_call_callback("glBlendEquation", (void*)glad_debug_real_glBlendEquation, 1, a0); }
+static PFNGLGENQUERIESPROC glad_debug_real_glGenQueries;
+static void APIENTRY glad_debug_glGenQueries(GLsizei a0, GLuint* a1) { _pre_call_callback("glGenQueries", (void*)glad_debug_real_glGenQueries, 2, a0, a1); glad_debug_real_glGenQueries(a0, a1); _post_call_callback("glGenQueries", (void*)glad_debug_real_glGenQueries, 2, a0, a1); }
+static PFNGLDELETEQUERIESPROC glad_debug_real_glDeleteQueries;
+static void APIENTRY glad_debug_glDeleteQueries(GLsizei a0, const GLuint* a1) { _pre_call_callback("glDeleteQueries", (void*)glad_debug_real_glDeleteQueries, 2, a0, a1); glad_debug_real_glDeleteQueries(a0, a1); _post_call_callback("glDeleteQueries", (void*)glad_debug_real_glDeleteQueries, 2, a0, a1); }
+static PFNGLISQUERYPROC glad_debug_real_glIsQuery;
+static GLboolean APIENTRY glad_debug_glIsQuery(GLuint a0) { GLboolean ret; _pre_call_callback("glIsQuery", (void*)glad_debug_real_glIsQuery, 1, a0); ret = glad_debug_real_glIsQuery(a0); _post_call_callback("glIsQuery", (void*)glad_debug_real_glIsQuery, 1, a0); return ret; }
+static PFNGLBEGINQUERYPROC glad_debug_real_glBeginQuery;
+static void APIENTRY glad_debug_glBeginQuery(GLenum a0, GLuint a1) { _pre_call_callback("glBeginQuery", (void*)glad_debug_real_glBeginQuery, 2, a0, a1); glad_debug_real_glBeginQuery(a0, a1); _post_call_callback("glBeginQuery", (void*)glad_debug_real_glBeginQuery, 2, a0, a1); }
+static PFNGLENDQUERYPROC glad_debug_real_glEndQuery;
+static void APIENTRY glad_debug_glEndQuery(GLenum a0) { _pre_call_callback("glEndQuery", (void*)glad_debug_real_glEndQuery, 1, a0); glad_debug_real_glEndQuery(a0); _post_call_callback("glEndQuery", (void*)glad_debug_real_glEndQuery, 1, a0); }
+static PFNGLGETQUERYIVPROC glad_debug_real_glGetQueryiv;
+static void APIENTRY glad_debug_glGetQueryiv(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetQueryiv", (void*)glad_debug_real_glGetQueryiv, 3, a0, a1, a2); glad_debug_real_glGetQueryiv(a0, a1, a2); _post_call_callback("glGetQueryiv", (void*)glad_debug_real_glGetQueryiv, 3, a0, a1, a2); }
+static PFNGLGETQUERYOBJECTIVPROC glad_debug_real_glGetQueryObjectiv;
+static void APIENTRY glad_debug_glGetQueryObjectiv(GLuint a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetQueryObjectiv", (void*)glad_debug_real_glGetQueryObjectiv, 3, a0, a1, a2); glad_debug_real_glGetQueryObjectiv(a0, a1, a2); _post_call_callback("glGetQueryObjectiv", (void*)glad_debug_real_glGetQueryObjectiv, 3, a0, a1, a2); }
+static PFNGLGETQUERYOBJECTUIVPROC glad_debug_real_glGetQueryObjectuiv;
+static void APIENTRY glad_debug_glGetQueryObjectuiv(GLuint a0, GLenum a1, GLuint* a2) { _pre_call_callback("glGetQueryObjectuiv", (void*)glad_debug_real_glGetQueryObjectuiv, 3, a0, a1, a2); glad_debug_real_glGetQueryObjectuiv(a0, a1, a2); _post_call_callback("glGetQueryObjectuiv", (void*)glad_debug_real_glGetQueryObjectuiv, 3, a0, a1, a2); }
+static PFNGLBINDBUFFERPROC glad_debug_real_glBindBuffer;
+static void APIENTRY glad_debug_glBindBuffer(GLenum a0, GLuint a1) { _pre_call_callback("glBindBuffer", (void*)glad_debug_real_glBindBuffer, 2, a0, a1); glad_debug_real_glBindBuffer(a0, a1); _post_call_callback("glBindBuffer", (void*)glad_debug_real_glBindBuffer, 2, a0, a1); }
+static PFNGLDELETEBUFFERSPROC glad_debug_real_glDeleteBuffers;
+static void APIENTRY glad_debug_glDeleteBuffers(GLsizei a0, const GLuint* a1) { _pre_call_callback("glDeleteBuffers", (void*)glad_debug_real_glDeleteBuffers, 2, a0, a1); glad_debug_real_glDeleteBuffers(a0, a1); _post_call_callback("glDeleteBuffers", (void*)glad_debug_real_glDeleteBuffers, 2, a0, a1); }
+static PFNGLGENBUFFERSPROC glad_debug_real_glGenBuffers;
+static void APIENTRY glad_debug_glGenBuffers(GLsizei a0, GLuint* a1) { _pre_call_callback("glGenBuffers", (void*)glad_debug_real_glGenBuffers, 2, a0, a1); glad_debug_real_glGenBuffers(a0, a1); _post_call_callback("glGenBuffers", (void*)glad_debug_real_glGenBuffers, 2, a0, a1); }
+static PFNGLISBUFFERPROC glad_debug_real_glIsBuffer;
+static GLboolean APIENTRY glad_debug_glIsBuffer(GLuint a0) { GLboolean ret; _pre_call_callback("glIsBuffer", (void*)glad_debug_real_glIsBuffer, 1, a0); ret = glad_debug_real_glIsBuffer(a0); _post_call_callback("glIsBuffer", (void*)glad_debug_real_glIsBuffer, 1, a0); return ret; }
+static PFNGLBUFFERDATAPROC glad_debug_real_glBufferData;
+static void APIENTRY glad_debug_glBufferData(GLenum a0, GLsizeiptr a1, const void* a2, GLenum a3) { _pre_call_callback("glBufferData", (void*)glad_debug_real_glBufferData, 4, a0, a1, a2, a3); glad_debug_real_glBufferData(a0, a1, a2, a3); _post_call_callback("glBufferData", (void*)glad_debug_real_glBufferData, 4, a0, a1, a2, a3); }
+static PFNGLBUFFERSUBDATAPROC glad_debug_real_glBufferSubData;
+static void APIENTRY glad_debug_glBufferSubData(GLenum a0, GLintptr a1, GLsizeiptr a2, const void* a3) { _pre_call_callback("glBufferSubData", (void*)glad_debug_real_glBufferSubData, 4, a0, a1, a2, a3); glad_debug_real_glBufferSubData(a0, a1, a2, a3); _post_call_callback("glBufferSubData", (void*)glad_debug_real_glBufferSubData, 4, a0, a1, a2, a3); }
+static PFNGLGETBUFFERSUBDATAPROC glad_debug_real_glGetBufferSubData;
+static void APIENTRY glad_debug_glGetBufferSubData(GLenum a0, GLintptr a1, GLsizeiptr a2, void* a3) { _pre_call_callback("glGetBufferSubData", (void*)glad_debug_real_glGetBufferSubData, 4, a0, a1, a2, a3); glad_debug_real_glGetBufferSubData(a0, a1, a2, a3); _post_call_callback("glGetBufferSubData", (void*)glad_debug_real_glGetBufferSubData, 4, a0, a1, a2, a3); }
+static PFNGLMAPBUFFERPROC glad_debug_real_glMapBuffer;
+static void* APIENTRY glad_debug_glMapBuffer(GLenum a0, GLenum a1) { void* ret; _pre_call_callback("glMapBuffer", (void*)glad_debug_real_glMapBuffer, 2, a0, a1); ret = glad_debug_real_glMapBuffer(a0, a1); _post_call_callback("glMapBuffer", (void*)glad_debug_real_glMapBuffer, 2, a0, a1); return ret; }
+static PFNGLUNMAPBUFFERPROC glad_debug_real_glUnmapBuffer;
+static GLboolean APIENTRY glad_debug_glUnmapBuffer(GLenum a0) { GLboolean ret; _pre_call_callback("glUnmapBuffer", (void*)glad_debug_real_glUnmapBuffer, 1, a0); ret = glad_debug_real_glUnmapBuffer(a0); _post_call_callback("glUnmapBuffer", (void*)glad_debug_real_glUnmapBuffer, 1, a0); return ret; }
+static PFNGLGETBUFFERPARAMETERIVPROC glad_debug_real_glGetBufferParameteriv;
+static void APIENTRY glad_debug_glGetBufferParameteriv(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetBufferParameteriv", (void*)glad_debug_real_glGetBufferParameteriv, 3, a0, a1, a2); glad_debug_real_glGetBufferParameteriv(a0, a1, a2); _post_call_callback("glGetBufferParameteriv", (void*)glad_debug_real_glGetBufferParameteriv, 3, a0, a1, a2); }
+static PFNGLGETBUFFERPOINTERVPROC glad_debug_real_glGetBufferPointerv;
+static void APIENTRY glad_debug_glGetBufferPointerv(GLenum a0, GLenum a1, void** a2) { _pre_call_callback("glGetBufferPointerv", (void*)glad_debug_real_glGetBufferPointerv, 3, a0, a1, a2); glad_debug_real_glGetBufferPointerv(a0, a1, a2); _post_call_callback("glGetBufferPointerv", (void*)glad_debug_real_glGetBufferPointerv, 3, a0, a1, a2); }
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_debug_real_glBlendEquationSeparate;
+static void APIENTRY glad_debug_glBlendEquationSeparate(GLenum a0, GLenum a1) { _pre_call_callback("glBlendEquationSeparate", (void*)glad_debug_real_glBlendEquationSeparate, 2, a0, a1); glad_debug_real_glBlendEquationSeparate(a0, a1); _post_call_callback("glBlendEquationSeparate", (void*)glad_debug_real_glBlendEquationSeparate, 2, a0, a1); }
+static PFNGLDRAWBUFFERSPROC glad_debug_real_glDrawBuffers;
+static void APIENTRY glad_debug_glDrawBuffers(GLsizei a0, const GLenum* a1) { _pre_call_callback("glDrawBuffers", (void*)glad_debug_real_glDrawBuffers, 2, a0, a1); glad_debug_real_glDrawBuffers(a0, a1); _post_call_callback("glDrawBuffers", (void*)glad_debug_real_glDrawBuffers, 2, a0, a1); }
+static PFNGLSTENCILOPSEPARATEPROC glad_debug_real_glStencilOpSeparate;
+static void APIENTRY glad_debug_glStencilOpSeparate(GLenum a0, GLenum a1, GLenum a2, GLenum a3) { _pre_call_callback("glStencilOpSeparate", (void*)glad_debug_real_glStencilOpSeparate, 4, a0, a1, a2, a3); glad_debug_real_glStencilOpSeparate(a0, a1, a2, a3); _post_call_callback("glStencilOpSeparate", (void*)glad_debug_real_glStencilOpSeparate, 4, a0, a1, a2, a3); }
+static PFNGLSTENCILFUNCSEPARATEPROC glad_debug_real_glStencilFuncSeparate;
+static void APIENTRY glad_debug_glStencilFuncSeparate(GLenum a0, GLenum a1, GLint a2, GLuint a3) { _pre_call_callback("glStencilFuncSeparate", (void*)glad_debug_real_glStencilFuncSeparate, 4, a0, a1, a2, a3); glad_debug_real_glStencilFuncSeparate(a0, a1, a2, a3); _post_call_callback("glStencilFuncSeparate", (void*)glad_debug_real_glStencilFuncSeparate, 4, a0, a1, a2, a3); }
+static PFNGLSTENCILMASKSEPARATEPROC glad_debug_real_glStencilMaskSeparate;
+static void APIENTRY glad_debug_glStencilMaskSeparate(GLenum a0, GLuint a1) { _pre_call_callback("glStencilMaskSeparate", (void*)glad_debug_real_glStencilMaskSeparate, 2, a0, a1); glad_debug_real_glStencilMaskSeparate(a0, a1); _post_call_callback("glStencilMaskSeparate", (void*)glad_debug_real_glStencilMaskSeparate, 2, a0, a1); }
+static PFNGLATTACHSHADERPROC glad_debug_real_glAttachShader;
+static void APIENTRY glad_debug_glAttachShader(GLuint a0, GLuint a1) { _pre_call_callback("glAttachShader", (void*)glad_debug_real_glAttachShader, 2, a0, a1); glad_debug_real_glAttachShader(a0, a1); _post_call_callback("glAttachShader", (void*)glad_debug_real_glAttachShader, 2, a0, a1); }
+static PFNGLBINDATTRIBLOCATIONPROC glad_debug_real_glBindAttribLocation;
+static void APIENTRY glad_debug_glBindAttribLocation(GLuint a0, GLuint a1, const GLchar* a2) { _pre_call_callback("glBindAttribLocation", (void*)glad_debug_real_glBindAttribLocation, 3, a0, a1, a2); glad_debug_real_glBindAttribLocation(a0, a1, a2); _post_call_callback("glBindAttribLocation", (void*)glad_debug_real_glBindAttribLocation, 3, a0, a1, a2); }
+static PFNGLCOMPILESHADERPROC glad_debug_real_glCompileShader;
+static void APIENTRY glad_debug_glCompileShader(GLuint a0) { _pre_call_callback("glCompileShader", (void*)glad_debug_real_glCompileShader, 1, a0); glad_debug_real_glCompileShader(a0); _post_call_callback("glCompileShader", (void*)glad_debug_real_glCompileShader, 1, a0); }
+static PFNGLCREATEPROGRAMPROC glad_debug_real_glCreateProgram;
+static GLuint APIENTRY glad_debug_glCreateProgram() { GLuint ret; _pre_call_callback("glCreateProgram", (void*)glad_debug_real_glCreateProgram, 0); ret = glad_debug_real_glCreateProgram(); _post_call_callback("glCreateProgram", (void*)glad_debug_real_glCreateProgram, 0); return ret; }
+static PFNGLCREATESHADERPROC glad_debug_real_glCreateShader;
+static GLuint APIENTRY glad_debug_glCreateShader(GLenum a0) { GLuint ret; _pre_call_callback("glCreateShader", (void*)glad_debug_real_glCreateShader, 1, a0); ret = glad_debug_real_glCreateShader(a0); _post_call_callback("glCreateShader", (void*)glad_debug_real_glCreateShader, 1, a0); return ret; }
+static PFNGLDELETEPROGRAMPROC glad_debug_real_glDeleteProgram;
+static void APIENTRY glad_debug_glDeleteProgram(GLuint a0) { _pre_call_callback("glDeleteProgram", (void*)glad_debug_real_glDeleteProgram, 1, a0); glad_debug_real_glDeleteProgram(a0); _post_call_callback("glDeleteProgram", (void*)glad_debug_real_glDeleteProgram, 1, a0); }
+static PFNGLDELETESHADERPROC glad_debug_real_glDeleteShader;
+static void APIENTRY glad_debug_glDeleteShader(GLuint a0) { _pre_call_callback("glDeleteShader", (void*)glad_debug_real_glDeleteShader, 1, a0); glad_debug_real_glDeleteShader(a0); _post_call_callback("glDeleteShader", (void*)glad_debug_real_glDeleteShader, 1, a0); }
+static PFNGLDETACHSHADERPROC glad_debug_real_glDetachShader;
+static void APIENTRY glad_debug_glDetachShader(GLuint a0, GLuint a1) { _pre_call_callback("glDetachShader", (void*)glad_debug_real_glDetachShader, 2, a0, a1); glad_debug_real_glDetachShader(a0, a1); _post_call_callback("glDetachShader", (void*)glad_debug_real_glDetachShader, 2, a0, a1); }
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_debug_real_glDisableVertexAttribArray;
+static void APIENTRY glad_debug_glDisableVertexAttribArray(GLuint a0) { _pre_call_callback("glDisableVertexAttribArray", (void*)glad_debug_real_glDisableVertexAttribArray, 1, a0); glad_debug_real_glDisableVertexAttribArray(a0); _post_call_callback("glDisableVertexAttribArray", (void*)glad_debug_real_glDisableVertexAttribArray, 1, a0); }
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_debug_real_glEnableVertexAttribArray;
+static void APIENTRY glad_debug_glEnableVertexAttribArray(GLuint a0) { _pre_call_callback("glEnableVertexAttribArray", (void*)glad_debug_real_glEnableVertexAttribArray, 1, a0); glad_debug_real_glEnableVertexAttribArray(a0); _post_call_callback("glEnableVertexAttribArray", (void*)glad_debug_real_glEnableVertexAttribArray, 1, a0); }
+static PFNGLGETACTIVEATTRIBPROC glad_debug_real_glGetActiveAttrib;
+static void APIENTRY glad_debug_glGetActiveAttrib(GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint* a4, GLenum* a5, GLchar* a6) { _pre_call_callback("glGetActiveAttrib", (void*)glad_debug_real_glGetActiveAttrib, 7, a0, a1, a2, a3, a4, a5, a6); glad_debug_real_glGetActiveAttrib(a0, a1, a2, a3, a4, a5, a6); _post_call_callback("glGetActiveAttrib", (void*)glad_debug_real_glGetActiveAttrib, 7, a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLGETACTIVEUNIFORMPROC glad_debug_real_glGetActiveUniform;
+static void APIENTRY glad_debug_glGetActiveUniform(GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint* a4, GLenum* a5, GLchar* a6) { _pre_call_callback("glGetActiveUniform", (void*)glad_debug_real_glGetActiveUniform, 7, a0, a1, a2, a3, a4, a5, a6); glad_debug_real_glGetActiveUniform(a0, a1, a2, a3, a4, a5, a6); _post_call_callback("glGetActiveUniform", (void*)glad_debug_real_glGetActiveUniform, 7, a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLGETATTACHEDSHADERSPROC glad_debug_real_glGetAttachedShaders;
+static void APIENTRY glad_debug_glGetAttachedShaders(GLuint a0, GLsizei a1, GLsizei* a2, GLuint* a3) { _pre_call_callback("glGetAttachedShaders", (void*)glad_debug_real_glGetAttachedShaders, 4, a0, a1, a2, a3); glad_debug_real_glGetAttachedShaders(a0, a1, a2, a3); _post_call_callback("glGetAttachedShaders", (void*)glad_debug_real_glGetAttachedShaders, 4, a0, a1, a2, a3); }
+static PFNGLGETATTRIBLOCATIONPROC glad_debug_real_glGetAttribLocation;
+static GLint APIENTRY glad_debug_glGetAttribLocation(GLuint a0, const GLchar* a1) { GLint ret; _pre_call_callback("glGetAttribLocation", (void*)glad_debug_real_glGetAttribLocation, 2, a0, a1); ret = glad_debug_real_glGetAttribLocation(a0, a1); _post_call_callback("glGetAttribLocation", (void*)glad_debug_real_glGetAttribLocation, 2, a0, a1); return ret; }
+static PFNGLGETPROGRAMIVPROC glad_debug_real_glGetProgramiv;
+static void APIENTRY glad_debug_glGetProgramiv(GLuint a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetProgramiv", (void*)glad_debug_real_glGetProgramiv, 3, a0, a1, a2); glad_debug_real_glGetProgramiv(a0, a1, a2); _post_call_callback("glGetProgramiv", (void*)glad_debug_real_glGetProgramiv, 3, a0, a1, a2); }
+static PFNGLGETPROGRAMINFOLOGPROC glad_debug_real_glGetProgramInfoLog;
+static void APIENTRY glad_debug_glGetProgramInfoLog(GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3) { _pre_call_callback("glGetProgramInfoLog", (void*)glad_debug_real_glGetProgramInfoLog, 4, a0, a1, a2, a3); glad_debug_real_glGetProgramInfoLog(a0, a1, a2, a3); _post_call_callback("glGetProgramInfoLog", (void*)glad_debug_real_glGetProgramInfoLog, 4, a0, a1, a2, a3); }
+static PFNGLGETSHADERIVPROC glad_debug_real_glGetShaderiv;
+static void APIENTRY glad_debug_glGetShaderiv(GLuint a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetShaderiv", (void*)glad_debug_real_glGetShaderiv, 3, a0, a1, a2); glad_debug_real_glGetShaderiv(a0, a1, a2); _post_call_callback("glGetShaderiv", (void*)glad_debug_real_glGetShaderiv, 3, a0, a1, a2); }
+static PFNGLGETSHADERINFOLOGPROC glad_debug_real_glGetShaderInfoLog;
+static void APIENTRY glad_debug_glGetShaderInfoLog(GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3) { _pre_call_callback("glGetShaderInfoLog", (void*)glad_debug_real_glGetShaderInfoLog, 4, a0, a1, a2, a3); glad_debug_real_glGetShaderInfoLog(a0, a1, a2, a3); _post_call_callback("glGetShaderInfoLog", (void*)glad_debug_real_glGetShaderInfoLog, 4, a0, a1, a2, a3); }
+static PFNGLGETSHADERSOURCEPROC glad_debug_real_glGetShaderSource;
+static void APIENTRY glad_debug_glGetShaderSource(GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3) { _pre_call_callback("glGetShaderSource", (void*)glad_debug_real_glGetShaderSource, 4, a0, a1, a2, a3); glad_debug_real_glGetShaderSource(a0, a1, a2, a3); _post_call_callback("glGetShaderSource", (void*)glad_debug_real_glGetShaderSource, 4, a0, a1, a2, a3); }
+static PFNGLGETUNIFORMLOCATIONPROC glad_debug_real_glGetUniformLocation;
+static GLint APIENTRY glad_debug_glGetUniformLocation(GLuint a0, const GLchar* a1) { GLint ret; _pre_call_callback("glGetUniformLocation", (void*)glad_debug_real_glGetUniformLocation, 2, a0, a1); ret = glad_debug_real_glGetUniformLocation(a0, a1); _post_call_callback("glGetUniformLocation", (void*)glad_debug_real_glGetUniformLocation, 2, a0, a1); return ret; }
+static PFNGLGETUNIFORMFVPROC glad_debug_real_glGetUniformfv;
+static void APIENTRY glad_debug_glGetUniformfv(GLuint a0, GLint a1, GLfloat* a2) { _pre_call_callback("glGetUniformfv", (void*)glad_debug_real_glGetUniformfv, 3, a0, a1, a2); glad_debug_real_glGetUniformfv(a0, a1, a2); _post_call_callback("glGetUniformfv", (void*)glad_debug_real_glGetUniformfv, 3, a0, a1, a2); }
+static PFNGLGETUNIFORMIVPROC glad_debug_real_glGetUniformiv;
+static void APIENTRY glad_debug_glGetUniformiv(GLuint a0, GLint a1, GLint* a2) { _pre_call_callback("glGetUniformiv", (void*)glad_debug_real_glGetUniformiv, 3, a0, a1, a2); glad_debug_real_glGetUniformiv(a0, a1, a2); _post_call_callback("glGetUniformiv", (void*)glad_debug_real_glGetUniformiv, 3, a0, a1, a2); }
+static PFNGLGETVERTEXATTRIBDVPROC glad_debug_real_glGetVertexAttribdv;
+static void APIENTRY glad_debug_glGetVertexAttribdv(GLuint a0, GLenum a1, GLdouble* a2) { _pre_call_callback("glGetVertexAttribdv", (void*)glad_debug_real_glGetVertexAttribdv, 3, a0, a1, a2); glad_debug_real_glGetVertexAttribdv(a0, a1, a2); _post_call_callback("glGetVertexAttribdv", (void*)glad_debug_real_glGetVertexAttribdv, 3, a0, a1, a2); }
+static PFNGLGETVERTEXATTRIBFVPROC glad_debug_real_glGetVertexAttribfv;
+static void APIENTRY glad_debug_glGetVertexAttribfv(GLuint a0, GLenum a1, GLfloat* a2) { _pre_call_callback("glGetVertexAttribfv", (void*)glad_debug_real_glGetVertexAttribfv, 3, a0, a1, a2); glad_debug_real_glGetVertexAttribfv(a0, a1, a2); _post_call_callback("glGetVertexAttribfv", (void*)glad_debug_real_glGetVertexAttribfv, 3, a0, a1, a2); }
+static PFNGLGETVERTEXATTRIBIVPROC glad_debug_real_glGetVertexAttribiv;
+static void APIENTRY glad_debug_glGetVertexAttribiv(GLuint a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetVertexAttribiv", (void*)glad_debug_real_glGetVertexAttribiv, 3, a0, a1, a2); glad_debug_real_glGetVertexAttribiv(a0, a1, a2); _post_call_callback("glGetVertexAttribiv", (void*)glad_debug_real_glGetVertexAttribiv, 3, a0, a1, a2); }
+static PFNGLGETVERTEXATTRIBPOINTERVPROC glad_debug_real_glGetVertexAttribPointerv;
+static void APIENTRY glad_debug_glGetVertexAttribPointerv(GLuint a0, GLenum a1, void** a2) { _pre_call_callback("glGetVertexAttribPointerv", (void*)glad_debug_real_glGetVertexAttribPointerv, 3, a0, a1, a2); glad_debug_real_glGetVertexAttribPointerv(a0, a1, a2); _post_call_callback("glGetVertexAttribPointerv", (void*)glad_debug_real_glGetVertexAttribPointerv, 3, a0, a1, a2); }
+static PFNGLISPROGRAMPROC glad_debug_real_glIsProgram;
+static GLboolean APIENTRY glad_debug_glIsProgram(GLuint a0) { GLboolean ret; _pre_call_callback("glIsProgram", (void*)glad_debug_real_glIsProgram, 1, a0); ret = glad_debug_real_glIsProgram(a0); _post_call_callback("glIsProgram", (void*)glad_debug_real_glIsProgram, 1, a0); return ret; }
+static PFNGLISSHADERPROC glad_debug_real_glIsShader;
+static GLboolean APIENTRY glad_debug_glIsShader(GLuint a0) { GLboolean ret; _pre_call_callback("glIsShader", (void*)glad_debug_real_glIsShader, 1, a0); ret = glad_debug_real_glIsShader(a0); _post_call_callback("glIsShader", (void*)glad_debug_real_glIsShader, 1, a0); return ret; }
+static PFNGLLINKPROGRAMPROC glad_debug_real_glLinkProgram;
+static void APIENTRY glad_debug_glLinkProgram(GLuint a0) { _pre_call_callback("glLinkProgram", (void*)glad_debug_real_glLinkProgram, 1, a0); glad_debug_real_glLinkProgram(a0); _post_call_callback("glLinkProgram", (void*)glad_debug_real_glLinkProgram, 1, a0); }
+static PFNGLSHADERSOURCEPROC glad_debug_real_glShaderSource;
+static void APIENTRY glad_debug_glShaderSource(GLuint a0, GLsizei a1, const GLchar** a2, const GLint* a3) { _pre_call_callback("glShaderSource", (void*)glad_debug_real_glShaderSource, 4, a0, a1, a2, a3); glad_debug_real_glShaderSource(a0, a1, a2, a3); _post_call_callback("glShaderSource", (void*)glad_debug_real_glShaderSource, 4, a0, a1, a2, a3); }
+static PFNGLUSEPROGRAMPROC glad_debug_real_glUseProgram;
+static void APIENTRY glad_debug_glUseProgram(GLuint a0) { _pre_call_callback("glUseProgram", (void*)glad_debug_real_glUseProgram, 1, a0); glad_debug_real_glUseProgram(a0); _post_call_callback("glUseProgram", (void*)glad_debug_real_glUseProgram, 1, a0); }
+static PFNGLUNIFORM1FPROC glad_debug_real_glUniform1f;
+static void APIENTRY glad_debug_glUniform1f(GLint a0, GLfloat a1) { _pre_call_callback("glUniform1f", (void*)glad_debug_real_glUniform1f, 2, a0, a1); glad_debug_real_glUniform1f(a0, a1); _post_call_callback("glUniform1f", (void*)glad_debug_real_glUniform1f, 2, a0, a1); }
+static PFNGLUNIFORM2FPROC glad_debug_real_glUniform2f;
+static void APIENTRY glad_debug_glUniform2f(GLint a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glUniform2f", (void*)glad_debug_real_glUniform2f, 3, a0, a1, a2); glad_debug_real_glUniform2f(a0, a1, a2); _post_call_callback("glUniform2f", (void*)glad_debug_real_glUniform2f, 3, a0, a1, a2); }
+static PFNGLUNIFORM3FPROC glad_debug_real_glUniform3f;
+static void APIENTRY glad_debug_glUniform3f(GLint a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glUniform3f", (void*)glad_debug_real_glUniform3f, 4, a0, a1, a2, a3); glad_debug_real_glUniform3f(a0, a1, a2, a3); _post_call_callback("glUniform3f", (void*)glad_debug_real_glUniform3f, 4, a0, a1, a2, a3); }
+static PFNGLUNIFORM4FPROC glad_debug_real_glUniform4f;
+static void APIENTRY glad_debug_glUniform4f(GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4) { _pre_call_callback("glUniform4f", (void*)glad_debug_real_glUniform4f, 5, a0, a1, a2, a3, a4); glad_debug_real_glUniform4f(a0, a1, a2, a3, a4); _post_call_callback("glUniform4f", (void*)glad_debug_real_glUniform4f, 5, a0, a1, a2, a3, a4); }
+static PFNGLUNIFORM1IPROC glad_debug_real_glUniform1i;
+static void APIENTRY glad_debug_glUniform1i(GLint a0, GLint a1) { _pre_call_callback("glUniform1i", (void*)glad_debug_real_glUniform1i, 2, a0, a1); glad_debug_real_glUniform1i(a0, a1); _post_call_callback("glUniform1i", (void*)glad_debug_real_glUniform1i, 2, a0, a1); }
+static PFNGLUNIFORM2IPROC glad_debug_real_glUniform2i;
+static void APIENTRY glad_debug_glUniform2i(GLint a0, GLint a1, GLint a2) { _pre_call_callback("glUniform2i", (void*)glad_debug_real_glUniform2i, 3, a0, a1, a2); glad_debug_real_glUniform2i(a0, a1, a2); _post_call_callback("glUniform2i", (void*)glad_debug_real_glUniform2i, 3, a0, a1, a2); }
+static PFNGLUNIFORM3IPROC glad_debug_real_glUniform3i;
+static void APIENTRY glad_debug_glUniform3i(GLint a0, GLint a1, GLint a2, GLint a3) { _pre_call_callback("glUniform3i", (void*)glad_debug_real_glUniform3i, 4, a0, a1, a2, a3); glad_debug_real_glUniform3i(a0, a1, a2, a3); _post_call_callback("glUniform3i", (void*)glad_debug_real_glUniform3i, 4, a0, a1, a2, a3); }
+static PFNGLUNIFORM4IPROC glad_debug_real_glUniform4i;
+static void APIENTRY glad_debug_glUniform4i(GLint a0, GLint a1, GLint a2, GLint a3, GLint a4) { _pre_call_callback("glUniform4i", (void*)glad_debug_real_glUniform4i, 5, a0, a1, a2, a3, a4); glad_debug_real_glUniform4i(a0, a1, a2, a3, a4); _post_call_callback("glUniform4i", (void*)glad_debug_real_glUniform4i, 5, a0, a1, a2, a3, a4); }
+static PFNGLUNIFORM1FVPROC glad_debug_real_glUniform1fv;
+static void APIENTRY glad_debug_glUniform1fv(GLint a0, GLsizei a1, const GLfloat* a2) { _pre_call_callback("glUniform1fv", (void*)glad_debug_real_glUniform1fv, 3, a0, a1, a2); glad_debug_real_glUniform1fv(a0, a1, a2); _post_call_callback("glUniform1fv", (void*)glad_debug_real_glUniform1fv, 3, a0, a1, a2); }
+static PFNGLUNIFORM2FVPROC glad_debug_real_glUniform2fv;
+static void APIENTRY glad_debug_glUniform2fv(GLint a0, GLsizei a1, const GLfloat* a2) { _pre_call_callback("glUniform2fv", (void*)glad_debug_real_glUniform2fv, 3, a0, a1, a2); glad_debug_real_glUniform2fv(a0, a1, a2); _post_call_callback("glUniform2fv", (void*)glad_debug_real_glUniform2fv, 3, a0, a1, a2); }
+static PFNGLUNIFORM3FVPROC glad_debug_real_glUniform3fv;
+static void APIENTRY glad_debug_glUniform3fv(GLint a0, GLsizei a1, const GLfloat* a2) { _pre_call_callback("glUniform3fv", (void*)glad_debug_real_glUniform3fv, 3, a0, a1, a2); glad_debug_real_glUniform3fv(a0, a1, a2); _post_call_callback("glUniform3fv", (void*)glad_debug_real_glUniform3fv, 3, a0, a1, a2); }
+static PFNGLUNIFORM4FVPROC glad_debug_real_glUniform4fv;
+static void APIENTRY glad_debug_glUniform4fv(GLint a0, GLsizei a1, const GLfloat* a2) { _pre_call_callback("glUniform4fv", (void*)glad_debug_real_glUniform4fv, 3, a0, a1, a2); glad_debug_real_glUniform4fv(a0, a1, a2); _post_call_callback("glUniform4fv", (void*)glad_debug_real_glUniform4fv, 3, a0, a1, a2); }
+static PFNGLUNIFORM1IVPROC glad_debug_real_glUniform1iv;
+static void APIENTRY glad_debug_glUniform1iv(GLint a0, GLsizei a1, const GLint* a2) { _pre_call_callback("glUniform1iv", (void*)glad_debug_real_glUniform1iv, 3, a0, a1, a2); glad_debug_real_glUniform1iv(a0, a1, a2); _post_call_callback("glUniform1iv", (void*)glad_debug_real_glUniform1iv, 3, a0, a1, a2); }
+static PFNGLUNIFORM2IVPROC glad_debug_real_glUniform2iv;
+static void APIENTRY glad_debug_glUniform2iv(GLint a0, GLsizei a1, const GLint* a2) { _pre_call_callback("glUniform2iv", (void*)glad_debug_real_glUniform2iv, 3, a0, a1, a2); glad_debug_real_glUniform2iv(a0, a1, a2); _post_call_callback("glUniform2iv", (void*)glad_debug_real_glUniform2iv, 3, a0, a1, a2); }
+static PFNGLUNIFORM3IVPROC glad_debug_real_glUniform3iv;
+static void APIENTRY glad_debug_glUniform3iv(GLint a0, GLsizei a1, const GLint* a2) { _pre_call_callback("glUniform3iv", (void*)glad_debug_real_glUniform3iv, 3, a0, a1, a2); glad_debug_real_glUniform3iv(a0, a1, a2); _post_call_callback("glUniform3iv", (void*)glad_debug_real_glUniform3iv, 3, a0, a1, a2); }
+static PFNGLUNIFORM4IVPROC glad_debug_real_glUniform4iv;
+static void APIENTRY glad_debug_glUniform4iv(GLint a0, GLsizei a1, const GLint* a2) { _pre_call_callback("glUniform4iv", (void*)glad_debug_real_glUniform4iv, 3, a0, a1, a2); glad_debug_real_glUniform4iv(a0, a1, a2); _post_call_callback("glUniform4iv", (void*)glad_debug_real_glUniform4iv, 3, a0, a1, a2); }
+static PFNGLUNIFORMMATRIX2FVPROC glad_debug_real_glUniformMatrix2fv;
+static void APIENTRY glad_debug_glUniformMatrix2fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3) { _pre_call_callback("glUniformMatrix2fv", (void*)glad_debug_real_glUniformMatrix2fv, 4, a0, a1, a2, a3); glad_debug_real_glUniformMatrix2fv(a0, a1, a2, a3); _post_call_callback("glUniformMatrix2fv", (void*)glad_debug_real_glUniformMatrix2fv, 4, a0, a1, a2, a3); }
+static PFNGLUNIFORMMATRIX3FVPROC glad_debug_real_glUniformMatrix3fv;
+static void APIENTRY glad_debug_glUniformMatrix3fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3) { _pre_call_callback("glUniformMatrix3fv", (void*)glad_debug_real_glUniformMatrix3fv, 4, a0, a1, a2, a3); glad_debug_real_glUniformMatrix3fv(a0, a1, a2, a3); _post_call_callback("glUniformMatrix3fv", (void*)glad_debug_real_glUniformMatrix3fv, 4, a0, a1, a2, a3); }
+static PFNGLUNIFORMMATRIX4FVPROC glad_debug_real_glUniformMatrix4fv;
+static void APIENTRY glad_debug_glUniformMatrix4fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3) { _pre_call_callback("glUniformMatrix4fv", (void*)glad_debug_real_glUniformMatrix4fv, 4, a0, a1, a2, a3); glad_debug_real_glUniformMatrix4fv(a0, a1, a2, a3); _post_call_callback("glUniformMatrix4fv", (void*)glad_debug_real_glUniformMatrix4fv, 4, a0, a1, a2, a3); }
+static PFNGLVALIDATEPROGRAMPROC glad_debug_real_glValidateProgram;
+static void APIENTRY glad_debug_glValidateProgram(GLuint a0) { _pre_call_callback("glValidateProgram", (void*)glad_debug_real_glValidateProgram, 1, a0); glad_debug_real_glValidateProgram(a0); _post_call_callback("glValidateProgram", (void*)glad_debug_real_glValidateProgram, 1, a0); }
+static PFNGLVERTEXATTRIB1DPROC glad_debug_real_glVertexAttrib1d;
+static void APIENTRY glad_debug_glVertexAttrib1d(GLuint a0, GLdouble a1) { _pre_call_callback("glVertexAttrib1d", (void*)glad_debug_real_glVertexAttrib1d, 2, a0, a1); glad_debug_real_glVertexAttrib1d(a0, a1); _post_call_callback("glVertexAttrib1d", (void*)glad_debug_real_glVertexAttrib1d, 2, a0, a1); }
+static PFNGLVERTEXATTRIB1DVPROC glad_debug_real_glVertexAttrib1dv;
+static void APIENTRY glad_debug_glVertexAttrib1dv(GLuint a0, const GLdouble* a1) { _pre_call_callback("glVertexAttrib1dv", (void*)glad_debug_real_glVertexAttrib1dv, 2, a0, a1); glad_debug_real_glVertexAttrib1dv(a0, a1); _post_call_callback("glVertexAttrib1dv", (void*)glad_debug_real_glVertexAttrib1dv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB1FPROC glad_debug_real_glVertexAttrib1f;
+static void APIENTRY glad_debug_glVertexAttrib1f(GLuint a0, GLfloat a1) { _pre_call_callback("glVertexAttrib1f", (void*)glad_debug_real_glVertexAttrib1f, 2, a0, a1); glad_debug_real_glVertexAttrib1f(a0, a1); _post_call_callback("glVertexAttrib1f", (void*)glad_debug_real_glVertexAttrib1f, 2, a0, a1); }
+static PFNGLVERTEXATTRIB1FVPROC glad_debug_real_glVertexAttrib1fv;
+static void APIENTRY glad_debug_glVertexAttrib1fv(GLuint a0, const GLfloat* a1) { _pre_call_callback("glVertexAttrib1fv", (void*)glad_debug_real_glVertexAttrib1fv, 2, a0, a1); glad_debug_real_glVertexAttrib1fv(a0, a1); _post_call_callback("glVertexAttrib1fv", (void*)glad_debug_real_glVertexAttrib1fv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB1SPROC glad_debug_real_glVertexAttrib1s;
+static void APIENTRY glad_debug_glVertexAttrib1s(GLuint a0, GLshort a1) { _pre_call_callback("glVertexAttrib1s", (void*)glad_debug_real_glVertexAttrib1s, 2, a0, a1); glad_debug_real_glVertexAttrib1s(a0, a1); _post_call_callback("glVertexAttrib1s", (void*)glad_debug_real_glVertexAttrib1s, 2, a0, a1); }
+static PFNGLVERTEXATTRIB1SVPROC glad_debug_real_glVertexAttrib1sv;
+static void APIENTRY glad_debug_glVertexAttrib1sv(GLuint a0, const GLshort* a1) { _pre_call_callback("glVertexAttrib1sv", (void*)glad_debug_real_glVertexAttrib1sv, 2, a0, a1); glad_debug_real_glVertexAttrib1sv(a0, a1); _post_call_callback("glVertexAttrib1sv", (void*)glad_debug_real_glVertexAttrib1sv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB2DPROC glad_debug_real_glVertexAttrib2d;
+static void APIENTRY glad_debug_glVertexAttrib2d(GLuint a0, GLdouble a1, GLdouble a2) { _pre_call_callback("glVertexAttrib2d", (void*)glad_debug_real_glVertexAttrib2d, 3, a0, a1, a2); glad_debug_real_glVertexAttrib2d(a0, a1, a2); _post_call_callback("glVertexAttrib2d", (void*)glad_debug_real_glVertexAttrib2d, 3, a0, a1, a2); }
+static PFNGLVERTEXATTRIB2DVPROC glad_debug_real_glVertexAttrib2dv;
+static void APIENTRY glad_debug_glVertexAttrib2dv(GLuint a0, const GLdouble* a1) { _pre_call_callback("glVertexAttrib2dv", (void*)glad_debug_real_glVertexAttrib2dv, 2, a0, a1); glad_debug_real_glVertexAttrib2dv(a0, a1); _post_call_callback("glVertexAttrib2dv", (void*)glad_debug_real_glVertexAttrib2dv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB2FPROC glad_debug_real_glVertexAttrib2f;
+static void APIENTRY glad_debug_glVertexAttrib2f(GLuint a0, GLfloat a1, GLfloat a2) { _pre_call_callback("glVertexAttrib2f", (void*)glad_debug_real_glVertexAttrib2f, 3, a0, a1, a2); glad_debug_real_glVertexAttrib2f(a0, a1, a2); _post_call_callback("glVertexAttrib2f", (void*)glad_debug_real_glVertexAttrib2f, 3, a0, a1, a2); }
+static PFNGLVERTEXATTRIB2FVPROC glad_debug_real_glVertexAttrib2fv;
+static void APIENTRY glad_debug_glVertexAttrib2fv(GLuint a0, const GLfloat* a1) { _pre_call_callback("glVertexAttrib2fv", (void*)glad_debug_real_glVertexAttrib2fv, 2, a0, a1); glad_debug_real_glVertexAttrib2fv(a0, a1); _post_call_callback("glVertexAttrib2fv", (void*)glad_debug_real_glVertexAttrib2fv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB2SPROC glad_debug_real_glVertexAttrib2s;
+static void APIENTRY glad_debug_glVertexAttrib2s(GLuint a0, GLshort a1, GLshort a2) { _pre_call_callback("glVertexAttrib2s", (void*)glad_debug_real_glVertexAttrib2s, 3, a0, a1, a2); glad_debug_real_glVertexAttrib2s(a0, a1, a2); _post_call_callback("glVertexAttrib2s", (void*)glad_debug_real_glVertexAttrib2s, 3, a0, a1, a2); }
+static PFNGLVERTEXATTRIB2SVPROC glad_debug_real_glVertexAttrib2sv;
+static void APIENTRY glad_debug_glVertexAttrib2sv(GLuint a0, const GLshort* a1) { _pre_call_callback("glVertexAttrib2sv", (void*)glad_debug_real_glVertexAttrib2sv, 2, a0, a1); glad_debug_real_glVertexAttrib2sv(a0, a1); _post_call_callback("glVertexAttrib2sv", (void*)glad_debug_real_glVertexAttrib2sv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB3DPROC glad_debug_real_glVertexAttrib3d;
+static void APIENTRY glad_debug_glVertexAttrib3d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3) { _pre_call_callback("glVertexAttrib3d", (void*)glad_debug_real_glVertexAttrib3d, 4, a0, a1, a2, a3); glad_debug_real_glVertexAttrib3d(a0, a1, a2, a3); _post_call_callback("glVertexAttrib3d", (void*)glad_debug_real_glVertexAttrib3d, 4, a0, a1, a2, a3); }
+static PFNGLVERTEXATTRIB3DVPROC glad_debug_real_glVertexAttrib3dv;
+static void APIENTRY glad_debug_glVertexAttrib3dv(GLuint a0, const GLdouble* a1) { _pre_call_callback("glVertexAttrib3dv", (void*)glad_debug_real_glVertexAttrib3dv, 2, a0, a1); glad_debug_real_glVertexAttrib3dv(a0, a1); _post_call_callback("glVertexAttrib3dv", (void*)glad_debug_real_glVertexAttrib3dv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB3FPROC glad_debug_real_glVertexAttrib3f;
+static void APIENTRY glad_debug_glVertexAttrib3f(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3) { _pre_call_callback("glVertexAttrib3f", (void*)glad_debug_real_glVertexAttrib3f, 4, a0, a1, a2, a3); glad_debug_real_glVertexAttrib3f(a0, a1, a2, a3); _post_call_callback("glVertexAttrib3f", (void*)glad_debug_real_glVertexAttrib3f, 4, a0, a1, a2, a3); }
+static PFNGLVERTEXATTRIB3FVPROC glad_debug_real_glVertexAttrib3fv;
+static void APIENTRY glad_debug_glVertexAttrib3fv(GLuint a0, const GLfloat* a1) { _pre_call_callback("glVertexAttrib3fv", (void*)glad_debug_real_glVertexAttrib3fv, 2, a0, a1); glad_debug_real_glVertexAttrib3fv(a0, a1); _post_call_callback("glVertexAttrib3fv", (void*)glad_debug_real_glVertexAttrib3fv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB3SPROC glad_debug_real_glVertexAttrib3s;
+static void APIENTRY glad_debug_glVertexAttrib3s(GLuint a0, GLshort a1, GLshort a2, GLshort a3) { _pre_call_callback("glVertexAttrib3s", (void*)glad_debug_real_glVertexAttrib3s, 4, a0, a1, a2, a3); glad_debug_real_glVertexAttrib3s(a0, a1, a2, a3); _post_call_callback("glVertexAttrib3s", (void*)glad_debug_real_glVertexAttrib3s, 4, a0, a1, a2, a3); }
+static PFNGLVERTEXATTRIB3SVPROC glad_debug_real_glVertexAttrib3sv;
+static void APIENTRY glad_debug_glVertexAttrib3sv(GLuint a0, const GLshort* a1) { _pre_call_callback("glVertexAttrib3sv", (void*)glad_debug_real_glVertexAttrib3sv, 2, a0, a1); glad_debug_real_glVertexAttrib3sv(a0, a1); _post_call_callback("glVertexAttrib3sv", (void*)glad_debug_real_glVertexAttrib3sv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4NBVPROC glad_debug_real_glVertexAttrib4Nbv;
+static void APIENTRY glad_debug_glVertexAttrib4Nbv(GLuint a0, const GLbyte* a1) { _pre_call_callback("glVertexAttrib4Nbv", (void*)glad_debug_real_glVertexAttrib4Nbv, 2, a0, a1); glad_debug_real_glVertexAttrib4Nbv(a0, a1); _post_call_callback("glVertexAttrib4Nbv", (void*)glad_debug_real_glVertexAttrib4Nbv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4NIVPROC glad_debug_real_glVertexAttrib4Niv;
+static void APIENTRY glad_debug_glVertexAttrib4Niv(GLuint a0, const GLint* a1) { _pre_call_callback("glVertexAttrib4Niv", (void*)glad_debug_real_glVertexAttrib4Niv, 2, a0, a1); glad_debug_real_glVertexAttrib4Niv(a0, a1); _post_call_callback("glVertexAttrib4Niv", (void*)glad_debug_real_glVertexAttrib4Niv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4NSVPROC glad_debug_real_glVertexAttrib4Nsv;
+static void APIENTRY glad_debug_glVertexAttrib4Nsv(GLuint a0, const GLshort* a1) { _pre_call_callback("glVertexAttrib4Nsv", (void*)glad_debug_real_glVertexAttrib4Nsv, 2, a0, a1); glad_debug_real_glVertexAttrib4Nsv(a0, a1); _post_call_callback("glVertexAttrib4Nsv", (void*)glad_debug_real_glVertexAttrib4Nsv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4NUBPROC glad_debug_real_glVertexAttrib4Nub;
+static void APIENTRY glad_debug_glVertexAttrib4Nub(GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4) { _pre_call_callback("glVertexAttrib4Nub", (void*)glad_debug_real_glVertexAttrib4Nub, 5, a0, a1, a2, a3, a4); glad_debug_real_glVertexAttrib4Nub(a0, a1, a2, a3, a4); _post_call_callback("glVertexAttrib4Nub", (void*)glad_debug_real_glVertexAttrib4Nub, 5, a0, a1, a2, a3, a4); }
+static PFNGLVERTEXATTRIB4NUBVPROC glad_debug_real_glVertexAttrib4Nubv;
+static void APIENTRY glad_debug_glVertexAttrib4Nubv(GLuint a0, const GLubyte* a1) { _pre_call_callback("glVertexAttrib4Nubv", (void*)glad_debug_real_glVertexAttrib4Nubv, 2, a0, a1); glad_debug_real_glVertexAttrib4Nubv(a0, a1); _post_call_callback("glVertexAttrib4Nubv", (void*)glad_debug_real_glVertexAttrib4Nubv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4NUIVPROC glad_debug_real_glVertexAttrib4Nuiv;
+static void APIENTRY glad_debug_glVertexAttrib4Nuiv(GLuint a0, const GLuint* a1) { _pre_call_callback("glVertexAttrib4Nuiv", (void*)glad_debug_real_glVertexAttrib4Nuiv, 2, a0, a1); glad_debug_real_glVertexAttrib4Nuiv(a0, a1); _post_call_callback("glVertexAttrib4Nuiv", (void*)glad_debug_real_glVertexAttrib4Nuiv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4NUSVPROC glad_debug_real_glVertexAttrib4Nusv;
+static void APIENTRY glad_debug_glVertexAttrib4Nusv(GLuint a0, const GLushort* a1) { _pre_call_callback("glVertexAttrib4Nusv", (void*)glad_debug_real_glVertexAttrib4Nusv, 2, a0, a1); glad_debug_real_glVertexAttrib4Nusv(a0, a1); _post_call_callback("glVertexAttrib4Nusv", (void*)glad_debug_real_glVertexAttrib4Nusv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4BVPROC glad_debug_real_glVertexAttrib4bv;
+static void APIENTRY glad_debug_glVertexAttrib4bv(GLuint a0, const GLbyte* a1) { _pre_call_callback("glVertexAttrib4bv", (void*)glad_debug_real_glVertexAttrib4bv, 2, a0, a1); glad_debug_real_glVertexAttrib4bv(a0, a1); _post_call_callback("glVertexAttrib4bv", (void*)glad_debug_real_glVertexAttrib4bv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4DPROC glad_debug_real_glVertexAttrib4d;
+static void APIENTRY glad_debug_glVertexAttrib4d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4) { _pre_call_callback("glVertexAttrib4d", (void*)glad_debug_real_glVertexAttrib4d, 5, a0, a1, a2, a3, a4); glad_debug_real_glVertexAttrib4d(a0, a1, a2, a3, a4); _post_call_callback("glVertexAttrib4d", (void*)glad_debug_real_glVertexAttrib4d, 5, a0, a1, a2, a3, a4); }
+static PFNGLVERTEXATTRIB4DVPROC glad_debug_real_glVertexAttrib4dv;
+static void APIENTRY glad_debug_glVertexAttrib4dv(GLuint a0, const GLdouble* a1) { _pre_call_callback("glVertexAttrib4dv", (void*)glad_debug_real_glVertexAttrib4dv, 2, a0, a1); glad_debug_real_glVertexAttrib4dv(a0, a1); _post_call_callback("glVertexAttrib4dv", (void*)glad_debug_real_glVertexAttrib4dv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4FPROC glad_debug_real_glVertexAttrib4f;
+static void APIENTRY glad_debug_glVertexAttrib4f(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4) { _pre_call_callback("glVertexAttrib4f", (void*)glad_debug_real_glVertexAttrib4f, 5, a0, a1, a2, a3, a4); glad_debug_real_glVertexAttrib4f(a0, a1, a2, a3, a4); _post_call_callback("glVertexAttrib4f", (void*)glad_debug_real_glVertexAttrib4f, 5, a0, a1, a2, a3, a4); }
+static PFNGLVERTEXATTRIB4FVPROC glad_debug_real_glVertexAttrib4fv;
+static void APIENTRY glad_debug_glVertexAttrib4fv(GLuint a0, const GLfloat* a1) { _pre_call_callback("glVertexAttrib4fv", (void*)glad_debug_real_glVertexAttrib4fv, 2, a0, a1); glad_debug_real_glVertexAttrib4fv(a0, a1); _post_call_callback("glVertexAttrib4fv", (void*)glad_debug_real_glVertexAttrib4fv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4IVPROC glad_debug_real_glVertexAttrib4iv;
+static void APIENTRY glad_debug_glVertexAttrib4iv(GLuint a0, const GLint* a1) { _pre_call_callback("glVertexAttrib4iv", (void*)glad_debug_real_glVertexAttrib4iv, 2, a0, a1); glad_debug_real_glVertexAttrib4iv(a0, a1); _post_call_callback("glVertexAttrib4iv", (void*)glad_debug_real_glVertexAttrib4iv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4SPROC glad_debug_real_glVertexAttrib4s;
+static void APIENTRY glad_debug_glVertexAttrib4s(GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4) { _pre_call_callback("glVertexAttrib4s", (void*)glad_debug_real_glVertexAttrib4s, 5, a0, a1, a2, a3, a4); glad_debug_real_glVertexAttrib4s(a0, a1, a2, a3, a4); _post_call_callback("glVertexAttrib4s", (void*)glad_debug_real_glVertexAttrib4s, 5, a0, a1, a2, a3, a4); }
+static PFNGLVERTEXATTRIB4SVPROC glad_debug_real_glVertexAttrib4sv;
+static void APIENTRY glad_debug_glVertexAttrib4sv(GLuint a0, const GLshort* a1) { _pre_call_callback("glVertexAttrib4sv", (void*)glad_debug_real_glVertexAttrib4sv, 2, a0, a1); glad_debug_real_glVertexAttrib4sv(a0, a1); _post_call_callback("glVertexAttrib4sv", (void*)glad_debug_real_glVertexAttrib4sv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4UBVPROC glad_debug_real_glVertexAttrib4ubv;
+static void APIENTRY glad_debug_glVertexAttrib4ubv(GLuint a0, const GLubyte* a1) { _pre_call_callback("glVertexAttrib4ubv", (void*)glad_debug_real_glVertexAttrib4ubv, 2, a0, a1); glad_debug_real_glVertexAttrib4ubv(a0, a1); _post_call_callback("glVertexAttrib4ubv", (void*)glad_debug_real_glVertexAttrib4ubv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4UIVPROC glad_debug_real_glVertexAttrib4uiv;
+static void APIENTRY glad_debug_glVertexAttrib4uiv(GLuint a0, const GLuint* a1) { _pre_call_callback("glVertexAttrib4uiv", (void*)glad_debug_real_glVertexAttrib4uiv, 2, a0, a1); glad_debug_real_glVertexAttrib4uiv(a0, a1); _post_call_callback("glVertexAttrib4uiv", (void*)glad_debug_real_glVertexAttrib4uiv, 2, a0, a1); }
+static PFNGLVERTEXATTRIB4USVPROC glad_debug_real_glVertexAttrib4usv;
+static void APIENTRY glad_debug_glVertexAttrib4usv(GLuint a0, const GLushort* a1) { _pre_call_callback("glVertexAttrib4usv", (void*)glad_debug_real_glVertexAttrib4usv, 2, a0, a1); glad_debug_real_glVertexAttrib4usv(a0, a1); _post_call_callback("glVertexAttrib4usv", (void*)glad_debug_real_glVertexAttrib4usv, 2, a0, a1); }
+static PFNGLVERTEXATTRIBPOINTERPROC glad_debug_real_glVertexAttribPointer;
+static void APIENTRY glad_debug_glVertexAttribPointer(GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const void* a5) { _pre_call_callback("glVertexAttribPointer", (void*)glad_debug_real_glVertexAttribPointer, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glVertexAttribPointer(a0, a1, a2, a3, a4, a5); _post_call_callback("glVertexAttribPointer", (void*)glad_debug_real_glVertexAttribPointer, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLBINDBUFFERARBPROC glad_debug_real_glBindBufferARB;
+static void APIENTRY glad_debug_glBindBufferARB(GLenum a0, GLuint a1) { _pre_call_callback("glBindBufferARB", (void*)glad_debug_real_glBindBufferARB, 2, a0, a1); glad_debug_real_glBindBufferARB(a0, a1); _post_call_callback("glBindBufferARB", (void*)glad_debug_real_glBindBufferARB, 2, a0, a1); }
+static PFNGLDELETEBUFFERSARBPROC glad_debug_real_glDeleteBuffersARB;
+static void APIENTRY glad_debug_glDeleteBuffersARB(GLsizei a0, const GLuint* a1) { _pre_call_callback("glDeleteBuffersARB", (void*)glad_debug_real_glDeleteBuffersARB, 2, a0, a1); glad_debug_real_glDeleteBuffersARB(a0, a1); _post_call_callback("glDeleteBuffersARB", (void*)glad_debug_real_glDeleteBuffersARB, 2, a0, a1); }
+static PFNGLGENBUFFERSARBPROC glad_debug_real_glGenBuffersARB;
+static void APIENTRY glad_debug_glGenBuffersARB(GLsizei a0, GLuint* a1) { _pre_call_callback("glGenBuffersARB", (void*)glad_debug_real_glGenBuffersARB, 2, a0, a1); glad_debug_real_glGenBuffersARB(a0, a1); _post_call_callback("glGenBuffersARB", (void*)glad_debug_real_glGenBuffersARB, 2, a0, a1); }
+static PFNGLISBUFFERARBPROC glad_debug_real_glIsBufferARB;
+static GLboolean APIENTRY glad_debug_glIsBufferARB(GLuint a0) { GLboolean ret; _pre_call_callback("glIsBufferARB", (void*)glad_debug_real_glIsBufferARB, 1, a0); ret = glad_debug_real_glIsBufferARB(a0); _post_call_callback("glIsBufferARB", (void*)glad_debug_real_glIsBufferARB, 1, a0); return ret; }
+static PFNGLBUFFERDATAARBPROC glad_debug_real_glBufferDataARB;
+static void APIENTRY glad_debug_glBufferDataARB(GLenum a0, GLsizeiptrARB a1, const void* a2, GLenum a3) { _pre_call_callback("glBufferDataARB", (void*)glad_debug_real_glBufferDataARB, 4, a0, a1, a2, a3); glad_debug_real_glBufferDataARB(a0, a1, a2, a3); _post_call_callback("glBufferDataARB", (void*)glad_debug_real_glBufferDataARB, 4, a0, a1, a2, a3); }
+static PFNGLBUFFERSUBDATAARBPROC glad_debug_real_glBufferSubDataARB;
+static void APIENTRY glad_debug_glBufferSubDataARB(GLenum a0, GLintptrARB a1, GLsizeiptrARB a2, const void* a3) { _pre_call_callback("glBufferSubDataARB", (void*)glad_debug_real_glBufferSubDataARB, 4, a0, a1, a2, a3); glad_debug_real_glBufferSubDataARB(a0, a1, a2, a3); _post_call_callback("glBufferSubDataARB", (void*)glad_debug_real_glBufferSubDataARB, 4, a0, a1, a2, a3); }
+static PFNGLGETBUFFERSUBDATAARBPROC glad_debug_real_glGetBufferSubDataARB;
+static void APIENTRY glad_debug_glGetBufferSubDataARB(GLenum a0, GLintptrARB a1, GLsizeiptrARB a2, void* a3) { _pre_call_callback("glGetBufferSubDataARB", (void*)glad_debug_real_glGetBufferSubDataARB, 4, a0, a1, a2, a3); glad_debug_real_glGetBufferSubDataARB(a0, a1, a2, a3); _post_call_callback("glGetBufferSubDataARB", (void*)glad_debug_real_glGetBufferSubDataARB, 4, a0, a1, a2, a3); }
+static PFNGLMAPBUFFERARBPROC glad_debug_real_glMapBufferARB;
+static void* APIENTRY glad_debug_glMapBufferARB(GLenum a0, GLenum a1) { void* ret; _pre_call_callback("glMapBufferARB", (void*)glad_debug_real_glMapBufferARB, 2, a0, a1); ret = glad_debug_real_glMapBufferARB(a0, a1); _post_call_callback("glMapBufferARB", (void*)glad_debug_real_glMapBufferARB, 2, a0, a1); return ret; }
+static PFNGLUNMAPBUFFERARBPROC glad_debug_real_glUnmapBufferARB;
+static GLboolean APIENTRY glad_debug_glUnmapBufferARB(GLenum a0) { GLboolean ret; _pre_call_callback("glUnmapBufferARB", (void*)glad_debug_real_glUnmapBufferARB, 1, a0); ret = glad_debug_real_glUnmapBufferARB(a0); _post_call_callback("glUnmapBufferARB", (void*)glad_debug_real_glUnmapBufferARB, 1, a0); return ret; }
+static PFNGLGETBUFFERPARAMETERIVARBPROC glad_debug_real_glGetBufferParameterivARB;
+static void APIENTRY glad_debug_glGetBufferParameterivARB(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetBufferParameterivARB", (void*)glad_debug_real_glGetBufferParameterivARB, 3, a0, a1, a2); glad_debug_real_glGetBufferParameterivARB(a0, a1, a2); _post_call_callback("glGetBufferParameterivARB", (void*)glad_debug_real_glGetBufferParameterivARB, 3, a0, a1, a2); }
+static PFNGLGETBUFFERPOINTERVARBPROC glad_debug_real_glGetBufferPointervARB;
+static void APIENTRY glad_debug_glGetBufferPointervARB(GLenum a0, GLenum a1, void** a2) { _pre_call_callback("glGetBufferPointervARB", (void*)glad_debug_real_glGetBufferPointervARB, 3, a0, a1, a2); glad_debug_real_glGetBufferPointervARB(a0, a1, a2); _post_call_callback("glGetBufferPointervARB", (void*)glad_debug_real_glGetBufferPointervARB, 3, a0, a1, a2); }
+static PFNGLBINDVERTEXARRAYPROC glad_debug_real_glBindVertexArray;
+static void APIENTRY glad_debug_glBindVertexArray(GLuint a0) { _pre_call_callback("glBindVertexArray", (void*)glad_debug_real_glBindVertexArray, 1, a0); glad_debug_real_glBindVertexArray(a0); _post_call_callback("glBindVertexArray", (void*)glad_debug_real_glBindVertexArray, 1, a0); }
+static PFNGLDELETEVERTEXARRAYSPROC glad_debug_real_glDeleteVertexArrays;
+static void APIENTRY glad_debug_glDeleteVertexArrays(GLsizei a0, const GLuint* a1) { _pre_call_callback("glDeleteVertexArrays", (void*)glad_debug_real_glDeleteVertexArrays, 2, a0, a1); glad_debug_real_glDeleteVertexArrays(a0, a1); _post_call_callback("glDeleteVertexArrays", (void*)glad_debug_real_glDeleteVertexArrays, 2, a0, a1); }
+static PFNGLGENVERTEXARRAYSPROC glad_debug_real_glGenVertexArrays;
+static void APIENTRY glad_debug_glGenVertexArrays(GLsizei a0, GLuint* a1) { _pre_call_callback("glGenVertexArrays", (void*)glad_debug_real_glGenVertexArrays, 2, a0, a1); glad_debug_real_glGenVertexArrays(a0, a1); _post_call_callback("glGenVertexArrays", (void*)glad_debug_real_glGenVertexArrays, 2, a0, a1); }
+static PFNGLISVERTEXARRAYPROC glad_debug_real_glIsVertexArray;
+static GLboolean APIENTRY glad_debug_glIsVertexArray(GLuint a0) { GLboolean ret; _pre_call_callback("glIsVertexArray", (void*)glad_debug_real_glIsVertexArray, 1, a0); ret = glad_debug_real_glIsVertexArray(a0); _post_call_callback("glIsVertexArray", (void*)glad_debug_real_glIsVertexArray, 1, a0); return ret; }
+static PFNGLISRENDERBUFFERPROC glad_debug_real_glIsRenderbuffer;
+static GLboolean APIENTRY glad_debug_glIsRenderbuffer(GLuint a0) { GLboolean ret; _pre_call_callback("glIsRenderbuffer", (void*)glad_debug_real_glIsRenderbuffer, 1, a0); ret = glad_debug_real_glIsRenderbuffer(a0); _post_call_callback("glIsRenderbuffer", (void*)glad_debug_real_glIsRenderbuffer, 1, a0); return ret; }
+static PFNGLBINDRENDERBUFFERPROC glad_debug_real_glBindRenderbuffer;
+static void APIENTRY glad_debug_glBindRenderbuffer(GLenum a0, GLuint a1) { _pre_call_callback("glBindRenderbuffer", (void*)glad_debug_real_glBindRenderbuffer, 2, a0, a1); glad_debug_real_glBindRenderbuffer(a0, a1); _post_call_callback("glBindRenderbuffer", (void*)glad_debug_real_glBindRenderbuffer, 2, a0, a1); }
+static PFNGLDELETERENDERBUFFERSPROC glad_debug_real_glDeleteRenderbuffers;
+static void APIENTRY glad_debug_glDeleteRenderbuffers(GLsizei a0, const GLuint* a1) { _pre_call_callback("glDeleteRenderbuffers", (void*)glad_debug_real_glDeleteRenderbuffers, 2, a0, a1); glad_debug_real_glDeleteRenderbuffers(a0, a1); _post_call_callback("glDeleteRenderbuffers", (void*)glad_debug_real_glDeleteRenderbuffers, 2, a0, a1); }
+static PFNGLGENRENDERBUFFERSPROC glad_debug_real_glGenRenderbuffers;
+static void APIENTRY glad_debug_glGenRenderbuffers(GLsizei a0, GLuint* a1) { _pre_call_callback("glGenRenderbuffers", (void*)glad_debug_real_glGenRenderbuffers, 2, a0, a1); glad_debug_real_glGenRenderbuffers(a0, a1); _post_call_callback("glGenRenderbuffers", (void*)glad_debug_real_glGenRenderbuffers, 2, a0, a1); }
+static PFNGLRENDERBUFFERSTORAGEPROC glad_debug_real_glRenderbufferStorage;
+static void APIENTRY glad_debug_glRenderbufferStorage(GLenum a0, GLenum a1, GLsizei a2, GLsizei a3) { _pre_call_callback("glRenderbufferStorage", (void*)glad_debug_real_glRenderbufferStorage, 4, a0, a1, a2, a3); glad_debug_real_glRenderbufferStorage(a0, a1, a2, a3); _post_call_callback("glRenderbufferStorage", (void*)glad_debug_real_glRenderbufferStorage, 4, a0, a1, a2, a3); }
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_debug_real_glGetRenderbufferParameteriv;
+static void APIENTRY glad_debug_glGetRenderbufferParameteriv(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetRenderbufferParameteriv", (void*)glad_debug_real_glGetRenderbufferParameteriv, 3, a0, a1, a2); glad_debug_real_glGetRenderbufferParameteriv(a0, a1, a2); _post_call_callback("glGetRenderbufferParameteriv", (void*)glad_debug_real_glGetRenderbufferParameteriv, 3, a0, a1, a2); }
+static PFNGLISFRAMEBUFFERPROC glad_debug_real_glIsFramebuffer;
+static GLboolean APIENTRY glad_debug_glIsFramebuffer(GLuint a0) { GLboolean ret; _pre_call_callback("glIsFramebuffer", (void*)glad_debug_real_glIsFramebuffer, 1, a0); ret = glad_debug_real_glIsFramebuffer(a0); _post_call_callback("glIsFramebuffer", (void*)glad_debug_real_glIsFramebuffer, 1, a0); return ret; }
+static PFNGLBINDFRAMEBUFFERPROC glad_debug_real_glBindFramebuffer;
+static void APIENTRY glad_debug_glBindFramebuffer(GLenum a0, GLuint a1) { _pre_call_callback("glBindFramebuffer", (void*)glad_debug_real_glBindFramebuffer, 2, a0, a1); glad_debug_real_glBindFramebuffer(a0, a1); _post_call_callback("glBindFramebuffer", (void*)glad_debug_real_glBindFramebuffer, 2, a0, a1); }
+static PFNGLDELETEFRAMEBUFFERSPROC glad_debug_real_glDeleteFramebuffers;
+static void APIENTRY glad_debug_glDeleteFramebuffers(GLsizei a0, const GLuint* a1) { _pre_call_callback("glDeleteFramebuffers", (void*)glad_debug_real_glDeleteFramebuffers, 2, a0, a1); glad_debug_real_glDeleteFramebuffers(a0, a1); _post_call_callback("glDeleteFramebuffers", (void*)glad_debug_real_glDeleteFramebuffers, 2, a0, a1); }
+static PFNGLGENFRAMEBUFFERSPROC glad_debug_real_glGenFramebuffers;
+static void APIENTRY glad_debug_glGenFramebuffers(GLsizei a0, GLuint* a1) { _pre_call_callback("glGenFramebuffers", (void*)glad_debug_real_glGenFramebuffers, 2, a0, a1); glad_debug_real_glGenFramebuffers(a0, a1); _post_call_callback("glGenFramebuffers", (void*)glad_debug_real_glGenFramebuffers, 2, a0, a1); }
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_debug_real_glCheckFramebufferStatus;
+static GLenum APIENTRY glad_debug_glCheckFramebufferStatus(GLenum a0) { GLenum ret; _pre_call_callback("glCheckFramebufferStatus", (void*)glad_debug_real_glCheckFramebufferStatus, 1, a0); ret = glad_debug_real_glCheckFramebufferStatus(a0); _post_call_callback("glCheckFramebufferStatus", (void*)glad_debug_real_glCheckFramebufferStatus, 1, a0); return ret; }
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_debug_real_glFramebufferTexture1D;
+static void APIENTRY glad_debug_glFramebufferTexture1D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { _pre_call_callback("glFramebufferTexture1D", (void*)glad_debug_real_glFramebufferTexture1D, 5, a0, a1, a2, a3, a4); glad_debug_real_glFramebufferTexture1D(a0, a1, a2, a3, a4); _post_call_callback("glFramebufferTexture1D", (void*)glad_debug_real_glFramebufferTexture1D, 5, a0, a1, a2, a3, a4); }
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_debug_real_glFramebufferTexture2D;
+static void APIENTRY glad_debug_glFramebufferTexture2D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { _pre_call_callback("glFramebufferTexture2D", (void*)glad_debug_real_glFramebufferTexture2D, 5, a0, a1, a2, a3, a4); glad_debug_real_glFramebufferTexture2D(a0, a1, a2, a3, a4); _post_call_callback("glFramebufferTexture2D", (void*)glad_debug_real_glFramebufferTexture2D, 5, a0, a1, a2, a3, a4); }
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_debug_real_glFramebufferTexture3D;
+static void APIENTRY glad_debug_glFramebufferTexture3D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5) { _pre_call_callback("glFramebufferTexture3D", (void*)glad_debug_real_glFramebufferTexture3D, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glFramebufferTexture3D(a0, a1, a2, a3, a4, a5); _post_call_callback("glFramebufferTexture3D", (void*)glad_debug_real_glFramebufferTexture3D, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_debug_real_glFramebufferRenderbuffer;
+static void APIENTRY glad_debug_glFramebufferRenderbuffer(GLenum a0, GLenum a1, GLenum a2, GLuint a3) { _pre_call_callback("glFramebufferRenderbuffer", (void*)glad_debug_real_glFramebufferRenderbuffer, 4, a0, a1, a2, a3); glad_debug_real_glFramebufferRenderbuffer(a0, a1, a2, a3); _post_call_callback("glFramebufferRenderbuffer", (void*)glad_debug_real_glFramebufferRenderbuffer, 4, a0, a1, a2, a3); }
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_real_glGetFramebufferAttachmentParameteriv;
+static void APIENTRY glad_debug_glGetFramebufferAttachmentParameteriv(GLenum a0, GLenum a1, GLenum a2, GLint* a3) { _pre_call_callback("glGetFramebufferAttachmentParameteriv", (void*)glad_debug_real_glGetFramebufferAttachmentParameteriv, 4, a0, a1, a2, a3); glad_debug_real_glGetFramebufferAttachmentParameteriv(a0, a1, a2, a3); _post_call_callback("glGetFramebufferAttachmentParameteriv", (void*)glad_debug_real_glGetFramebufferAttachmentParameteriv, 4, a0, a1, a2, a3); }
+static PFNGLGENERATEMIPMAPPROC glad_debug_real_glGenerateMipmap;
+static void APIENTRY glad_debug_glGenerateMipmap(GLenum a0) { _pre_call_callback("glGenerateMipmap", (void*)glad_debug_real_glGenerateMipmap, 1, a0); glad_debug_real_glGenerateMipmap(a0); _post_call_callback("glGenerateMipmap", (void*)glad_debug_real_glGenerateMipmap, 1, a0); }
+static PFNGLBLITFRAMEBUFFERPROC glad_debug_real_glBlitFramebuffer;
+static void APIENTRY glad_debug_glBlitFramebuffer(GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9) { _pre_call_callback("glBlitFramebuffer", (void*)glad_debug_real_glBlitFramebuffer, 10, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); glad_debug_real_glBlitFramebuffer(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); _post_call_callback("glBlitFramebuffer", (void*)glad_debug_real_glBlitFramebuffer, 10, a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_real_glRenderbufferStorageMultisample;
+static void APIENTRY glad_debug_glRenderbufferStorageMultisample(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4) { _pre_call_callback("glRenderbufferStorageMultisample", (void*)glad_debug_real_glRenderbufferStorageMultisample, 5, a0, a1, a2, a3, a4); glad_debug_real_glRenderbufferStorageMultisample(a0, a1, a2, a3, a4); _post_call_callback("glRenderbufferStorageMultisample", (void*)glad_debug_real_glRenderbufferStorageMultisample, 5, a0, a1, a2, a3, a4); }
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_debug_real_glFramebufferTextureLayer;
+static void APIENTRY glad_debug_glFramebufferTextureLayer(GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4) { _pre_call_callback("glFramebufferTextureLayer", (void*)glad_debug_real_glFramebufferTextureLayer, 5, a0, a1, a2, a3, a4); glad_debug_real_glFramebufferTextureLayer(a0, a1, a2, a3, a4); _post_call_callback("glFramebufferTextureLayer", (void*)glad_debug_real_glFramebufferTextureLayer, 5, a0, a1, a2, a3, a4); }
+static PFNGLISRENDERBUFFEREXTPROC glad_debug_real_glIsRenderbufferEXT;
+static GLboolean APIENTRY glad_debug_glIsRenderbufferEXT(GLuint a0) { GLboolean ret; _pre_call_callback("glIsRenderbufferEXT", (void*)glad_debug_real_glIsRenderbufferEXT, 1, a0); ret = glad_debug_real_glIsRenderbufferEXT(a0); _post_call_callback("glIsRenderbufferEXT", (void*)glad_debug_real_glIsRenderbufferEXT, 1, a0); return ret; }
+static PFNGLBINDRENDERBUFFEREXTPROC glad_debug_real_glBindRenderbufferEXT;
+static void APIENTRY glad_debug_glBindRenderbufferEXT(GLenum a0, GLuint a1) { _pre_call_callback("glBindRenderbufferEXT", (void*)glad_debug_real_glBindRenderbufferEXT, 2, a0, a1); glad_debug_real_glBindRenderbufferEXT(a0, a1); _post_call_callback("glBindRenderbufferEXT", (void*)glad_debug_real_glBindRenderbufferEXT, 2, a0, a1); }
+static PFNGLDELETERENDERBUFFERSEXTPROC glad_debug_real_glDeleteRenderbuffersEXT;
+static void APIENTRY glad_debug_glDeleteRenderbuffersEXT(GLsizei a0, const GLuint* a1) { _pre_call_callback("glDeleteRenderbuffersEXT", (void*)glad_debug_real_glDeleteRenderbuffersEXT, 2, a0, a1); glad_debug_real_glDeleteRenderbuffersEXT(a0, a1); _post_call_callback("glDeleteRenderbuffersEXT", (void*)glad_debug_real_glDeleteRenderbuffersEXT, 2, a0, a1); }
+static PFNGLGENRENDERBUFFERSEXTPROC glad_debug_real_glGenRenderbuffersEXT;
+static void APIENTRY glad_debug_glGenRenderbuffersEXT(GLsizei a0, GLuint* a1) { _pre_call_callback("glGenRenderbuffersEXT", (void*)glad_debug_real_glGenRenderbuffersEXT, 2, a0, a1); glad_debug_real_glGenRenderbuffersEXT(a0, a1); _post_call_callback("glGenRenderbuffersEXT", (void*)glad_debug_real_glGenRenderbuffersEXT, 2, a0, a1); }
+static PFNGLRENDERBUFFERSTORAGEEXTPROC glad_debug_real_glRenderbufferStorageEXT;
+static void APIENTRY glad_debug_glRenderbufferStorageEXT(GLenum a0, GLenum a1, GLsizei a2, GLsizei a3) { _pre_call_callback("glRenderbufferStorageEXT", (void*)glad_debug_real_glRenderbufferStorageEXT, 4, a0, a1, a2, a3); glad_debug_real_glRenderbufferStorageEXT(a0, a1, a2, a3); _post_call_callback("glRenderbufferStorageEXT", (void*)glad_debug_real_glRenderbufferStorageEXT, 4, a0, a1, a2, a3); }
+static PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC glad_debug_real_glGetRenderbufferParameterivEXT;
+static void APIENTRY glad_debug_glGetRenderbufferParameterivEXT(GLenum a0, GLenum a1, GLint* a2) { _pre_call_callback("glGetRenderbufferParameterivEXT", (void*)glad_debug_real_glGetRenderbufferParameterivEXT, 3, a0, a1, a2); glad_debug_real_glGetRenderbufferParameterivEXT(a0, a1, a2); _post_call_callback("glGetRenderbufferParameterivEXT", (void*)glad_debug_real_glGetRenderbufferParameterivEXT, 3, a0, a1, a2); }
+static PFNGLISFRAMEBUFFEREXTPROC glad_debug_real_glIsFramebufferEXT;
+static GLboolean APIENTRY glad_debug_glIsFramebufferEXT(GLuint a0) { GLboolean ret; _pre_call_callback("glIsFramebufferEXT", (void*)glad_debug_real_glIsFramebufferEXT, 1, a0); ret = glad_debug_real_glIsFramebufferEXT(a0); _post_call_callback("glIsFramebufferEXT", (void*)glad_debug_real_glIsFramebufferEXT, 1, a0); return ret; }
+static PFNGLBINDFRAMEBUFFEREXTPROC glad_debug_real_glBindFramebufferEXT;
+static void APIENTRY glad_debug_glBindFramebufferEXT(GLenum a0, GLuint a1) { _pre_call_callback("glBindFramebufferEXT", (void*)glad_debug_real_glBindFramebufferEXT, 2, a0, a1); glad_debug_real_glBindFramebufferEXT(a0, a1); _post_call_callback("glBindFramebufferEXT", (void*)glad_debug_real_glBindFramebufferEXT, 2, a0, a1); }
+static PFNGLDELETEFRAMEBUFFERSEXTPROC glad_debug_real_glDeleteFramebuffersEXT;
+static void APIENTRY glad_debug_glDeleteFramebuffersEXT(GLsizei a0, const GLuint* a1) { _pre_call_callback("glDeleteFramebuffersEXT", (void*)glad_debug_real_glDeleteFramebuffersEXT, 2, a0, a1); glad_debug_real_glDeleteFramebuffersEXT(a0, a1); _post_call_callback("glDeleteFramebuffersEXT", (void*)glad_debug_real_glDeleteFramebuffersEXT, 2, a0, a1); }
+static PFNGLGENFRAMEBUFFERSEXTPROC glad_debug_real_glGenFramebuffersEXT;
+static void APIENTRY glad_debug_glGenFramebuffersEXT(GLsizei a0, GLuint* a1) { _pre_call_callback("glGenFramebuffersEXT", (void*)glad_debug_real_glGenFramebuffersEXT, 2, a0, a1); glad_debug_real_glGenFramebuffersEXT(a0, a1); _post_call_callback("glGenFramebuffersEXT", (void*)glad_debug_real_glGenFramebuffersEXT, 2, a0, a1); }
+static PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC glad_debug_real_glCheckFramebufferStatusEXT;
+static GLenum APIENTRY glad_debug_glCheckFramebufferStatusEXT(GLenum a0) { GLenum ret; _pre_call_callback("glCheckFramebufferStatusEXT", (void*)glad_debug_real_glCheckFramebufferStatusEXT, 1, a0); ret = glad_debug_real_glCheckFramebufferStatusEXT(a0); _post_call_callback("glCheckFramebufferStatusEXT", (void*)glad_debug_real_glCheckFramebufferStatusEXT, 1, a0); return ret; }
+static PFNGLFRAMEBUFFERTEXTURE1DEXTPROC glad_debug_real_glFramebufferTexture1DEXT;
+static void APIENTRY glad_debug_glFramebufferTexture1DEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { _pre_call_callback("glFramebufferTexture1DEXT", (void*)glad_debug_real_glFramebufferTexture1DEXT, 5, a0, a1, a2, a3, a4); glad_debug_real_glFramebufferTexture1DEXT(a0, a1, a2, a3, a4); _post_call_callback("glFramebufferTexture1DEXT", (void*)glad_debug_real_glFramebufferTexture1DEXT, 5, a0, a1, a2, a3, a4); }
+static PFNGLFRAMEBUFFERTEXTURE2DEXTPROC glad_debug_real_glFramebufferTexture2DEXT;
+static void APIENTRY glad_debug_glFramebufferTexture2DEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { _pre_call_callback("glFramebufferTexture2DEXT", (void*)glad_debug_real_glFramebufferTexture2DEXT, 5, a0, a1, a2, a3, a4); glad_debug_real_glFramebufferTexture2DEXT(a0, a1, a2, a3, a4); _post_call_callback("glFramebufferTexture2DEXT", (void*)glad_debug_real_glFramebufferTexture2DEXT, 5, a0, a1, a2, a3, a4); }
+static PFNGLFRAMEBUFFERTEXTURE3DEXTPROC glad_debug_real_glFramebufferTexture3DEXT;
+static void APIENTRY glad_debug_glFramebufferTexture3DEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5) { _pre_call_callback("glFramebufferTexture3DEXT", (void*)glad_debug_real_glFramebufferTexture3DEXT, 6, a0, a1, a2, a3, a4, a5); glad_debug_real_glFramebufferTexture3DEXT(a0, a1, a2, a3, a4, a5); _post_call_callback("glFramebufferTexture3DEXT", (void*)glad_debug_real_glFramebufferTexture3DEXT, 6, a0, a1, a2, a3, a4, a5); }
+static PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC glad_debug_real_glFramebufferRenderbufferEXT;
+static void APIENTRY glad_debug_glFramebufferRenderbufferEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3) { _pre_call_callback("glFramebufferRenderbufferEXT", (void*)glad_debug_real_glFramebufferRenderbufferEXT, 4, a0, a1, a2, a3); glad_debug_real_glFramebufferRenderbufferEXT(a0, a1, a2, a3); _post_call_callback("glFramebufferRenderbufferEXT", (void*)glad_debug_real_glFramebufferRenderbufferEXT, 4, a0, a1, a2, a3); }
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC glad_debug_real_glGetFramebufferAttachmentParameterivEXT;
+static void APIENTRY glad_debug_glGetFramebufferAttachmentParameterivEXT(GLenum a0, GLenum a1, GLenum a2, GLint* a3) { _pre_call_callback("glGetFramebufferAttachmentParameterivEXT", (void*)glad_debug_real_glGetFramebufferAttachmentParameterivEXT, 4, a0, a1, a2, a3); glad_debug_real_glGetFramebufferAttachmentParameterivEXT(a0, a1, a2, a3); _post_call_callback("glGetFramebufferAttachmentParameterivEXT", (void*)glad_debug_real_glGetFramebufferAttachmentParameterivEXT, 4, a0, a1, a2, a3); }
+static PFNGLGENERATEMIPMAPEXTPROC glad_debug_real_glGenerateMipmapEXT;
+static void APIENTRY glad_debug_glGenerateMipmapEXT(GLenum a0) { _pre_call_callback("glGenerateMipmapEXT", (void*)glad_debug_real_glGenerateMipmapEXT, 1, a0); glad_debug_real_glGenerateMipmapEXT(a0); _post_call_callback("glGenerateMipmapEXT", (void*)glad_debug_real_glGenerateMipmapEXT, 1, a0); }
+static PFNGLBINDVERTEXARRAYAPPLEPROC glad_debug_real_glBindVertexArrayAPPLE;
+static void APIENTRY glad_debug_glBindVertexArrayAPPLE(GLuint a0) { _pre_call_callback("glBindVertexArrayAPPLE", (void*)glad_debug_real_glBindVertexArrayAPPLE, 1, a0); glad_debug_real_glBindVertexArrayAPPLE(a0); _post_call_callback("glBindVertexArrayAPPLE", (void*)glad_debug_real_glBindVertexArrayAPPLE, 1, a0); }
+static PFNGLDELETEVERTEXARRAYSAPPLEPROC glad_debug_real_glDeleteVertexArraysAPPLE;
+static void APIENTRY glad_debug_glDeleteVertexArraysAPPLE(GLsizei a0, const GLuint* a1) { _pre_call_callback("glDeleteVertexArraysAPPLE", (void*)glad_debug_real_glDeleteVertexArraysAPPLE, 2, a0, a1); glad_debug_real_glDeleteVertexArraysAPPLE(a0, a1); _post_call_callback("glDeleteVertexArraysAPPLE", (void*)glad_debug_real_glDeleteVertexArraysAPPLE, 2, a0, a1); }
+static PFNGLGENVERTEXARRAYSAPPLEPROC glad_debug_real_glGenVertexArraysAPPLE;
+static void APIENTRY glad_debug_glGenVertexArraysAPPLE(GLsizei a0, GLuint* a1) { _pre_call_callback("glGenVertexArraysAPPLE", (void*)glad_debug_real_glGenVertexArraysAPPLE, 2, a0, a1); glad_debug_real_glGenVertexArraysAPPLE(a0, a1); _post_call_callback("glGenVertexArraysAPPLE", (void*)glad_debug_real_glGenVertexArraysAPPLE, 2, a0, a1); }
+static PFNGLISVERTEXARRAYAPPLEPROC glad_debug_real_glIsVertexArrayAPPLE;
+static GLboolean APIENTRY glad_debug_glIsVertexArrayAPPLE(GLuint a0) { GLboolean ret; _pre_call_callback("glIsVertexArrayAPPLE", (void*)glad_debug_real_glIsVertexArrayAPPLE, 1, a0); ret = glad_debug_real_glIsVertexArrayAPPLE(a0); _post_call_callback("glIsVertexArrayAPPLE", (void*)glad_debug_real_glIsVertexArrayAPPLE, 1, a0); return ret; }
+
+#define GLAD_DEBUG_INSTALL(name) if (glad_##name) { glad_debug_real_##name = glad_##name; glad_##name = glad_debug_##name; }
+
+static void install_debug_GL(void) {
+	GLAD_DEBUG_INSTALL(glCullFace);
+	GLAD_DEBUG_INSTALL(glFrontFace);
+	GLAD_DEBUG_INSTALL(glHint);
+	GLAD_DEBUG_INSTALL(glLineWidth);
+	GLAD_DEBUG_INSTALL(glPointSize);
+	GLAD_DEBUG_INSTALL(glPolygonMode);
+	GLAD_DEBUG_INSTALL(glScissor);
+	GLAD_DEBUG_INSTALL(glTexParameterf);
+	GLAD_DEBUG_INSTALL(glTexParameterfv);
+	GLAD_DEBUG_INSTALL(glTexParameteri);
+	GLAD_DEBUG_INSTALL(glTexParameteriv);
+	GLAD_DEBUG_INSTALL(glTexImage1D);
+	GLAD_DEBUG_INSTALL(glTexImage2D);
+	GLAD_DEBUG_INSTALL(glDrawBuffer);
+	GLAD_DEBUG_INSTALL(glClear);
+	GLAD_DEBUG_INSTALL(glClearColor);
+	GLAD_DEBUG_INSTALL(glClearStencil);
+	GLAD_DEBUG_INSTALL(glClearDepth);
+	GLAD_DEBUG_INSTALL(glStencilMask);
+	GLAD_DEBUG_INSTALL(glColorMask);
+	GLAD_DEBUG_INSTALL(glDepthMask);
+	GLAD_DEBUG_INSTALL(glDisable);
+	GLAD_DEBUG_INSTALL(glEnable);
+	GLAD_DEBUG_INSTALL(glFinish);
+	GLAD_DEBUG_INSTALL(glFlush);
+	GLAD_DEBUG_INSTALL(glBlendFunc);
+	GLAD_DEBUG_INSTALL(glLogicOp);
+	GLAD_DEBUG_INSTALL(glStencilFunc);
+	GLAD_DEBUG_INSTALL(glStencilOp);
+	GLAD_DEBUG_INSTALL(glDepthFunc);
+	GLAD_DEBUG_INSTALL(glPixelStoref);
+	GLAD_DEBUG_INSTALL(glPixelStorei);
+	GLAD_DEBUG_INSTALL(glReadBuffer);
+	GLAD_DEBUG_INSTALL(glReadPixels);
+	GLAD_DEBUG_INSTALL(glGetBooleanv);
+	GLAD_DEBUG_INSTALL(glGetDoublev);
+	GLAD_DEBUG_INSTALL(glGetFloatv);
+	GLAD_DEBUG_INSTALL(glGetIntegerv);
+	GLAD_DEBUG_INSTALL(glGetString);
+	GLAD_DEBUG_INSTALL(glGetTexImage);
+	GLAD_DEBUG_INSTALL(glGetTexParameterfv);
+	GLAD_DEBUG_INSTALL(glGetTexParameteriv);
+	GLAD_DEBUG_INSTALL(glGetTexLevelParameterfv);
+	GLAD_DEBUG_INSTALL(glGetTexLevelParameteriv);
+	GLAD_DEBUG_INSTALL(glIsEnabled);
+	GLAD_DEBUG_INSTALL(glDepthRange);
+	GLAD_DEBUG_INSTALL(glViewport);
+	GLAD_DEBUG_INSTALL(glNewList);
+	GLAD_DEBUG_INSTALL(glEndList);
+	GLAD_DEBUG_INSTALL(glCallList);
+	GLAD_DEBUG_INSTALL(glCallLists);
+	GLAD_DEBUG_INSTALL(glDeleteLists);
+	GLAD_DEBUG_INSTALL(glGenLists);
+	GLAD_DEBUG_INSTALL(glListBase);
+	GLAD_DEBUG_INSTALL(glBegin);
+	GLAD_DEBUG_INSTALL(glBitmap);
+	GLAD_DEBUG_INSTALL(glColor3b);
+	GLAD_DEBUG_INSTALL(glColor3bv);
+	GLAD_DEBUG_INSTALL(glColor3d);
+	GLAD_DEBUG_INSTALL(glColor3dv);
+	GLAD_DEBUG_INSTALL(glColor3f);
+	GLAD_DEBUG_INSTALL(glColor3fv);
+	GLAD_DEBUG_INSTALL(glColor3i);
+	GLAD_DEBUG_INSTALL(glColor3iv);
+	GLAD_DEBUG_INSTALL(glColor3s);
+	GLAD_DEBUG_INSTALL(glColor3sv);
+	GLAD_DEBUG_INSTALL(glColor3ub);
+	GLAD_DEBUG_INSTALL(glColor3ubv);
+	GLAD_DEBUG_INSTALL(glColor3ui);
+	GLAD_DEBUG_INSTALL(glColor3uiv);
+	GLAD_DEBUG_INSTALL(glColor3us);
+	GLAD_DEBUG_INSTALL(glColor3usv);
+	GLAD_DEBUG_INSTALL(glColor4b);
+	GLAD_DEBUG_INSTALL(glColor4bv);
+	GLAD_DEBUG_INSTALL(glColor4d);
+	GLAD_DEBUG_INSTALL(glColor4dv);
+	GLAD_DEBUG_INSTALL(glColor4f);
+	GLAD_DEBUG_INSTALL(glColor4fv);
+	GLAD_DEBUG_INSTALL(glColor4i);
+	GLAD_DEBUG_INSTALL(glColor4iv);
+	GLAD_DEBUG_INSTALL(glColor4s);
+	GLAD_DEBUG_INSTALL(glColor4sv);
+	GLAD_DEBUG_INSTALL(glColor4ub);
+	GLAD_DEBUG_INSTALL(glColor4ubv);
+	GLAD_DEBUG_INSTALL(glColor4ui);
+	GLAD_DEBUG_INSTALL(glColor4uiv);
+	GLAD_DEBUG_INSTALL(glColor4us);
+	GLAD_DEBUG_INSTALL(glColor4usv);
+	GLAD_DEBUG_INSTALL(glEdgeFlag);
+	GLAD_DEBUG_INSTALL(glEdgeFlagv);
+	GLAD_DEBUG_INSTALL(glEnd);
+	GLAD_DEBUG_INSTALL(glIndexd);
+	GLAD_DEBUG_INSTALL(glIndexdv);
+	GLAD_DEBUG_INSTALL(glIndexf);
+	GLAD_DEBUG_INSTALL(glIndexfv);
+	GLAD_DEBUG_INSTALL(glIndexi);
+	GLAD_DEBUG_INSTALL(glIndexiv);
+	GLAD_DEBUG_INSTALL(glIndexs);
+	GLAD_DEBUG_INSTALL(glIndexsv);
+	GLAD_DEBUG_INSTALL(glNormal3b);
+	GLAD_DEBUG_INSTALL(glNormal3bv);
+	GLAD_DEBUG_INSTALL(glNormal3d);
+	GLAD_DEBUG_INSTALL(glNormal3dv);
+	GLAD_DEBUG_INSTALL(glNormal3f);
+	GLAD_DEBUG_INSTALL(glNormal3fv);
+	GLAD_DEBUG_INSTALL(glNormal3i);
+	GLAD_DEBUG_INSTALL(glNormal3iv);
+	GLAD_DEBUG_INSTALL(glNormal3s);
+	GLAD_DEBUG_INSTALL(glNormal3sv);
+	GLAD_DEBUG_INSTALL(glRasterPos2d);
+	GLAD_DEBUG_INSTALL(glRasterPos2dv);
+	GLAD_DEBUG_INSTALL(glRasterPos2f);
+	GLAD_DEBUG_INSTALL(glRasterPos2fv);
+	GLAD_DEBUG_INSTALL(glRasterPos2i);
+	GLAD_DEBUG_INSTALL(glRasterPos2iv);
+	GLAD_DEBUG_INSTALL(glRasterPos2s);
+	GLAD_DEBUG_INSTALL(glRasterPos2sv);
+	GLAD_DEBUG_INSTALL(glRasterPos3d);
+	GLAD_DEBUG_INSTALL(glRasterPos3dv);
+	GLAD_DEBUG_INSTALL(glRasterPos3f);
+	GLAD_DEBUG_INSTALL(glRasterPos3fv);
+	GLAD_DEBUG_INSTALL(glRasterPos3i);
+	GLAD_DEBUG_INSTALL(glRasterPos3iv);
+	GLAD_DEBUG_INSTALL(glRasterPos3s);
+	GLAD_DEBUG_INSTALL(glRasterPos3sv);
+	GLAD_DEBUG_INSTALL(glRasterPos4d);
+	GLAD_DEBUG_INSTALL(glRasterPos4dv);
+	GLAD_DEBUG_INSTALL(glRasterPos4f);
+	GLAD_DEBUG_INSTALL(glRasterPos4fv);
+	GLAD_DEBUG_INSTALL(glRasterPos4i);
+	GLAD_DEBUG_INSTALL(glRasterPos4iv);
+	GLAD_DEBUG_INSTALL(glRasterPos4s);
+	GLAD_DEBUG_INSTALL(glRasterPos4sv);
+	GLAD_DEBUG_INSTALL(glRectd);
+	GLAD_DEBUG_INSTALL(glRectdv);
+	GLAD_DEBUG_INSTALL(glRectf);
+	GLAD_DEBUG_INSTALL(glRectfv);
+	GLAD_DEBUG_INSTALL(glRecti);
+	GLAD_DEBUG_INSTALL(glRectiv);
+	GLAD_DEBUG_INSTALL(glRects);
+	GLAD_DEBUG_INSTALL(glRectsv);
+	GLAD_DEBUG_INSTALL(glTexCoord1d);
+	GLAD_DEBUG_INSTALL(glTexCoord1dv);
+	GLAD_DEBUG_INSTALL(glTexCoord1f);
+	GLAD_DEBUG_INSTALL(glTexCoord1fv);
+	GLAD_DEBUG_INSTALL(glTexCoord1i);
+	GLAD_DEBUG_INSTALL(glTexCoord1iv);
+	GLAD_DEBUG_INSTALL(glTexCoord1s);
+	GLAD_DEBUG_INSTALL(glTexCoord1sv);
+	GLAD_DEBUG_INSTALL(glTexCoord2d);
+	GLAD_DEBUG_INSTALL(glTexCoord2dv);
+	GLAD_DEBUG_INSTALL(glTexCoord2f);
+	GLAD_DEBUG_INSTALL(glTexCoord2fv);
+	GLAD_DEBUG_INSTALL(glTexCoord2i);
+	GLAD_DEBUG_INSTALL(glTexCoord2iv);
+	GLAD_DEBUG_INSTALL(glTexCoord2s);
+	GLAD_DEBUG_INSTALL(glTexCoord2sv);
+	GLAD_DEBUG_INSTALL(glTexCoord3d);
+	GLAD_DEBUG_INSTALL(glTexCoord3dv);
+	GLAD_DEBUG_INSTALL(glTexCoord3f);
+	GLAD_DEBUG_INSTALL(glTexCoord3fv);
+	GLAD_DEBUG_INSTALL(glTexCoord3i);
+	GLAD_DEBUG_INSTALL(glTexCoord3iv);
+	GLAD_DEBUG_INSTALL(glTexCoord3s);
+	GLAD_DEBUG_INSTALL(glTexCoord3sv);
+	GLAD_DEBUG_INSTALL(glTexCoord4d);
+	GLAD_DEBUG_INSTALL(glTexCoord4dv);
+	GLAD_DEBUG_INSTALL(glTexCoord4f);
+	GLAD_DEBUG_INSTALL(glTexCoord4fv);
+	GLAD_DEBUG_INSTALL(glTexCoord4i);
+	GLAD_DEBUG_INSTALL(glTexCoord4iv);
+	GLAD_DEBUG_INSTALL(glTexCoord4s);
+	GLAD_DEBUG_INSTALL(glTexCoord4sv);
+	GLAD_DEBUG_INSTALL(glVertex2d);
+	GLAD_DEBUG_INSTALL(glVertex2dv);
+	GLAD_DEBUG_INSTALL(glVertex2f);
+	GLAD_DEBUG_INSTALL(glVertex2fv);
+	GLAD_DEBUG_INSTALL(glVertex2i);
+	GLAD_DEBUG_INSTALL(glVertex2iv);
+	GLAD_DEBUG_INSTALL(glVertex2s);
+	GLAD_DEBUG_INSTALL(glVertex2sv);
+	GLAD_DEBUG_INSTALL(glVertex3d);
+	GLAD_DEBUG_INSTALL(glVertex3dv);
+	GLAD_DEBUG_INSTALL(glVertex3f);
+	GLAD_DEBUG_INSTALL(glVertex3fv);
+	GLAD_DEBUG_INSTALL(glVertex3i);
+	GLAD_DEBUG_INSTALL(glVertex3iv);
+	GLAD_DEBUG_INSTALL(glVertex3s);
+	GLAD_DEBUG_INSTALL(glVertex3sv);
+	GLAD_DEBUG_INSTALL(glVertex4d);
+	GLAD_DEBUG_INSTALL(glVertex4dv);
+	GLAD_DEBUG_INSTALL(glVertex4f);
+	GLAD_DEBUG_INSTALL(glVertex4fv);
+	GLAD_DEBUG_INSTALL(glVertex4i);
+	GLAD_DEBUG_INSTALL(glVertex4iv);
+	GLAD_DEBUG_INSTALL(glVertex4s);
+	GLAD_DEBUG_INSTALL(glVertex4sv);
+	GLAD_DEBUG_INSTALL(glClipPlane);
+	GLAD_DEBUG_INSTALL(glColorMaterial);
+	GLAD_DEBUG_INSTALL(glFogf);
+	GLAD_DEBUG_INSTALL(glFogfv);
+	GLAD_DEBUG_INSTALL(glFogi);
+	GLAD_DEBUG_INSTALL(glFogiv);
+	GLAD_DEBUG_INSTALL(glLightf);
+	GLAD_DEBUG_INSTALL(glLightfv);
+	GLAD_DEBUG_INSTALL(glLighti);
+	GLAD_DEBUG_INSTALL(glLightiv);
+	GLAD_DEBUG_INSTALL(glLightModelf);
+	GLAD_DEBUG_INSTALL(glLightModelfv);
+	GLAD_DEBUG_INSTALL(glLightModeli);
+	GLAD_DEBUG_INSTALL(glLightModeliv);
+	GLAD_DEBUG_INSTALL(glLineStipple);
+	GLAD_DEBUG_INSTALL(glMaterialf);
+	GLAD_DEBUG_INSTALL(glMaterialfv);
+	GLAD_DEBUG_INSTALL(glMateriali);
+	GLAD_DEBUG_INSTALL(glMaterialiv);
+	GLAD_DEBUG_INSTALL(glPolygonStipple);
+	GLAD_DEBUG_INSTALL(glShadeModel);
+	GLAD_DEBUG_INSTALL(glTexEnvf);
+	GLAD_DEBUG_INSTALL(glTexEnvfv);
+	GLAD_DEBUG_INSTALL(glTexEnvi);
+	GLAD_DEBUG_INSTALL(glTexEnviv);
+	GLAD_DEBUG_INSTALL(glTexGend);
+	GLAD_DEBUG_INSTALL(glTexGendv);
+	GLAD_DEBUG_INSTALL(glTexGenf);
+	GLAD_DEBUG_INSTALL(glTexGenfv);
+	GLAD_DEBUG_INSTALL(glTexGeni);
+	GLAD_DEBUG_INSTALL(glTexGeniv);
+	GLAD_DEBUG_INSTALL(glFeedbackBuffer);
+	GLAD_DEBUG_INSTALL(glSelectBuffer);
+	GLAD_DEBUG_INSTALL(glRenderMode);
+	GLAD_DEBUG_INSTALL(glInitNames);
+	GLAD_DEBUG_INSTALL(glLoadName);
+	GLAD_DEBUG_INSTALL(glPassThrough);
+	GLAD_DEBUG_INSTALL(glPopName);
+	GLAD_DEBUG_INSTALL(glPushName);
+	GLAD_DEBUG_INSTALL(glClearAccum);
+	GLAD_DEBUG_INSTALL(glClearIndex);
+	GLAD_DEBUG_INSTALL(glIndexMask);
+	GLAD_DEBUG_INSTALL(glAccum);
+	GLAD_DEBUG_INSTALL(glPopAttrib);
+	GLAD_DEBUG_INSTALL(glPushAttrib);
+	GLAD_DEBUG_INSTALL(glMap1d);
+	GLAD_DEBUG_INSTALL(glMap1f);
+	GLAD_DEBUG_INSTALL(glMap2d);
+	GLAD_DEBUG_INSTALL(glMap2f);
+	GLAD_DEBUG_INSTALL(glMapGrid1d);
+	GLAD_DEBUG_INSTALL(glMapGrid1f);
+	GLAD_DEBUG_INSTALL(glMapGrid2d);
+	GLAD_DEBUG_INSTALL(glMapGrid2f);
+	GLAD_DEBUG_INSTALL(glEvalCoord1d);
+	GLAD_DEBUG_INSTALL(glEvalCoord1dv);
+	GLAD_DEBUG_INSTALL(glEvalCoord1f);
+	GLAD_DEBUG_INSTALL(glEvalCoord1fv);
+	GLAD_DEBUG_INSTALL(glEvalCoord2d);
+	GLAD_DEBUG_INSTALL(glEvalCoord2dv);
+	GLAD_DEBUG_INSTALL(glEvalCoord2f);
+	GLAD_DEBUG_INSTALL(glEvalCoord2fv);
+	GLAD_DEBUG_INSTALL(glEvalMesh1);
+	GLAD_DEBUG_INSTALL(glEvalPoint1);
+	GLAD_DEBUG_INSTALL(glEvalMesh2);
+	GLAD_DEBUG_INSTALL(glEvalPoint2);
+	GLAD_DEBUG_INSTALL(glAlphaFunc);
+	GLAD_DEBUG_INSTALL(glPixelZoom);
+	GLAD_DEBUG_INSTALL(glPixelTransferf);
+	GLAD_DEBUG_INSTALL(glPixelTransferi);
+	GLAD_DEBUG_INSTALL(glPixelMapfv);
+	GLAD_DEBUG_INSTALL(glPixelMapuiv);
+	GLAD_DEBUG_INSTALL(glPixelMapusv);
+	GLAD_DEBUG_INSTALL(glCopyPixels);
+	GLAD_DEBUG_INSTALL(glDrawPixels);
+	GLAD_DEBUG_INSTALL(glGetClipPlane);
+	GLAD_DEBUG_INSTALL(glGetLightfv);
+	GLAD_DEBUG_INSTALL(glGetLightiv);
+	GLAD_DEBUG_INSTALL(glGetMapdv);
+	GLAD_DEBUG_INSTALL(glGetMapfv);
+	GLAD_DEBUG_INSTALL(glGetMapiv);
+	GLAD_DEBUG_INSTALL(glGetMaterialfv);
+	GLAD_DEBUG_INSTALL(glGetMaterialiv);
+	GLAD_DEBUG_INSTALL(glGetPixelMapfv);
+	GLAD_DEBUG_INSTALL(glGetPixelMapuiv);
+	GLAD_DEBUG_INSTALL(glGetPixelMapusv);
+	GLAD_DEBUG_INSTALL(glGetPolygonStipple);
+	GLAD_DEBUG_INSTALL(glGetTexEnvfv);
+	GLAD_DEBUG_INSTALL(glGetTexEnviv);
+	GLAD_DEBUG_INSTALL(glGetTexGendv);
+	GLAD_DEBUG_INSTALL(glGetTexGenfv);
+	GLAD_DEBUG_INSTALL(glGetTexGeniv);
+	GLAD_DEBUG_INSTALL(glIsList);
+	GLAD_DEBUG_INSTALL(glFrustum);
+	GLAD_DEBUG_INSTALL(glLoadIdentity);
+	GLAD_DEBUG_INSTALL(glLoadMatrixf);
+	GLAD_DEBUG_INSTALL(glLoadMatrixd);
+	GLAD_DEBUG_INSTALL(glMatrixMode);
+	GLAD_DEBUG_INSTALL(glMultMatrixf);
+	GLAD_DEBUG_INSTALL(glMultMatrixd);
+	GLAD_DEBUG_INSTALL(glOrtho);
+	GLAD_DEBUG_INSTALL(glPopMatrix);
+	GLAD_DEBUG_INSTALL(glPushMatrix);
+	GLAD_DEBUG_INSTALL(glRotated);
+	GLAD_DEBUG_INSTALL(glRotatef);
+	GLAD_DEBUG_INSTALL(glScaled);
+	GLAD_DEBUG_INSTALL(glScalef);
+	GLAD_DEBUG_INSTALL(glTranslated);
+	GLAD_DEBUG_INSTALL(glTranslatef);
+	GLAD_DEBUG_INSTALL(glDrawArrays);
+	GLAD_DEBUG_INSTALL(glDrawElements);
+	GLAD_DEBUG_INSTALL(glGetPointerv);
+	GLAD_DEBUG_INSTALL(glPolygonOffset);
+	GLAD_DEBUG_INSTALL(glCopyTexImage1D);
+	GLAD_DEBUG_INSTALL(glCopyTexImage2D);
+	GLAD_DEBUG_INSTALL(glCopyTexSubImage1D);
+	GLAD_DEBUG_INSTALL(glCopyTexSubImage2D);
+	GLAD_DEBUG_INSTALL(glTexSubImage1D);
+	GLAD_DEBUG_INSTALL(glTexSubImage2D);
+	GLAD_DEBUG_INSTALL(glBindTexture);
+	GLAD_DEBUG_INSTALL(glDeleteTextures);
+	GLAD_DEBUG_INSTALL(glGenTextures);
+	GLAD_DEBUG_INSTALL(glIsTexture);
+	GLAD_DEBUG_INSTALL(glArrayElement);
+	GLAD_DEBUG_INSTALL(glColorPointer);
+	GLAD_DEBUG_INSTALL(glDisableClientState);
+	GLAD_DEBUG_INSTALL(glEdgeFlagPointer);
+	GLAD_DEBUG_INSTALL(glEnableClientState);
+	GLAD_DEBUG_INSTALL(glIndexPointer);
+	GLAD_DEBUG_INSTALL(glInterleavedArrays);
+	GLAD_DEBUG_INSTALL(glNormalPointer);
+	GLAD_DEBUG_INSTALL(glTexCoordPointer);
+	GLAD_DEBUG_INSTALL(glVertexPointer);
+	GLAD_DEBUG_INSTALL(glAreTexturesResident);
+	GLAD_DEBUG_INSTALL(glPrioritizeTextures);
+	GLAD_DEBUG_INSTALL(glIndexub);
+	GLAD_DEBUG_INSTALL(glIndexubv);
+	GLAD_DEBUG_INSTALL(glPopClientAttrib);
+	GLAD_DEBUG_INSTALL(glPushClientAttrib);
+	GLAD_DEBUG_INSTALL(glDrawRangeElements);
+	GLAD_DEBUG_INSTALL(glTexImage3D);
+	GLAD_DEBUG_INSTALL(glTexSubImage3D);
+	GLAD_DEBUG_INSTALL(glCopyTexSubImage3D);
+	GLAD_DEBUG_INSTALL(glActiveTexture);
+	GLAD_DEBUG_INSTALL(glSampleCoverage);
+	GLAD_DEBUG_INSTALL(glCompressedTexImage3D);
+	GLAD_DEBUG_INSTALL(glCompressedTexImage2D);
+	GLAD_DEBUG_INSTALL(glCompressedTexImage1D);
+	GLAD_DEBUG_INSTALL(glCompressedTexSubImage3D);
+	GLAD_DEBUG_INSTALL(glCompressedTexSubImage2D);
+	GLAD_DEBUG_INSTALL(glCompressedTexSubImage1D);
+	GLAD_DEBUG_INSTALL(glGetCompressedTexImage);
+	GLAD_DEBUG_INSTALL(glClientActiveTexture);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord1d);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord1dv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord1f);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord1fv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord1i);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord1iv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord1s);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord1sv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord2d);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord2dv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord2f);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord2fv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord2i);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord2iv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord2s);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord2sv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord3d);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord3dv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord3f);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord3fv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord3i);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord3iv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord3s);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord3sv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord4d);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord4dv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord4f);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord4fv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord4i);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord4iv);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord4s);
+	GLAD_DEBUG_INSTALL(glMultiTexCoord4sv);
+	GLAD_DEBUG_INSTALL(glLoadTransposeMatrixf);
+	GLAD_DEBUG_INSTALL(glLoadTransposeMatrixd);
+	GLAD_DEBUG_INSTALL(glMultTransposeMatrixf);
+	GLAD_DEBUG_INSTALL(glMultTransposeMatrixd);
+	GLAD_DEBUG_INSTALL(glBlendFuncSeparate);
+	GLAD_DEBUG_INSTALL(glMultiDrawArrays);
+	GLAD_DEBUG_INSTALL(glMultiDrawElements);
+	GLAD_DEBUG_INSTALL(glPointParameterf);
+	GLAD_DEBUG_INSTALL(glPointParameterfv);
+	GLAD_DEBUG_INSTALL(glPointParameteri);
+	GLAD_DEBUG_INSTALL(glPointParameteriv);
+	GLAD_DEBUG_INSTALL(glFogCoordf);
+	GLAD_DEBUG_INSTALL(glFogCoordfv);
+	GLAD_DEBUG_INSTALL(glFogCoordd);
+	GLAD_DEBUG_INSTALL(glFogCoorddv);
+	GLAD_DEBUG_INSTALL(glFogCoordPointer);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3b);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3bv);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3d);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3dv);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3f);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3fv);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3i);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3iv);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3s);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3sv);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3ub);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3ubv);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3ui);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3uiv);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3us);
+	GLAD_DEBUG_INSTALL(glSecondaryColor3usv);
+	GLAD_DEBUG_INSTALL(glSecondaryColorPointer);
+	GLAD_DEBUG_INSTALL(glWindowPos2d);
+	GLAD_DEBUG_INSTALL(glWindowPos2dv);
+	GLAD_DEBUG_INSTALL(glWindowPos2f);
+	GLAD_DEBUG_INSTALL(glWindowPos2fv);
+	GLAD_DEBUG_INSTALL(glWindowPos2i);
+	GLAD_DEBUG_INSTALL(glWindowPos2iv);
+	GLAD_DEBUG_INSTALL(glWindowPos2s);
+	GLAD_DEBUG_INSTALL(glWindowPos2sv);
+	GLAD_DEBUG_INSTALL(glWindowPos3d);
+	GLAD_DEBUG_INSTALL(glWindowPos3dv);
+	GLAD_DEBUG_INSTALL(glWindowPos3f);
+	GLAD_DEBUG_INSTALL(glWindowPos3fv);
+	GLAD_DEBUG_INSTALL(glWindowPos3i);
+	GLAD_DEBUG_INSTALL(glWindowPos3iv);
+	GLAD_DEBUG_INSTALL(glWindowPos3s);
+	GLAD_DEBUG_INSTALL(glWindowPos3sv);
+	GLAD_DEBUG_INSTALL(glBlendColor);
+	GLAD_DEBUG_INSTALL(glBlendEquation);
+	GLAD_DEBUG_INSTALL(glGenQueries);
+	GLAD_DEBUG_INSTALL(glDeleteQueries);
+	GLAD_DEBUG_INSTALL(glIsQuery);
+	GLAD_DEBUG_INSTALL(glBeginQuery);
+	GLAD_DEBUG_INSTALL(glEndQuery);
+	GLAD_DEBUG_INSTALL(glGetQueryiv);
+	GLAD_DEBUG_INSTALL(glGetQueryObjectiv);
+	GLAD_DEBUG_INSTALL(glGetQueryObjectuiv);
+	GLAD_DEBUG_INSTALL(glBindBuffer);
+	GLAD_DEBUG_INSTALL(glDeleteBuffers);
+	GLAD_DEBUG_INSTALL(glGenBuffers);
+	GLAD_DEBUG_INSTALL(glIsBuffer);
+	GLAD_DEBUG_INSTALL(glBufferData);
+	GLAD_DEBUG_INSTALL(glBufferSubData);
+	GLAD_DEBUG_INSTALL(glGetBufferSubData);
+	GLAD_DEBUG_INSTALL(glMapBuffer);
+	GLAD_DEBUG_INSTALL(glUnmapBuffer);
+	GLAD_DEBUG_INSTALL(glGetBufferParameteriv);
+	GLAD_DEBUG_INSTALL(glGetBufferPointerv);
+	GLAD_DEBUG_INSTALL(glBlendEquationSeparate);
+	GLAD_DEBUG_INSTALL(glDrawBuffers);
+	GLAD_DEBUG_INSTALL(glStencilOpSeparate);
+	GLAD_DEBUG_INSTALL(glStencilFuncSeparate);
+	GLAD_DEBUG_INSTALL(glStencilMaskSeparate);
+	GLAD_DEBUG_INSTALL(glAttachShader);
+	GLAD_DEBUG_INSTALL(glBindAttribLocation);
+	GLAD_DEBUG_INSTALL(glCompileShader);
+	GLAD_DEBUG_INSTALL(glCreateProgram);
+	GLAD_DEBUG_INSTALL(glCreateShader);
+	GLAD_DEBUG_INSTALL(glDeleteProgram);
+	GLAD_DEBUG_INSTALL(glDeleteShader);
+	GLAD_DEBUG_INSTALL(glDetachShader);
+	GLAD_DEBUG_INSTALL(glDisableVertexAttribArray);
+	GLAD_DEBUG_INSTALL(glEnableVertexAttribArray);
+	GLAD_DEBUG_INSTALL(glGetActiveAttrib);
+	GLAD_DEBUG_INSTALL(glGetActiveUniform);
+	GLAD_DEBUG_INSTALL(glGetAttachedShaders);
+	GLAD_DEBUG_INSTALL(glGetAttribLocation);
+	GLAD_DEBUG_INSTALL(glGetProgramiv);
+	GLAD_DEBUG_INSTALL(glGetProgramInfoLog);
+	GLAD_DEBUG_INSTALL(glGetShaderiv);
+	GLAD_DEBUG_INSTALL(glGetShaderInfoLog);
+	GLAD_DEBUG_INSTALL(glGetShaderSource);
+	GLAD_DEBUG_INSTALL(glGetUniformLocation);
+	GLAD_DEBUG_INSTALL(glGetUniformfv);
+	GLAD_DEBUG_INSTALL(glGetUniformiv);
+	GLAD_DEBUG_INSTALL(glGetVertexAttribdv);
+	GLAD_DEBUG_INSTALL(glGetVertexAttribfv);
+	GLAD_DEBUG_INSTALL(glGetVertexAttribiv);
+	GLAD_DEBUG_INSTALL(glGetVertexAttribPointerv);
+	GLAD_DEBUG_INSTALL(glIsProgram);
+	GLAD_DEBUG_INSTALL(glIsShader);
+	GLAD_DEBUG_INSTALL(glLinkProgram);
+	GLAD_DEBUG_INSTALL(glShaderSource);
+	GLAD_DEBUG_INSTALL(glUseProgram);
+	GLAD_DEBUG_INSTALL(glUniform1f);
+	GLAD_DEBUG_INSTALL(glUniform2f);
+	GLAD_DEBUG_INSTALL(glUniform3f);
+	GLAD_DEBUG_INSTALL(glUniform4f);
+	GLAD_DEBUG_INSTALL(glUniform1i);
+	GLAD_DEBUG_INSTALL(glUniform2i);
+	GLAD_DEBUG_INSTALL(glUniform3i);
+	GLAD_DEBUG_INSTALL(glUniform4i);
+	GLAD_DEBUG_INSTALL(glUniform1fv);
+	GLAD_DEBUG_INSTALL(glUniform2fv);
+	GLAD_DEBUG_INSTALL(glUniform3fv);
+	GLAD_DEBUG_INSTALL(glUniform4fv);
+	GLAD_DEBUG_INSTALL(glUniform1iv);
+	GLAD_DEBUG_INSTALL(glUniform2iv);
+	GLAD_DEBUG_INSTALL(glUniform3iv);
+	GLAD_DEBUG_INSTALL(glUniform4iv);
+	GLAD_DEBUG_INSTALL(glUniformMatrix2fv);
+	GLAD_DEBUG_INSTALL(glUniformMatrix3fv);
+	GLAD_DEBUG_INSTALL(glUniformMatrix4fv);
+	GLAD_DEBUG_INSTALL(glValidateProgram);
+	GLAD_DEBUG_INSTALL(glVertexAttrib1d);
+	GLAD_DEBUG_INSTALL(glVertexAttrib1dv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib1f);
+	GLAD_DEBUG_INSTALL(glVertexAttrib1fv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib1s);
+	GLAD_DEBUG_INSTALL(glVertexAttrib1sv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib2d);
+	GLAD_DEBUG_INSTALL(glVertexAttrib2dv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib2f);
+	GLAD_DEBUG_INSTALL(glVertexAttrib2fv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib2s);
+	GLAD_DEBUG_INSTALL(glVertexAttrib2sv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib3d);
+	GLAD_DEBUG_INSTALL(glVertexAttrib3dv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib3f);
+	GLAD_DEBUG_INSTALL(glVertexAttrib3fv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib3s);
+	GLAD_DEBUG_INSTALL(glVertexAttrib3sv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4Nbv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4Niv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4Nsv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4Nub);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4Nubv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4Nuiv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4Nusv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4bv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4d);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4dv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4f);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4fv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4iv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4s);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4sv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4ubv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4uiv);
+	GLAD_DEBUG_INSTALL(glVertexAttrib4usv);
+	GLAD_DEBUG_INSTALL(glVertexAttribPointer);
+	GLAD_DEBUG_INSTALL(glBindBufferARB);
+	GLAD_DEBUG_INSTALL(glDeleteBuffersARB);
+	GLAD_DEBUG_INSTALL(glGenBuffersARB);
+	GLAD_DEBUG_INSTALL(glIsBufferARB);
+	GLAD_DEBUG_INSTALL(glBufferDataARB);
+	GLAD_DEBUG_INSTALL(glBufferSubDataARB);
+	GLAD_DEBUG_INSTALL(glGetBufferSubDataARB);
+	GLAD_DEBUG_INSTALL(glMapBufferARB);
+	GLAD_DEBUG_INSTALL(glUnmapBufferARB);
+	GLAD_DEBUG_INSTALL(glGetBufferParameterivARB);
+	GLAD_DEBUG_INSTALL(glGetBufferPointervARB);
+	GLAD_DEBUG_INSTALL(glBindVertexArray);
+	GLAD_DEBUG_INSTALL(glDeleteVertexArrays);
+	GLAD_DEBUG_INSTALL(glGenVertexArrays);
+	GLAD_DEBUG_INSTALL(glIsVertexArray);
+	GLAD_DEBUG_INSTALL(glIsRenderbuffer);
+	GLAD_DEBUG_INSTALL(glBindRenderbuffer);
+	GLAD_DEBUG_INSTALL(glDeleteRenderbuffers);
+	GLAD_DEBUG_INSTALL(glGenRenderbuffers);
+	GLAD_DEBUG_INSTALL(glRenderbufferStorage);
+	GLAD_DEBUG_INSTALL(glGetRenderbufferParameteriv);
+	GLAD_DEBUG_INSTALL(glIsFramebuffer);
+	GLAD_DEBUG_INSTALL(glBindFramebuffer);
+	GLAD_DEBUG_INSTALL(glDeleteFramebuffers);
+	GLAD_DEBUG_INSTALL(glGenFramebuffers);
+	GLAD_DEBUG_INSTALL(glCheckFramebufferStatus);
+	GLAD_DEBUG_INSTALL(glFramebufferTexture1D);
+	GLAD_DEBUG_INSTALL(glFramebufferTexture2D);
+	GLAD_DEBUG_INSTALL(glFramebufferTexture3D);
+	GLAD_DEBUG_INSTALL(glFramebufferRenderbuffer);
+	GLAD_DEBUG_INSTALL(glGetFramebufferAttachmentParameteriv);
+	GLAD_DEBUG_INSTALL(glGenerateMipmap);
+	GLAD_DEBUG_INSTALL(glBlitFramebuffer);
+	GLAD_DEBUG_INSTALL(glRenderbufferStorageMultisample);
+	GLAD_DEBUG_INSTALL(glFramebufferTextureLayer);
+	GLAD_DEBUG_INSTALL(glIsRenderbufferEXT);
+	GLAD_DEBUG_INSTALL(glBindRenderbufferEXT);
+	GLAD_DEBUG_INSTALL(glDeleteRenderbuffersEXT);
+	GLAD_DEBUG_INSTALL(glGenRenderbuffersEXT);
+	GLAD_DEBUG_INSTALL(glRenderbufferStorageEXT);
+	GLAD_DEBUG_INSTALL(glGetRenderbufferParameterivEXT);
+	GLAD_DEBUG_INSTALL(glIsFramebufferEXT);
+	GLAD_DEBUG_INSTALL(glBindFramebufferEXT);
+	GLAD_DEBUG_INSTALL(glDeleteFramebuffersEXT);
+	GLAD_DEBUG_INSTALL(glGenFramebuffersEXT);
+	GLAD_DEBUG_INSTALL(glCheckFramebufferStatusEXT);
+	GLAD_DEBUG_INSTALL(glFramebufferTexture1DEXT);
+	GLAD_DEBUG_INSTALL(glFramebufferTexture2DEXT);
+	GLAD_DEBUG_INSTALL(glFramebufferTexture3DEXT);
+	GLAD_DEBUG_INSTALL(glFramebufferRenderbufferEXT);
+	GLAD_DEBUG_INSTALL(glGetFramebufferAttachmentParameterivEXT);
+	GLAD_DEBUG_INSTALL(glGenerateMipmapEXT);
+	GLAD_DEBUG_INSTALL(glBindVertexArrayAPPLE);
+	GLAD_DEBUG_INSTALL(glDeleteVertexArraysAPPLE);
+	GLAD_DEBUG_INSTALL(glGenVertexArraysAPPLE);
+	GLAD_DEBUG_INSTALL(glIsVertexArrayAPPLE);
+}
+#endif /* DEBUG */
+
 static int find_extensionsGL(void) {
 	if (!get_exts()) return 0;
 	GLAD_GL_ARB_vertex_buffer_object = has_ext("GL_ARB_vertex_buffer_object");
@@ -1540,6 +4613,10 @@ int gladLoadGLLoader(GLADloadproc load) {
 	if(glGetString == NULL) return 0;
 	if(glGetString(GL_VERSION) == NULL) return 0;
 	find_coreGL();
+#ifdef OFX_OPENGL_LAZY_LOAD
+	glad_lazy_load = load;
+	load = &get_lazy_proc;
+#endif
 	load_GL_VERSION_1_0(load);
 	load_GL_VERSION_1_1(load);
 	load_GL_VERSION_1_2(load);
@@ -1554,6 +4631,9 @@ int gladLoadGLLoader(GLADloadproc load) {
 	load_GL_ARB_framebuffer_object(load);
 	load_GL_EXT_framebuffer_object(load);
 	load_GL_APPLE_vertex_array_object(load);
+#ifdef DEBUG
+	install_debug_GL();
+#endif
 	return GLVersion.major != 0 || GLVersion.minor != 0;
 }
 
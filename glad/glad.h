@@ -84,6 +84,11 @@ GLAPI int gladLoadGL(void);
 
 GLAPI int gladLoadGLLoader(GLADloadproc);
 
+/* In debug builds, called before and after each OpenGL function except glGetError (see glad.cpp) */
+typedef void (* GLADcallback)(const char *name, void *funcptr, int len_args, ...);
+GLAPI void glad_set_pre_callback(GLADcallback cb);
+GLAPI void glad_set_post_callback(GLADcallback cb);
+
 #include <stddef.h>
 #ifndef GLEXT_64_TYPES_DEFINED
 /* This code block is duplicated in glxext.h, so must be protected */
@@ -68,7 +68,7 @@ public:
         int rowBytes = sizeof(PIX) * nComponents * (procWindow.x2 - procWindow.x1);
 
         for (int dsty = procWindow.y1; dsty < procWindow.y2; ++dsty) {
-            if ( _effect.abort() ) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
                 break;
             }
 
@@ -253,7 +253,7 @@ public:
         }
         assert(nComponents == 4 || nComponents == 1);
         for (int dsty = procWindow.y1; dsty < procWindow.y2; ++dsty) {
-            if ( _effect.abort() ) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
                 break;
             }
 
@@ -344,7 +344,7 @@ public:
         float tmpPix[nComponents];
 
         for (int dsty = procWindow.y1; dsty < procWindow.y2; ++dsty) {
-            if ( _effect.abort() ) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
                 break;
             }
 
@@ -437,7 +437,7 @@ public:
         float unpPix[4];
 
         for (int dsty = procWindow.y1; dsty < procWindow.y2; ++dsty) {
-            if ( _effect.abort() ) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
                 break;
             }
 
@@ -525,7 +525,7 @@ public:
             procWindow.y2 = _dstBounds.y2;
         }
         for (int dsty = procWindow.y1; dsty < procWindow.y2; ++dsty) {
-            if ( _effect.abort() ) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
                 break;
             }
 
@@ -641,7 +641,7 @@ public:
             unpPix[3] = 1.f;
         }
         for (int dsty = procWindow.y1; dsty < procWindow.y2; ++dsty) {
-            if ( _effect.abort() ) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
                 break;
             }
 
@@ -732,7 +732,7 @@ public:
         int rowSize =  _nComponents * (procWindow.x2 - procWindow.x1);
 
         for (int y = procWindow.y1; y < procWindow.y2; ++y) {
-            if ( _effect.abort() ) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
                 break;
             }
 
@@ -31,6 +31,7 @@
 
 #include "ofxsFormatResolution.h"
 #include "ofxsCoords.h"
+#include "ofxsProfiling.h"
 
 // Some hosts (e.g. Resolve) may not support normalized defaults (setDefaultCoordinateSystem(eCoordinatesNormalised))
 #define kParamDefaultsNormalised "defaultsNormalisedGenerator"
@@ -244,6 +245,8 @@ GeneratorPlugin::checkComponents(BitDepthEnum dstBitDepth,
 bool
 GeneratorPlugin::getTimeDomain(OfxRangeD &range)
 {
+    OFX_PROFILE_SCOPE(timer, "action", "GeneratorPlugin::getTimeDomain");
+
     // this should only be called in the general context, ever!
     if (getContext() == eContextGeneral) {
         assert(_range);
@@ -333,6 +336,8 @@ GeneratorPlugin::changedParam(const InstanceChangedArgs &args,
 bool
 GeneratorPlugin::getRegionOfDefinition(double time, OfxRectD &rod)
 {
+    OFX_PROFILE_SCOPE(timer, "action", "GeneratorPlugin::getRegionOfDefinition");
+
     GeneratorExtentEnum extent = (GeneratorExtentEnum)_extent->getValue();
 
     switch (extent) {
@@ -379,6 +384,8 @@ GeneratorPlugin::getRegionOfDefinition(double time, OfxRectD &rod)
 void
 GeneratorPlugin::getClipPreferences(ClipPreferencesSetter &clipPreferences)
 {
+    OFX_PROFILE_SCOPE(timer, "action", "GeneratorPlugin::getClipPreferences");
+
     double par = 0.;
     GeneratorExtentEnum extent = (GeneratorExtentEnum)_extent->getValue();
 
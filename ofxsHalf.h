@@ -0,0 +1,212 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; -*- */
+/* ***** BEGIN LICENSE BLOCK *****
+ * This file is part of openfx-supportext <https://github.com/NatronGitHub/openfx-supportext>,
+ * (C) 2018-2021 The Natron Developers
+ * (C) 2013-2018 INRIA
+ *
+ * openfx-supportext is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * openfx-supportext is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openfx-supportext.  If not, see <http://www.gnu.org/licenses/gpl-2.0.html>
+ * ***** END LICENSE BLOCK ***** */
+
+/*
+ * OFX half-float pixel type, for processors that work directly on eBitDepthHalf images.
+ */
+
+#ifndef openfx_supportext_ofxsHalf_h
+#define openfx_supportext_ofxsHalf_h
+
+#include <cstring> // for memcpy
+#include <cstddef> // for size_t
+
+// F16C (available on x86 CPUs since Ivy Bridge) converts 8 values per instruction.
+// Define OFXS_HALF_NO_F16C to disable it even if the compiler targets it.
+#if !defined(OFXS_HALF_NO_F16C) && ( defined(__F16C__) || ( defined(_MSC_VER) && defined(__AVX2__) ) )
+#define OFXS_HALF_USE_F16C 1
+#include <immintrin.h>
+#endif
+
+namespace OFX {
+// convert an IEEE 754 binary16 value to float (exact)
+inline float
+halfBitsToFloat(unsigned short h)
+{
+    unsigned int sign = (unsigned int)(h & 0x8000) << 16;
+    unsigned int exponent = (h >> 10) & 0x1f;
+    unsigned int mantissa = h & 0x3ff;
+    unsigned int bits;
+
+    if (exponent == 0) {
+        // zero or denormal: the value is mantissa * 2^-24, which is exact in float
+        float f = mantissa * (1.f / 16777216.f);
+
+        return sign ? -f : f;
+    } else if (exponent == 31) {
+        // inf or NaN
+        bits = sign | 0x7f800000 | (mantissa << 13);
+    } else {
+        bits = sign | ( (exponent + (127 - 15) ) << 23 ) | (mantissa << 13);
+    }
+    float f;
+    std::memcpy( &f, &bits, sizeof(f) );
+
+    return f;
+}
+
+// convert a float to IEEE 754 binary16 (round to nearest even, overflows to inf)
+inline unsigned short
+floatToHalfBits(float f)
+{
+    unsigned int x;
+
+    std::memcpy( &x, &f, sizeof(x) );
+    unsigned int sign = (x >> 16) & 0x8000;
+    unsigned int absx = x & 0x7fffffff;
+
+    if (absx >= 0x7f800000) {
+        // inf or NaN (keep NaNs quiet)
+        return (unsigned short)( sign | 0x7c00 | ( (absx > 0x7f800000) ? ( 0x200 | ( (absx >> 13) & 0x3ff ) ) : 0 ) );
+    }
+    if (absx >= 0x477ff000) {
+        // 65520 and above round to inf
+        return (unsigned short)(sign | 0x7c00);
+    }
+    if (absx < 0x38800000) {
+        // below the smallest normal half (2^-14): denormal or zero
+        if (absx <= 0x33000000) {
+            // 2^-25 and below round to zero
+            return (unsigned short)sign;
+        }
+        unsigned int e = absx >> 23;
+        unsigned int m = (absx & 0x7fffff) | 0x800000;
+        unsigned int shift = 126 - e; // in [14,24]
+        unsigned int h = m >> shift;
+        unsigned int rem = m & ( (1u << shift) - 1 );
+        unsigned int halfway = 1u << (shift - 1);
+        if ( ( rem > halfway) || ( ( rem == halfway) && (h & 1) ) ) {
+            ++h;
+        }
+
+        return (unsigned short)(sign | h);
+    }
+    // normal: rebias the exponent, round the mantissa (a carry correctly increments the exponent)
+    unsigned int h = (absx - ( (127 - 15) << 23 ) ) >> 13;
+    unsigned int rem = absx & 0x1fff;
+    if ( ( rem > 0x1000) || ( ( rem == 0x1000) && (h & 1) ) ) {
+        ++h;
+    }
+
+    return (unsigned short)(sign | h);
+}
+
+/**
+ * @brief A 16-bit floating point value with the memory layout of an eBitDepthHalf component.
+ * It converts implicitly to and from float, so that pixel processors templated on PIX
+ * (with maxValue=1, as for float) can read and write half images directly: all
+ * arithmetic is done in float.
+ **/
+class half
+{
+public:
+    half()
+        : _h(0)
+    {
+    }
+
+    half(float f)
+        : _h( floatToHalfBits(f) )
+    {
+    }
+
+    operator float() const
+    {
+        return halfBitsToFloat(_h);
+    }
+
+    half & operator +=(float f)
+    {
+        return *this = float(*this) + f;
+    }
+
+    half & operator -=(float f)
+    {
+        return *this = float(*this) - f;
+    }
+
+    half & operator *=(float f)
+    {
+        return *this = float(*this) * f;
+    }
+
+    half & operator /=(float f)
+    {
+        return *this = float(*this) / f;
+    }
+
+    unsigned short bits() const
+    {
+        return _h;
+    }
+
+    static half fromBits(unsigned short bits)
+    {
+        half h;
+
+        h._h = bits;
+
+        return h;
+    }
+
+private:
+    unsigned short _h;
+};
+
+/// convert n half values to float. src and dst must not overlap.
+inline void
+halfToFloat(const half* src,
+            float* dst,
+            std::size_t n)
+{
+    std::size_t i = 0;
+
+#ifdef OFXS_HALF_USE_F16C
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm_loadu_si128( (const __m128i*)(src + i) );
+        _mm256_storeu_ps( dst + i, _mm256_cvtph_ps(h) );
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = src[i];
+    }
+}
+
+/// convert n float values to half (round to nearest even). src and dst must not overlap.
+inline void
+floatToHalf(const float* src,
+            half* dst,
+            std::size_t n)
+{
+    std::size_t i = 0;
+
+#ifdef OFXS_HALF_USE_F16C
+    for (; i + 8 <= n; i += 8) {
+        __m256 f = _mm256_loadu_ps(src + i);
+        _mm_storeu_si128( (__m128i*)(dst + i), _mm256_cvtps_ph(f, 0) ); // 0 = round to nearest even
+    }
+#endif
+    for (; i < n; ++i) {
+        dst[i] = src[i];
+    }
+}
+} // namespace OFX
+
+#endif // openfx_supportext_ofxsHalf_h
@@ -25,6 +25,7 @@
 #include "ofxsMaskMix.h"
 #include "ofxsImageBlender.H"
 #include "ofxsMacros.h"
+#include "ofxsProfiling.h"
 
 namespace OFX {
 /** @brief  Base class used to blend two images together */
@@ -86,7 +87,7 @@ public:
         float blendComp = 1.0f - blend;
 
         for (int y = procWindow.y1; y < procWindow.y2; y++) {
-            if ( _effect.abort() ) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
                 break;
             }
 
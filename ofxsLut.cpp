@@ -33,6 +33,12 @@ typedef unsigned char uint8_t;
 #endif
 #include <limits>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <cctype>
+#include <sstream>
+
+#include "ofxsFileOpen.h"
 
 #ifndef M_PI
 #define M_PI        3.14159265358979323846264338327950288   /* pi             */
@@ -772,6 +778,244 @@ lab_to_rgb709(float l,
     lab_to_xyz(l, a, b, &x, &y, &z);
     xyz_to_rgb709(x, y, z, r, g, b_);
 }
+
+// read a line, strip the end-of-line and leading spaces. Returns false at end of file.
+static bool
+readLine(std::FILE* file,
+         std::string* line)
+{
+    char buf[1024];
+
+    line->clear();
+    for (;;) {
+        if ( !std::fgets(buf, sizeof(buf), file) ) {
+            return !line->empty();
+        }
+        line->append(buf);
+        if ( !line->empty() && ( (*line)[line->size() - 1] == '\n' ) ) {
+            break;
+        }
+    }
+    while ( !line->empty() && ( ( (*line)[line->size() - 1] == '\n' ) || ( (*line)[line->size() - 1] == '\r' ) ) ) {
+        line->erase(line->size() - 1);
+    }
+    std::size_t first = line->find_first_not_of(" \t");
+    if (first == std::string::npos) {
+        line->clear();
+    } else if (first > 0) {
+        line->erase(0, first);
+    }
+
+    return true;
+}
+
+bool
+Lut3D::read(const std::string & filename,
+            std::string* errorMessage)
+{
+    std::FILE* file = OFX::fopen_utf8(filename.c_str(), "r");
+
+    if (!file) {
+        if (errorMessage) {
+            *errorMessage = "Cannot open file " + filename;
+        }
+
+        return false;
+    }
+    _name = filename;
+    _size = 0;
+    _data.clear();
+    for (int c = 0; c < 3; ++c) {
+        _domainMin[c] = 0.f;
+        _domainMax[c] = 1.f;
+    }
+    std::string ext;
+    std::size_t dot = filename.find_last_of('.');
+    if (dot != std::string::npos) {
+        ext = filename.substr(dot + 1);
+        for (std::size_t i = 0; i < ext.size(); ++i) {
+            ext[i] = (char)std::tolower(ext[i]);
+        }
+    }
+    bool ok = (ext == "3dl") ? read3dl(file, errorMessage) : readCube(file, errorMessage);
+    std::fclose(file);
+    if (!ok) {
+        _size = 0;
+        _data.clear();
+    } else if (errorMessage) {
+        errorMessage->clear();
+    }
+
+    return ok;
+}
+
+// Resolve/Iridas .cube format: keywords followed by size^3 lines of float RGB triplets, red changes fastest.
+bool
+Lut3D::readCube(std::FILE* file,
+                std::string* errorMessage)
+{
+    std::string line;
+    std::size_t expected = 0;
+
+    while ( readLine(file, &line) ) {
+        if ( line.empty() || (line[0] == '#') ) {
+            continue;
+        }
+        if ( (line[0] == '-') || (line[0] == '.') || ( (line[0] >= '0') && (line[0] <= '9') ) ) {
+            float r, g, b;
+            if ( (expected == 0) || (std::sscanf(line.c_str(), "%f %f %f", &r, &g, &b) != 3) ) {
+                if (errorMessage) {
+                    *errorMessage = "Invalid .cube line: " + line;
+                }
+
+                return false;
+            }
+            if (_data.size() >= expected) {
+                if (errorMessage) {
+                    *errorMessage = "Too many entries in .cube file";
+                }
+
+                return false;
+            }
+            _data.push_back(r);
+            _data.push_back(g);
+            _data.push_back(b);
+            continue;
+        }
+        std::istringstream iss(line);
+        std::string keyword;
+        iss >> keyword;
+        if (keyword == "LUT_3D_SIZE") {
+            int size = 0;
+            iss >> size;
+            if ( (size < 2) || (size > 256) ) {
+                if (errorMessage) {
+                    *errorMessage = "Invalid LUT_3D_SIZE in .cube file";
+                }
+
+                return false;
+            }
+            _size = size;
+            expected = (std::size_t)size * size * size * 3;
+            _data.reserve(expected);
+        } else if (keyword == "DOMAIN_MIN") {
+            iss >> _domainMin[0] >> _domainMin[1] >> _domainMin[2];
+        } else if (keyword == "DOMAIN_MAX") {
+            iss >> _domainMax[0] >> _domainMax[1] >> _domainMax[2];
+        } else if (keyword == "LUT_1D_SIZE") {
+            if (errorMessage) {
+                *errorMessage = "1D .cube files are not supported";
+            }
+
+            return false;
+        }
+        // TITLE, LUT_3D_INPUT_RANGE and unknown keywords are ignored
+    }
+    if ( (expected == 0) || (_data.size() != expected) ) {
+        if (errorMessage) {
+            *errorMessage = "Incomplete .cube file";
+        }
+
+        return false;
+    }
+    for (int c = 0; c < 3; ++c) {
+        if ( !(_domainMax[c] > _domainMin[c]) ) {
+            if (errorMessage) {
+                *errorMessage = "Invalid domain in .cube file";
+            }
+
+            return false;
+        }
+    }
+
+    return true;
+} // Lut3D::readCube
+
+// Autodesk/Lustre .3dl format: a line with the input mesh points (integers), an optional "Mesh" line,
+// followed by size^3 lines of integer RGB triplets, blue changes fastest.
+// The output bit depth is given by the "Mesh" line, or deduced from the largest value.
+bool
+Lut3D::read3dl(std::FILE* file,
+               std::string* errorMessage)
+{
+    std::string line;
+    std::vector<int> mesh;
+    std::vector<int> values;
+    int outBits = 0;
+
+    while ( readLine(file, &line) ) {
+        if ( line.empty() || (line[0] == '#') ) {
+            continue;
+        }
+        if ( (line.compare(0, 6, "3DMESH") == 0) ) {
+            continue;
+        }
+        if ( (line.compare(0, 4, "Mesh") == 0) ) {
+            int inBits = 0;
+            if (std::sscanf(line.c_str(), "Mesh %d %d", &inBits, &outBits) != 2) {
+                outBits = 0;
+            }
+            continue;
+        }
+        if ( (line[0] < '0') || (line[0] > '9') ) {
+            // other Lustre keywords (LUT8, gamma...)
+            continue;
+        }
+        std::istringstream iss(line);
+        std::vector<int> items;
+        int v;
+        while (iss >> v) {
+            items.push_back(v);
+        }
+        if ( mesh.empty() ) {
+            mesh = items;
+            continue;
+        }
+        if (items.size() != 3) {
+            if (errorMessage) {
+                *errorMessage = "Invalid .3dl line: " + line;
+            }
+
+            return false;
+        }
+        values.insert( values.end(), items.begin(), items.end() );
+    }
+    const int size = (int)mesh.size();
+    if ( (size < 2) || (values.size() != (std::size_t)size * size * size * 3) ) {
+        if (errorMessage) {
+            *errorMessage = "Invalid or incomplete .3dl file";
+        }
+
+        return false;
+    }
+    int maxOut;
+    if (outBits > 0) {
+        maxOut = (1 << outBits) - 1;
+    } else {
+        int maxVal = *std::max_element( values.begin(), values.end() );
+        int bits = 8;
+        while ( (bits < 16) && (maxVal > (1 << bits) - 1) ) {
+            bits += 2;
+        }
+        maxOut = (1 << bits) - 1;
+    }
+    _size = size;
+    _data.resize(values.size());
+    const float scale = 1.f / maxOut;
+    // reorder from blue-fastest to red-fastest
+    for (int r = 0; r < size; ++r) {
+        for (int g = 0; g < size; ++g) {
+            for (int b = 0; b < size; ++b) {
+                const int src = ( (r * size + g) * size + b ) * 3;
+                const int dst = ( (b * size + g) * size + r ) * 3;
+                for (int c = 0; c < 3; ++c) {
+                    _data[dst + c] = values[src + c] * scale;
+                }
+            }
+        }
+    }
+
+    return true;
+} // Lut3D::read3dl
 }         // namespace Color
 } //namespace OFX
-
@@ -27,7 +27,11 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <cmath>
+#include <limits>
+#include <cstdio>
+#include <algorithm>
 #include <cassert>
 #include <cstring> // for memcpy
 #include <cstdlib> // for rand
@@ -39,6 +43,7 @@
 #include "ofxsPixelProcessor.h"
 #include "ofxsMultiThread.h"
 #include "ofxsThreadSuite.h"
+#include "ofxsHalf.h"
 
 #define OFXS_HUE_CIRCLE 1.f // if hue should be between 0 and 1
 //#define OFXS_HUE_CIRCLE 360.f // if hue should be in degrees
@@ -151,6 +156,10 @@ class Lut
     /// and never change afterwards
     mutable unsigned short toFunc_hipart_to_uint8xx[0x10000];                 /// contains  2^16 = 65536 values between 0-255
     mutable float fromFunc_uint8_to_float[256];                 /// values between 0-1.f
+    /// toFunc at the first float of each hipart interval, plus one past the end (2^16+1 values), filled on demand by fillUint16Table()
+    mutable std::vector<float> toFunc_hipart_to_float;
+    mutable bool _hasUint16Table;
+    mutable bool _isIncreasing;                 ///< fromFunc is increasing on the 8-bit values
 
 private:
     // Luts should be allocated and destroyed  through the LutManager
@@ -160,6 +169,9 @@ private:
         : _name(name)
         , _fromFunc(fromFunc)
         , _toFunc(toFunc)
+        , toFunc_hipart_to_float()
+        , _hasUint16Table(false)
+        , _isIncreasing(true)
     {
         fillTables();
     }
@@ -190,7 +202,40 @@ private:
             fromFunc_uint8_to_float[b] = f;
             int i = hipart(f);
             toFunc_hipart_to_uint8xx[i] = Color::charToUint8xx(b);
+            if ( (b > 0) && !(fromFunc_uint8_to_float[b - 1] < f) ) {
+                _isIncreasing = false;
+            }
+        }
+    }
+
+    ///init the table used for 16-bit output (256kB).
+    ///Within a hipart interval, the float value is linear in the low 16 bits, so that
+    ///toFunc is interpolated linearly between the samples at the start of each interval.
+    ///Not thread-safe: called by LutManager::getLutUint16()
+    void fillUint16Table() const
+    {
+        if (_hasUint16Table) {
+            return;
+        }
+        toFunc_hipart_to_float.resize(0x10001);
+        for (unsigned int i = 0; i <= 0x10000; ++i) {
+            unsigned int bits = (i & 0xffff) << 16;
+            float inp;
+            std::memcpy( &inp, &bits, sizeof(inp) );
+            if ( ( (bits & 0x7f800000) == 0x7f800000 ) || (i == 0x10000) ) {
+                // NaN and infinity
+                inp = ( (bits & 0x80000000) || (i == 0x10000) ) ? -std::numeric_limits<float>::max() : std::numeric_limits<float>::max();
+            }
+            float f = _toFunc(inp);
+            // keep the interpolation finite
+            if ( !(f > -1e10f) ) {
+                f = -1e10f;
+            } else if ( !(f < 1e10f) ) {
+                f = 1e10f;
+            }
+            toFunc_hipart_to_float[i] = f;
         }
+        _hasUint16Table = true;
     }
 
 public:
@@ -234,14 +279,38 @@ public:
         return toFunc_hipart_to_uint8xx[hipart(v)];
     }
 
-    // the following only works for increasing LUTs
+    /// true if fromFunc is strictly increasing on the 8-bit values (required by the 8-bit based 16-bit conversions)
+    bool isIncreasing() const
+    {
+        return _isIncreasing;
+    }
+
+    /// true if the 16-bit output table was built (see LutManager::getLutUint16())
+    bool hasUint16Table() const
+    {
+        return _hasUint16Table;
+    }
 
     /* @brief Converts a float ranging in [0 - 1.f] in linear color-space using the look-up tables.
      * @return An unsigned short in [0 - 65535] in the destination color-space.
-     * This function uses localluy linear approximations of the transfer function.
+     * If the 16-bit output table was built, the transfer function is interpolated between 2^16
+     * logarithmically spaced samples, which is accurate to one 16-bit code value for smooth functions.
+     * Else, this function uses locally linear approximations of the transfer function
+     * between the 8-bit values, or the (slow) full function if the LUT is not increasing.
      */
     unsigned short toColorSpaceUint16FromLinearFloatFast(float v) const WARN_UNUSED_RETURN
     {
+        if (_hasUint16Table) {
+            unsigned int bits;
+            std::memcpy( &bits, &v, sizeof(bits) );
+            const float* t = &toFunc_hipart_to_float[bits >> 16];
+
+            return (unsigned short)Color::floatToInt<65536>( t[0] + (t[1] - t[0]) * ( (bits & 0xffff) * (1.f / 65536.f) ) );
+        }
+        // the following only works for increasing LUTs
+        if (!_isIncreasing) {
+            return (unsigned short)Color::floatToInt<65536>( _toFunc(v) );
+        }
         // algorithm:
         // - convert to 8 bits -> val8u
         // - convert val8u-1, val8u and val8u+1 to float
@@ -635,6 +704,104 @@ public:
         }
     }
 
+    /* @brief convert from linear float to half in the destination color-space.
+     * Half values are not quantized like 8 or 16-bit values, so the full transfer function is used. */
+    void to_half_packed(const void* pixelData,
+                        const OfxRectI & bounds,
+                        OFX::PixelComponentEnum pixelComponents,
+                        int pixelComponentCount,
+                        OFX::BitDepthEnum bitDepth,
+                        int rowBytes,
+                        const OfxRectI & renderWindow,
+                        void* dstPixelData,
+                        const OfxRectI & dstBounds,
+                        OFX::PixelComponentEnum dstPixelComponents,
+                        int dstPixelComponentCount,
+                        OFX::BitDepthEnum dstBitDepth,
+                        int dstRowBytes) const
+    {
+        assert(bitDepth == eBitDepthFloat && dstBitDepth == eBitDepthHalf && pixelComponents == dstPixelComponents && pixelComponentCount == dstPixelComponentCount);
+        assert(bounds.x1 <= renderWindow.x1 && renderWindow.x2 <= bounds.x2 &&
+               bounds.y1 <= renderWindow.y1 && renderWindow.y2 <= bounds.y2 &&
+               dstBounds.x1 <= renderWindow.x1 && renderWindow.x2 <= dstBounds.x2 &&
+               dstBounds.y1 <= renderWindow.y1 && renderWindow.y2 <= dstBounds.y2);
+        //validate();
+
+        const int nComponents = pixelComponentCount;
+
+        for (int y = renderWindow.y1; y < renderWindow.y2; ++y) {
+            const float *src_pixels = (const float*)OFX::getPixelAddress(pixelData, bounds, pixelComponentCount, bitDepth, rowBytes, 0, y);
+            OFX::half *dst_pixels = (OFX::half*)OFX::getPixelAddress(dstPixelData, dstBounds, dstPixelComponentCount, dstBitDepth, dstRowBytes, 0, y);
+            const float *src_end = (const float*)OFX::getPixelAddress(pixelData, bounds, pixelComponentCount, bitDepth, rowBytes, renderWindow.x2, y, false);
+
+            while (src_pixels != src_end) {
+                if (nComponents == 1) {
+                    // alpha channel: no colorspace conversion
+                    dst_pixels[0] = src_pixels[0];
+                } else {
+                    for (int k = 0; k < 3; ++k) {
+                        dst_pixels[k] = _toFunc(src_pixels[k]);
+                    }
+                    if (nComponents == 4) {
+                        // alpha channel: no colorspace conversion
+                        dst_pixels[3] = src_pixels[3];
+                    }
+                }
+                dst_pixels += nComponents;
+                src_pixels += nComponents;
+            }
+        }
+    }
+
+    /* @brief convert from half in the source color-space to linear float.
+     * Half values are not quantized like 8 or 16-bit values, so the full transfer function is used. */
+    void from_half_packed(const void* pixelData,
+                          const OfxRectI & bounds,
+                          OFX::PixelComponentEnum pixelComponents,
+                          int pixelComponentCount,
+                          OFX::BitDepthEnum bitDepth,
+                          int rowBytes,
+                          const OfxRectI & renderWindow,
+                          void* dstPixelData,
+                          const OfxRectI & dstBounds,
+                          OFX::PixelComponentEnum dstPixelComponents,
+                          int dstPixelComponentCount,
+                          OFX::BitDepthEnum dstBitDepth,
+                          int dstRowBytes) const
+    {
+        assert(bitDepth == eBitDepthHalf && dstBitDepth == eBitDepthFloat && pixelComponents == dstPixelComponents && pixelComponentCount == dstPixelComponentCount);
+        assert(bounds.x1 <= renderWindow.x1 && renderWindow.x2 <= bounds.x2 &&
+               bounds.y1 <= renderWindow.y1 && renderWindow.y2 <= bounds.y2 &&
+               dstBounds.x1 <= renderWindow.x1 && renderWindow.x2 <= dstBounds.x2 &&
+               dstBounds.y1 <= renderWindow.y1 && renderWindow.y2 <= dstBounds.y2);
+        //validate();
+
+        const int nComponents = pixelComponentCount;
+
+        for (int y = renderWindow.y1; y < renderWindow.y2; ++y) {
+            const OFX::half *src_pixels = (const OFX::half*)OFX::getPixelAddress(pixelData, bounds, pixelComponentCount, bitDepth, rowBytes, 0, y);
+            float *dst_pixels = (float*)OFX::getPixelAddress(dstPixelData, dstBounds, dstPixelComponentCount, dstBitDepth, dstRowBytes, 0, y);
+            const OFX::half *src_end = (const OFX::half*)OFX::getPixelAddress(pixelData, bounds, pixelComponentCount, bitDepth, rowBytes, renderWindow.x2, y, false);
+
+            while (src_pixels != src_end) {
+                if (nComponents == 1) {
+                    // alpha channel: no colorspace conversion
+                    dst_pixels[0] = src_pixels[0];
+                } else {
+                    for (int k = 0; k < 3; ++k) {
+                        dst_pixels[k] = _fromFunc(src_pixels[k]);
+                    }
+                    if (nComponents == 4) {
+                        // alpha channel: no colorspace conversion
+                        dst_pixels[3] = src_pixels[3];
+                    }
+                }
+                dst_pixels += nComponents;
+                src_pixels += nComponents;
+            }
+        }
+    }
+
 private:
     static float index_to_float(const unsigned short i);
     static unsigned short hipart(const float f);
@@ -1149,6 +1316,825 @@ void lab_to_xyz( float l, float a, float b, float *x, float *y, float *z );
 void rgb709_to_lab( float r, float g, float b, float *l, float *a, float *b_ );
 void lab_to_rgb709( float l, float a, float b, float *r, float *g, float *b_ );
 
+/// signature of the primaries conversion functions above (e.g. rgb709_to_xyz<double>)
+typedef void (*colorMatrixFunction)(double r, double g, double b, double *x, double *y, double *z);
+
+/**
+ * @brief A 3x3 matrix applied to RGB triplets, used to convert between primaries.
+ * It can be built from any of the linear primaries conversion functions above, and
+ * matrices can be multiplied, so that a chain of conversions is a single matrix-vector
+ * product per pixel:
+ *   ColorMatrix m = ColorMatrix(xyz_to_rgbACESAP1<double>) * ColorMatrix(rgb709_to_xyz<double>);
+ **/
+struct ColorMatrix
+{
+    double m[9]; // row-major: out[i] = m[3*i+0]*in[0] + m[3*i+1]*in[1] + m[3*i+2]*in[2]
+
+    ColorMatrix()
+    {
+        setIdentity();
+    }
+
+    explicit ColorMatrix(colorMatrixFunction f)
+    {
+        // the conversion functions are linear, so column j is the image of the j-th basis vector
+        double col[3][3];
+
+        f(1., 0., 0., &col[0][0], &col[0][1], &col[0][2]);
+        f(0., 1., 0., &col[1][0], &col[1][1], &col[1][2]);
+        f(0., 0., 1., &col[2][0], &col[2][1], &col[2][2]);
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                m[3 * i + j] = col[j][i];
+            }
+        }
+    }
+
+    void setIdentity()
+    {
+        for (int i = 0; i < 9; ++i) {
+            m[i] = (i % 4 == 0) ? 1. : 0.;
+        }
+    }
+
+    bool isIdentity() const
+    {
+        for (int i = 0; i < 9; ++i) {
+            if ( m[i] != ( (i % 4 == 0) ? 1. : 0. ) ) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// (a * b) applies b first, then a
+    ColorMatrix operator*(const ColorMatrix & b) const
+    {
+        ColorMatrix ret;
+
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                ret.m[3 * i + j] = m[3 * i + 0] * b.m[0 + j] + m[3 * i + 1] * b.m[3 + j] + m[3 * i + 2] * b.m[6 + j];
+            }
+        }
+
+        return ret;
+    }
+
+    void apply(float r,
+               float g,
+               float b,
+               float *r_,
+               float *g_,
+               float *b_) const
+    {
+        *r_ = (float)(m[0] * r + m[1] * g + m[2] * b);
+        *g_ = (float)(m[3] * r + m[4] * g + m[5] * b);
+        *b_ = (float)(m[6] * r + m[7] * g + m[8] * b);
+    }
+};
+
+/**
+ * @brief A color-space conversion made of a decoding Lut, a 3x3 matrix and an encoding Lut,
+ * applied in a single pass over the image.
+ * Each Lut may be NULL (linear). The alpha channel, if any, is copied.
+ * Float images are converted using the full transfer functions, 8-bit and 16-bit images
+ * use the Lut's fast look-up tables.
+ **/
+class ColorPipeline
+{
+public:
+    /// number of pixels processed at once: the intermediate planar buffers (3*kBlockSize floats) stay in L1
+    enum { kBlockSize = 256 };
+
+    ColorPipeline(const Lut* decode = NULL,
+                  const ColorMatrix & matrix = ColorMatrix(),
+                  const Lut* encode = NULL)
+        : _decode(decode)
+        , _encode(encode)
+        , _isIdentityMatrix(true)
+    {
+        setMatrix(matrix);
+    }
+
+    void setDecodeLut(const Lut* lut)
+    {
+        _decode = lut;
+    }
+
+    void setEncodeLut(const Lut* lut)
+    {
+        _encode = lut;
+    }
+
+    void setMatrix(const ColorMatrix & matrix)
+    {
+        for (int i = 0; i < 9; ++i) {
+            _m[i] = (float)matrix.m[i];
+        }
+        _isIdentityMatrix = matrix.isIdentity();
+    }
+
+    /// convert a single RGB triplet, with components in [0,1]
+    void apply(float r,
+               float g,
+               float b,
+               float *r_,
+               float *g_,
+               float *b_) const
+    {
+        if (_decode) {
+            r = _decode->fromColorSpaceFloatToLinearFloat(r);
+            g = _decode->fromColorSpaceFloatToLinearFloat(g);
+            b = _decode->fromColorSpaceFloatToLinearFloat(b);
+        }
+        float lr = _m[0] * r + _m[1] * g + _m[2] * b;
+        float lg = _m[3] * r + _m[4] * g + _m[5] * b;
+        float lb = _m[6] * r + _m[7] * g + _m[8] * b;
+        if (_encode) {
+            lr = _encode->toColorSpaceFloatFromLinearFloat(lr);
+            lg = _encode->toColorSpaceFloatFromLinearFloat(lg);
+            lb = _encode->toColorSpaceFloatFromLinearFloat(lb);
+        }
+        *r_ = lr;
+        *g_ = lg;
+        *b_ = lb;
+    }
+
+    /**
+     * @brief Convert a row of n pixels. src and dst may be the same buffer.
+     * PIX is unsigned char (maxValue=255), unsigned short (maxValue=65535) or float (maxValue=1).
+     **/
+    template <class PIX, int nComponents, int maxValue>
+    void processRow(const PIX* src,
+                    PIX* dst,
+                    int n) const
+    {
+        assert(nComponents == 3 || nComponents == 4);
+        // planar intermediate buffers, so that the matrix product vectorizes
+        float r[kBlockSize];
+        float g[kBlockSize];
+        float b[kBlockSize];
+
+        for (int x0 = 0; x0 < n; x0 += kBlockSize) {
+            const int len = (std::min)( (int)kBlockSize, n - x0 );
+            const PIX* s = src + x0 * nComponents;
+            PIX* d = dst + x0 * nComponents;
+
+            // decode
+            for (int i = 0; i < len; ++i, s += nComponents) {
+                r[i] = decode<PIX, maxValue>(s[0]);
+                g[i] = decode<PIX, maxValue>(s[1]);
+                b[i] = decode<PIX, maxValue>(s[2]);
+            }
+
+            // matrix
+            if (!_isIdentityMatrix) {
+                const float m0 = _m[0], m1 = _m[1], m2 = _m[2];
+                const float m3 = _m[3], m4 = _m[4], m5 = _m[5];
+                const float m6 = _m[6], m7 = _m[7], m8 = _m[8];
+                for (int i = 0; i < len; ++i) {
+                    const float vr = r[i], vg = g[i], vb = b[i];
+                    r[i] = m0 * vr + m1 * vg + m2 * vb;
+                    g[i] = m3 * vr + m4 * vg + m5 * vb;
+                    b[i] = m6 * vr + m7 * vg + m8 * vb;
+                }
+            }
+
+            // encode (alpha is left untouched, or copied if src != dst)
+            s = src + x0 * nComponents;
+            for (int i = 0; i < len; ++i, s += nComponents, d += nComponents) {
+                if (nComponents == 4) {
+                    d[3] = s[3];
+                }
+                d[0] = encode<PIX, maxValue>(r[i]);
+                d[1] = encode<PIX, maxValue>(g[i]);
+                d[2] = encode<PIX, maxValue>(b[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Convert renderWindow from src to dst, using the multithread suite.
+     * Both images must have the same bit depth and the same number of components (3 or 4).
+     * Pixels outside of the source bounds are set to black and transparent.
+     * @see colorTransformProcess()
+     **/
+    void process(OFX::ImageEffect &instance,
+                 const OfxRectI & renderWindow,
+                 const OfxPointD & renderScale,
+                 const OFX::Image* srcImg,
+                 OFX::Image* dstImg) const;
+
+private:
+    template <class PIX, int maxValue>
+    float decode(PIX v) const
+    {
+        if (maxValue == 255) {
+            return _decode ? _decode->fromColorSpaceUint8ToLinearFloatFast( (unsigned char)v ) : intToFloat<256>(v);
+        } else if (maxValue == 65535) {
+            return _decode ? _decode->fromColorSpaceUint16ToLinearFloatFast( (unsigned short)v ) : intToFloat<65536>(v);
+        }
+
+        return _decode ? _decode->fromColorSpaceFloatToLinearFloat(v) : (float)v;
+    }
+
+    template <class PIX, int maxValue>
+    PIX encode(float v) const
+    {
+        if (maxValue == 255) {
+            return (PIX)( _encode ? _encode->toColorSpaceUint8FromLinearFloatFast(v) : floatToInt<256>(v) );
+        } else if (maxValue == 65535) {
+            return (PIX)( _encode ? _encode->toColorSpaceUint16FromLinearFloatFast(v) : floatToInt<65536>(v) );
+        }
+
+        return (PIX)( _encode ? _encode->toColorSpaceFloatFromLinearFloat(v) : v );
+    }
+
+    const Lut* _decode;
+    const Lut* _encode;
+    float _m[9];
+    bool _isIdentityMatrix;
+};
+
+enum Lut3DInterpolationEnum
+{
+    eLut3DInterpolationTrilinear = 0,
+    eLut3DInterpolationTetrahedral
+};
+
+/**
+ * @brief A 3D look-up table, as read from a .cube (Resolve/Iridas) or .3dl (Autodesk/Lustre) file.
+ * An optional shaper Lut maps the (linear) input to the space the 3D LUT was designed for
+ * (using its toColorSpaceFloatFromLinearFloat() function) before the 3D look-up, so that
+ * e.g. scene-linear images can be fed to a 3D LUT built for log input.
+ * The alpha channel, if any, is copied.
+ **/
+class Lut3D
+{
+public:
+    /// number of pixels processed at once
+    enum { kBlockSize = 256 };
+
+    Lut3D()
+        : _name()
+        , _size(0)
+        , _data()
+        , _shaper(NULL)
+        , _interpolation(eLut3DInterpolationTetrahedral)
+    {
+        for (int c = 0; c < 3; ++c) {
+            _domainMin[c] = 0.f;
+            _domainMax[c] = 1.f;
+        }
+    }
+
+    /**
+     * @brief Read a .cube or .3dl file (the format is deduced from the extension, .cube is the default).
+     * The filename is UTF-8 encoded.
+     * @return false and set errorMessage if the file could not be read.
+     **/
+    bool read(const std::string & filename, std::string* errorMessage);
+
+    /// initialize the LUT from a size^3 RGB table where red changes fastest
+    void setTable(int size, const std::vector<float> & rgb)
+    {
+        assert( (int)rgb.size() == size * size * size * 3 );
+        _size = size;
+        _data = rgb;
+    }
+
+    void setDomain(const float domainMin[3],
+                   const float domainMax[3])
+    {
+        for (int c = 0; c < 3; ++c) {
+            _domainMin[c] = domainMin[c];
+            _domainMax[c] = domainMax[c];
+        }
+    }
+
+    void setShaper(const Lut* shaper)
+    {
+        _shaper = shaper;
+    }
+
+    void setInterpolation(Lut3DInterpolationEnum interpolation)
+    {
+        _interpolation = interpolation;
+    }
+
+    const std::string & getName() const
+    {
+        return _name;
+    }
+
+    int getSize() const
+    {
+        return _size;
+    }
+
+    bool isValid() const
+    {
+        return _size >= 2;
+    }
+
+    /// convert a single RGB triplet
+    void apply(float r,
+               float g,
+               float b,
+               float *r_,
+               float *g_,
+               float *b_) const
+    {
+        float rgb[3] = { r, g, b };
+
+        toLatticeCoords(rgb);
+        lookup(rgb[0], rgb[1], rgb[2], r_, g_, b_);
+    }
+
+    /**
+     * @brief Convert a row of n pixels. src and dst may be the same buffer.
+     * PIX is unsigned char (maxValue=255), unsigned short (maxValue=65535) or float (maxValue=1).
+     **/
+    template <class PIX, int nComponents, int maxValue>
+    void processRow(const PIX* src,
+                    PIX* dst,
+                    int n) const
+    {
+        assert(nComponents == 3 || nComponents == 4);
+        assert( isValid() );
+        // planar buffers holding the lattice coordinates, then the result
+        float r[kBlockSize];
+        float g[kBlockSize];
+        float b[kBlockSize];
+
+        for (int x0 = 0; x0 < n; x0 += kBlockSize) {
+            const int len = (std::min)( (int)kBlockSize, n - x0 );
+            const PIX* s = src + x0 * nComponents;
+            PIX* d = dst + x0 * nComponents;
+
+            for (int i = 0; i < len; ++i, s += nComponents) {
+                r[i] = s[0] / (float)maxValue;
+                g[i] = s[1] / (float)maxValue;
+                b[i] = s[2] / (float)maxValue;
+            }
+            if (_shaper) {
+                for (int i = 0; i < len; ++i) {
+                    r[i] = _shaper->toColorSpaceFloatFromLinearFloat(r[i]);
+                    g[i] = _shaper->toColorSpaceFloatFromLinearFloat(g[i]);
+                    b[i] = _shaper->toColorSpaceFloatFromLinearFloat(b[i]);
+                }
+            }
+            // scale to lattice coordinates and clamp (this loop vectorizes)
+            const float n1 = (float)(_size - 1);
+            const float sr = n1 / (_domainMax[0] - _domainMin[0]);
+            const float sg = n1 / (_domainMax[1] - _domainMin[1]);
+            const float sb = n1 / (_domainMax[2] - _domainMin[2]);
+            for (int i = 0; i < len; ++i) {
+                r[i] = clampLattice( (r[i] - _domainMin[0]) * sr, n1 );
+                g[i] = clampLattice( (g[i] - _domainMin[1]) * sg, n1 );
+                b[i] = clampLattice( (b[i] - _domainMin[2]) * sb, n1 );
+            }
+            if (_interpolation == eLut3DInterpolationTrilinear) {
+                for (int i = 0; i < len; ++i) {
+                    trilinear(r[i], g[i], b[i], &r[i], &g[i], &b[i]);
+                }
+            } else {
+                for (int i = 0; i < len; ++i) {
+                    tetrahedral(r[i], g[i], b[i], &r[i], &g[i], &b[i]);
+                }
+            }
+
+            s = src + x0 * nComponents;
+            for (int i = 0; i < len; ++i, s += nComponents, d += nComponents) {
+                if (nComponents == 4) {
+                    d[3] = s[3];
+                }
+                if (maxValue == 1) {
+                    d[0] = (PIX)r[i];
+                    d[1] = (PIX)g[i];
+                    d[2] = (PIX)b[i];
+                } else {
+                    d[0] = (PIX)floatToInt<maxValue + 1>(r[i]);
+                    d[1] = (PIX)floatToInt<maxValue + 1>(g[i]);
+                    d[2] = (PIX)floatToInt<maxValue + 1>(b[i]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Convert renderWindow from src to dst, using the multithread suite.
+     * @see colorTransformProcess()
+     **/
+    void process(OFX::ImageEffect &instance,
+                 const OfxRectI & renderWindow,
+                 const OfxPointD & renderScale,
+                 const OFX::Image* srcImg,
+                 OFX::Image* dstImg) const;
+
+private:
+    // clamp v to [0, n1]. NaN maps to 0 and infinities to the bounds (std::min/std::max would let NaN through).
+    static float clampLattice(float v,
+                              float n1)
+    {
+        return (v >= 0.f) ? ( (v <= n1) ? v : n1 ) : 0.f;
+    }
+
+    void toLatticeCoords(float rgb[3]) const
+    {
+        const float n1 = (float)(_size - 1);
+
+        for (int c = 0; c < 3; ++c) {
+            float v = _shaper ? _shaper->toColorSpaceFloatFromLinearFloat(rgb[c]) : rgb[c];
+            v = (v - _domainMin[c]) * n1 / (_domainMax[c] - _domainMin[c]);
+            rgb[c] = clampLattice(v, n1);
+        }
+    }
+
+    void lookup(float r,
+                float g,
+                float b,
+                float *r_,
+                float *g_,
+                float *b_) const
+    {
+        if (_interpolation == eLut3DInterpolationTrilinear) {
+            trilinear(r, g, b, r_, g_, b_);
+        } else {
+            tetrahedral(r, g, b, r_, g_, b_);
+        }
+    }
+
+    // lattice coordinates are in [0, _size - 1]
+    void cell(float r,
+              float g,
+              float b,
+              int *i0,
+              int di[3],
+              float f[3]) const
+    {
+        const float c[3] = { r, g, b };
+        const int stride[3] = { 3, 3 * _size, 3 * _size * _size };
+
+        *i0 = 0;
+        for (int k = 0; k < 3; ++k) {
+            int i = (int)c[k];
+            if (i >= _size - 1) {
+                i = _size - 2;
+            } else if (i < 0) {
+                i = 0;
+            }
+            f[k] = c[k] - i;
+            *i0 += i * stride[k];
+            di[k] = stride[k];
+        }
+    }
+
+    void trilinear(float r,
+                   float g,
+                   float b,
+                   float *r_,
+                   float *g_,
+                   float *b_) const
+    {
+        int i0;
+        int di[3];
+        float f[3];
+
+        cell(r, g, b, &i0, di, f);
+        const float* p = &_data[i0];
+        float out[3];
+        for (int c = 0; c < 3; ++c) {
+            const float c000 = p[c];
+            const float c100 = p[di[0] + c];
+            const float c010 = p[di[1] + c];
+            const float c110 = p[di[0] + di[1] + c];
+            const float c001 = p[di[2] + c];
+            const float c101 = p[di[0] + di[2] + c];
+            const float c011 = p[di[1] + di[2] + c];
+            const float c111 = p[di[0] + di[1] + di[2] + c];
+            const float c00 = c000 + (c100 - c000) * f[0];
+            const float c10 = c010 + (c110 - c010) * f[0];
+            const float c01 = c001 + (c101 - c001) * f[0];
+            const float c11 = c011 + (c111 - c011) * f[0];
+            const float c0 = c00 + (c10 - c00) * f[1];
+            const float c1 = c01 + (c11 - c01) * f[1];
+            out[c] = c0 + (c1 - c0) * f[2];
+        }
+        *r_ = out[0];
+        *g_ = out[1];
+        *b_ = out[2];
+    }
+
+    // tetrahedral interpolation: the unit cube is split in 6 tetrahedra along its main diagonal,
+    // and only 4 vertices are read instead of 8.
+    void tetrahedral(float r,
+                     float g,
+                     float b,
+                     float *r_,
+                     float *g_,
+                     float *b_) const
+    {
+        int i0;
+        int di[3];
+        float f[3];
+
+        cell(r, g, b, &i0, di, f);
+        // sort the fractional parts, and walk from the origin to the opposite corner
+        // along the edges of the tetrahedron containing the point
+        int a, m, z; // axes with the largest, median and smallest fractions
+        if (f[0] >= f[1]) {
+            if (f[1] >= f[2]) {
+                a = 0; m = 1; z = 2;
+            } else if (f[0] >= f[2]) {
+                a = 0; m = 2; z = 1;
+            } else {
+                a = 2; m = 0; z = 1;
+            }
+        } else {
+            if (f[0] >= f[2]) {
+                a = 1; m = 0; z = 2;
+            } else if (f[1] >= f[2]) {
+                a = 1; m = 2; z = 0;
+            } else {
+                a = 2; m = 1; z = 0;
+            }
+        }
+        const float* p0 = &_data[i0];
+        const float* p1 = p0 + di[a];
+        const float* p2 = p1 + di[m];
+        const float* p3 = p2 + di[z];
+        const float w0 = 1.f - f[a];
+        const float w1 = f[a] - f[m];
+        const float w2 = f[m] - f[z];
+        const float w3 = f[z];
+        *r_ = w0 * p0[0] + w1 * p1[0] + w2 * p2[0] + w3 * p3[0];
+        *g_ = w0 * p0[1] + w1 * p1[1] + w2 * p2[1] + w3 * p3[1];
+        *b_ = w0 * p0[2] + w1 * p1[2] + w2 * p2[2] + w3 * p3[2];
+    }
+
+    bool readCube(std::FILE* file, std::string* errorMessage);
+    bool read3dl(std::FILE* file, std::string* errorMessage);
+
+    std::string _name;                 ///< name of the lut (the file name)
+    int _size;                         ///< number of lattice points along each axis
+    std::vector<float> _data;          ///< _size^3 RGB triplets, red changes fastest
+    float _domainMin[3];
+    float _domainMax[3];
+    const Lut* _shaper;
+    Lut3DInterpolationEnum _interpolation;
+};
+
+// apply transform.processRow() to a row of n pixels
+template <class TRANSFORM, class PIX, int nComponents, int maxValue>
+struct ColorTransformRow
+{
+    static void process(const TRANSFORM & transform,
+                        const PIX* src,
+                        PIX* dst,
+                        int n)
+    {
+        transform.template processRow<PIX, nComponents, maxValue>(src, dst, n);
+    }
+};
+
+// half rows are converted to float in blocks (using F16C if available), processed as float, and converted back
+template <class TRANSFORM, int nComponents>
+struct ColorTransformRow<TRANSFORM, OFX::half, nComponents, 1>
+{
+    enum { kBlockSize = 256 };
+
+    static void process(const TRANSFORM & transform,
+                        const OFX::half* src,
+                        OFX::half* dst,
+                        int n)
+    {
+        float tmp[kBlockSize * nComponents];
+
+        for (int x0 = 0; x0 < n; x0 += kBlockSize) {
+            const int len = (std::min)( (int)kBlockSize, n - x0 );
+            halfToFloat(src + x0 * nComponents, tmp, len * nComponents);
+            transform.template processRow<float, nComponents, 1>(tmp, tmp, len);
+            floatToHalf(tmp, dst + x0 * nComponents, len * nComponents);
+        }
+    }
+};
+
+// threaded processor for any color transform that has a method
+// processRow<PIX, nComponents, maxValue>(const PIX* src, PIX* dst, int n) (e.g. ColorPipeline or Lut3D)
+template <class TRANSFORM, class PIX, int nComponents, int maxValue>
+class ColorTransformProcessor
+    : public OFX::PixelProcessorFilterBase
+{
+public:
+    ColorTransformProcessor(OFX::ImageEffect &instance,
+                            const TRANSFORM & transform)
+        : OFX::PixelProcessorFilterBase(instance)
+        , _transform(transform)
+    {
+    }
+
+    void multiThreadProcessImages(const OfxRectI& procWindow,
+                                  const OfxPointD& rs)
+    {
+        unused(rs);
+        assert(_dstBounds.x1 <= procWindow.x1 && procWindow.x2 <= _dstBounds.x2 && _dstBounds.y1 <= procWindow.y1 && procWindow.y2 <= _dstBounds.y2);
+        // the part of the row that is within the source bounds
+        const int x1 = (std::max)(_srcBounds.x1, procWindow.x1);
+        const int x2 = (std::min)(_srcBounds.x2, procWindow.x2);
+
+        for (int y = procWindow.y1; y < procWindow.y2; ++y) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
+                break;
+            }
+
+            PIX *dstPix = (PIX *) getDstPixelAddress(procWindow.x1, y);
+            assert(dstPix);
+            if (!dstPix) {
+                // coverity[dead_error_line]
+                continue;
+            }
+            if ( (y < _srcBounds.y1) || (_srcBounds.y2 <= y) || (x2 <= x1) ) {
+                std::fill( dstPix, dstPix + nComponents * (procWindow.x2 - procWindow.x1), PIX() );
+                continue;
+            }
+            // start and end of line may be black
+            std::fill( dstPix, dstPix + nComponents * (x1 - procWindow.x1), PIX() );
+            std::fill( dstPix + nComponents * (x2 - procWindow.x1), dstPix + nComponents * (procWindow.x2 - procWindow.x1), PIX() );
+
+            const PIX *srcPix = (const PIX *) getSrcPixelAddress(x1, y);
+            assert(srcPix);
+            ColorTransformRow<TRANSFORM, PIX, nComponents, maxValue>::process(_transform, srcPix, dstPix + nComponents * (x1 - procWindow.x1), x2 - x1);
+        }
+    }
+
+private:
+    const TRANSFORM & _transform;
+};
+
+template <class TRANSFORM, class PIX, int nComponents, int maxValue>
+void
+colorTransformProcessForDepthAndComponents(const TRANSFORM & transform,
+                                          OFX::ImageEffect &instance,
+                                          const OfxRectI & renderWindow,
+                                          const OfxPointD & renderScale,
+                                          const void *srcPixelData,
+                                          const OfxRectI & srcBounds,
+                                          OFX::PixelComponentEnum srcPixelComponents,
+                                          int srcPixelComponentCount,
+                                          OFX::BitDepthEnum srcBitDepth,
+                                          int srcRowBytes,
+                                          void *dstPixelData,
+                                          const OfxRectI & dstBounds,
+                                          OFX::PixelComponentEnum dstPixelComponents,
+                                          int dstPixelComponentCount,
+                                          OFX::BitDepthEnum dstBitDepth,
+                                          int dstRowBytes)
+{
+    ColorTransformProcessor<TRANSFORM, PIX, nComponents, maxValue> processor(instance, transform);
+    // set the images
+    processor.setDstImg(dstPixelData, dstBounds, dstPixelComponents, dstPixelComponentCount, dstBitDepth, dstRowBytes);
+    processor.setSrcImg(srcPixelData, srcBounds, srcPixelComponents, srcPixelComponentCount, srcBitDepth, srcRowBytes, 0);
+
+    // set the render window
+    processor.setRenderWindow(renderWindow, renderScale);
+
+    // Call the base class process member, this will call the derived templated process code
+    processor.process();
+}
+
+template <class TRANSFORM, class PIX, int maxValue>
+void
+colorTransformProcessForDepth(const TRANSFORM & transform,
+                             OFX::ImageEffect &instance,
+                             const OfxRectI & renderWindow,
+                             const OfxPointD & renderScale,
+                             const void *srcPixelData,
+                             const OfxRectI & srcBounds,
+                             OFX::PixelComponentEnum srcPixelComponents,
+                             int srcPixelComponentCount,
+                             OFX::BitDepthEnum srcBitDepth,
+                             int srcRowBytes,
+                             void *dstPixelData,
+                             const OfxRectI & dstBounds,
+                             OFX::PixelComponentEnum dstPixelComponents,
+                             int dstPixelComponentCount,
+                             OFX::BitDepthEnum dstBitDepth,
+                             int dstRowBytes)
+{
+    if (dstPixelComponentCount == 4) {
+        colorTransformProcessForDepthAndComponents<TRANSFORM, PIX, 4, maxValue>(transform, instance, renderWindow, renderScale,
+                                                                    srcPixelData, srcBounds, srcPixelComponents, srcPixelComponentCount, srcBitDepth, srcRowBytes,
+                                                                    dstPixelData, dstBounds, dstPixelComponents, dstPixelComponentCount, dstBitDepth, dstRowBytes);
+    } else if (dstPixelComponentCount == 3) {
+        colorTransformProcessForDepthAndComponents<TRANSFORM, PIX, 3, maxValue>(transform, instance, renderWindow, renderScale,
+                                                                    srcPixelData, srcBounds, srcPixelComponents, srcPixelComponentCount, srcBitDepth, srcRowBytes,
+                                                                    dstPixelData, dstBounds, dstPixelComponents, dstPixelComponentCount, dstBitDepth, dstRowBytes);
+    } else {
+        OFX::throwSuiteStatusException(kOfxStatErrFormat);
+    }
+}
+
+template <class TRANSFORM>
+void
+colorTransformProcess(const TRANSFORM & transform,
+                      OFX::ImageEffect &instance,
+                      const OfxRectI & renderWindow,
+                      const OfxPointD & renderScale,
+                      const void *srcPixelData,
+                      const OfxRectI & srcBounds,
+                      OFX::PixelComponentEnum srcPixelComponents,
+                      int srcPixelComponentCount,
+                      OFX::BitDepthEnum srcBitDepth,
+                      int srcRowBytes,
+                      void *dstPixelData,
+                      const OfxRectI & dstBounds,
+                      OFX::PixelComponentEnum dstPixelComponents,
+                      int dstPixelComponentCount,
+                      OFX::BitDepthEnum dstBitDepth,
+                      int dstRowBytes)
+{
+    assert(srcPixelData && dstPixelData);
+    if ( (srcBitDepth != dstBitDepth) || (srcPixelComponentCount != dstPixelComponentCount) ) {
+        OFX::throwSuiteStatusException(kOfxStatErrImageFormat);
+
+        return;
+    }
+    switch (dstBitDepth) {
+    case OFX::eBitDepthUByte:
+        colorTransformProcessForDepth<TRANSFORM, unsigned char, 255>(transform, instance, renderWindow, renderScale,
+                                                                     srcPixelData, srcBounds, srcPixelComponents, srcPixelComponentCount, srcBitDepth, srcRowBytes,
+                                                                     dstPixelData, dstBounds, dstPixelComponents, dstPixelComponentCount, dstBitDepth, dstRowBytes);
+        break;
+    case OFX::eBitDepthUShort:
+        colorTransformProcessForDepth<TRANSFORM, unsigned short, 65535>(transform, instance, renderWindow, renderScale,
+                                                                        srcPixelData, srcBounds, srcPixelComponents, srcPixelComponentCount, srcBitDepth, srcRowBytes,
+                                                                        dstPixelData, dstBounds, dstPixelComponents, dstPixelComponentCount, dstBitDepth, dstRowBytes);
+        break;
+    case OFX::eBitDepthHalf:
+        colorTransformProcessForDepth<TRANSFORM, OFX::half, 1>(transform, instance, renderWindow, renderScale,
+                                                               srcPixelData, srcBounds, srcPixelComponents, srcPixelComponentCount, srcBitDepth, srcRowBytes,
+                                                               dstPixelData, dstBounds, dstPixelComponents, dstPixelComponentCount, dstBitDepth, dstRowBytes);
+        break;
+    case OFX::eBitDepthFloat:
+        colorTransformProcessForDepth<TRANSFORM, float, 1>(transform, instance, renderWindow, renderScale,
+                                                           srcPixelData, srcBounds, srcPixelComponents, srcPixelComponentCount, srcBitDepth, srcRowBytes,
+                                                           dstPixelData, dstBounds, dstPixelComponents, dstPixelComponentCount, dstBitDepth, dstRowBytes);
+        break;
+    default:
+        OFX::throwSuiteStatusException(kOfxStatErrFormat);
+    }
+}
+
+template <class TRANSFORM>
+void
+colorTransformProcess(const TRANSFORM & transform,
+                      OFX::ImageEffect &instance,
+                      const OfxRectI & renderWindow,
+                      const OfxPointD & renderScale,
+                      const OFX::Image* srcImg,
+                      OFX::Image* dstImg)
+{
+    const void* srcPixelData;
+    OfxRectI srcBounds;
+    OFX::PixelComponentEnum srcPixelComponents;
+    OFX::BitDepthEnum srcBitDepth;
+    int srcRowBytes;
+    void* dstPixelData;
+    OfxRectI dstBounds;
+    OFX::PixelComponentEnum dstPixelComponents;
+    OFX::BitDepthEnum dstBitDepth;
+    int dstRowBytes;
+
+    assert(srcImg && dstImg);
+    getImageData(srcImg, &srcPixelData, &srcBounds, &srcPixelComponents, &srcBitDepth, &srcRowBytes);
+    getImageData(dstImg, &dstPixelData, &dstBounds, &dstPixelComponents, &dstBitDepth, &dstRowBytes);
+    colorTransformProcess(transform, instance, renderWindow, renderScale,
+                          srcPixelData, srcBounds, srcPixelComponents, srcImg->getPixelComponentCount(), srcBitDepth, srcRowBytes,
+                          dstPixelData, dstBounds, dstPixelComponents, dstImg->getPixelComponentCount(), dstBitDepth, dstRowBytes);
+}
+
+inline void
+ColorPipeline::process(OFX::ImageEffect &instance,
+                       const OfxRectI & renderWindow,
+                       const OfxPointD & renderScale,
+                       const OFX::Image* srcImg,
+                       OFX::Image* dstImg) const
+{
+    colorTransformProcess(*this, instance, renderWindow, renderScale, srcImg, dstImg);
+}
+
+inline void
+Lut3D::process(OFX::ImageEffect &instance,
+               const OfxRectI & renderWindow,
+               const OfxPointD & renderScale,
+               const OFX::Image* srcImg,
+               OFX::Image* dstImg) const
+{
+    colorTransformProcess(*this, instance, renderWindow, renderScale, srcImg, dstImg);
+}
 
 // an object that holds precomputed LUTs for the whole application.
 // The LutManager object should be constructed in the plugin factory's load() function, and destructed in the unload() function
@@ -1159,11 +2145,15 @@ class LutManager
     typedef OFX::MultiThread::AutoMutexT<MUTEX> AutoMutex;
 
     typedef std::map<std::string, const Lut* > LutsMap;
+    // 3D luts are keyed by file name, shaper and interpolation, since these cannot be changed on a shared lut
+    typedef std::pair<std::string, std::pair<const Lut*, int> > Lut3DKey;
+    typedef std::map<Lut3DKey, const Lut3D* > Luts3DMap;
 
 public:
     LutManager()
     : _lock()
     , _luts()
+    , _luts3D()
     {
     }
 
@@ -1172,6 +2162,9 @@ public:
         for (typename LutsMap::iterator it = _luts.begin(); it != _luts.end(); ++it) {
             delete it->second;
         }
+        for (typename Luts3DMap::iterator it = _luts3D.begin(); it != _luts3D.end(); ++it) {
+            delete it->second;
+        }
     }
 
     /**
@@ -1202,6 +2195,23 @@ public:
         return NULL;
     }
 
+    /**
+     * @brief Same as getLut(), but also builds the table used by Lut::toColorSpaceUint16FromLinearFloatFast()
+     * for accurate 16-bit output (256kB per lut). The table is built only once.
+     * @WARNING: Not thread-safe with respect to renders using the same lut. You should call it in the load() action of your plug-in
+     **/
+    const Lut* getLutUint16(const std::string & name,
+                            fromColorSpaceFunctionV1 fromFunc,
+                            toColorSpaceFunctionV1 toFunc)
+    {
+        const Lut* lut = getLut(name, fromFunc, toFunc);
+        AutoMutex l(_lock);
+
+        lut->fillUint16Table();
+
+        return lut;
+    }
+
     /**
      * @brief Release a lut previously retrieved with getLut()
      **/
@@ -1215,6 +2225,57 @@ public:
         }
     }
 
+    /**
+     * @brief Returns a pointer to the 3D lut read from the given file (.cube or .3dl), using the given
+     * shaper (which may be NULL, and must outlive the 3D lut) and interpolation.
+     * The file is read only once, and further calls return the cached lut. A lut with another shaper
+     * or interpolation is a copy of the cached table.
+     * Ownership of the returned pointer remains to the LutManager.
+     * @return NULL and set errorMessage if the file could not be read.
+     **/
+    const Lut3D* getLut3D(const std::string & filename,
+                          const Lut* shaper,
+                          Lut3DInterpolationEnum interpolation,
+                          std::string* errorMessage)
+    {
+        AutoMutex l(_lock);
+        const Lut3DKey key( filename, std::make_pair(shaper, (int)interpolation) );
+        typename Luts3DMap::iterator found = _luts3D.find(key);
+
+        if ( found != _luts3D.end() ) {
+            return found->second;
+        }
+        std::auto_ptr<Lut3D> lut;
+        found = findLut3D(filename);
+        if ( found != _luts3D.end() ) {
+            lut.reset( new Lut3D(*found->second) );
+        } else {
+            lut.reset(new Lut3D);
+            if ( !lut->read(filename, errorMessage) ) {
+                return NULL;
+            }
+        }
+        lut->setShaper(shaper);
+        lut->setInterpolation(interpolation);
+        _luts3D[key] = lut.get();
+
+        return lut.release();
+    }
+
+    /**
+     * @brief Release the 3D luts previously retrieved with getLut3D() from the given file (with any shaper
+     * and interpolation), e.g. when the file changed
+     **/
+    void releaseLut3D(const std::string& filename)
+    {
+        AutoMutex l(_lock);
+        typename Luts3DMap::iterator found = findLut3D(filename);
+        while ( found != _luts3D.end() && found->first.first == filename ) {
+            delete found->second;
+            _luts3D.erase(found++);
+        }
+    }
+
     ///buit-ins color-spaces
     const Lut* linearLut()
     {
@@ -1290,9 +2351,17 @@ private:
     LutManager &operator= (const LutManager &);
     LutManager(const LutManager &);
 
+    // the first 3D lut read from filename, or _luts3D.end()
+    typename Luts3DMap::iterator findLut3D(const std::string& filename)
+    {
+        typename Luts3DMap::iterator it = _luts3D.lower_bound( Lut3DKey( filename, std::make_pair( (const Lut*)NULL, 0 ) ) );
+
+        return ( it != _luts3D.end() && it->first.first == filename ) ? it : _luts3D.end();
+    }
 
-    mutable MUTEX _lock;                 ///< protects _luts
+    mutable MUTEX _lock;                 ///< protects _luts and _luts3D
     LutsMap _luts;
+    Luts3DMap _luts3D;
 };
 
 }         //namespace Color
@@ -0,0 +1,358 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; -*- */
+/* ***** BEGIN LICENSE BLOCK *****
+ * This file is part of openfx-supportext <https://github.com/NatronGitHub/openfx-supportext>,
+ * (C) 2018-2021 The Natron Developers
+ * (C) 2013-2018 INRIA
+ *
+ * openfx-supportext is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * openfx-supportext is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openfx-supportext.  If not, see <http://www.gnu.org/licenses/gpl-2.0.html>
+ * ***** END LICENSE BLOCK ***** */
+
+/*
+ * OFX merge stack: composite N layers in a single pass.
+ */
+
+#ifndef openfx_supportext_ofxsMergeStack_h
+#define openfx_supportext_ofxsMergeStack_h
+
+#include <vector>
+#include <algorithm>
+
+#include "ofxsProcessing.H"
+#include "ofxsMaskMix.h"
+#include "ofxsMerging.h"
+#include "ofxsHalf.h"
+#include "ofxsMacros.h"
+#include "ofxsProfiling.h"
+
+namespace OFX {
+namespace MergeImages2D {
+/** @brief one layer of a merge stack: img is the A input, and the result of the layers below is the B input */
+struct MergeLayer
+{
+    const OFX::Image* img;            ///< A input (NULL is black and transparent)
+    MergingFunctionEnum operation;
+    bool alphaMasking;                ///< see mergePixel()
+    double mix;
+    const OFX::Image* maskImg;        ///< optional mask, with the same depth as the other images (NULL if masking is disabled)
+    bool maskInvert;
+
+    MergeLayer()
+        : img(NULL)
+        , operation(eMergeOver)
+        , alphaMasking(false)
+        , mix(1.)
+        , maskImg(NULL)
+        , maskInvert(false)
+    {
+    }
+};
+
+class MergeStackProcessorBase
+    : public OFX::ImageProcessor
+{
+protected:
+    const OFX::Image *_bgImg;
+    std::vector<MergeLayer> _layers;
+
+public:
+
+    MergeStackProcessorBase(OFX::ImageEffect &instance)
+        : OFX::ImageProcessor(instance)
+        , _bgImg(NULL)
+        , _layers()
+    {
+    }
+
+    /** @brief set the bottom image of the stack (NULL is black and transparent) */
+    void setBackgroundImg(const OFX::Image *v)
+    {
+        _bgImg = v;
+    }
+
+    /** @brief add a layer on top of the stack */
+    void addLayer(const MergeLayer & layer)
+    {
+        _layers.push_back(layer);
+    }
+
+    void setLayers(const std::vector<MergeLayer> & layers)
+    {
+        _layers = layers;
+    }
+};
+
+/**
+ * @brief Composite the layers over the background image, bottom to top, in a single pass.
+ * Each row is processed in tiles of kTileSize pixels, which are accumulated in the destination
+ * row while they are in the L1 cache, instead of writing one full intermediate image per layer.
+ * As in the two-input Merge, each layer is merged in normalized float (so that integer images saturate
+ * instead of wrapping), and its result is stored as PIX through ofxsMaskMixPix(), so that the output is
+ * bit-identical to chaining two-input merges.
+ **/
+template <class PIX, int nComponents, int maxValue>
+class MergeStackProcessor
+    : public MergeStackProcessorBase
+{
+    typedef void (*RowFunction)(bool, const float*, const float*, float*, int);
+
+public:
+    enum { kTileSize = 256 };
+
+    MergeStackProcessor(OFX::ImageEffect &instance)
+        : MergeStackProcessorBase(instance)
+    {
+    }
+
+private:
+    void multiThreadProcessImages(const OfxRectI& procWindow, const OfxPointD& rs) OVERRIDE FINAL
+    {
+        unused(rs);
+        assert(_dstImg);
+        std::vector<RowFunction> rowFunctions( _layers.size() );
+        for (std::size_t i = 0; i < _layers.size(); ++i) {
+            rowFunctions[i] = getRowFunction(_layers[i].operation);
+        }
+        PIX aRow[kTileSize * nComponents];
+        float aFloat[kTileSize * nComponents];
+        float bFloat[kTileSize * nComponents];
+        float merged[kTileSize * nComponents];
+
+        for (int y = procWindow.y1; y < procWindow.y2; ++y) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
+                break;
+            }
+
+            PIX *dstPix = (PIX *) _dstImg->getPixelAddress(procWindow.x1, y);
+            assert(dstPix);
+            if (!dstPix) {
+                // coverity[dead_error_line]
+                continue;
+            }
+            for (int x0 = procWindow.x1; x0 < procWindow.x2; x0 += kTileSize) {
+                const int n = (std::min)( (int)kTileSize, procWindow.x2 - x0 );
+                PIX *acc = dstPix + (x0 - procWindow.x1) * nComponents;
+
+                copyRow(_bgImg, x0, y, n, acc);
+                for (std::size_t i = 0; i < _layers.size(); ++i) {
+                    const MergeLayer & layer = _layers[i];
+                    const PIX *a = getRow(layer.img, x0, y, n, aRow);
+                    rowFunctions[i]( layer.alphaMasking, toFloat(a, aFloat, n), toFloat(acc, bFloat, n), merged, n );
+                    float tmpPix[nComponents];
+                    for (int x = 0; x < n; ++x) {
+                        for (int c = 0; c < nComponents; ++c) {
+                            tmpPix[c] = merged[x * nComponents + c] * maxValue;
+                        }
+                        ofxsMaskMixPix<PIX, nComponents, maxValue, true>(tmpPix, x0 + x, y, acc + x * nComponents,
+                                                                         layer.maskImg != NULL, layer.maskImg, (float)layer.mix, layer.maskInvert,
+                                                                         acc + x * nComponents);
+                    }
+                }
+            }
+        }
+    } // multiThreadProcessImages
+
+    // return the n pixels of src normalized to [0,1], in buf
+    template <class SRCPIX>
+    static const float * toFloat(const SRCPIX *src,
+                                 float *buf,
+                                 int n)
+    {
+        for (int i = 0; i < n * nComponents; ++i) {
+            buf[i] = src[i] / (float)maxValue;
+        }
+
+        return buf;
+    }
+
+    // float images are already normalized
+    static const float * toFloat(const float *src,
+                                 float * /*buf*/,
+                                 int /*n*/)
+    {
+        return src;
+    }
+
+    // return the n pixels of img starting at (x0, y), using buf (padded with black) if they are not all within the image bounds
+    static const PIX * getRow(const OFX::Image* img,
+                              int x0,
+                              int y,
+                              int n,
+                              PIX *buf)
+    {
+        if (img) {
+            const OfxRectI & bounds = img->getBounds();
+            if ( (bounds.y1 <= y) && (y < bounds.y2) && (bounds.x1 <= x0) && (x0 + n <= bounds.x2) ) {
+                return (const PIX *) img->getPixelAddress(x0, y);
+            }
+        }
+        copyRow(img, x0, y, n, buf);
+
+        return buf;
+    }
+
+    static void copyRow(const OFX::Image* img,
+                        int x0,
+                        int y,
+                        int n,
+                        PIX *dst)
+    {
+        if (!img) {
+            std::fill( dst, dst + n * nComponents, PIX() );
+
+            return;
+        }
+        const OfxRectI & bounds = img->getBounds();
+        if ( (y < bounds.y1) || (bounds.y2 <= y) ) {
+            std::fill( dst, dst + n * nComponents, PIX() );
+
+            return;
+        }
+        const int x1 = (std::min)( (std::max)(x0, bounds.x1), x0 + n );
+        const int x2 = (std::max)( (std::min)(x0 + n, bounds.x2), x1 );
+        std::fill( dst, dst + (x1 - x0) * nComponents, PIX() );
+        if (x1 < x2) {
+            const PIX *src = (const PIX *) img->getPixelAddress(x1, y);
+            std::copy( src, src + (x2 - x1) * nComponents, dst + (x1 - x0) * nComponents );
+        }
+        std::fill( dst + (x2 - x0) * nComponents, dst + n * nComponents, PIX() );
+    }
+
+    // the reference (mergePixel) implementation is used, so that the result does not depend on the tile size
+    static RowFunction getRowFunction(MergingFunctionEnum operation)
+    {
+#define OFXS_MERGE_ROW(f) case f: return &RowMerger<f, float, nComponents, 1, false>::process
+        switch (operation) {
+        OFXS_MERGE_ROW(eMergeATop);
+        OFXS_MERGE_ROW(eMergeAverage);
+        OFXS_MERGE_ROW(eMergeColor);
+        OFXS_MERGE_ROW(eMergeColorBurn);
+        OFXS_MERGE_ROW(eMergeColorDodge);
+        OFXS_MERGE_ROW(eMergeConjointOver);
+        OFXS_MERGE_ROW(eMergeCopy);
+        OFXS_MERGE_ROW(eMergeDifference);
+        OFXS_MERGE_ROW(eMergeDisjointOver);
+        OFXS_MERGE_ROW(eMergeDivide);
+        OFXS_MERGE_ROW(eMergeExclusion);
+        OFXS_MERGE_ROW(eMergeFreeze);
+        OFXS_MERGE_ROW(eMergeFrom);
+        OFXS_MERGE_ROW(eMergeGeometric);
+        OFXS_MERGE_ROW(eMergeGrainExtract);
+        OFXS_MERGE_ROW(eMergeGrainMerge);
+        OFXS_MERGE_ROW(eMergeHardLight);
+        OFXS_MERGE_ROW(eMergeHue);
+        OFXS_MERGE_ROW(eMergeHypot);
+        OFXS_MERGE_ROW(eMergeIn);
+        OFXS_MERGE_ROW(eMergeLuminosity);
+        OFXS_MERGE_ROW(eMergeMask);
+        OFXS_MERGE_ROW(eMergeMatte);
+        OFXS_MERGE_ROW(eMergeMax);
+        OFXS_MERGE_ROW(eMergeMin);
+        OFXS_MERGE_ROW(eMergeMinus);
+        OFXS_MERGE_ROW(eMergeMultiply);
+        OFXS_MERGE_ROW(eMergeOut);
+        OFXS_MERGE_ROW(eMergeOver);
+        OFXS_MERGE_ROW(eMergeOverlay);
+        OFXS_MERGE_ROW(eMergePinLight);
+        OFXS_MERGE_ROW(eMergePlus);
+        OFXS_MERGE_ROW(eMergeReflect);
+        OFXS_MERGE_ROW(eMergeSaturation);
+        OFXS_MERGE_ROW(eMergeScreen);
+        OFXS_MERGE_ROW(eMergeSoftLight);
+        OFXS_MERGE_ROW(eMergeStencil);
+        OFXS_MERGE_ROW(eMergeUnder);
+        OFXS_MERGE_ROW(eMergeXOR);
+        }
+#undef OFXS_MERGE_ROW
+        assert(false);
+
+        return &RowMerger<eMergeCopy, float, nComponents, 1, false>::process;
+    }
+};
+
+template <class PIX, int nComponents, int maxValue>
+void
+mergeStackForDepthAndComponents(OFX::ImageEffect &instance,
+                                const OfxRectI & renderWindow,
+                                const OfxPointD & renderScale,
+                                const OFX::Image* bgImg,
+                                const std::vector<MergeLayer> & layers,
+                                OFX::Image* dstImg)
+{
+    MergeStackProcessor<PIX, nComponents, maxValue> processor(instance);
+
+    processor.setDstImg(dstImg);
+    processor.setBackgroundImg(bgImg);
+    processor.setLayers(layers);
+    processor.setRenderWindow(renderWindow, renderScale);
+    processor.process();
+}
+
+template <class PIX, int maxValue>
+void
+mergeStackForDepth(OFX::ImageEffect &instance,
+                   const OfxRectI & renderWindow,
+                   const OfxPointD & renderScale,
+                   const OFX::Image* bgImg,
+                   const std::vector<MergeLayer> & layers,
+                   OFX::Image* dstImg)
+{
+    switch ( dstImg->getPixelComponentCount() ) {
+    case 1:
+        mergeStackForDepthAndComponents<PIX, 1, maxValue>(instance, renderWindow, renderScale, bgImg, layers, dstImg);
+        break;
+    case 3:
+        mergeStackForDepthAndComponents<PIX, 3, maxValue>(instance, renderWindow, renderScale, bgImg, layers, dstImg);
+        break;
+    case 4:
+        mergeStackForDepthAndComponents<PIX, 4, maxValue>(instance, renderWindow, renderScale, bgImg, layers, dstImg);
+        break;
+    default:
+        OFX::throwSuiteStatusException(kOfxStatErrFormat);
+    }
+}
+
+/**
+ * @brief Composite the layers (bottom to top) over bgImg into dstImg, within renderWindow.
+ * All images and masks must have the same bit depth and components as dstImg.
+ **/
+inline void
+mergeStack(OFX::ImageEffect &instance,
+           const OfxRectI & renderWindow,
+           const OfxPointD & renderScale,
+           const OFX::Image* bgImg,
+           const std::vector<MergeLayer> & layers,
+           OFX::Image* dstImg)
+{
+    assert(dstImg);
+    switch ( dstImg->getPixelDepth() ) {
+    case OFX::eBitDepthUByte:
+        mergeStackForDepth<unsigned char, 255>(instance, renderWindow, renderScale, bgImg, layers, dstImg);
+        break;
+    case OFX::eBitDepthUShort:
+        mergeStackForDepth<unsigned short, 65535>(instance, renderWindow, renderScale, bgImg, layers, dstImg);
+        break;
+    case OFX::eBitDepthHalf:
+        mergeStackForDepth<OFX::half, 1>(instance, renderWindow, renderScale, bgImg, layers, dstImg);
+        break;
+    case OFX::eBitDepthFloat:
+        mergeStackForDepth<float, 1>(instance, renderWindow, renderScale, bgImg, layers, dstImg);
+        break;
+    default:
+        OFX::throwSuiteStatusException(kOfxStatErrFormat);
+    }
+}
+} // namespace MergeImages2D
+} // namespace OFX
+
+#endif // openfx_supportext_ofxsMergeStack_h
@@ -34,6 +34,14 @@
 #include <algorithm>
 #include <set>
 
+#include "ofxsMultiThread.h"
+#include "ofxsProfiling.h"
+#ifndef OFX_USE_MULTITHREAD_MUTEX
+// some OFX hosts do not have mutex handling in the MT-Suite (e.g. Sony Catalyst Edit)
+// prefer using the fast mutex by Marcus Geelnard http://tinythreadpp.bitsnbites.eu/
+#include "fast_mutex.h"
+#endif
+
 using namespace OFX;
 
 using std::vector;
@@ -41,6 +49,14 @@ using std::string;
 using std::map;
 using std::set;
 
+#ifdef OFX_USE_MULTITHREAD_MUTEX
+typedef OFX::MultiThread::Mutex Mutex;
+typedef OFX::MultiThread::AutoMutex AutoMutex;
+#else
+typedef tthread::fast_mutex Mutex;
+typedef OFX::MultiThread::AutoMutexT<tthread::fast_mutex> AutoMutex;
+#endif
+
 static bool gHostSupportsMultiPlaneV1 = false;
 static bool gHostSupportsMultiPlaneV2 = false;
 static bool gHostSupportsDynamicChoices = false;
@@ -57,32 +73,131 @@ namespace OFX {
 namespace MultiPlane {
 
 
+/**
+ * @brief An entry of the global plane descriptors table.
+ **/
+struct ImagePlaneDescData
+{
+    // Index in the table
+    int handle;
+
+    // Planes with the same planeID have the same planeIDHandle
+    int planeIDHandle;
+
+    std::string planeID, planeLabel;
+    std::vector<std::string> channels;
+    std::string channelsLabel;
+    bool isColorPlane;
+
+    // Precomputed options, see getPlaneOption() and getChannelOption()
+    std::string planeOptionLabel;
+    std::vector<std::string> channelOptionIDs, channelOptionLabels;
+};
+
+namespace {
+// The table is only accessed with g_planesMutex locked.
+// Entries are never removed, so that ImagePlaneDesc can keep a pointer to them.
+struct ImagePlaneDescTable
+{
+    std::map<std::string, const ImagePlaneDescData*> descs; // keyed by all the fields
+    std::map<std::string, int> planeIDs;
+};
+
+Mutex g_planesMutex;
+
+ImagePlaneDescTable&
+getPlanesTable()
+{
+    static ImagePlaneDescTable table;
+
+    return table;
+}
+} // anonymous namespace
+
+void
+ImagePlaneDesc::intern(const std::string& planeID,
+                       const std::string& planeLabel,
+                       const std::string& channelsLabel,
+                       const std::vector<std::string>& channels)
+{
+    // Build the key from all fields. '\0' cannot appear in any of them.
+    std::string key = planeID;
+    key += '\0';
+    key += planeLabel;
+    key += '\0';
+    key += channelsLabel;
+    for (std::size_t i = 0; i < channels.size(); ++i) {
+        key += '\0';
+        key += channels[i];
+    }
+
+    AutoMutex locker(&g_planesMutex);
+    ImagePlaneDescTable& table = getPlanesTable();
+    std::map<std::string, const ImagePlaneDescData*>::const_iterator found = table.descs.find(key);
+    if ( found != table.descs.end() ) {
+        _data = found->second;
+
+        return;
+    }
+
+    ImagePlaneDescData* data = new ImagePlaneDescData;
+    data->handle = (int)table.descs.size();
+    std::map<std::string, int>::const_iterator foundID = table.planeIDs.find(planeID);
+    if ( foundID != table.planeIDs.end() ) {
+        data->planeIDHandle = foundID->second;
+    } else {
+        data->planeIDHandle = (int)table.planeIDs.size();
+        table.planeIDs[planeID] = data->planeIDHandle;
+    }
+    data->planeID = planeID;
+    data->planeLabel = planeLabel;
+    data->channels = channels;
+    data->channelsLabel = channelsLabel;
+    data->isColorPlane = ImagePlaneDesc::isColorPlane(planeID);
+    data->planeOptionLabel = planeLabel + "." + channelsLabel;
+    data->channelOptionIDs.resize( channels.size() );
+    data->channelOptionLabels.resize( channels.size() );
+    for (std::size_t i = 0; i < channels.size(); ++i) {
+        std::string& optionID = data->channelOptionIDs[i];
+        std::string& optionLabel = data->channelOptionLabels[i];
+        optionLabel = planeLabel;
+        optionID = planeID;
+        if ( !optionLabel.empty() ) {
+            optionLabel += '.';
+        }
+        if ( !optionID.empty() ) {
+            optionID += '.';
+        }
+        optionLabel += channels[i];
+        optionID += channels[i];
+    }
+    table.descs[key] = data;
+    _data = data;
+} // intern
+
 ImagePlaneDesc::ImagePlaneDesc()
-: _planeID("none")
-, _planeLabel("none")
-, _channels()
-, _channelsLabel("none")
+: _data(NULL)
 {
+    intern("none", "none", "none", std::vector<std::string>());
 }
 
 ImagePlaneDesc::ImagePlaneDesc(const std::string& planeID,
                                const std::string& planeLabel,
                                const std::string& channelsLabel,
                                const std::vector<std::string>& channels)
-: _planeID(planeID)
-, _planeLabel(planeLabel)
-, _channels(channels)
-, _channelsLabel(channelsLabel)
+: _data(NULL)
 {
-    if (planeLabel.empty()) {
-        // Plane label is the ID if empty
-        _planeLabel = _planeID;
-    }
+    // Plane label is the ID if empty
+    const std::string& label = planeLabel.empty() ? planeID : planeLabel;
     if ( channelsLabel.empty() ) {
         // Channels label is the concatenation of all channels
+        std::string concatenated;
         for (std::size_t i = 0; i < channels.size(); ++i) {
-            _channelsLabel.append(channels[i]);
+            concatenated.append(channels[i]);
         }
+        intern(planeID, label, concatenated, channels);
+    } else {
+        intern(planeID, label, channelsLabel, channels);
     }
 }
 
@@ -91,40 +206,33 @@ ImagePlaneDesc::ImagePlaneDesc(const std::string& planeName,
                                const std::string& channelsLabel,
                                const char** channels,
                                int count)
-: _planeID(planeName)
-, _planeLabel(planeLabel)
-, _channels()
-, _channelsLabel(channelsLabel)
+: _data(NULL)
 {
-    _channels.resize(count);
+    std::vector<std::string> channelsVec(count);
     for (int i = 0; i < count; ++i) {
-        _channels[i] = channels[i];
-    }
-
-    if (planeLabel.empty()) {
-        // Plane label is the ID if empty
-        _planeLabel = _planeID;
+        channelsVec[i] = channels[i];
     }
+    const std::string& label = planeLabel.empty() ? planeName : planeLabel;
     if ( channelsLabel.empty() ) {
-        // Channels label is the concatenation of all channels
-        for (std::size_t i = 0; i < _channels.size(); ++i) {
-            _channelsLabel.append(channels[i]);
+        std::string concatenated;
+        for (int i = 0; i < count; ++i) {
+            concatenated.append(channels[i]);
         }
+        intern(planeName, label, concatenated, channelsVec);
+    } else {
+        intern(planeName, label, channelsLabel, channelsVec);
     }
 }
 
 ImagePlaneDesc::ImagePlaneDesc(const ImagePlaneDesc& other)
+: _data(other._data)
 {
-    *this = other;
 }
 
 ImagePlaneDesc&
 ImagePlaneDesc::operator=(const ImagePlaneDesc& other)
 {
-    _planeID = other._planeID;
-    _planeLabel = other._planeLabel;
-    _channels = other._channels;
-    _channelsLabel = other._channelsLabel;
+    _data = other._data;
     return *this;
 }
 
@@ -141,7 +249,7 @@ ImagePlaneDesc::isColorPlane(const std::string& planeID)
 bool
 ImagePlaneDesc::isColorPlane() const
 {
-    return ImagePlaneDesc::isColorPlane(_planeID);
+    return _data->isColorPlane;
 }
 
 
@@ -149,46 +257,58 @@ ImagePlaneDesc::isColorPlane() const
 bool
 ImagePlaneDesc::operator==(const ImagePlaneDesc& other) const
 {
-    if ( _channels.size() != other._channels.size() ) {
+    if (_data == other._data) {
+        return true;
+    }
+    if ( _data->channels.size() != other._data->channels.size() ) {
         return false;
     }
-    return _planeID == other._planeID;
+    return _data->planeIDHandle == other._data->planeIDHandle;
 }
 
 bool
 ImagePlaneDesc::operator<(const ImagePlaneDesc& other) const
 {
-    return _planeID < other._planeID;
+    if (_data->planeIDHandle == other._data->planeIDHandle) {
+        return false;
+    }
+    return _data->planeID < other._data->planeID;
+}
+
+int
+ImagePlaneDesc::getHandle() const
+{
+    return _data->handle;
 }
 
 int
 ImagePlaneDesc::getNumComponents() const
 {
-    return (int)_channels.size();
+    return (int)_data->channels.size();
 }
 
 const std::string&
 ImagePlaneDesc::getPlaneID() const
 {
-    return _planeID;
+    return _data->planeID;
 }
 
 const std::string&
 ImagePlaneDesc::getPlaneLabel() const
 {
-    return _planeLabel;
+    return _data->planeLabel;
 }
 
 const std::string&
 ImagePlaneDesc::getChannelsLabel() const
 {
-    return _channelsLabel;
+    return _data->channelsLabel;
 }
 
 const std::vector<std::string>&
 ImagePlaneDesc::getChannels() const
 {
-    return _channels;
+    return _data->channels;
 }
 
 const ImagePlaneDesc&
@@ -267,23 +387,13 @@ ImagePlaneDesc::getDisparityRightComponents()
 void
 ImagePlaneDesc::getChannelOption(int channelIndex, std::string* optionID, std::string* optionLabel) const
 {
-    if (channelIndex < 0 || channelIndex >= (int)_channels.size()) {
+    if (channelIndex < 0 || channelIndex >= (int)_data->channels.size()) {
         assert(false);
         return;
     }
 
-    *optionLabel += _planeLabel;
-    *optionID += _planeID;
-    if ( !optionLabel->empty() ) {
-        *optionLabel += '.';
-    }
-    if (!optionID->empty()) {
-        *optionID += '.';
-    }
-
-    // For the option label, append the name of the channel
-    *optionLabel += _channels[channelIndex];
-    *optionID += _channels[channelIndex];
+    *optionLabel += _data->channelOptionLabels[channelIndex];
+    *optionID += _data->channelOptionIDs[channelIndex];
 }
 
 void
@@ -291,8 +401,8 @@ ImagePlaneDesc::getPlaneOption(std::string* optionID, std::string* optionLabel)
 {
     // The option ID is always the name of the layer, this ensures for the Color plane that even if the components type changes, the choice stays
     // the same in the parameter.
-    *optionLabel = _planeLabel + "." + _channelsLabel;
-    *optionID = _planeID;
+    *optionLabel = _data->planeOptionLabel;
+    *optionID = _data->planeID;
 }
 
 const ImagePlaneDesc&
@@ -461,8 +571,38 @@ struct ChoiceOption
 {
     string name, label, hint;
 
+    // What the option resolves to, so that getPlaneNeeded does not have to parse the option string.
+    // retCode is eGetPlaneNeededRetCodeFailed if the option was not resolved.
+    MultiPlane::MultiPlaneEffect::GetPlaneNeededRetCodeEnum retCode;
+
+    // Index of the clip in ChoiceParamClips::clips, or -1
+    int clipIndex;
+
+    MultiPlane::ImagePlaneDesc plane;
+    int channelIndex;
+
+    // True for the hard-coded color channels, which may not be present in the clip
+    bool isBuiltInColorChannel;
 };
 
+ChoiceOption
+makeChoiceOption(const string& name,
+                 const string& label,
+                 const string& hint,
+                 MultiPlane::MultiPlaneEffect::GetPlaneNeededRetCodeEnum retCode)
+{
+    ChoiceOption ret;
+    ret.name = name;
+    ret.label = label;
+    ret.hint = hint;
+    ret.retCode = retCode;
+    ret.clipIndex = -1;
+    ret.channelIndex = -1;
+    ret.isBuiltInColorChannel = false;
+
+    return ret;
+}
+
 struct ChoiceOption_Compare
 {
     bool operator() (const ChoiceOption& lhs, const ChoiceOption& rhs) const
@@ -491,7 +631,11 @@ getHardCodedPlaneOptions(const vector<string>& clips,
             const std::vector<std::string>& planeChannels = planesToAdd[p]->getChannels();
 
             for (std::size_t i = 0; i < planeChannels.size(); ++i) {
-                ChoiceOption option;
+                ChoiceOption option = makeChoiceOption(string(), string(), string(), MultiPlane::MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedChannelInPlane);
+                option.clipIndex = (int)c;
+                option.plane = *planesToAdd[p];
+                option.channelIndex = (int)i;
+                option.isBuiltInColorChannel = planesToAdd[p]->isColorPlane();
 
                 // Prefix the clip name if there are multiple clip channels to read from
                 if (clips.size() > 1) {
@@ -526,7 +670,7 @@ getHardCodedPlaneOptions(const vector<string>& clips,
                 opt.append(kMultiPlaneChannelParamOption0);
                 hint.append(kMultiPlaneChannelParamOption0Hint);
 
-                ChoiceOption choice = {opt, opt, hint};
+                ChoiceOption choice = makeChoiceOption(opt, opt, hint, MultiPlane::MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedConstant0);
                 options->push_back(choice);
             }
             {
@@ -534,7 +678,7 @@ getHardCodedPlaneOptions(const vector<string>& clips,
                 opt.append(kMultiPlaneChannelParamOption1);
                 hint.append(kMultiPlaneChannelParamOption1Hint);
 
-                ChoiceOption choice = {opt, opt, hint};
+                ChoiceOption choice = makeChoiceOption(opt, opt, hint, MultiPlane::MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedConstant1);
                 options->push_back(choice);
             }
         }
@@ -613,6 +757,11 @@ struct ChoiceParamClips
     vector<Clip*> clips;
     vector<string> clipNames;
 
+    // The options last set on the param by buildChannelMenus, valid if optionsSet is true.
+    // Used to avoid resetting the menu when its options did not change.
+    vector<ChoiceOption> options;
+    bool optionsSet;
+
     ChoiceParamClips()
     : param(NULL)
     , splitPlanesIntoChannels(false)
@@ -622,11 +771,50 @@ struct ChoiceParamClips
     , hideIfClipDisconnected(false)
     , clips()
     , clipNames()
+    , options()
+    , optionsSet(false)
+    {
+    }
+};
 
+/**
+ * @brief The planes list returned by the host for a clip, used as the key of the per-clip planes cache.
+ **/
+struct ClipPlanesKey
+{
+    // The strings returned by getPlanesPresent (plus extraneous planes for the output clip)
+    vector<string> planeStrings;
+
+    // The number of components of the color plane
+    int colorComps;
+
+    ClipPlanesKey()
+    : planeStrings()
+    , colorComps(0)
+    {
+    }
+
+    bool operator==(const ClipPlanesKey& other) const
     {
+        return colorComps == other.colorComps && planeStrings == other.planeStrings;
     }
 };
 
+static bool
+choiceOptionsEqual(const vector<ChoiceOption>& a, const vector<ChoiceOption>& b)
+{
+    if ( a.size() != b.size() ) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        if ( (a[i].name != b[i].name) || (a[i].label != b[i].label) || (a[i].hint != b[i].hint) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 
 
 struct MultiPlaneEffectPrivate
@@ -645,17 +833,38 @@ struct MultiPlaneEffectPrivate
     // Stores for each clip its available planes
     // This is to avoid a recursion when calling getPlanesPresent
     // on the output clip.
+    // The entries are kept across calls to buildChannelMenus and only remapped when
+    // the host's plane list for the clip changes (see perClipPlanesKey).
     std::map<Clip*, std::list<ImagePlaneDesc> > perClipPlanesAvailable;
 
+    // For each clip in perClipPlanesAvailable, the host plane list it was built from
+    std::map<Clip*, ClipPlanesKey> perClipPlanesKey;
+
+    // Planes already mapped from their OpenFX string, so that a layer is only parsed once
+    std::map<string, ImagePlaneDesc> mappedPlanes;
+
     MultiPlaneEffectPrivate(MultiPlaneEffect* publicInterface)
     : _publicInterface(publicInterface)
     , params()
     , allPlanesCheckbox(NULL)
     , dstClip(publicInterface->fetchClip(kOfxImageEffectOutputClipName))
     , perClipPlanesAvailable()
+    , perClipPlanesKey()
+    , mappedPlanes()
     {
     }
 
+    /**
+     * @brief Map a plane string returned by getPlanesPresent to an ImagePlaneDesc, using the mappedPlanes cache.
+     **/
+    const ImagePlaneDesc& mapPlaneString(const string& ofxPlane);
+
+    /**
+     * @brief Fetch the planes present on clip and update perClipPlanesAvailable[clipToMap] if they changed.
+     * @returns true if the planes available for clipToMap changed since the last call.
+     **/
+    bool refreshClipPlanes(Clip* clip, Clip* clipToMap, bool isOutput);
+
     /**
      * @brief The instanceChanged handler for the "All Planes" checkbox if the parameter was defined with
      **/
@@ -719,11 +928,65 @@ MultiPlaneEffect::fetchDynamicMultiplaneChoiceParameter(const string& paramName,
 
 
 
+const ImagePlaneDesc&
+MultiPlaneEffectPrivate::mapPlaneString(const string& ofxPlane)
+{
+    map<string, ImagePlaneDesc>::iterator found = mappedPlanes.find(ofxPlane);
+    if ( found != mappedPlanes.end() ) {
+        return found->second;
+    }
+
+    return mappedPlanes[ofxPlane] = ImagePlaneDesc::mapOFXPlaneStringToPlane(ofxPlane);
+}
+
+bool
+MultiPlaneEffectPrivate::refreshClipPlanes(Clip* clip,
+                                           Clip* clipToMap,
+                                           bool isOutput)
+{
+    // Fetch planes presents from the clip and map them to ImagePlaneDesc
+    // Note that the clip cannot bethe output clip: the host may call recursively the getClipComponents() action during the call to getPlanesPresent()
+    // to find out the components present in output of this effect.
+    //
+    // Instead the plug-in should read planes from the pass-through clip (the same that is set in the implementation of getClipComponents)
+    // to populate the output menu.
+    ClipPlanesKey key;
+    clip->getPlanesPresent(&key.planeStrings);
+
+    // If this is the output menu, add user created planes from a user interface
+    if (isOutput) {
+        vector<string> extraPlanes;
+        _publicInterface->getExtraneousPlanesCreated(&extraPlanes);
+        key.planeStrings.insert(key.planeStrings.end(), extraPlanes.begin(), extraPlanes.end());
+    }
+    if ( std::find(key.planeStrings.begin(), key.planeStrings.end(), string(kOfxMultiplaneColorPlaneID)) != key.planeStrings.end() ) {
+        key.colorComps = clip->getPixelComponentCount();
+    }
+
+    map<Clip*, ClipPlanesKey>::iterator foundKey = perClipPlanesKey.find(clipToMap);
+    if ( ( foundKey != perClipPlanesKey.end() ) && (foundKey->second == key) &&
+         ( perClipPlanesAvailable.find(clipToMap) != perClipPlanesAvailable.end() ) ) {
+        // Same plane list as last time: the mapped planes are still valid
+        return false;
+    }
+
+    std::list<ImagePlaneDesc>& availableClipPlanes = perClipPlanesAvailable[clipToMap];
+    availableClipPlanes.clear();
+    for (std::size_t i = 0; i < key.planeStrings.size(); ++i) {
+        if (key.planeStrings[i] == kOfxMultiplaneColorPlaneID) {
+            availableClipPlanes.push_back( ImagePlaneDesc::mapNCompsToColorPlane(key.colorComps) );
+        } else {
+            availableClipPlanes.push_back( mapPlaneString(key.planeStrings[i]) );
+        }
+    }
+    perClipPlanesKey[clipToMap] = key;
+
+    return true;
+} // refreshClipPlanes
+
 void
 MultiPlaneEffectPrivate::buildChannelMenus()
 {
-    perClipPlanesAvailable.clear();
-
     // If no dynamic choices support, only add built-in planes.
     if (!gHostSupportsDynamicChoices) {
         vector<const MultiPlane::ImagePlaneDesc*> planesToAdd;
@@ -737,6 +1000,7 @@ MultiPlaneEffectPrivate::buildChannelMenus()
                 Clip* clip = it->second.isOutput ? dstClip : it->second.clips[c];
                 map<Clip*,  std::list<ImagePlaneDesc> >::iterator foundClip = perClipPlanesAvailable.find(clip);
                 if (foundClip != perClipPlanesAvailable.end()) {
+                    // The hard-coded planes never change
                     continue;
                 } else {
                     std::list<ImagePlaneDesc>& clipPlanes = perClipPlanesAvailable[clip];
@@ -751,81 +1015,61 @@ MultiPlaneEffectPrivate::buildChannelMenus()
     
     // This code requires dynamic choice parameters support.
 
+    // Clips whose planes were fetched during this call, and those among them whose planes changed.
+    // This speeds it up in the case where we have multiple choice parameters accessing the same clip.
+    set<Clip*> refreshedClips, changedClips;
 
     // For each parameter to refresh
-    std::vector<std::pair<ChoiceParam*,std::vector<ChoiceOption> > > perParamOptions;
+    std::vector<std::pair<ChoiceParamClips*,std::vector<ChoiceOption> > > perParamOptions;
     for (map<string, ChoiceParamClips>::iterator it = params.begin(); it != params.end(); ++it) {
 
-        vector<ChoiceOption> options;
-        set<ChoiceOption, ChoiceOption_Compare> optionsSorted;
-
-        if (it->second.splitPlanesIntoChannels) {
-            // Add built-in hard-coded options A.R, A.G, ... 0, 1, B.R, B.G ...
-            getHardCodedPlaneOptions(it->second.clipNames, it->second.addConstantOptions, true /*onlyColorPlane*/, &options);
-            optionsSorted.insert(options.begin(), options.end());
-        } else {
-            // For plane selectors, we might want a "None" option to select an input plane.
-            if (it->second.addNoneOption) {
-                ChoiceOption opt = {kMultiPlanePlaneParamOptionNone, kMultiPlanePlaneParamOptionNoneLabel, ""};
-                options.push_back(opt);
-                optionsSorted.insert(opt);
-            }
-        }
-
         // We don't use a map here to keep the clips in the order of what the user passed them in fetchDynamicMultiplaneChoiceParameter
         std::list<std::pair<Clip*, std::list<ImagePlaneDesc>* > > perClipPlanes;
+        bool clipPlanesChanged = false;
         for (std::size_t c = 0; c < it->second.clips.size(); ++c) {
 
             Clip* clip = it->second.clips[c];
 
-            // Did we fetch the clip available planes already ? This speeds it up in the case where we have multiple choice parameters
-            // accessing the same clip.
-            std::list<ImagePlaneDesc>* availableClipPlanes = 0;
-
             // For the output plane selector, map the clip planes against the output clip even though the user provided a
             // source clip as pass-through clip so the extraneous planes returned by getExtraneousPlanesCreated are not added for
             // the available planes on the source clip
             Clip* clipToMap = it->second.isOutput ? dstClip : clip;
 
-            map<Clip*,  std::list<ImagePlaneDesc> >::iterator foundClip = perClipPlanesAvailable.find(clipToMap);
-            if (foundClip != perClipPlanesAvailable.end()) {
-                availableClipPlanes = &foundClip->second;
-            } else {
-
-                availableClipPlanes = &(perClipPlanesAvailable)[clipToMap];
-
-                // Fetch planes presents from the clip and map them to ImagePlaneDesc
-                // Note that the clip cannot bethe output clip: the host may call recursively the getClipComponents() action during the call to getPlanesPresent()
-                // to find out the components present in output of this effect.
-                //
-                // Instead the plug-in should read planes from the pass-through clip (the same that is set in the implementation of getClipComponents)
-                // to populate the output menu.
-                vector<string> clipPlaneStrings;
-                clip->getPlanesPresent(&clipPlaneStrings);
-
-                // If this is the output menu, add user created planes from a user interface
-                if (it->second.isOutput) {
-                    vector<string> extraPlanes;
-                    _publicInterface->getExtraneousPlanesCreated(&extraPlanes);
-                    clipPlaneStrings.insert(clipPlaneStrings.end(), extraPlanes.begin(), extraPlanes.end());
+            if ( refreshedClips.insert(clipToMap).second ) {
+                if ( refreshClipPlanes(clip, clipToMap, it->second.isOutput) ) {
+                    changedClips.insert(clipToMap);
                 }
-
-                for (std::size_t i = 0; i < clipPlaneStrings.size(); ++i) {
-                    ImagePlaneDesc plane;
-                    if (clipPlaneStrings[i] == kOfxMultiplaneColorPlaneID) {
-                        plane = ImagePlaneDesc::mapNCompsToColorPlane(clip->getPixelComponentCount());
-                    } else {
-                        plane = ImagePlaneDesc::mapOFXPlaneStringToPlane(clipPlaneStrings[i]);
-                    }
-                    availableClipPlanes->push_back(plane);
-                }
-
+            }
+            if ( changedClips.find(clipToMap) != changedClips.end() ) {
+                clipPlanesChanged = true;
             }
 
-            perClipPlanes.push_back(std::make_pair(clip, availableClipPlanes));
+            perClipPlanes.push_back( std::make_pair(clip, &perClipPlanesAvailable[clipToMap]) );
         } // for each clip
 
-        for (std::list<std::pair<Clip*, std::list<ImagePlaneDesc>* > >::const_iterator it2 = perClipPlanes.begin(); it2 != perClipPlanes.end(); ++it2) {
+        if (it->second.optionsSet && !clipPlanesChanged) {
+            // None of the planes this menu depends on changed: keep the menu as is
+            continue;
+        }
+
+        vector<ChoiceOption> options;
+        set<ChoiceOption, ChoiceOption_Compare> optionsSorted;
+
+        if (it->second.splitPlanesIntoChannels) {
+            // Add built-in hard-coded options A.R, A.G, ... 0, 1, B.R, B.G ...
+            getHardCodedPlaneOptions(it->second.clipNames, it->second.addConstantOptions, true /*onlyColorPlane*/, &options);
+            optionsSorted.insert(options.begin(), options.end());
+        } else {
+            // For plane selectors, we might want a "None" option to select an input plane.
+            if (it->second.addNoneOption) {
+                ChoiceOption opt = makeChoiceOption(kMultiPlanePlaneParamOptionNone, kMultiPlanePlaneParamOptionNoneLabel, "", MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedPlane);
+                options.push_back(opt);
+                optionsSorted.insert(opt);
+            }
+        }
+
+        int clipIndex = 0;
+        for (std::list<std::pair<Clip*, std::list<ImagePlaneDesc>* > >::const_iterator it2 = perClipPlanes.begin(); it2 != perClipPlanes.end(); ++it2, ++clipIndex) {
 
             const std::list<ImagePlaneDesc>* planes = it2->second;
 
@@ -835,7 +1079,10 @@ MultiPlaneEffectPrivate::buildChannelMenus()
                     int nChannels = it3->getNumComponents();
                     for (int k = 0; k < nChannels; ++k) {
 
-                        ChoiceOption opt;
+                        ChoiceOption opt = makeChoiceOption(string(), string(), string(), MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedChannelInPlane);
+                        opt.clipIndex = clipIndex;
+                        opt.plane = *it3;
+                        opt.channelIndex = k;
                         it3->getChannelOption(k, &opt.name, &opt.label);
 
                         // Prefix the clip name if there are multiple clip channels to read from
@@ -852,7 +1099,9 @@ MultiPlaneEffectPrivate::buildChannelMenus()
                     }
                 } else {
                     // User wants planes in options
-                    ChoiceOption opt;
+                    ChoiceOption opt = makeChoiceOption(string(), string(), string(), MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedPlane);
+                    opt.clipIndex = clipIndex;
+                    opt.plane = *it3;
                     it3->getPlaneOption(&opt.name, &opt.label);
 
                     // Prefix the clip name if there are multiple clip channels to read from
@@ -869,8 +1118,13 @@ MultiPlaneEffectPrivate::buildChannelMenus()
 
         } // for each clip planes available
 
-        // Set the new choice menu
-        perParamOptions.push_back(std::make_pair(it->second.param,options));
+        // Set the new choice menu, unless the options are the same as the ones already set
+        if ( !it->second.optionsSet || !choiceOptionsEqual(options, it->second.options) ) {
+            perParamOptions.push_back( std::make_pair(&it->second, options) );
+        } else {
+            // Same menu, but the planes the options resolve to may have changed
+            it->second.options = options;
+        }
 
 
     } // for all choice parameters
@@ -878,14 +1132,16 @@ MultiPlaneEffectPrivate::buildChannelMenus()
 
     // Reset all choice options in the same pass, once the perClipPlanesAvailable is full, because the resetOptions call may recursively call
     // getClipComponents and thus getPlaneNeeded which relies on it.
-    for (std::vector<std::pair<ChoiceParam*,std::vector<ChoiceOption> > >::const_iterator it = perParamOptions.begin(); it != perParamOptions.end(); ++it) {
+    for (std::vector<std::pair<ChoiceParamClips*,std::vector<ChoiceOption> > >::const_iterator it = perParamOptions.begin(); it != perParamOptions.end(); ++it) {
         vector<string> labels(it->second.size()), hints(it->second.size()), enums(it->second.size());
         for (std::size_t i = 0; i < it->second.size(); ++i) {
             labels[i] = it->second[i].label;
             hints[i] = it->second[i].hint;
             enums[i] = it->second[i].name;
         }
-        it->first->resetOptions(labels, hints, enums);
+        it->first->options = it->second;
+        it->first->optionsSet = true;
+        it->first->param->resetOptions(labels, hints, enums);
     }
 } // buildChannelMenus
 
@@ -924,6 +1180,60 @@ MultiPlaneEffect::onAllParametersFetched()
     _imp->refreshSelectorsVisibility();
 }
 
+void
+MultiPlaneImages::clear()
+{
+    for (std::size_t i = 0; i < _planes.size(); ++i) {
+        delete _planes[i].srcImg;
+        delete _planes[i].dstImg;
+    }
+    _planes.clear();
+}
+
+void
+MultiPlaneImages::addPlane(const ImagePlaneDesc& plane,
+                           const Image* srcImg,
+                           Image* dstImg)
+{
+    PlaneImages images;
+    images.plane = plane;
+    images.srcImg = srcImg;
+    images.dstImg = dstImg;
+    _planes.push_back(images);
+}
+
+void
+MultiPlaneEffect::fetchPlanesToRender(const RenderArguments& args,
+                                      Clip* srcClip,
+                                      MultiPlaneImages* images)
+{
+    images->clear();
+    bool srcConnected = srcClip && srcClip->isConnected();
+    for (std::list<std::string>::const_iterator it = args.planes.begin(); it != args.planes.end(); ++it) {
+        ImagePlaneDesc plane;
+        if (*it == kOfxMultiplaneColorPlaneID) {
+            plane = ImagePlaneDesc::mapNCompsToColorPlane( _imp->dstClip->getPixelComponentCount() );
+        } else {
+            plane = _imp->mapPlaneString(*it);
+        }
+        auto_ptr<Image> dst( _imp->dstClip->fetchImagePlane( args.time, args.renderView, it->c_str() ) );
+        if ( !dst.get() ) {
+            throwSuiteStatusException(kOfxStatFailed);
+
+            return;
+        }
+        auto_ptr<const Image> src( srcConnected ? srcClip->fetchImagePlane( args.time, args.renderView, it->c_str() ) : 0 );
+        if ( src.get() && ( src->getPixelDepth() != dst->getPixelDepth() ) ) {
+            throwSuiteStatusException(kOfxStatErrImageFormat);
+
+            return;
+        }
+        images->addPlane( plane, src.get(), dst.get() );
+        src.release();
+        dst.release();
+    }
+}
+
 void
 MultiPlaneEffect::refreshPlaneChoiceMenus()
 {
@@ -951,6 +1261,8 @@ MultiPlaneEffect::changedClip(const InstanceChangedArgs & /*args*/, const std::s
 void
 MultiPlaneEffect::getClipPreferences(ClipPreferencesSetter &clipPreferences)
 {
+    OFX_PROFILE_SCOPE(timer, "action", "MultiPlaneEffect::getClipPreferences");
+
     // Refresh the channel menus on Natron < 3 or if it has never been refreshed, otherwise this is done in clipChanged in Natron >= 3
     if (!gHostIsNatron3OrGreater) {
         _imp->buildChannelMenus();
@@ -986,6 +1298,8 @@ MultiPlaneEffect::getClipPreferences(ClipPreferencesSetter &clipPreferences)
 OfxStatus
 MultiPlaneEffect::getClipComponents(const ClipComponentsArguments& args, ClipComponentsSetter& clipComponents)
 {
+    OFX_PROFILE_SCOPE(timer, "action", "MultiPlaneEffect::getClipComponents");
+
 
     assert(gHostSupportsMultiPlaneV2 || gHostSupportsMultiPlaneV1);
 
@@ -1023,6 +1337,57 @@ MultiPlaneEffect::getClipComponents(const ClipComponentsArguments& args, ClipCom
     return kOfxStatOK;
 } // getClipComponents
 
+/**
+ * @brief Returns what the option resolves to, as precomputed by buildChannelMenus.
+ **/
+static MultiPlaneEffect::GetPlaneNeededRetCodeEnum
+resolveChoiceOption(const ChoiceOption& option,
+                    const ChoiceParamClips& param,
+                    OFX::Clip* dstClip,
+                    OFX::Clip** clip,
+                    ImagePlaneDesc* plane,
+                    int* channelIndexInPlane)
+{
+    switch (option.retCode) {
+    case MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedConstant0:
+    case MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedConstant1:
+        return option.retCode;
+    case MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedPlane:
+    case MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedChannelInPlane:
+        break;
+    default:
+        return MultiPlaneEffect::eGetPlaneNeededRetCodeFailed;
+    }
+    *plane = option.plane;
+    if ( (option.clipIndex < 0) || ( option.clipIndex >= (int)param.clips.size() ) ) {
+        // The "None" option
+        return option.retCode;
+    }
+    *clip = param.clips[option.clipIndex];
+    *channelIndexInPlane = option.channelIndex;
+    if (option.isBuiltInColorChannel) {
+        // Same as in findBuiltInSelectedChannel: the channel may not exist actually in the available components
+        int clipComponentsCount = (*clip)->getPixelComponentCount();
+        if (clipComponentsCount == 1 && *channelIndexInPlane == 3) {
+            *channelIndexInPlane = 0;
+        }
+        if (*channelIndexInPlane >= clipComponentsCount) {
+            *plane = ImagePlaneDesc();
+            int chanIndex = *channelIndexInPlane;
+            *channelIndexInPlane = -1;
+
+            return chanIndex == 3 ? MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedConstant1 : MultiPlaneEffect::eGetPlaneNeededRetCodeReturnedConstant0;
+        }
+
+        return option.retCode;
+    }
+    if (param.isOutput) {
+        *clip = dstClip;
+    }
+
+    return option.retCode;
+} // resolveChoiceOption
+
 static bool findBuiltInSelectedChannel(const std::string& selectedOptionID,
                                        bool compareWithID,
                                        const ChoiceParamClips& param,
@@ -1177,6 +1542,26 @@ MultiPlaneEffect::getPlaneNeeded(const std::string& paramName,
         int choice_i;
         found->second.param->getValue(choice_i);
 
+        // If the menu was built by buildChannelMenus, the option was resolved when it was built:
+        // no need to parse the option string.
+        const vector<ChoiceOption>& options = found->second.options;
+        if ( found->second.optionsSet && (0 <= choice_i) && ( choice_i < (int)options.size() ) &&
+             ( options[choice_i].retCode != eGetPlaneNeededRetCodeFailed ) &&
+             ( found->second.param->getNOptions() == (int)options.size() ) ) {
+            GetPlaneNeededRetCodeEnum retCode = resolveChoiceOption(options[choice_i], found->second, _imp->dstClip, &retClip, &retPlane, &retChannelIndexInPlane);
+            if (clip) {
+                *clip = retClip;
+            }
+            if (plane) {
+                *plane = retPlane;
+            }
+            if (channelIndexInPlane) {
+                *channelIndexInPlane = retChannelIndexInPlane;
+            }
+
+            return retCode;
+        }
+
         if ( (0 <= choice_i) && ( choice_i < found->second.param->getNOptions() ) ) {
 #ifdef OFX_EXTENSIONS_NATRON
             found->second.param->getEnum(choice_i, selectedOptionID);
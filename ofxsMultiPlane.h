@@ -40,7 +40,9 @@
 #include <vector>
 
 #include "ofxsImageEffect.h"
+#include "ofxsProcessing.H"
 #include "ofxsMacros.h"
+#include "ofxsProfiling.h"
 #ifdef OFX_EXTENSIONS_NATRON
 #include "ofxNatron.h"
 #endif
@@ -213,7 +215,12 @@ namespace MultiPlane {
  * If empty, the channels label is set to the concatenation of all channels.
  * The channels are the unique identifier for each channel composing the plane.
  * The plane can only be composed from 1 to 4 (included) channels.
+ *
+ * Plane descriptors are interned in a global table: an ImagePlaneDesc is a handle to its
+ * immutable entry in the table, so that copies are cheap and comparisons are integer comparisons.
+ * The option IDs and labels returned by getPlaneOption() and getChannelOption() are precomputed.
     **/
+struct ImagePlaneDescData;
 class ImagePlaneDesc
 {
     public:
@@ -297,6 +304,12 @@ class ImagePlaneDesc
     void getPlaneOption(std::string* optionID, std::string* optionLabel) const;
     void getChannelOption(int channelIndex, std::string* optionID, std::string* optionLabel) const;
 
+    /**
+     * @brief Returns the handle of this plane in the global table of plane descriptors.
+     * Planes with the same handle have the same ID, labels and channels.
+     **/
+    int getHandle() const;
+
     /**
      * @brief Maps the given nComps to the color plane
      **/
@@ -388,12 +401,70 @@ class ImagePlaneDesc
 
 
 private:
-    std::string _planeID, _planeLabel;
-    std::vector<std::string> _channels;
-    std::string _channelsLabel;
+    void intern(const std::string& planeID,
+                const std::string& planeLabel,
+                const std::string& channelsLabel,
+                const std::vector<std::string>& channels);
+
+    // The interned descriptor, never deleted
+    const ImagePlaneDescData* _data;
 };
 
 
+/**
+ * @brief The images of the planes to render in a single pass, see MultiPlaneEffect::fetchPlanesToRender().
+ * The images are owned by this object and released by its destructor.
+ **/
+class MultiPlaneImages
+{
+public:
+    struct PlaneImages
+    {
+        ImagePlaneDesc plane;
+        const OFX::Image* srcImg; // may be NULL if the source clip is not connected or does not have this plane
+        OFX::Image* dstImg;
+
+        PlaneImages()
+        : plane()
+        , srcImg(NULL)
+        , dstImg(NULL)
+        {
+        }
+    };
+
+    MultiPlaneImages()
+    : _planes()
+    {
+    }
+
+    ~MultiPlaneImages()
+    {
+        clear();
+    }
+
+    /**
+     * @brief Release all images
+     **/
+    void clear();
+
+    /**
+     * @brief Take ownership of the images of a plane
+     **/
+    void addPlane(const ImagePlaneDesc& plane, const OFX::Image* srcImg, OFX::Image* dstImg);
+
+    const std::vector<PlaneImages>& getPlanes() const
+    {
+        return _planes;
+    }
+
+private:
+    // non-copyable
+    MultiPlaneImages(const MultiPlaneImages&);
+    MultiPlaneImages& operator=(const MultiPlaneImages&);
+
+    std::vector<PlaneImages> _planes;
+};
+
 struct MultiPlaneEffectPrivate;
 class MultiPlaneEffect
     : public OFX::ImageEffect
@@ -499,6 +570,17 @@ public:
      **/
     virtual OfxStatus getClipComponents(const ClipComponentsArguments& args, ClipComponentsSetter& clipComponents) OVERRIDE;
 
+    /**
+     * @brief Fetch, for each plane requested by the host in the render action, the output image and the
+     * image of the same plane on srcClip (which may be NULL).
+     * This is meant to be used when getPlaneNeeded() on the output plane selector returned eGetPlaneNeededRetCodeReturnedAllPlanes:
+     * all planes can then be rendered in a single threaded pass with a MultiPlaneProcessor, instead of fetching the mask
+     * and running a processor for each plane.
+     * Throws kOfxStatFailed if an output image cannot be fetched, and kOfxStatErrImageFormat if the source and output
+     * images of a plane have a different bit depth.
+     **/
+    void fetchPlanesToRender(const OFX::RenderArguments& args, OFX::Clip* srcClip, MultiPlaneImages* images);
+
     /**
      * @brief Force a refresh of the channel selectors. This should in general not be called as this is done for you in changedClip() in Natron > 3
      * or getClipPreferences for any other host.
@@ -518,6 +600,85 @@ public:
     
 };
 
+// the number of rows processed for all planes before moving to the next band, see MultiPlaneProcessor
+#define kMultiPlaneProcessorBandHeight 16
+
+/**
+ * @brief Base class for a processor that renders several planes in one threaded pass.
+ * Each thread renders its part of the render window in bands of kMultiPlaneProcessorBandHeight rows, processing
+ * every plane of a band before moving to the next one, so that the mask rows and the per-pixel coordinates stay in cache,
+ * and threads are only spawned once for all planes.
+ * Derived classes implement processPlane(), which may dispatch on the plane images depth and components.
+ **/
+class MultiPlaneProcessor
+    : public OFX::ImageProcessor
+{
+protected:
+    std::vector<MultiPlaneImages::PlaneImages> _planes;
+    const OFX::Image* _maskImg;
+    bool _doMasking;
+    bool _maskInvert;
+    double _mix;
+
+public:
+    MultiPlaneProcessor(OFX::ImageEffect &instance)
+    : OFX::ImageProcessor(instance)
+    , _planes()
+    , _maskImg(NULL)
+    , _doMasking(false)
+    , _maskInvert(false)
+    , _mix(1.)
+    {
+    }
+
+    /** @brief set the planes to process. The images remain owned by images. */
+    void setPlanes(const MultiPlaneImages& images)
+    {
+        _planes = images.getPlanes();
+        if ( !_planes.empty() ) {
+            setDstImg(_planes[0].dstImg);
+        }
+    }
+
+    void setMaskImg(const OFX::Image *v,
+                    bool maskInvert)
+    {
+        _maskImg = v;
+        _maskInvert = maskInvert;
+    }
+
+    void doMasking(bool v)
+    {
+        _doMasking = v;
+    }
+
+    void setMix(double mix)
+    {
+        _mix = mix;
+    }
+
+private:
+    void multiThreadProcessImages(const OfxRectI& procWindow, const OfxPointD& rs) OVERRIDE FINAL
+    {
+        for (int y = procWindow.y1; y < procWindow.y2; y += kMultiPlaneProcessorBandHeight) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
+                return;
+            }
+            OfxRectI band = procWindow;
+            band.y1 = y;
+            band.y2 = (std::min)(y + kMultiPlaneProcessorBandHeight, procWindow.y2);
+            for (std::size_t p = 0; p < _planes.size(); ++p) {
+                processPlane(_planes[p], band, rs);
+            }
+        }
+    }
+
+    /**
+     * @brief Render the given plane in window, which is a band of rows of the render window.
+     **/
+    virtual void processPlane(const MultiPlaneImages::PlaneImages& plane, const OfxRectI& window, const OfxPointD& rs) = 0;
+};
+
 namespace Factory {
 
 /**
@@ -13,11 +13,1828 @@
 
 
 namespace OFX {
+#if defined(HAVE_OSMESA) && defined(OFX_OPENGL_LAZY_LOAD)
+// Lazy loading: each function pointer initially points to a trampoline, which resolves the
+// function with OSMesaGetProcAddress on its first call and replaces the pointer with it.
+// Two threads calling the same trampoline for the first time both store the same value.
+// If OSMesa does not provide the function, the trampoline is kept and the call does nothing
+// (returning 0). Since the pointers are never NULL, support must not be tested by comparing
+// them to NULL (see ofxsOGLFunctions-README.md).
+#define OFX_OSMESA_LAZY_RESOLVE(type, name) type f = (type)OSMesaGetProcAddress(#name); if (f != NULL) *g_lazySlot_##name = f
+#define OFX_OSMESA_LAZY_INIT(name) _m##name = lazy_##name; g_lazySlot_##name = &_m##name
+
+static PFNGLCULLFACEPROC* g_lazySlot_glCullFace = NULL;
+static void APIENTRY lazy_glCullFace(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCULLFACEPROC, glCullFace); if (f == NULL) { return; } return f(a0); }
+static PFNGLFRONTFACEPROC* g_lazySlot_glFrontFace = NULL;
+static void APIENTRY lazy_glFrontFace(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRONTFACEPROC, glFrontFace); if (f == NULL) { return; } return f(a0); }
+static PFNGLHINTPROC* g_lazySlot_glHint = NULL;
+static void APIENTRY lazy_glHint(GLenum a0, GLenum a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLHINTPROC, glHint); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLLINEWIDTHPROC* g_lazySlot_glLineWidth = NULL;
+static void APIENTRY lazy_glLineWidth(GLfloat a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLINEWIDTHPROC, glLineWidth); if (f == NULL) { return; } return f(a0); }
+static PFNGLPOINTSIZEPROC* g_lazySlot_glPointSize = NULL;
+static void APIENTRY lazy_glPointSize(GLfloat a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOINTSIZEPROC, glPointSize); if (f == NULL) { return; } return f(a0); }
+static PFNGLPOLYGONMODEPROC* g_lazySlot_glPolygonMode = NULL;
+static void APIENTRY lazy_glPolygonMode(GLenum a0, GLenum a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOLYGONMODEPROC, glPolygonMode); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLSCISSORPROC* g_lazySlot_glScissor = NULL;
+static void APIENTRY lazy_glScissor(GLint a0, GLint a1, GLsizei a2, GLsizei a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSCISSORPROC, glScissor); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLTEXPARAMETERFPROC* g_lazySlot_glTexParameterf = NULL;
+static void APIENTRY lazy_glTexParameterf(GLenum a0, GLenum a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXPARAMETERFPROC, glTexParameterf); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXPARAMETERFVPROC* g_lazySlot_glTexParameterfv = NULL;
+static void APIENTRY lazy_glTexParameterfv(GLenum a0, GLenum a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXPARAMETERFVPROC, glTexParameterfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXPARAMETERIPROC* g_lazySlot_glTexParameteri = NULL;
+static void APIENTRY lazy_glTexParameteri(GLenum a0, GLenum a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXPARAMETERIPROC, glTexParameteri); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXPARAMETERIVPROC* g_lazySlot_glTexParameteriv = NULL;
+static void APIENTRY lazy_glTexParameteriv(GLenum a0, GLenum a1, const GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXPARAMETERIVPROC, glTexParameteriv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXIMAGE1DPROC* g_lazySlot_glTexImage1D = NULL;
+static void APIENTRY lazy_glTexImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLint a4, GLenum a5, GLenum a6, const void* a7) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXIMAGE1DPROC, glTexImage1D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7); }
+static PFNGLTEXIMAGE2DPROC* g_lazySlot_glTexImage2D = NULL;
+static void APIENTRY lazy_glTexImage2D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLint a5, GLenum a6, GLenum a7, const void* a8) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXIMAGE2DPROC, glTexImage2D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static PFNGLDRAWBUFFERPROC* g_lazySlot_glDrawBuffer = NULL;
+static void APIENTRY lazy_glDrawBuffer(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDRAWBUFFERPROC, glDrawBuffer); if (f == NULL) { return; } return f(a0); }
+static PFNGLCLEARPROC* g_lazySlot_glClear = NULL;
+static void APIENTRY lazy_glClear(GLbitfield a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCLEARPROC, glClear); if (f == NULL) { return; } return f(a0); }
+static PFNGLCLEARCOLORPROC* g_lazySlot_glClearColor = NULL;
+static void APIENTRY lazy_glClearColor(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCLEARCOLORPROC, glClearColor); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLCLEARSTENCILPROC* g_lazySlot_glClearStencil = NULL;
+static void APIENTRY lazy_glClearStencil(GLint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCLEARSTENCILPROC, glClearStencil); if (f == NULL) { return; } return f(a0); }
+static PFNGLCLEARDEPTHPROC* g_lazySlot_glClearDepth = NULL;
+static void APIENTRY lazy_glClearDepth(GLdouble a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCLEARDEPTHPROC, glClearDepth); if (f == NULL) { return; } return f(a0); }
+static PFNGLSTENCILMASKPROC* g_lazySlot_glStencilMask = NULL;
+static void APIENTRY lazy_glStencilMask(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSTENCILMASKPROC, glStencilMask); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLORMASKPROC* g_lazySlot_glColorMask = NULL;
+static void APIENTRY lazy_glColorMask(GLboolean a0, GLboolean a1, GLboolean a2, GLboolean a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLORMASKPROC, glColorMask); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLDEPTHMASKPROC* g_lazySlot_glDepthMask = NULL;
+static void APIENTRY lazy_glDepthMask(GLboolean a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDEPTHMASKPROC, glDepthMask); if (f == NULL) { return; } return f(a0); }
+static PFNGLDISABLEPROC* g_lazySlot_glDisable = NULL;
+static void APIENTRY lazy_glDisable(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDISABLEPROC, glDisable); if (f == NULL) { return; } return f(a0); }
+static PFNGLENABLEPROC* g_lazySlot_glEnable = NULL;
+static void APIENTRY lazy_glEnable(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLENABLEPROC, glEnable); if (f == NULL) { return; } return f(a0); }
+static PFNGLFINISHPROC* g_lazySlot_glFinish = NULL;
+static void APIENTRY lazy_glFinish() { OFX_OSMESA_LAZY_RESOLVE(PFNGLFINISHPROC, glFinish); if (f == NULL) { return; } return f(); }
+static PFNGLFLUSHPROC* g_lazySlot_glFlush = NULL;
+static void APIENTRY lazy_glFlush() { OFX_OSMESA_LAZY_RESOLVE(PFNGLFLUSHPROC, glFlush); if (f == NULL) { return; } return f(); }
+static PFNGLBLENDFUNCPROC* g_lazySlot_glBlendFunc = NULL;
+static void APIENTRY lazy_glBlendFunc(GLenum a0, GLenum a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBLENDFUNCPROC, glBlendFunc); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLLOGICOPPROC* g_lazySlot_glLogicOp = NULL;
+static void APIENTRY lazy_glLogicOp(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLOGICOPPROC, glLogicOp); if (f == NULL) { return; } return f(a0); }
+static PFNGLSTENCILFUNCPROC* g_lazySlot_glStencilFunc = NULL;
+static void APIENTRY lazy_glStencilFunc(GLenum a0, GLint a1, GLuint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSTENCILFUNCPROC, glStencilFunc); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSTENCILOPPROC* g_lazySlot_glStencilOp = NULL;
+static void APIENTRY lazy_glStencilOp(GLenum a0, GLenum a1, GLenum a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSTENCILOPPROC, glStencilOp); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLDEPTHFUNCPROC* g_lazySlot_glDepthFunc = NULL;
+static void APIENTRY lazy_glDepthFunc(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDEPTHFUNCPROC, glDepthFunc); if (f == NULL) { return; } return f(a0); }
+static PFNGLPIXELSTOREFPROC* g_lazySlot_glPixelStoref = NULL;
+static void APIENTRY lazy_glPixelStoref(GLenum a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPIXELSTOREFPROC, glPixelStoref); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLPIXELSTOREIPROC* g_lazySlot_glPixelStorei = NULL;
+static void APIENTRY lazy_glPixelStorei(GLenum a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPIXELSTOREIPROC, glPixelStorei); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLREADBUFFERPROC* g_lazySlot_glReadBuffer = NULL;
+static void APIENTRY lazy_glReadBuffer(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLREADBUFFERPROC, glReadBuffer); if (f == NULL) { return; } return f(a0); }
+static PFNGLREADPIXELSPROC* g_lazySlot_glReadPixels = NULL;
+static void APIENTRY lazy_glReadPixels(GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4, GLenum a5, void* a6) { OFX_OSMESA_LAZY_RESOLVE(PFNGLREADPIXELSPROC, glReadPixels); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLGETBOOLEANVPROC* g_lazySlot_glGetBooleanv = NULL;
+static void APIENTRY lazy_glGetBooleanv(GLenum a0, GLboolean* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETBOOLEANVPROC, glGetBooleanv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGETDOUBLEVPROC* g_lazySlot_glGetDoublev = NULL;
+static void APIENTRY lazy_glGetDoublev(GLenum a0, GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETDOUBLEVPROC, glGetDoublev); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGETERRORPROC* g_lazySlot_glGetError = NULL;
+static GLenum APIENTRY lazy_glGetError() { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETERRORPROC, glGetError); if (f == NULL) { return (GLenum)0; } return f(); }
+static PFNGLGETFLOATVPROC* g_lazySlot_glGetFloatv = NULL;
+static void APIENTRY lazy_glGetFloatv(GLenum a0, GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETFLOATVPROC, glGetFloatv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGETINTEGERVPROC* g_lazySlot_glGetIntegerv = NULL;
+static void APIENTRY lazy_glGetIntegerv(GLenum a0, GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETINTEGERVPROC, glGetIntegerv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGETSTRINGPROC* g_lazySlot_glGetString = NULL;
+static const GLubyte* APIENTRY lazy_glGetString(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETSTRINGPROC, glGetString); if (f == NULL) { return (const GLubyte*)0; } return f(a0); }
+static PFNGLGETTEXIMAGEPROC* g_lazySlot_glGetTexImage = NULL;
+static void APIENTRY lazy_glGetTexImage(GLenum a0, GLint a1, GLenum a2, GLenum a3, void* a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETTEXIMAGEPROC, glGetTexImage); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLGETTEXPARAMETERFVPROC* g_lazySlot_glGetTexParameterfv = NULL;
+static void APIENTRY lazy_glGetTexParameterfv(GLenum a0, GLenum a1, GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETTEXPARAMETERFVPROC, glGetTexParameterfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETTEXPARAMETERIVPROC* g_lazySlot_glGetTexParameteriv = NULL;
+static void APIENTRY lazy_glGetTexParameteriv(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETTEXPARAMETERIVPROC, glGetTexParameteriv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETTEXLEVELPARAMETERFVPROC* g_lazySlot_glGetTexLevelParameterfv = NULL;
+static void APIENTRY lazy_glGetTexLevelParameterfv(GLenum a0, GLint a1, GLenum a2, GLfloat* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETTEXLEVELPARAMETERFVPROC, glGetTexLevelParameterfv); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETTEXLEVELPARAMETERIVPROC* g_lazySlot_glGetTexLevelParameteriv = NULL;
+static void APIENTRY lazy_glGetTexLevelParameteriv(GLenum a0, GLint a1, GLenum a2, GLint* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETTEXLEVELPARAMETERIVPROC, glGetTexLevelParameteriv); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLISENABLEDPROC* g_lazySlot_glIsEnabled = NULL;
+static GLboolean APIENTRY lazy_glIsEnabled(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISENABLEDPROC, glIsEnabled); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLDEPTHRANGEPROC* g_lazySlot_glDepthRange = NULL;
+static void APIENTRY lazy_glDepthRange(GLdouble a0, GLdouble a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDEPTHRANGEPROC, glDepthRange); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVIEWPORTPROC* g_lazySlot_glViewport = NULL;
+static void APIENTRY lazy_glViewport(GLint a0, GLint a1, GLsizei a2, GLsizei a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVIEWPORTPROC, glViewport); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLNEWLISTPROC* g_lazySlot_glNewList = NULL;
+static void APIENTRY lazy_glNewList(GLuint a0, GLenum a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNEWLISTPROC, glNewList); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLENDLISTPROC* g_lazySlot_glEndList = NULL;
+static void APIENTRY lazy_glEndList() { OFX_OSMESA_LAZY_RESOLVE(PFNGLENDLISTPROC, glEndList); if (f == NULL) { return; } return f(); }
+static PFNGLCALLLISTPROC* g_lazySlot_glCallList = NULL;
+static void APIENTRY lazy_glCallList(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCALLLISTPROC, glCallList); if (f == NULL) { return; } return f(a0); }
+static PFNGLCALLLISTSPROC* g_lazySlot_glCallLists = NULL;
+static void APIENTRY lazy_glCallLists(GLsizei a0, GLenum a1, const void* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCALLLISTSPROC, glCallLists); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLDELETELISTSPROC* g_lazySlot_glDeleteLists = NULL;
+static void APIENTRY lazy_glDeleteLists(GLuint a0, GLsizei a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETELISTSPROC, glDeleteLists); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGENLISTSPROC* g_lazySlot_glGenLists = NULL;
+static GLuint APIENTRY lazy_glGenLists(GLsizei a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENLISTSPROC, glGenLists); if (f == NULL) { return (GLuint)0; } return f(a0); }
+static PFNGLLISTBASEPROC* g_lazySlot_glListBase = NULL;
+static void APIENTRY lazy_glListBase(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLISTBASEPROC, glListBase); if (f == NULL) { return; } return f(a0); }
+static PFNGLBEGINPROC* g_lazySlot_glBegin = NULL;
+static void APIENTRY lazy_glBegin(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBEGINPROC, glBegin); if (f == NULL) { return; } return f(a0); }
+static PFNGLBITMAPPROC* g_lazySlot_glBitmap = NULL;
+static void APIENTRY lazy_glBitmap(GLsizei a0, GLsizei a1, GLfloat a2, GLfloat a3, GLfloat a4, GLfloat a5, const GLubyte* a6) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBITMAPPROC, glBitmap); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLCOLOR3BPROC* g_lazySlot_glColor3b = NULL;
+static void APIENTRY lazy_glColor3b(GLbyte a0, GLbyte a1, GLbyte a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3BPROC, glColor3b); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCOLOR3BVPROC* g_lazySlot_glColor3bv = NULL;
+static void APIENTRY lazy_glColor3bv(const GLbyte* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3BVPROC, glColor3bv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR3DPROC* g_lazySlot_glColor3d = NULL;
+static void APIENTRY lazy_glColor3d(GLdouble a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3DPROC, glColor3d); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCOLOR3DVPROC* g_lazySlot_glColor3dv = NULL;
+static void APIENTRY lazy_glColor3dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3DVPROC, glColor3dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR3FPROC* g_lazySlot_glColor3f = NULL;
+static void APIENTRY lazy_glColor3f(GLfloat a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3FPROC, glColor3f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCOLOR3FVPROC* g_lazySlot_glColor3fv = NULL;
+static void APIENTRY lazy_glColor3fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3FVPROC, glColor3fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR3IPROC* g_lazySlot_glColor3i = NULL;
+static void APIENTRY lazy_glColor3i(GLint a0, GLint a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3IPROC, glColor3i); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCOLOR3IVPROC* g_lazySlot_glColor3iv = NULL;
+static void APIENTRY lazy_glColor3iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3IVPROC, glColor3iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR3SPROC* g_lazySlot_glColor3s = NULL;
+static void APIENTRY lazy_glColor3s(GLshort a0, GLshort a1, GLshort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3SPROC, glColor3s); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCOLOR3SVPROC* g_lazySlot_glColor3sv = NULL;
+static void APIENTRY lazy_glColor3sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3SVPROC, glColor3sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR3UBPROC* g_lazySlot_glColor3ub = NULL;
+static void APIENTRY lazy_glColor3ub(GLubyte a0, GLubyte a1, GLubyte a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3UBPROC, glColor3ub); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCOLOR3UBVPROC* g_lazySlot_glColor3ubv = NULL;
+static void APIENTRY lazy_glColor3ubv(const GLubyte* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3UBVPROC, glColor3ubv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR3UIPROC* g_lazySlot_glColor3ui = NULL;
+static void APIENTRY lazy_glColor3ui(GLuint a0, GLuint a1, GLuint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3UIPROC, glColor3ui); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCOLOR3UIVPROC* g_lazySlot_glColor3uiv = NULL;
+static void APIENTRY lazy_glColor3uiv(const GLuint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3UIVPROC, glColor3uiv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR3USPROC* g_lazySlot_glColor3us = NULL;
+static void APIENTRY lazy_glColor3us(GLushort a0, GLushort a1, GLushort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3USPROC, glColor3us); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCOLOR3USVPROC* g_lazySlot_glColor3usv = NULL;
+static void APIENTRY lazy_glColor3usv(const GLushort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR3USVPROC, glColor3usv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR4BPROC* g_lazySlot_glColor4b = NULL;
+static void APIENTRY lazy_glColor4b(GLbyte a0, GLbyte a1, GLbyte a2, GLbyte a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4BPROC, glColor4b); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLCOLOR4BVPROC* g_lazySlot_glColor4bv = NULL;
+static void APIENTRY lazy_glColor4bv(const GLbyte* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4BVPROC, glColor4bv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR4DPROC* g_lazySlot_glColor4d = NULL;
+static void APIENTRY lazy_glColor4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4DPROC, glColor4d); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLCOLOR4DVPROC* g_lazySlot_glColor4dv = NULL;
+static void APIENTRY lazy_glColor4dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4DVPROC, glColor4dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR4FPROC* g_lazySlot_glColor4f = NULL;
+static void APIENTRY lazy_glColor4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4FPROC, glColor4f); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLCOLOR4FVPROC* g_lazySlot_glColor4fv = NULL;
+static void APIENTRY lazy_glColor4fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4FVPROC, glColor4fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR4IPROC* g_lazySlot_glColor4i = NULL;
+static void APIENTRY lazy_glColor4i(GLint a0, GLint a1, GLint a2, GLint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4IPROC, glColor4i); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLCOLOR4IVPROC* g_lazySlot_glColor4iv = NULL;
+static void APIENTRY lazy_glColor4iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4IVPROC, glColor4iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR4SPROC* g_lazySlot_glColor4s = NULL;
+static void APIENTRY lazy_glColor4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4SPROC, glColor4s); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLCOLOR4SVPROC* g_lazySlot_glColor4sv = NULL;
+static void APIENTRY lazy_glColor4sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4SVPROC, glColor4sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR4UBPROC* g_lazySlot_glColor4ub = NULL;
+static void APIENTRY lazy_glColor4ub(GLubyte a0, GLubyte a1, GLubyte a2, GLubyte a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4UBPROC, glColor4ub); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLCOLOR4UBVPROC* g_lazySlot_glColor4ubv = NULL;
+static void APIENTRY lazy_glColor4ubv(const GLubyte* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4UBVPROC, glColor4ubv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR4UIPROC* g_lazySlot_glColor4ui = NULL;
+static void APIENTRY lazy_glColor4ui(GLuint a0, GLuint a1, GLuint a2, GLuint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4UIPROC, glColor4ui); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLCOLOR4UIVPROC* g_lazySlot_glColor4uiv = NULL;
+static void APIENTRY lazy_glColor4uiv(const GLuint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4UIVPROC, glColor4uiv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLOR4USPROC* g_lazySlot_glColor4us = NULL;
+static void APIENTRY lazy_glColor4us(GLushort a0, GLushort a1, GLushort a2, GLushort a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4USPROC, glColor4us); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLCOLOR4USVPROC* g_lazySlot_glColor4usv = NULL;
+static void APIENTRY lazy_glColor4usv(const GLushort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLOR4USVPROC, glColor4usv); if (f == NULL) { return; } return f(a0); }
+static PFNGLEDGEFLAGPROC* g_lazySlot_glEdgeFlag = NULL;
+static void APIENTRY lazy_glEdgeFlag(GLboolean a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEDGEFLAGPROC, glEdgeFlag); if (f == NULL) { return; } return f(a0); }
+static PFNGLEDGEFLAGVPROC* g_lazySlot_glEdgeFlagv = NULL;
+static void APIENTRY lazy_glEdgeFlagv(const GLboolean* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEDGEFLAGVPROC, glEdgeFlagv); if (f == NULL) { return; } return f(a0); }
+static PFNGLENDPROC* g_lazySlot_glEnd = NULL;
+static void APIENTRY lazy_glEnd() { OFX_OSMESA_LAZY_RESOLVE(PFNGLENDPROC, glEnd); if (f == NULL) { return; } return f(); }
+static PFNGLINDEXDPROC* g_lazySlot_glIndexd = NULL;
+static void APIENTRY lazy_glIndexd(GLdouble a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXDPROC, glIndexd); if (f == NULL) { return; } return f(a0); }
+static PFNGLINDEXDVPROC* g_lazySlot_glIndexdv = NULL;
+static void APIENTRY lazy_glIndexdv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXDVPROC, glIndexdv); if (f == NULL) { return; } return f(a0); }
+static PFNGLINDEXFPROC* g_lazySlot_glIndexf = NULL;
+static void APIENTRY lazy_glIndexf(GLfloat a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXFPROC, glIndexf); if (f == NULL) { return; } return f(a0); }
+static PFNGLINDEXFVPROC* g_lazySlot_glIndexfv = NULL;
+static void APIENTRY lazy_glIndexfv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXFVPROC, glIndexfv); if (f == NULL) { return; } return f(a0); }
+static PFNGLINDEXIPROC* g_lazySlot_glIndexi = NULL;
+static void APIENTRY lazy_glIndexi(GLint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXIPROC, glIndexi); if (f == NULL) { return; } return f(a0); }
+static PFNGLINDEXIVPROC* g_lazySlot_glIndexiv = NULL;
+static void APIENTRY lazy_glIndexiv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXIVPROC, glIndexiv); if (f == NULL) { return; } return f(a0); }
+static PFNGLINDEXSPROC* g_lazySlot_glIndexs = NULL;
+static void APIENTRY lazy_glIndexs(GLshort a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXSPROC, glIndexs); if (f == NULL) { return; } return f(a0); }
+static PFNGLINDEXSVPROC* g_lazySlot_glIndexsv = NULL;
+static void APIENTRY lazy_glIndexsv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXSVPROC, glIndexsv); if (f == NULL) { return; } return f(a0); }
+static PFNGLNORMAL3BPROC* g_lazySlot_glNormal3b = NULL;
+static void APIENTRY lazy_glNormal3b(GLbyte a0, GLbyte a1, GLbyte a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMAL3BPROC, glNormal3b); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLNORMAL3BVPROC* g_lazySlot_glNormal3bv = NULL;
+static void APIENTRY lazy_glNormal3bv(const GLbyte* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMAL3BVPROC, glNormal3bv); if (f == NULL) { return; } return f(a0); }
+static PFNGLNORMAL3DPROC* g_lazySlot_glNormal3d = NULL;
+static void APIENTRY lazy_glNormal3d(GLdouble a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMAL3DPROC, glNormal3d); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLNORMAL3DVPROC* g_lazySlot_glNormal3dv = NULL;
+static void APIENTRY lazy_glNormal3dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMAL3DVPROC, glNormal3dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLNORMAL3FPROC* g_lazySlot_glNormal3f = NULL;
+static void APIENTRY lazy_glNormal3f(GLfloat a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMAL3FPROC, glNormal3f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLNORMAL3FVPROC* g_lazySlot_glNormal3fv = NULL;
+static void APIENTRY lazy_glNormal3fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMAL3FVPROC, glNormal3fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLNORMAL3IPROC* g_lazySlot_glNormal3i = NULL;
+static void APIENTRY lazy_glNormal3i(GLint a0, GLint a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMAL3IPROC, glNormal3i); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLNORMAL3IVPROC* g_lazySlot_glNormal3iv = NULL;
+static void APIENTRY lazy_glNormal3iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMAL3IVPROC, glNormal3iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLNORMAL3SPROC* g_lazySlot_glNormal3s = NULL;
+static void APIENTRY lazy_glNormal3s(GLshort a0, GLshort a1, GLshort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMAL3SPROC, glNormal3s); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLNORMAL3SVPROC* g_lazySlot_glNormal3sv = NULL;
+static void APIENTRY lazy_glNormal3sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMAL3SVPROC, glNormal3sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS2DPROC* g_lazySlot_glRasterPos2d = NULL;
+static void APIENTRY lazy_glRasterPos2d(GLdouble a0, GLdouble a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS2DPROC, glRasterPos2d); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLRASTERPOS2DVPROC* g_lazySlot_glRasterPos2dv = NULL;
+static void APIENTRY lazy_glRasterPos2dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS2DVPROC, glRasterPos2dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS2FPROC* g_lazySlot_glRasterPos2f = NULL;
+static void APIENTRY lazy_glRasterPos2f(GLfloat a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS2FPROC, glRasterPos2f); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLRASTERPOS2FVPROC* g_lazySlot_glRasterPos2fv = NULL;
+static void APIENTRY lazy_glRasterPos2fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS2FVPROC, glRasterPos2fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS2IPROC* g_lazySlot_glRasterPos2i = NULL;
+static void APIENTRY lazy_glRasterPos2i(GLint a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS2IPROC, glRasterPos2i); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLRASTERPOS2IVPROC* g_lazySlot_glRasterPos2iv = NULL;
+static void APIENTRY lazy_glRasterPos2iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS2IVPROC, glRasterPos2iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS2SPROC* g_lazySlot_glRasterPos2s = NULL;
+static void APIENTRY lazy_glRasterPos2s(GLshort a0, GLshort a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS2SPROC, glRasterPos2s); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLRASTERPOS2SVPROC* g_lazySlot_glRasterPos2sv = NULL;
+static void APIENTRY lazy_glRasterPos2sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS2SVPROC, glRasterPos2sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS3DPROC* g_lazySlot_glRasterPos3d = NULL;
+static void APIENTRY lazy_glRasterPos3d(GLdouble a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS3DPROC, glRasterPos3d); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLRASTERPOS3DVPROC* g_lazySlot_glRasterPos3dv = NULL;
+static void APIENTRY lazy_glRasterPos3dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS3DVPROC, glRasterPos3dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS3FPROC* g_lazySlot_glRasterPos3f = NULL;
+static void APIENTRY lazy_glRasterPos3f(GLfloat a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS3FPROC, glRasterPos3f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLRASTERPOS3FVPROC* g_lazySlot_glRasterPos3fv = NULL;
+static void APIENTRY lazy_glRasterPos3fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS3FVPROC, glRasterPos3fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS3IPROC* g_lazySlot_glRasterPos3i = NULL;
+static void APIENTRY lazy_glRasterPos3i(GLint a0, GLint a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS3IPROC, glRasterPos3i); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLRASTERPOS3IVPROC* g_lazySlot_glRasterPos3iv = NULL;
+static void APIENTRY lazy_glRasterPos3iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS3IVPROC, glRasterPos3iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS3SPROC* g_lazySlot_glRasterPos3s = NULL;
+static void APIENTRY lazy_glRasterPos3s(GLshort a0, GLshort a1, GLshort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS3SPROC, glRasterPos3s); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLRASTERPOS3SVPROC* g_lazySlot_glRasterPos3sv = NULL;
+static void APIENTRY lazy_glRasterPos3sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS3SVPROC, glRasterPos3sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS4DPROC* g_lazySlot_glRasterPos4d = NULL;
+static void APIENTRY lazy_glRasterPos4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS4DPROC, glRasterPos4d); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLRASTERPOS4DVPROC* g_lazySlot_glRasterPos4dv = NULL;
+static void APIENTRY lazy_glRasterPos4dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS4DVPROC, glRasterPos4dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS4FPROC* g_lazySlot_glRasterPos4f = NULL;
+static void APIENTRY lazy_glRasterPos4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS4FPROC, glRasterPos4f); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLRASTERPOS4FVPROC* g_lazySlot_glRasterPos4fv = NULL;
+static void APIENTRY lazy_glRasterPos4fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS4FVPROC, glRasterPos4fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS4IPROC* g_lazySlot_glRasterPos4i = NULL;
+static void APIENTRY lazy_glRasterPos4i(GLint a0, GLint a1, GLint a2, GLint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS4IPROC, glRasterPos4i); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLRASTERPOS4IVPROC* g_lazySlot_glRasterPos4iv = NULL;
+static void APIENTRY lazy_glRasterPos4iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS4IVPROC, glRasterPos4iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRASTERPOS4SPROC* g_lazySlot_glRasterPos4s = NULL;
+static void APIENTRY lazy_glRasterPos4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS4SPROC, glRasterPos4s); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLRASTERPOS4SVPROC* g_lazySlot_glRasterPos4sv = NULL;
+static void APIENTRY lazy_glRasterPos4sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRASTERPOS4SVPROC, glRasterPos4sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLRECTDPROC* g_lazySlot_glRectd = NULL;
+static void APIENTRY lazy_glRectd(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRECTDPROC, glRectd); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLRECTDVPROC* g_lazySlot_glRectdv = NULL;
+static void APIENTRY lazy_glRectdv(const GLdouble* a0, const GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRECTDVPROC, glRectdv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLRECTFPROC* g_lazySlot_glRectf = NULL;
+static void APIENTRY lazy_glRectf(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRECTFPROC, glRectf); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLRECTFVPROC* g_lazySlot_glRectfv = NULL;
+static void APIENTRY lazy_glRectfv(const GLfloat* a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRECTFVPROC, glRectfv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLRECTIPROC* g_lazySlot_glRecti = NULL;
+static void APIENTRY lazy_glRecti(GLint a0, GLint a1, GLint a2, GLint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRECTIPROC, glRecti); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLRECTIVPROC* g_lazySlot_glRectiv = NULL;
+static void APIENTRY lazy_glRectiv(const GLint* a0, const GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRECTIVPROC, glRectiv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLRECTSPROC* g_lazySlot_glRects = NULL;
+static void APIENTRY lazy_glRects(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRECTSPROC, glRects); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLRECTSVPROC* g_lazySlot_glRectsv = NULL;
+static void APIENTRY lazy_glRectsv(const GLshort* a0, const GLshort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRECTSVPROC, glRectsv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLTEXCOORD1DPROC* g_lazySlot_glTexCoord1d = NULL;
+static void APIENTRY lazy_glTexCoord1d(GLdouble a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD1DPROC, glTexCoord1d); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD1DVPROC* g_lazySlot_glTexCoord1dv = NULL;
+static void APIENTRY lazy_glTexCoord1dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD1DVPROC, glTexCoord1dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD1FPROC* g_lazySlot_glTexCoord1f = NULL;
+static void APIENTRY lazy_glTexCoord1f(GLfloat a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD1FPROC, glTexCoord1f); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD1FVPROC* g_lazySlot_glTexCoord1fv = NULL;
+static void APIENTRY lazy_glTexCoord1fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD1FVPROC, glTexCoord1fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD1IPROC* g_lazySlot_glTexCoord1i = NULL;
+static void APIENTRY lazy_glTexCoord1i(GLint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD1IPROC, glTexCoord1i); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD1IVPROC* g_lazySlot_glTexCoord1iv = NULL;
+static void APIENTRY lazy_glTexCoord1iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD1IVPROC, glTexCoord1iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD1SPROC* g_lazySlot_glTexCoord1s = NULL;
+static void APIENTRY lazy_glTexCoord1s(GLshort a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD1SPROC, glTexCoord1s); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD1SVPROC* g_lazySlot_glTexCoord1sv = NULL;
+static void APIENTRY lazy_glTexCoord1sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD1SVPROC, glTexCoord1sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD2DPROC* g_lazySlot_glTexCoord2d = NULL;
+static void APIENTRY lazy_glTexCoord2d(GLdouble a0, GLdouble a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD2DPROC, glTexCoord2d); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLTEXCOORD2DVPROC* g_lazySlot_glTexCoord2dv = NULL;
+static void APIENTRY lazy_glTexCoord2dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD2DVPROC, glTexCoord2dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD2FPROC* g_lazySlot_glTexCoord2f = NULL;
+static void APIENTRY lazy_glTexCoord2f(GLfloat a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD2FPROC, glTexCoord2f); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLTEXCOORD2FVPROC* g_lazySlot_glTexCoord2fv = NULL;
+static void APIENTRY lazy_glTexCoord2fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD2FVPROC, glTexCoord2fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD2IPROC* g_lazySlot_glTexCoord2i = NULL;
+static void APIENTRY lazy_glTexCoord2i(GLint a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD2IPROC, glTexCoord2i); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLTEXCOORD2IVPROC* g_lazySlot_glTexCoord2iv = NULL;
+static void APIENTRY lazy_glTexCoord2iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD2IVPROC, glTexCoord2iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD2SPROC* g_lazySlot_glTexCoord2s = NULL;
+static void APIENTRY lazy_glTexCoord2s(GLshort a0, GLshort a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD2SPROC, glTexCoord2s); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLTEXCOORD2SVPROC* g_lazySlot_glTexCoord2sv = NULL;
+static void APIENTRY lazy_glTexCoord2sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD2SVPROC, glTexCoord2sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD3DPROC* g_lazySlot_glTexCoord3d = NULL;
+static void APIENTRY lazy_glTexCoord3d(GLdouble a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD3DPROC, glTexCoord3d); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXCOORD3DVPROC* g_lazySlot_glTexCoord3dv = NULL;
+static void APIENTRY lazy_glTexCoord3dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD3DVPROC, glTexCoord3dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD3FPROC* g_lazySlot_glTexCoord3f = NULL;
+static void APIENTRY lazy_glTexCoord3f(GLfloat a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD3FPROC, glTexCoord3f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXCOORD3FVPROC* g_lazySlot_glTexCoord3fv = NULL;
+static void APIENTRY lazy_glTexCoord3fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD3FVPROC, glTexCoord3fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD3IPROC* g_lazySlot_glTexCoord3i = NULL;
+static void APIENTRY lazy_glTexCoord3i(GLint a0, GLint a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD3IPROC, glTexCoord3i); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXCOORD3IVPROC* g_lazySlot_glTexCoord3iv = NULL;
+static void APIENTRY lazy_glTexCoord3iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD3IVPROC, glTexCoord3iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD3SPROC* g_lazySlot_glTexCoord3s = NULL;
+static void APIENTRY lazy_glTexCoord3s(GLshort a0, GLshort a1, GLshort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD3SPROC, glTexCoord3s); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXCOORD3SVPROC* g_lazySlot_glTexCoord3sv = NULL;
+static void APIENTRY lazy_glTexCoord3sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD3SVPROC, glTexCoord3sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD4DPROC* g_lazySlot_glTexCoord4d = NULL;
+static void APIENTRY lazy_glTexCoord4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD4DPROC, glTexCoord4d); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLTEXCOORD4DVPROC* g_lazySlot_glTexCoord4dv = NULL;
+static void APIENTRY lazy_glTexCoord4dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD4DVPROC, glTexCoord4dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD4FPROC* g_lazySlot_glTexCoord4f = NULL;
+static void APIENTRY lazy_glTexCoord4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD4FPROC, glTexCoord4f); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLTEXCOORD4FVPROC* g_lazySlot_glTexCoord4fv = NULL;
+static void APIENTRY lazy_glTexCoord4fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD4FVPROC, glTexCoord4fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD4IPROC* g_lazySlot_glTexCoord4i = NULL;
+static void APIENTRY lazy_glTexCoord4i(GLint a0, GLint a1, GLint a2, GLint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD4IPROC, glTexCoord4i); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLTEXCOORD4IVPROC* g_lazySlot_glTexCoord4iv = NULL;
+static void APIENTRY lazy_glTexCoord4iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD4IVPROC, glTexCoord4iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXCOORD4SPROC* g_lazySlot_glTexCoord4s = NULL;
+static void APIENTRY lazy_glTexCoord4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD4SPROC, glTexCoord4s); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLTEXCOORD4SVPROC* g_lazySlot_glTexCoord4sv = NULL;
+static void APIENTRY lazy_glTexCoord4sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORD4SVPROC, glTexCoord4sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX2DPROC* g_lazySlot_glVertex2d = NULL;
+static void APIENTRY lazy_glVertex2d(GLdouble a0, GLdouble a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX2DPROC, glVertex2d); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEX2DVPROC* g_lazySlot_glVertex2dv = NULL;
+static void APIENTRY lazy_glVertex2dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX2DVPROC, glVertex2dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX2FPROC* g_lazySlot_glVertex2f = NULL;
+static void APIENTRY lazy_glVertex2f(GLfloat a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX2FPROC, glVertex2f); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEX2FVPROC* g_lazySlot_glVertex2fv = NULL;
+static void APIENTRY lazy_glVertex2fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX2FVPROC, glVertex2fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX2IPROC* g_lazySlot_glVertex2i = NULL;
+static void APIENTRY lazy_glVertex2i(GLint a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX2IPROC, glVertex2i); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEX2IVPROC* g_lazySlot_glVertex2iv = NULL;
+static void APIENTRY lazy_glVertex2iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX2IVPROC, glVertex2iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX2SPROC* g_lazySlot_glVertex2s = NULL;
+static void APIENTRY lazy_glVertex2s(GLshort a0, GLshort a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX2SPROC, glVertex2s); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEX2SVPROC* g_lazySlot_glVertex2sv = NULL;
+static void APIENTRY lazy_glVertex2sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX2SVPROC, glVertex2sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX3DPROC* g_lazySlot_glVertex3d = NULL;
+static void APIENTRY lazy_glVertex3d(GLdouble a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX3DPROC, glVertex3d); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLVERTEX3DVPROC* g_lazySlot_glVertex3dv = NULL;
+static void APIENTRY lazy_glVertex3dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX3DVPROC, glVertex3dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX3FPROC* g_lazySlot_glVertex3f = NULL;
+static void APIENTRY lazy_glVertex3f(GLfloat a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX3FPROC, glVertex3f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLVERTEX3FVPROC* g_lazySlot_glVertex3fv = NULL;
+static void APIENTRY lazy_glVertex3fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX3FVPROC, glVertex3fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX3IPROC* g_lazySlot_glVertex3i = NULL;
+static void APIENTRY lazy_glVertex3i(GLint a0, GLint a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX3IPROC, glVertex3i); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLVERTEX3IVPROC* g_lazySlot_glVertex3iv = NULL;
+static void APIENTRY lazy_glVertex3iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX3IVPROC, glVertex3iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX3SPROC* g_lazySlot_glVertex3s = NULL;
+static void APIENTRY lazy_glVertex3s(GLshort a0, GLshort a1, GLshort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX3SPROC, glVertex3s); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLVERTEX3SVPROC* g_lazySlot_glVertex3sv = NULL;
+static void APIENTRY lazy_glVertex3sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX3SVPROC, glVertex3sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX4DPROC* g_lazySlot_glVertex4d = NULL;
+static void APIENTRY lazy_glVertex4d(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX4DPROC, glVertex4d); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLVERTEX4DVPROC* g_lazySlot_glVertex4dv = NULL;
+static void APIENTRY lazy_glVertex4dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX4DVPROC, glVertex4dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX4FPROC* g_lazySlot_glVertex4f = NULL;
+static void APIENTRY lazy_glVertex4f(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX4FPROC, glVertex4f); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLVERTEX4FVPROC* g_lazySlot_glVertex4fv = NULL;
+static void APIENTRY lazy_glVertex4fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX4FVPROC, glVertex4fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX4IPROC* g_lazySlot_glVertex4i = NULL;
+static void APIENTRY lazy_glVertex4i(GLint a0, GLint a1, GLint a2, GLint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX4IPROC, glVertex4i); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLVERTEX4IVPROC* g_lazySlot_glVertex4iv = NULL;
+static void APIENTRY lazy_glVertex4iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX4IVPROC, glVertex4iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEX4SPROC* g_lazySlot_glVertex4s = NULL;
+static void APIENTRY lazy_glVertex4s(GLshort a0, GLshort a1, GLshort a2, GLshort a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX4SPROC, glVertex4s); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLVERTEX4SVPROC* g_lazySlot_glVertex4sv = NULL;
+static void APIENTRY lazy_glVertex4sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEX4SVPROC, glVertex4sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLCLIPPLANEPROC* g_lazySlot_glClipPlane = NULL;
+static void APIENTRY lazy_glClipPlane(GLenum a0, const GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCLIPPLANEPROC, glClipPlane); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLCOLORMATERIALPROC* g_lazySlot_glColorMaterial = NULL;
+static void APIENTRY lazy_glColorMaterial(GLenum a0, GLenum a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLORMATERIALPROC, glColorMaterial); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLFOGFPROC* g_lazySlot_glFogf = NULL;
+static void APIENTRY lazy_glFogf(GLenum a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFOGFPROC, glFogf); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLFOGFVPROC* g_lazySlot_glFogfv = NULL;
+static void APIENTRY lazy_glFogfv(GLenum a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFOGFVPROC, glFogfv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLFOGIPROC* g_lazySlot_glFogi = NULL;
+static void APIENTRY lazy_glFogi(GLenum a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFOGIPROC, glFogi); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLFOGIVPROC* g_lazySlot_glFogiv = NULL;
+static void APIENTRY lazy_glFogiv(GLenum a0, const GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFOGIVPROC, glFogiv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLLIGHTFPROC* g_lazySlot_glLightf = NULL;
+static void APIENTRY lazy_glLightf(GLenum a0, GLenum a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLIGHTFPROC, glLightf); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLLIGHTFVPROC* g_lazySlot_glLightfv = NULL;
+static void APIENTRY lazy_glLightfv(GLenum a0, GLenum a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLIGHTFVPROC, glLightfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLLIGHTIPROC* g_lazySlot_glLighti = NULL;
+static void APIENTRY lazy_glLighti(GLenum a0, GLenum a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLIGHTIPROC, glLighti); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLLIGHTIVPROC* g_lazySlot_glLightiv = NULL;
+static void APIENTRY lazy_glLightiv(GLenum a0, GLenum a1, const GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLIGHTIVPROC, glLightiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLLIGHTMODELFPROC* g_lazySlot_glLightModelf = NULL;
+static void APIENTRY lazy_glLightModelf(GLenum a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLIGHTMODELFPROC, glLightModelf); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLLIGHTMODELFVPROC* g_lazySlot_glLightModelfv = NULL;
+static void APIENTRY lazy_glLightModelfv(GLenum a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLIGHTMODELFVPROC, glLightModelfv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLLIGHTMODELIPROC* g_lazySlot_glLightModeli = NULL;
+static void APIENTRY lazy_glLightModeli(GLenum a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLIGHTMODELIPROC, glLightModeli); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLLIGHTMODELIVPROC* g_lazySlot_glLightModeliv = NULL;
+static void APIENTRY lazy_glLightModeliv(GLenum a0, const GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLIGHTMODELIVPROC, glLightModeliv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLLINESTIPPLEPROC* g_lazySlot_glLineStipple = NULL;
+static void APIENTRY lazy_glLineStipple(GLint a0, GLushort a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLINESTIPPLEPROC, glLineStipple); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMATERIALFPROC* g_lazySlot_glMaterialf = NULL;
+static void APIENTRY lazy_glMaterialf(GLenum a0, GLenum a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMATERIALFPROC, glMaterialf); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLMATERIALFVPROC* g_lazySlot_glMaterialfv = NULL;
+static void APIENTRY lazy_glMaterialfv(GLenum a0, GLenum a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMATERIALFVPROC, glMaterialfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLMATERIALIPROC* g_lazySlot_glMateriali = NULL;
+static void APIENTRY lazy_glMateriali(GLenum a0, GLenum a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMATERIALIPROC, glMateriali); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLMATERIALIVPROC* g_lazySlot_glMaterialiv = NULL;
+static void APIENTRY lazy_glMaterialiv(GLenum a0, GLenum a1, const GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMATERIALIVPROC, glMaterialiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLPOLYGONSTIPPLEPROC* g_lazySlot_glPolygonStipple = NULL;
+static void APIENTRY lazy_glPolygonStipple(const GLubyte* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOLYGONSTIPPLEPROC, glPolygonStipple); if (f == NULL) { return; } return f(a0); }
+static PFNGLSHADEMODELPROC* g_lazySlot_glShadeModel = NULL;
+static void APIENTRY lazy_glShadeModel(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSHADEMODELPROC, glShadeModel); if (f == NULL) { return; } return f(a0); }
+static PFNGLTEXENVFPROC* g_lazySlot_glTexEnvf = NULL;
+static void APIENTRY lazy_glTexEnvf(GLenum a0, GLenum a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXENVFPROC, glTexEnvf); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXENVFVPROC* g_lazySlot_glTexEnvfv = NULL;
+static void APIENTRY lazy_glTexEnvfv(GLenum a0, GLenum a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXENVFVPROC, glTexEnvfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXENVIPROC* g_lazySlot_glTexEnvi = NULL;
+static void APIENTRY lazy_glTexEnvi(GLenum a0, GLenum a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXENVIPROC, glTexEnvi); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXENVIVPROC* g_lazySlot_glTexEnviv = NULL;
+static void APIENTRY lazy_glTexEnviv(GLenum a0, GLenum a1, const GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXENVIVPROC, glTexEnviv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXGENDPROC* g_lazySlot_glTexGend = NULL;
+static void APIENTRY lazy_glTexGend(GLenum a0, GLenum a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXGENDPROC, glTexGend); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXGENDVPROC* g_lazySlot_glTexGendv = NULL;
+static void APIENTRY lazy_glTexGendv(GLenum a0, GLenum a1, const GLdouble* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXGENDVPROC, glTexGendv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXGENFPROC* g_lazySlot_glTexGenf = NULL;
+static void APIENTRY lazy_glTexGenf(GLenum a0, GLenum a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXGENFPROC, glTexGenf); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXGENFVPROC* g_lazySlot_glTexGenfv = NULL;
+static void APIENTRY lazy_glTexGenfv(GLenum a0, GLenum a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXGENFVPROC, glTexGenfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXGENIPROC* g_lazySlot_glTexGeni = NULL;
+static void APIENTRY lazy_glTexGeni(GLenum a0, GLenum a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXGENIPROC, glTexGeni); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXGENIVPROC* g_lazySlot_glTexGeniv = NULL;
+static void APIENTRY lazy_glTexGeniv(GLenum a0, GLenum a1, const GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXGENIVPROC, glTexGeniv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLFEEDBACKBUFFERPROC* g_lazySlot_glFeedbackBuffer = NULL;
+static void APIENTRY lazy_glFeedbackBuffer(GLsizei a0, GLenum a1, GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFEEDBACKBUFFERPROC, glFeedbackBuffer); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSELECTBUFFERPROC* g_lazySlot_glSelectBuffer = NULL;
+static void APIENTRY lazy_glSelectBuffer(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSELECTBUFFERPROC, glSelectBuffer); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLRENDERMODEPROC* g_lazySlot_glRenderMode = NULL;
+static GLint APIENTRY lazy_glRenderMode(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRENDERMODEPROC, glRenderMode); if (f == NULL) { return (GLint)0; } return f(a0); }
+static PFNGLINITNAMESPROC* g_lazySlot_glInitNames = NULL;
+static void APIENTRY lazy_glInitNames() { OFX_OSMESA_LAZY_RESOLVE(PFNGLINITNAMESPROC, glInitNames); if (f == NULL) { return; } return f(); }
+static PFNGLLOADNAMEPROC* g_lazySlot_glLoadName = NULL;
+static void APIENTRY lazy_glLoadName(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLOADNAMEPROC, glLoadName); if (f == NULL) { return; } return f(a0); }
+static PFNGLPASSTHROUGHPROC* g_lazySlot_glPassThrough = NULL;
+static void APIENTRY lazy_glPassThrough(GLfloat a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPASSTHROUGHPROC, glPassThrough); if (f == NULL) { return; } return f(a0); }
+static PFNGLPOPNAMEPROC* g_lazySlot_glPopName = NULL;
+static void APIENTRY lazy_glPopName() { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOPNAMEPROC, glPopName); if (f == NULL) { return; } return f(); }
+static PFNGLPUSHNAMEPROC* g_lazySlot_glPushName = NULL;
+static void APIENTRY lazy_glPushName(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPUSHNAMEPROC, glPushName); if (f == NULL) { return; } return f(a0); }
+static PFNGLCLEARACCUMPROC* g_lazySlot_glClearAccum = NULL;
+static void APIENTRY lazy_glClearAccum(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCLEARACCUMPROC, glClearAccum); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLCLEARINDEXPROC* g_lazySlot_glClearIndex = NULL;
+static void APIENTRY lazy_glClearIndex(GLfloat a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCLEARINDEXPROC, glClearIndex); if (f == NULL) { return; } return f(a0); }
+static PFNGLINDEXMASKPROC* g_lazySlot_glIndexMask = NULL;
+static void APIENTRY lazy_glIndexMask(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXMASKPROC, glIndexMask); if (f == NULL) { return; } return f(a0); }
+static PFNGLACCUMPROC* g_lazySlot_glAccum = NULL;
+static void APIENTRY lazy_glAccum(GLenum a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLACCUMPROC, glAccum); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLPOPATTRIBPROC* g_lazySlot_glPopAttrib = NULL;
+static void APIENTRY lazy_glPopAttrib() { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOPATTRIBPROC, glPopAttrib); if (f == NULL) { return; } return f(); }
+static PFNGLPUSHATTRIBPROC* g_lazySlot_glPushAttrib = NULL;
+static void APIENTRY lazy_glPushAttrib(GLbitfield a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPUSHATTRIBPROC, glPushAttrib); if (f == NULL) { return; } return f(a0); }
+static PFNGLMAP1DPROC* g_lazySlot_glMap1d = NULL;
+static void APIENTRY lazy_glMap1d(GLenum a0, GLdouble a1, GLdouble a2, GLint a3, GLint a4, const GLdouble* a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMAP1DPROC, glMap1d); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLMAP1FPROC* g_lazySlot_glMap1f = NULL;
+static void APIENTRY lazy_glMap1f(GLenum a0, GLfloat a1, GLfloat a2, GLint a3, GLint a4, const GLfloat* a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMAP1FPROC, glMap1f); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLMAP2DPROC* g_lazySlot_glMap2d = NULL;
+static void APIENTRY lazy_glMap2d(GLenum a0, GLdouble a1, GLdouble a2, GLint a3, GLint a4, GLdouble a5, GLdouble a6, GLint a7, GLint a8, const GLdouble* a9) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMAP2DPROC, glMap2d); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static PFNGLMAP2FPROC* g_lazySlot_glMap2f = NULL;
+static void APIENTRY lazy_glMap2f(GLenum a0, GLfloat a1, GLfloat a2, GLint a3, GLint a4, GLfloat a5, GLfloat a6, GLint a7, GLint a8, const GLfloat* a9) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMAP2FPROC, glMap2f); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static PFNGLMAPGRID1DPROC* g_lazySlot_glMapGrid1d = NULL;
+static void APIENTRY lazy_glMapGrid1d(GLint a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMAPGRID1DPROC, glMapGrid1d); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLMAPGRID1FPROC* g_lazySlot_glMapGrid1f = NULL;
+static void APIENTRY lazy_glMapGrid1f(GLint a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMAPGRID1FPROC, glMapGrid1f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLMAPGRID2DPROC* g_lazySlot_glMapGrid2d = NULL;
+static void APIENTRY lazy_glMapGrid2d(GLint a0, GLdouble a1, GLdouble a2, GLint a3, GLdouble a4, GLdouble a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMAPGRID2DPROC, glMapGrid2d); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLMAPGRID2FPROC* g_lazySlot_glMapGrid2f = NULL;
+static void APIENTRY lazy_glMapGrid2f(GLint a0, GLfloat a1, GLfloat a2, GLint a3, GLfloat a4, GLfloat a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMAPGRID2FPROC, glMapGrid2f); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLEVALCOORD1DPROC* g_lazySlot_glEvalCoord1d = NULL;
+static void APIENTRY lazy_glEvalCoord1d(GLdouble a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALCOORD1DPROC, glEvalCoord1d); if (f == NULL) { return; } return f(a0); }
+static PFNGLEVALCOORD1DVPROC* g_lazySlot_glEvalCoord1dv = NULL;
+static void APIENTRY lazy_glEvalCoord1dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALCOORD1DVPROC, glEvalCoord1dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLEVALCOORD1FPROC* g_lazySlot_glEvalCoord1f = NULL;
+static void APIENTRY lazy_glEvalCoord1f(GLfloat a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALCOORD1FPROC, glEvalCoord1f); if (f == NULL) { return; } return f(a0); }
+static PFNGLEVALCOORD1FVPROC* g_lazySlot_glEvalCoord1fv = NULL;
+static void APIENTRY lazy_glEvalCoord1fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALCOORD1FVPROC, glEvalCoord1fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLEVALCOORD2DPROC* g_lazySlot_glEvalCoord2d = NULL;
+static void APIENTRY lazy_glEvalCoord2d(GLdouble a0, GLdouble a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALCOORD2DPROC, glEvalCoord2d); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLEVALCOORD2DVPROC* g_lazySlot_glEvalCoord2dv = NULL;
+static void APIENTRY lazy_glEvalCoord2dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALCOORD2DVPROC, glEvalCoord2dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLEVALCOORD2FPROC* g_lazySlot_glEvalCoord2f = NULL;
+static void APIENTRY lazy_glEvalCoord2f(GLfloat a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALCOORD2FPROC, glEvalCoord2f); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLEVALCOORD2FVPROC* g_lazySlot_glEvalCoord2fv = NULL;
+static void APIENTRY lazy_glEvalCoord2fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALCOORD2FVPROC, glEvalCoord2fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLEVALMESH1PROC* g_lazySlot_glEvalMesh1 = NULL;
+static void APIENTRY lazy_glEvalMesh1(GLenum a0, GLint a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALMESH1PROC, glEvalMesh1); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLEVALPOINT1PROC* g_lazySlot_glEvalPoint1 = NULL;
+static void APIENTRY lazy_glEvalPoint1(GLint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALPOINT1PROC, glEvalPoint1); if (f == NULL) { return; } return f(a0); }
+static PFNGLEVALMESH2PROC* g_lazySlot_glEvalMesh2 = NULL;
+static void APIENTRY lazy_glEvalMesh2(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALMESH2PROC, glEvalMesh2); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLEVALPOINT2PROC* g_lazySlot_glEvalPoint2 = NULL;
+static void APIENTRY lazy_glEvalPoint2(GLint a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEVALPOINT2PROC, glEvalPoint2); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLALPHAFUNCPROC* g_lazySlot_glAlphaFunc = NULL;
+static void APIENTRY lazy_glAlphaFunc(GLenum a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLALPHAFUNCPROC, glAlphaFunc); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLPIXELZOOMPROC* g_lazySlot_glPixelZoom = NULL;
+static void APIENTRY lazy_glPixelZoom(GLfloat a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPIXELZOOMPROC, glPixelZoom); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLPIXELTRANSFERFPROC* g_lazySlot_glPixelTransferf = NULL;
+static void APIENTRY lazy_glPixelTransferf(GLenum a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPIXELTRANSFERFPROC, glPixelTransferf); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLPIXELTRANSFERIPROC* g_lazySlot_glPixelTransferi = NULL;
+static void APIENTRY lazy_glPixelTransferi(GLenum a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPIXELTRANSFERIPROC, glPixelTransferi); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLPIXELMAPFVPROC* g_lazySlot_glPixelMapfv = NULL;
+static void APIENTRY lazy_glPixelMapfv(GLenum a0, GLsizei a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPIXELMAPFVPROC, glPixelMapfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLPIXELMAPUIVPROC* g_lazySlot_glPixelMapuiv = NULL;
+static void APIENTRY lazy_glPixelMapuiv(GLenum a0, GLsizei a1, const GLuint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPIXELMAPUIVPROC, glPixelMapuiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLPIXELMAPUSVPROC* g_lazySlot_glPixelMapusv = NULL;
+static void APIENTRY lazy_glPixelMapusv(GLenum a0, GLsizei a1, const GLushort* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPIXELMAPUSVPROC, glPixelMapusv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCOPYPIXELSPROC* g_lazySlot_glCopyPixels = NULL;
+static void APIENTRY lazy_glCopyPixels(GLint a0, GLint a1, GLsizei a2, GLsizei a3, GLenum a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOPYPIXELSPROC, glCopyPixels); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLDRAWPIXELSPROC* g_lazySlot_glDrawPixels = NULL;
+static void APIENTRY lazy_glDrawPixels(GLsizei a0, GLsizei a1, GLenum a2, GLenum a3, const void* a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDRAWPIXELSPROC, glDrawPixels); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLGETCLIPPLANEPROC* g_lazySlot_glGetClipPlane = NULL;
+static void APIENTRY lazy_glGetClipPlane(GLenum a0, GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETCLIPPLANEPROC, glGetClipPlane); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGETLIGHTFVPROC* g_lazySlot_glGetLightfv = NULL;
+static void APIENTRY lazy_glGetLightfv(GLenum a0, GLenum a1, GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETLIGHTFVPROC, glGetLightfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETLIGHTIVPROC* g_lazySlot_glGetLightiv = NULL;
+static void APIENTRY lazy_glGetLightiv(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETLIGHTIVPROC, glGetLightiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETMAPDVPROC* g_lazySlot_glGetMapdv = NULL;
+static void APIENTRY lazy_glGetMapdv(GLenum a0, GLenum a1, GLdouble* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETMAPDVPROC, glGetMapdv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETMAPFVPROC* g_lazySlot_glGetMapfv = NULL;
+static void APIENTRY lazy_glGetMapfv(GLenum a0, GLenum a1, GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETMAPFVPROC, glGetMapfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETMAPIVPROC* g_lazySlot_glGetMapiv = NULL;
+static void APIENTRY lazy_glGetMapiv(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETMAPIVPROC, glGetMapiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETMATERIALFVPROC* g_lazySlot_glGetMaterialfv = NULL;
+static void APIENTRY lazy_glGetMaterialfv(GLenum a0, GLenum a1, GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETMATERIALFVPROC, glGetMaterialfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETMATERIALIVPROC* g_lazySlot_glGetMaterialiv = NULL;
+static void APIENTRY lazy_glGetMaterialiv(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETMATERIALIVPROC, glGetMaterialiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETPIXELMAPFVPROC* g_lazySlot_glGetPixelMapfv = NULL;
+static void APIENTRY lazy_glGetPixelMapfv(GLenum a0, GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETPIXELMAPFVPROC, glGetPixelMapfv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGETPIXELMAPUIVPROC* g_lazySlot_glGetPixelMapuiv = NULL;
+static void APIENTRY lazy_glGetPixelMapuiv(GLenum a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETPIXELMAPUIVPROC, glGetPixelMapuiv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGETPIXELMAPUSVPROC* g_lazySlot_glGetPixelMapusv = NULL;
+static void APIENTRY lazy_glGetPixelMapusv(GLenum a0, GLushort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETPIXELMAPUSVPROC, glGetPixelMapusv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGETPOLYGONSTIPPLEPROC* g_lazySlot_glGetPolygonStipple = NULL;
+static void APIENTRY lazy_glGetPolygonStipple(GLubyte* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETPOLYGONSTIPPLEPROC, glGetPolygonStipple); if (f == NULL) { return; } return f(a0); }
+static PFNGLGETTEXENVFVPROC* g_lazySlot_glGetTexEnvfv = NULL;
+static void APIENTRY lazy_glGetTexEnvfv(GLenum a0, GLenum a1, GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETTEXENVFVPROC, glGetTexEnvfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETTEXENVIVPROC* g_lazySlot_glGetTexEnviv = NULL;
+static void APIENTRY lazy_glGetTexEnviv(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETTEXENVIVPROC, glGetTexEnviv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETTEXGENDVPROC* g_lazySlot_glGetTexGendv = NULL;
+static void APIENTRY lazy_glGetTexGendv(GLenum a0, GLenum a1, GLdouble* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETTEXGENDVPROC, glGetTexGendv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETTEXGENFVPROC* g_lazySlot_glGetTexGenfv = NULL;
+static void APIENTRY lazy_glGetTexGenfv(GLenum a0, GLenum a1, GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETTEXGENFVPROC, glGetTexGenfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETTEXGENIVPROC* g_lazySlot_glGetTexGeniv = NULL;
+static void APIENTRY lazy_glGetTexGeniv(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETTEXGENIVPROC, glGetTexGeniv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLISLISTPROC* g_lazySlot_glIsList = NULL;
+static GLboolean APIENTRY lazy_glIsList(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISLISTPROC, glIsList); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLFRUSTUMPROC* g_lazySlot_glFrustum = NULL;
+static void APIENTRY lazy_glFrustum(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRUSTUMPROC, glFrustum); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLLOADIDENTITYPROC* g_lazySlot_glLoadIdentity = NULL;
+static void APIENTRY lazy_glLoadIdentity() { OFX_OSMESA_LAZY_RESOLVE(PFNGLLOADIDENTITYPROC, glLoadIdentity); if (f == NULL) { return; } return f(); }
+static PFNGLLOADMATRIXFPROC* g_lazySlot_glLoadMatrixf = NULL;
+static void APIENTRY lazy_glLoadMatrixf(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLOADMATRIXFPROC, glLoadMatrixf); if (f == NULL) { return; } return f(a0); }
+static PFNGLLOADMATRIXDPROC* g_lazySlot_glLoadMatrixd = NULL;
+static void APIENTRY lazy_glLoadMatrixd(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLOADMATRIXDPROC, glLoadMatrixd); if (f == NULL) { return; } return f(a0); }
+static PFNGLMATRIXMODEPROC* g_lazySlot_glMatrixMode = NULL;
+static void APIENTRY lazy_glMatrixMode(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMATRIXMODEPROC, glMatrixMode); if (f == NULL) { return; } return f(a0); }
+static PFNGLMULTMATRIXFPROC* g_lazySlot_glMultMatrixf = NULL;
+static void APIENTRY lazy_glMultMatrixf(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTMATRIXFPROC, glMultMatrixf); if (f == NULL) { return; } return f(a0); }
+static PFNGLMULTMATRIXDPROC* g_lazySlot_glMultMatrixd = NULL;
+static void APIENTRY lazy_glMultMatrixd(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTMATRIXDPROC, glMultMatrixd); if (f == NULL) { return; } return f(a0); }
+static PFNGLORTHOPROC* g_lazySlot_glOrtho = NULL;
+static void APIENTRY lazy_glOrtho(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4, GLdouble a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLORTHOPROC, glOrtho); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLPOPMATRIXPROC* g_lazySlot_glPopMatrix = NULL;
+static void APIENTRY lazy_glPopMatrix() { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOPMATRIXPROC, glPopMatrix); if (f == NULL) { return; } return f(); }
+static PFNGLPUSHMATRIXPROC* g_lazySlot_glPushMatrix = NULL;
+static void APIENTRY lazy_glPushMatrix() { OFX_OSMESA_LAZY_RESOLVE(PFNGLPUSHMATRIXPROC, glPushMatrix); if (f == NULL) { return; } return f(); }
+static PFNGLROTATEDPROC* g_lazySlot_glRotated = NULL;
+static void APIENTRY lazy_glRotated(GLdouble a0, GLdouble a1, GLdouble a2, GLdouble a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLROTATEDPROC, glRotated); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLROTATEFPROC* g_lazySlot_glRotatef = NULL;
+static void APIENTRY lazy_glRotatef(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLROTATEFPROC, glRotatef); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLSCALEDPROC* g_lazySlot_glScaled = NULL;
+static void APIENTRY lazy_glScaled(GLdouble a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSCALEDPROC, glScaled); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSCALEFPROC* g_lazySlot_glScalef = NULL;
+static void APIENTRY lazy_glScalef(GLfloat a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSCALEFPROC, glScalef); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTRANSLATEDPROC* g_lazySlot_glTranslated = NULL;
+static void APIENTRY lazy_glTranslated(GLdouble a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTRANSLATEDPROC, glTranslated); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTRANSLATEFPROC* g_lazySlot_glTranslatef = NULL;
+static void APIENTRY lazy_glTranslatef(GLfloat a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTRANSLATEFPROC, glTranslatef); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLDRAWARRAYSPROC* g_lazySlot_glDrawArrays = NULL;
+static void APIENTRY lazy_glDrawArrays(GLenum a0, GLint a1, GLsizei a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDRAWARRAYSPROC, glDrawArrays); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLDRAWELEMENTSPROC* g_lazySlot_glDrawElements = NULL;
+static void APIENTRY lazy_glDrawElements(GLenum a0, GLsizei a1, GLenum a2, const void* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDRAWELEMENTSPROC, glDrawElements); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETPOINTERVPROC* g_lazySlot_glGetPointerv = NULL;
+static void APIENTRY lazy_glGetPointerv(GLenum a0, void** a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETPOINTERVPROC, glGetPointerv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLPOLYGONOFFSETPROC* g_lazySlot_glPolygonOffset = NULL;
+static void APIENTRY lazy_glPolygonOffset(GLfloat a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOLYGONOFFSETPROC, glPolygonOffset); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLCOPYTEXIMAGE1DPROC* g_lazySlot_glCopyTexImage1D = NULL;
+static void APIENTRY lazy_glCopyTexImage1D(GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLint a6) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOPYTEXIMAGE1DPROC, glCopyTexImage1D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLCOPYTEXIMAGE2DPROC* g_lazySlot_glCopyTexImage2D = NULL;
+static void APIENTRY lazy_glCopyTexImage2D(GLenum a0, GLint a1, GLenum a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLint a7) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOPYTEXIMAGE2DPROC, glCopyTexImage2D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7); }
+static PFNGLCOPYTEXSUBIMAGE1DPROC* g_lazySlot_glCopyTexSubImage1D = NULL;
+static void APIENTRY lazy_glCopyTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOPYTEXSUBIMAGE1DPROC, glCopyTexSubImage1D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLCOPYTEXSUBIMAGE2DPROC* g_lazySlot_glCopyTexSubImage2D = NULL;
+static void APIENTRY lazy_glCopyTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLsizei a6, GLsizei a7) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOPYTEXSUBIMAGE2DPROC, glCopyTexSubImage2D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7); }
+static PFNGLTEXSUBIMAGE1DPROC* g_lazySlot_glTexSubImage1D = NULL;
+static void APIENTRY lazy_glTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLenum a5, const void* a6) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXSUBIMAGE1DPROC, glTexSubImage1D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLTEXSUBIMAGE2DPROC* g_lazySlot_glTexSubImage2D = NULL;
+static void APIENTRY lazy_glTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLenum a7, const void* a8) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static PFNGLBINDTEXTUREPROC* g_lazySlot_glBindTexture = NULL;
+static void APIENTRY lazy_glBindTexture(GLenum a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBINDTEXTUREPROC, glBindTexture); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLDELETETEXTURESPROC* g_lazySlot_glDeleteTextures = NULL;
+static void APIENTRY lazy_glDeleteTextures(GLsizei a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETETEXTURESPROC, glDeleteTextures); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGENTEXTURESPROC* g_lazySlot_glGenTextures = NULL;
+static void APIENTRY lazy_glGenTextures(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENTEXTURESPROC, glGenTextures); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLISTEXTUREPROC* g_lazySlot_glIsTexture = NULL;
+static GLboolean APIENTRY lazy_glIsTexture(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISTEXTUREPROC, glIsTexture); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLARRAYELEMENTPROC* g_lazySlot_glArrayElement = NULL;
+static void APIENTRY lazy_glArrayElement(GLint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLARRAYELEMENTPROC, glArrayElement); if (f == NULL) { return; } return f(a0); }
+static PFNGLCOLORPOINTERPROC* g_lazySlot_glColorPointer = NULL;
+static void APIENTRY lazy_glColorPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOLORPOINTERPROC, glColorPointer); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLDISABLECLIENTSTATEPROC* g_lazySlot_glDisableClientState = NULL;
+static void APIENTRY lazy_glDisableClientState(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDISABLECLIENTSTATEPROC, glDisableClientState); if (f == NULL) { return; } return f(a0); }
+static PFNGLEDGEFLAGPOINTERPROC* g_lazySlot_glEdgeFlagPointer = NULL;
+static void APIENTRY lazy_glEdgeFlagPointer(GLsizei a0, const void* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLEDGEFLAGPOINTERPROC, glEdgeFlagPointer); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLENABLECLIENTSTATEPROC* g_lazySlot_glEnableClientState = NULL;
+static void APIENTRY lazy_glEnableClientState(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLENABLECLIENTSTATEPROC, glEnableClientState); if (f == NULL) { return; } return f(a0); }
+static PFNGLINDEXPOINTERPROC* g_lazySlot_glIndexPointer = NULL;
+static void APIENTRY lazy_glIndexPointer(GLenum a0, GLsizei a1, const void* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXPOINTERPROC, glIndexPointer); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLINTERLEAVEDARRAYSPROC* g_lazySlot_glInterleavedArrays = NULL;
+static void APIENTRY lazy_glInterleavedArrays(GLenum a0, GLsizei a1, const void* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINTERLEAVEDARRAYSPROC, glInterleavedArrays); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLNORMALPOINTERPROC* g_lazySlot_glNormalPointer = NULL;
+static void APIENTRY lazy_glNormalPointer(GLenum a0, GLsizei a1, const void* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLNORMALPOINTERPROC, glNormalPointer); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLTEXCOORDPOINTERPROC* g_lazySlot_glTexCoordPointer = NULL;
+static void APIENTRY lazy_glTexCoordPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXCOORDPOINTERPROC, glTexCoordPointer); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLVERTEXPOINTERPROC* g_lazySlot_glVertexPointer = NULL;
+static void APIENTRY lazy_glVertexPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXPOINTERPROC, glVertexPointer); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLARETEXTURESRESIDENTPROC* g_lazySlot_glAreTexturesResident = NULL;
+static GLboolean APIENTRY lazy_glAreTexturesResident(GLsizei a0, const GLuint* a1, GLboolean* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLARETEXTURESRESIDENTPROC, glAreTexturesResident); if (f == NULL) { return (GLboolean)0; } return f(a0, a1, a2); }
+static PFNGLPRIORITIZETEXTURESPROC* g_lazySlot_glPrioritizeTextures = NULL;
+static void APIENTRY lazy_glPrioritizeTextures(GLsizei a0, const GLuint* a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPRIORITIZETEXTURESPROC, glPrioritizeTextures); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLINDEXUBPROC* g_lazySlot_glIndexub = NULL;
+static void APIENTRY lazy_glIndexub(GLubyte a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXUBPROC, glIndexub); if (f == NULL) { return; } return f(a0); }
+static PFNGLINDEXUBVPROC* g_lazySlot_glIndexubv = NULL;
+static void APIENTRY lazy_glIndexubv(const GLubyte* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLINDEXUBVPROC, glIndexubv); if (f == NULL) { return; } return f(a0); }
+static PFNGLPOPCLIENTATTRIBPROC* g_lazySlot_glPopClientAttrib = NULL;
+static void APIENTRY lazy_glPopClientAttrib() { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOPCLIENTATTRIBPROC, glPopClientAttrib); if (f == NULL) { return; } return f(); }
+static PFNGLPUSHCLIENTATTRIBPROC* g_lazySlot_glPushClientAttrib = NULL;
+static void APIENTRY lazy_glPushClientAttrib(GLbitfield a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPUSHCLIENTATTRIBPROC, glPushClientAttrib); if (f == NULL) { return; } return f(a0); }
+static PFNGLDRAWRANGEELEMENTSPROC* g_lazySlot_glDrawRangeElements = NULL;
+static void APIENTRY lazy_glDrawRangeElements(GLenum a0, GLuint a1, GLuint a2, GLsizei a3, GLenum a4, const void* a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDRAWRANGEELEMENTSPROC, glDrawRangeElements); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLTEXIMAGE3DPROC* g_lazySlot_glTexImage3D = NULL;
+static void APIENTRY lazy_glTexImage3D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLenum a7, GLenum a8, const void* a9) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXIMAGE3DPROC, glTexImage3D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static PFNGLTEXSUBIMAGE3DPROC* g_lazySlot_glTexSubImage3D = NULL;
+static void APIENTRY lazy_glTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLenum a9, const void* a10) { OFX_OSMESA_LAZY_RESOLVE(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); }
+static PFNGLCOPYTEXSUBIMAGE3DPROC* g_lazySlot_glCopyTexSubImage3D = NULL;
+static void APIENTRY lazy_glCopyTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLsizei a7, GLsizei a8) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOPYTEXSUBIMAGE3DPROC, glCopyTexSubImage3D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static PFNGLACTIVETEXTUREPROC* g_lazySlot_glActiveTexture = NULL;
+static void APIENTRY lazy_glActiveTexture(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLACTIVETEXTUREPROC, glActiveTexture); if (f == NULL) { return; } return f(a0); }
+static PFNGLSAMPLECOVERAGEPROC* g_lazySlot_glSampleCoverage = NULL;
+static void APIENTRY lazy_glSampleCoverage(GLfloat a0, GLboolean a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSAMPLECOVERAGEPROC, glSampleCoverage); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC* g_lazySlot_glCompressedTexImage3D = NULL;
+static void APIENTRY lazy_glCompressedTexImage3D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLsizei a5, GLint a6, GLsizei a7, const void* a8) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXIMAGE3DPROC, glCompressedTexImage3D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC* g_lazySlot_glCompressedTexImage2D = NULL;
+static void APIENTRY lazy_glCompressedTexImage2D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLsizei a4, GLint a5, GLsizei a6, const void* a7) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXIMAGE2DPROC, glCompressedTexImage2D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7); }
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC* g_lazySlot_glCompressedTexImage1D = NULL;
+static void APIENTRY lazy_glCompressedTexImage1D(GLenum a0, GLint a1, GLenum a2, GLsizei a3, GLint a4, GLsizei a5, const void* a6) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXIMAGE1DPROC, glCompressedTexImage1D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC* g_lazySlot_glCompressedTexSubImage3D = NULL;
+static void APIENTRY lazy_glCompressedTexSubImage3D(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4, GLsizei a5, GLsizei a6, GLsizei a7, GLenum a8, GLsizei a9, const void* a10) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10); }
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC* g_lazySlot_glCompressedTexSubImage2D = NULL;
+static void APIENTRY lazy_glCompressedTexSubImage2D(GLenum a0, GLint a1, GLint a2, GLint a3, GLsizei a4, GLsizei a5, GLenum a6, GLsizei a7, const void* a8) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8); }
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC* g_lazySlot_glCompressedTexSubImage1D = NULL;
+static void APIENTRY lazy_glCompressedTexSubImage1D(GLenum a0, GLint a1, GLint a2, GLsizei a3, GLenum a4, GLsizei a5, const void* a6) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, glCompressedTexSubImage1D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC* g_lazySlot_glGetCompressedTexImage = NULL;
+static void APIENTRY lazy_glGetCompressedTexImage(GLenum a0, GLint a1, void* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETCOMPRESSEDTEXIMAGEPROC, glGetCompressedTexImage); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCLIENTACTIVETEXTUREPROC* g_lazySlot_glClientActiveTexture = NULL;
+static void APIENTRY lazy_glClientActiveTexture(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCLIENTACTIVETEXTUREPROC, glClientActiveTexture); if (f == NULL) { return; } return f(a0); }
+static PFNGLMULTITEXCOORD1DPROC* g_lazySlot_glMultiTexCoord1d = NULL;
+static void APIENTRY lazy_glMultiTexCoord1d(GLenum a0, GLdouble a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD1DPROC, glMultiTexCoord1d); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD1DVPROC* g_lazySlot_glMultiTexCoord1dv = NULL;
+static void APIENTRY lazy_glMultiTexCoord1dv(GLenum a0, const GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD1DVPROC, glMultiTexCoord1dv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD1FPROC* g_lazySlot_glMultiTexCoord1f = NULL;
+static void APIENTRY lazy_glMultiTexCoord1f(GLenum a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD1FPROC, glMultiTexCoord1f); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD1FVPROC* g_lazySlot_glMultiTexCoord1fv = NULL;
+static void APIENTRY lazy_glMultiTexCoord1fv(GLenum a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD1FVPROC, glMultiTexCoord1fv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD1IPROC* g_lazySlot_glMultiTexCoord1i = NULL;
+static void APIENTRY lazy_glMultiTexCoord1i(GLenum a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD1IPROC, glMultiTexCoord1i); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD1IVPROC* g_lazySlot_glMultiTexCoord1iv = NULL;
+static void APIENTRY lazy_glMultiTexCoord1iv(GLenum a0, const GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD1IVPROC, glMultiTexCoord1iv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD1SPROC* g_lazySlot_glMultiTexCoord1s = NULL;
+static void APIENTRY lazy_glMultiTexCoord1s(GLenum a0, GLshort a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD1SPROC, glMultiTexCoord1s); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD1SVPROC* g_lazySlot_glMultiTexCoord1sv = NULL;
+static void APIENTRY lazy_glMultiTexCoord1sv(GLenum a0, const GLshort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD1SVPROC, glMultiTexCoord1sv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD2DPROC* g_lazySlot_glMultiTexCoord2d = NULL;
+static void APIENTRY lazy_glMultiTexCoord2d(GLenum a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD2DPROC, glMultiTexCoord2d); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLMULTITEXCOORD2DVPROC* g_lazySlot_glMultiTexCoord2dv = NULL;
+static void APIENTRY lazy_glMultiTexCoord2dv(GLenum a0, const GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD2DVPROC, glMultiTexCoord2dv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD2FPROC* g_lazySlot_glMultiTexCoord2f = NULL;
+static void APIENTRY lazy_glMultiTexCoord2f(GLenum a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD2FPROC, glMultiTexCoord2f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLMULTITEXCOORD2FVPROC* g_lazySlot_glMultiTexCoord2fv = NULL;
+static void APIENTRY lazy_glMultiTexCoord2fv(GLenum a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD2FVPROC, glMultiTexCoord2fv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD2IPROC* g_lazySlot_glMultiTexCoord2i = NULL;
+static void APIENTRY lazy_glMultiTexCoord2i(GLenum a0, GLint a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD2IPROC, glMultiTexCoord2i); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLMULTITEXCOORD2IVPROC* g_lazySlot_glMultiTexCoord2iv = NULL;
+static void APIENTRY lazy_glMultiTexCoord2iv(GLenum a0, const GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD2IVPROC, glMultiTexCoord2iv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD2SPROC* g_lazySlot_glMultiTexCoord2s = NULL;
+static void APIENTRY lazy_glMultiTexCoord2s(GLenum a0, GLshort a1, GLshort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD2SPROC, glMultiTexCoord2s); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLMULTITEXCOORD2SVPROC* g_lazySlot_glMultiTexCoord2sv = NULL;
+static void APIENTRY lazy_glMultiTexCoord2sv(GLenum a0, const GLshort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD2SVPROC, glMultiTexCoord2sv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD3DPROC* g_lazySlot_glMultiTexCoord3d = NULL;
+static void APIENTRY lazy_glMultiTexCoord3d(GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD3DPROC, glMultiTexCoord3d); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLMULTITEXCOORD3DVPROC* g_lazySlot_glMultiTexCoord3dv = NULL;
+static void APIENTRY lazy_glMultiTexCoord3dv(GLenum a0, const GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD3DVPROC, glMultiTexCoord3dv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD3FPROC* g_lazySlot_glMultiTexCoord3f = NULL;
+static void APIENTRY lazy_glMultiTexCoord3f(GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD3FPROC, glMultiTexCoord3f); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLMULTITEXCOORD3FVPROC* g_lazySlot_glMultiTexCoord3fv = NULL;
+static void APIENTRY lazy_glMultiTexCoord3fv(GLenum a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD3FVPROC, glMultiTexCoord3fv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD3IPROC* g_lazySlot_glMultiTexCoord3i = NULL;
+static void APIENTRY lazy_glMultiTexCoord3i(GLenum a0, GLint a1, GLint a2, GLint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD3IPROC, glMultiTexCoord3i); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLMULTITEXCOORD3IVPROC* g_lazySlot_glMultiTexCoord3iv = NULL;
+static void APIENTRY lazy_glMultiTexCoord3iv(GLenum a0, const GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD3IVPROC, glMultiTexCoord3iv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD3SPROC* g_lazySlot_glMultiTexCoord3s = NULL;
+static void APIENTRY lazy_glMultiTexCoord3s(GLenum a0, GLshort a1, GLshort a2, GLshort a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD3SPROC, glMultiTexCoord3s); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLMULTITEXCOORD3SVPROC* g_lazySlot_glMultiTexCoord3sv = NULL;
+static void APIENTRY lazy_glMultiTexCoord3sv(GLenum a0, const GLshort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD3SVPROC, glMultiTexCoord3sv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD4DPROC* g_lazySlot_glMultiTexCoord4d = NULL;
+static void APIENTRY lazy_glMultiTexCoord4d(GLenum a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD4DPROC, glMultiTexCoord4d); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLMULTITEXCOORD4DVPROC* g_lazySlot_glMultiTexCoord4dv = NULL;
+static void APIENTRY lazy_glMultiTexCoord4dv(GLenum a0, const GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD4DVPROC, glMultiTexCoord4dv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD4FPROC* g_lazySlot_glMultiTexCoord4f = NULL;
+static void APIENTRY lazy_glMultiTexCoord4f(GLenum a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD4FPROC, glMultiTexCoord4f); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLMULTITEXCOORD4FVPROC* g_lazySlot_glMultiTexCoord4fv = NULL;
+static void APIENTRY lazy_glMultiTexCoord4fv(GLenum a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD4FVPROC, glMultiTexCoord4fv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD4IPROC* g_lazySlot_glMultiTexCoord4i = NULL;
+static void APIENTRY lazy_glMultiTexCoord4i(GLenum a0, GLint a1, GLint a2, GLint a3, GLint a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD4IPROC, glMultiTexCoord4i); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLMULTITEXCOORD4IVPROC* g_lazySlot_glMultiTexCoord4iv = NULL;
+static void APIENTRY lazy_glMultiTexCoord4iv(GLenum a0, const GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD4IVPROC, glMultiTexCoord4iv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLMULTITEXCOORD4SPROC* g_lazySlot_glMultiTexCoord4s = NULL;
+static void APIENTRY lazy_glMultiTexCoord4s(GLenum a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD4SPROC, glMultiTexCoord4s); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLMULTITEXCOORD4SVPROC* g_lazySlot_glMultiTexCoord4sv = NULL;
+static void APIENTRY lazy_glMultiTexCoord4sv(GLenum a0, const GLshort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTITEXCOORD4SVPROC, glMultiTexCoord4sv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLLOADTRANSPOSEMATRIXFPROC* g_lazySlot_glLoadTransposeMatrixf = NULL;
+static void APIENTRY lazy_glLoadTransposeMatrixf(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLOADTRANSPOSEMATRIXFPROC, glLoadTransposeMatrixf); if (f == NULL) { return; } return f(a0); }
+static PFNGLLOADTRANSPOSEMATRIXDPROC* g_lazySlot_glLoadTransposeMatrixd = NULL;
+static void APIENTRY lazy_glLoadTransposeMatrixd(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLOADTRANSPOSEMATRIXDPROC, glLoadTransposeMatrixd); if (f == NULL) { return; } return f(a0); }
+static PFNGLMULTTRANSPOSEMATRIXFPROC* g_lazySlot_glMultTransposeMatrixf = NULL;
+static void APIENTRY lazy_glMultTransposeMatrixf(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTTRANSPOSEMATRIXFPROC, glMultTransposeMatrixf); if (f == NULL) { return; } return f(a0); }
+static PFNGLMULTTRANSPOSEMATRIXDPROC* g_lazySlot_glMultTransposeMatrixd = NULL;
+static void APIENTRY lazy_glMultTransposeMatrixd(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTTRANSPOSEMATRIXDPROC, glMultTransposeMatrixd); if (f == NULL) { return; } return f(a0); }
+static PFNGLBLENDFUNCSEPARATEPROC* g_lazySlot_glBlendFuncSeparate = NULL;
+static void APIENTRY lazy_glBlendFuncSeparate(GLenum a0, GLenum a1, GLenum a2, GLenum a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLMULTIDRAWARRAYSPROC* g_lazySlot_glMultiDrawArrays = NULL;
+static void APIENTRY lazy_glMultiDrawArrays(GLenum a0, const GLint* a1, const GLsizei* a2, GLsizei a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTIDRAWARRAYSPROC, glMultiDrawArrays); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLMULTIDRAWELEMENTSPROC* g_lazySlot_glMultiDrawElements = NULL;
+static void APIENTRY lazy_glMultiDrawElements(GLenum a0, const GLsizei* a1, GLenum a2, const void** a3, GLsizei a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMULTIDRAWELEMENTSPROC, glMultiDrawElements); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLPOINTPARAMETERFPROC* g_lazySlot_glPointParameterf = NULL;
+static void APIENTRY lazy_glPointParameterf(GLenum a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOINTPARAMETERFPROC, glPointParameterf); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLPOINTPARAMETERFVPROC* g_lazySlot_glPointParameterfv = NULL;
+static void APIENTRY lazy_glPointParameterfv(GLenum a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOINTPARAMETERFVPROC, glPointParameterfv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLPOINTPARAMETERIPROC* g_lazySlot_glPointParameteri = NULL;
+static void APIENTRY lazy_glPointParameteri(GLenum a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOINTPARAMETERIPROC, glPointParameteri); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLPOINTPARAMETERIVPROC* g_lazySlot_glPointParameteriv = NULL;
+static void APIENTRY lazy_glPointParameteriv(GLenum a0, const GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLPOINTPARAMETERIVPROC, glPointParameteriv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLFOGCOORDFPROC* g_lazySlot_glFogCoordf = NULL;
+static void APIENTRY lazy_glFogCoordf(GLfloat a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFOGCOORDFPROC, glFogCoordf); if (f == NULL) { return; } return f(a0); }
+static PFNGLFOGCOORDFVPROC* g_lazySlot_glFogCoordfv = NULL;
+static void APIENTRY lazy_glFogCoordfv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFOGCOORDFVPROC, glFogCoordfv); if (f == NULL) { return; } return f(a0); }
+static PFNGLFOGCOORDDPROC* g_lazySlot_glFogCoordd = NULL;
+static void APIENTRY lazy_glFogCoordd(GLdouble a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFOGCOORDDPROC, glFogCoordd); if (f == NULL) { return; } return f(a0); }
+static PFNGLFOGCOORDDVPROC* g_lazySlot_glFogCoorddv = NULL;
+static void APIENTRY lazy_glFogCoorddv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFOGCOORDDVPROC, glFogCoorddv); if (f == NULL) { return; } return f(a0); }
+static PFNGLFOGCOORDPOINTERPROC* g_lazySlot_glFogCoordPointer = NULL;
+static void APIENTRY lazy_glFogCoordPointer(GLenum a0, GLsizei a1, const void* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFOGCOORDPOINTERPROC, glFogCoordPointer); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3BPROC* g_lazySlot_glSecondaryColor3b = NULL;
+static void APIENTRY lazy_glSecondaryColor3b(GLbyte a0, GLbyte a1, GLbyte a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3BPROC, glSecondaryColor3b); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3BVPROC* g_lazySlot_glSecondaryColor3bv = NULL;
+static void APIENTRY lazy_glSecondaryColor3bv(const GLbyte* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3BVPROC, glSecondaryColor3bv); if (f == NULL) { return; } return f(a0); }
+static PFNGLSECONDARYCOLOR3DPROC* g_lazySlot_glSecondaryColor3d = NULL;
+static void APIENTRY lazy_glSecondaryColor3d(GLdouble a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3DPROC, glSecondaryColor3d); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3DVPROC* g_lazySlot_glSecondaryColor3dv = NULL;
+static void APIENTRY lazy_glSecondaryColor3dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3DVPROC, glSecondaryColor3dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLSECONDARYCOLOR3FPROC* g_lazySlot_glSecondaryColor3f = NULL;
+static void APIENTRY lazy_glSecondaryColor3f(GLfloat a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3FPROC, glSecondaryColor3f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3FVPROC* g_lazySlot_glSecondaryColor3fv = NULL;
+static void APIENTRY lazy_glSecondaryColor3fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3FVPROC, glSecondaryColor3fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLSECONDARYCOLOR3IPROC* g_lazySlot_glSecondaryColor3i = NULL;
+static void APIENTRY lazy_glSecondaryColor3i(GLint a0, GLint a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3IPROC, glSecondaryColor3i); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3IVPROC* g_lazySlot_glSecondaryColor3iv = NULL;
+static void APIENTRY lazy_glSecondaryColor3iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3IVPROC, glSecondaryColor3iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLSECONDARYCOLOR3SPROC* g_lazySlot_glSecondaryColor3s = NULL;
+static void APIENTRY lazy_glSecondaryColor3s(GLshort a0, GLshort a1, GLshort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3SPROC, glSecondaryColor3s); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3SVPROC* g_lazySlot_glSecondaryColor3sv = NULL;
+static void APIENTRY lazy_glSecondaryColor3sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3SVPROC, glSecondaryColor3sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLSECONDARYCOLOR3UBPROC* g_lazySlot_glSecondaryColor3ub = NULL;
+static void APIENTRY lazy_glSecondaryColor3ub(GLubyte a0, GLubyte a1, GLubyte a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3UBPROC, glSecondaryColor3ub); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3UBVPROC* g_lazySlot_glSecondaryColor3ubv = NULL;
+static void APIENTRY lazy_glSecondaryColor3ubv(const GLubyte* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3UBVPROC, glSecondaryColor3ubv); if (f == NULL) { return; } return f(a0); }
+static PFNGLSECONDARYCOLOR3UIPROC* g_lazySlot_glSecondaryColor3ui = NULL;
+static void APIENTRY lazy_glSecondaryColor3ui(GLuint a0, GLuint a1, GLuint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3UIPROC, glSecondaryColor3ui); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3UIVPROC* g_lazySlot_glSecondaryColor3uiv = NULL;
+static void APIENTRY lazy_glSecondaryColor3uiv(const GLuint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3UIVPROC, glSecondaryColor3uiv); if (f == NULL) { return; } return f(a0); }
+static PFNGLSECONDARYCOLOR3USPROC* g_lazySlot_glSecondaryColor3us = NULL;
+static void APIENTRY lazy_glSecondaryColor3us(GLushort a0, GLushort a1, GLushort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3USPROC, glSecondaryColor3us); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLSECONDARYCOLOR3USVPROC* g_lazySlot_glSecondaryColor3usv = NULL;
+static void APIENTRY lazy_glSecondaryColor3usv(const GLushort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLOR3USVPROC, glSecondaryColor3usv); if (f == NULL) { return; } return f(a0); }
+static PFNGLSECONDARYCOLORPOINTERPROC* g_lazySlot_glSecondaryColorPointer = NULL;
+static void APIENTRY lazy_glSecondaryColorPointer(GLint a0, GLenum a1, GLsizei a2, const void* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSECONDARYCOLORPOINTERPROC, glSecondaryColorPointer); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLWINDOWPOS2DPROC* g_lazySlot_glWindowPos2d = NULL;
+static void APIENTRY lazy_glWindowPos2d(GLdouble a0, GLdouble a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS2DPROC, glWindowPos2d); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLWINDOWPOS2DVPROC* g_lazySlot_glWindowPos2dv = NULL;
+static void APIENTRY lazy_glWindowPos2dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS2DVPROC, glWindowPos2dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLWINDOWPOS2FPROC* g_lazySlot_glWindowPos2f = NULL;
+static void APIENTRY lazy_glWindowPos2f(GLfloat a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS2FPROC, glWindowPos2f); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLWINDOWPOS2FVPROC* g_lazySlot_glWindowPos2fv = NULL;
+static void APIENTRY lazy_glWindowPos2fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS2FVPROC, glWindowPos2fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLWINDOWPOS2IPROC* g_lazySlot_glWindowPos2i = NULL;
+static void APIENTRY lazy_glWindowPos2i(GLint a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS2IPROC, glWindowPos2i); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLWINDOWPOS2IVPROC* g_lazySlot_glWindowPos2iv = NULL;
+static void APIENTRY lazy_glWindowPos2iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS2IVPROC, glWindowPos2iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLWINDOWPOS2SPROC* g_lazySlot_glWindowPos2s = NULL;
+static void APIENTRY lazy_glWindowPos2s(GLshort a0, GLshort a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS2SPROC, glWindowPos2s); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLWINDOWPOS2SVPROC* g_lazySlot_glWindowPos2sv = NULL;
+static void APIENTRY lazy_glWindowPos2sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS2SVPROC, glWindowPos2sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLWINDOWPOS3DPROC* g_lazySlot_glWindowPos3d = NULL;
+static void APIENTRY lazy_glWindowPos3d(GLdouble a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS3DPROC, glWindowPos3d); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLWINDOWPOS3DVPROC* g_lazySlot_glWindowPos3dv = NULL;
+static void APIENTRY lazy_glWindowPos3dv(const GLdouble* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS3DVPROC, glWindowPos3dv); if (f == NULL) { return; } return f(a0); }
+static PFNGLWINDOWPOS3FPROC* g_lazySlot_glWindowPos3f = NULL;
+static void APIENTRY lazy_glWindowPos3f(GLfloat a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS3FPROC, glWindowPos3f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLWINDOWPOS3FVPROC* g_lazySlot_glWindowPos3fv = NULL;
+static void APIENTRY lazy_glWindowPos3fv(const GLfloat* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS3FVPROC, glWindowPos3fv); if (f == NULL) { return; } return f(a0); }
+static PFNGLWINDOWPOS3IPROC* g_lazySlot_glWindowPos3i = NULL;
+static void APIENTRY lazy_glWindowPos3i(GLint a0, GLint a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS3IPROC, glWindowPos3i); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLWINDOWPOS3IVPROC* g_lazySlot_glWindowPos3iv = NULL;
+static void APIENTRY lazy_glWindowPos3iv(const GLint* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS3IVPROC, glWindowPos3iv); if (f == NULL) { return; } return f(a0); }
+static PFNGLWINDOWPOS3SPROC* g_lazySlot_glWindowPos3s = NULL;
+static void APIENTRY lazy_glWindowPos3s(GLshort a0, GLshort a1, GLshort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS3SPROC, glWindowPos3s); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLWINDOWPOS3SVPROC* g_lazySlot_glWindowPos3sv = NULL;
+static void APIENTRY lazy_glWindowPos3sv(const GLshort* a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLWINDOWPOS3SVPROC, glWindowPos3sv); if (f == NULL) { return; } return f(a0); }
+static PFNGLBLENDCOLORPROC* g_lazySlot_glBlendColor = NULL;
+static void APIENTRY lazy_glBlendColor(GLfloat a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBLENDCOLORPROC, glBlendColor); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLBLENDEQUATIONPROC* g_lazySlot_glBlendEquation = NULL;
+static void APIENTRY lazy_glBlendEquation(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBLENDEQUATIONPROC, glBlendEquation); if (f == NULL) { return; } return f(a0); }
+static PFNGLGENQUERIESPROC* g_lazySlot_glGenQueries = NULL;
+static void APIENTRY lazy_glGenQueries(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENQUERIESPROC, glGenQueries); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLDELETEQUERIESPROC* g_lazySlot_glDeleteQueries = NULL;
+static void APIENTRY lazy_glDeleteQueries(GLsizei a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETEQUERIESPROC, glDeleteQueries); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLISQUERYPROC* g_lazySlot_glIsQuery = NULL;
+static GLboolean APIENTRY lazy_glIsQuery(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISQUERYPROC, glIsQuery); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLBEGINQUERYPROC* g_lazySlot_glBeginQuery = NULL;
+static void APIENTRY lazy_glBeginQuery(GLenum a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBEGINQUERYPROC, glBeginQuery); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLENDQUERYPROC* g_lazySlot_glEndQuery = NULL;
+static void APIENTRY lazy_glEndQuery(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLENDQUERYPROC, glEndQuery); if (f == NULL) { return; } return f(a0); }
+static PFNGLGETQUERYIVPROC* g_lazySlot_glGetQueryiv = NULL;
+static void APIENTRY lazy_glGetQueryiv(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETQUERYIVPROC, glGetQueryiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETQUERYOBJECTIVPROC* g_lazySlot_glGetQueryObjectiv = NULL;
+static void APIENTRY lazy_glGetQueryObjectiv(GLuint a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETQUERYOBJECTIVPROC, glGetQueryObjectiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETQUERYOBJECTUIVPROC* g_lazySlot_glGetQueryObjectuiv = NULL;
+static void APIENTRY lazy_glGetQueryObjectuiv(GLuint a0, GLenum a1, GLuint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLBINDBUFFERPROC* g_lazySlot_glBindBuffer = NULL;
+static void APIENTRY lazy_glBindBuffer(GLenum a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBINDBUFFERPROC, glBindBuffer); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLDELETEBUFFERSPROC* g_lazySlot_glDeleteBuffers = NULL;
+static void APIENTRY lazy_glDeleteBuffers(GLsizei a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETEBUFFERSPROC, glDeleteBuffers); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGENBUFFERSPROC* g_lazySlot_glGenBuffers = NULL;
+static void APIENTRY lazy_glGenBuffers(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENBUFFERSPROC, glGenBuffers); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLISBUFFERPROC* g_lazySlot_glIsBuffer = NULL;
+static GLboolean APIENTRY lazy_glIsBuffer(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISBUFFERPROC, glIsBuffer); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLBUFFERDATAPROC* g_lazySlot_glBufferData = NULL;
+static void APIENTRY lazy_glBufferData(GLenum a0, GLsizeiptr a1, const void* a2, GLenum a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBUFFERDATAPROC, glBufferData); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLBUFFERSUBDATAPROC* g_lazySlot_glBufferSubData = NULL;
+static void APIENTRY lazy_glBufferSubData(GLenum a0, GLintptr a1, GLsizeiptr a2, const void* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBUFFERSUBDATAPROC, glBufferSubData); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETBUFFERSUBDATAPROC* g_lazySlot_glGetBufferSubData = NULL;
+static void APIENTRY lazy_glGetBufferSubData(GLenum a0, GLintptr a1, GLsizeiptr a2, void* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETBUFFERSUBDATAPROC, glGetBufferSubData); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLMAPBUFFERPROC* g_lazySlot_glMapBuffer = NULL;
+static void* APIENTRY lazy_glMapBuffer(GLenum a0, GLenum a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMAPBUFFERPROC, glMapBuffer); if (f == NULL) { return (void*)0; } return f(a0, a1); }
+static PFNGLUNMAPBUFFERPROC* g_lazySlot_glUnmapBuffer = NULL;
+static GLboolean APIENTRY lazy_glUnmapBuffer(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNMAPBUFFERPROC, glUnmapBuffer); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLGETBUFFERPARAMETERIVPROC* g_lazySlot_glGetBufferParameteriv = NULL;
+static void APIENTRY lazy_glGetBufferParameteriv(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETBUFFERPARAMETERIVPROC, glGetBufferParameteriv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETBUFFERPOINTERVPROC* g_lazySlot_glGetBufferPointerv = NULL;
+static void APIENTRY lazy_glGetBufferPointerv(GLenum a0, GLenum a1, void** a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETBUFFERPOINTERVPROC, glGetBufferPointerv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLBLENDEQUATIONSEPARATEPROC* g_lazySlot_glBlendEquationSeparate = NULL;
+static void APIENTRY lazy_glBlendEquationSeparate(GLenum a0, GLenum a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLDRAWBUFFERSPROC* g_lazySlot_glDrawBuffers = NULL;
+static void APIENTRY lazy_glDrawBuffers(GLsizei a0, const GLenum* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDRAWBUFFERSPROC, glDrawBuffers); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLSTENCILOPSEPARATEPROC* g_lazySlot_glStencilOpSeparate = NULL;
+static void APIENTRY lazy_glStencilOpSeparate(GLenum a0, GLenum a1, GLenum a2, GLenum a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSTENCILOPSEPARATEPROC, glStencilOpSeparate); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLSTENCILFUNCSEPARATEPROC* g_lazySlot_glStencilFuncSeparate = NULL;
+static void APIENTRY lazy_glStencilFuncSeparate(GLenum a0, GLenum a1, GLint a2, GLuint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSTENCILFUNCSEPARATEPROC, glStencilFuncSeparate); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLSTENCILMASKSEPARATEPROC* g_lazySlot_glStencilMaskSeparate = NULL;
+static void APIENTRY lazy_glStencilMaskSeparate(GLenum a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSTENCILMASKSEPARATEPROC, glStencilMaskSeparate); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLATTACHSHADERPROC* g_lazySlot_glAttachShader = NULL;
+static void APIENTRY lazy_glAttachShader(GLuint a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLATTACHSHADERPROC, glAttachShader); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLBINDATTRIBLOCATIONPROC* g_lazySlot_glBindAttribLocation = NULL;
+static void APIENTRY lazy_glBindAttribLocation(GLuint a0, GLuint a1, const GLchar* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLCOMPILESHADERPROC* g_lazySlot_glCompileShader = NULL;
+static void APIENTRY lazy_glCompileShader(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCOMPILESHADERPROC, glCompileShader); if (f == NULL) { return; } return f(a0); }
+static PFNGLCREATEPROGRAMPROC* g_lazySlot_glCreateProgram = NULL;
+static GLuint APIENTRY lazy_glCreateProgram() { OFX_OSMESA_LAZY_RESOLVE(PFNGLCREATEPROGRAMPROC, glCreateProgram); if (f == NULL) { return (GLuint)0; } return f(); }
+static PFNGLCREATESHADERPROC* g_lazySlot_glCreateShader = NULL;
+static GLuint APIENTRY lazy_glCreateShader(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCREATESHADERPROC, glCreateShader); if (f == NULL) { return (GLuint)0; } return f(a0); }
+static PFNGLDELETEPROGRAMPROC* g_lazySlot_glDeleteProgram = NULL;
+static void APIENTRY lazy_glDeleteProgram(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETEPROGRAMPROC, glDeleteProgram); if (f == NULL) { return; } return f(a0); }
+static PFNGLDELETESHADERPROC* g_lazySlot_glDeleteShader = NULL;
+static void APIENTRY lazy_glDeleteShader(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETESHADERPROC, glDeleteShader); if (f == NULL) { return; } return f(a0); }
+static PFNGLDETACHSHADERPROC* g_lazySlot_glDetachShader = NULL;
+static void APIENTRY lazy_glDetachShader(GLuint a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDETACHSHADERPROC, glDetachShader); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC* g_lazySlot_glDisableVertexAttribArray = NULL;
+static void APIENTRY lazy_glDisableVertexAttribArray(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray); if (f == NULL) { return; } return f(a0); }
+static PFNGLENABLEVERTEXATTRIBARRAYPROC* g_lazySlot_glEnableVertexAttribArray = NULL;
+static void APIENTRY lazy_glEnableVertexAttribArray(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray); if (f == NULL) { return; } return f(a0); }
+static PFNGLGETACTIVEATTRIBPROC* g_lazySlot_glGetActiveAttrib = NULL;
+static void APIENTRY lazy_glGetActiveAttrib(GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint* a4, GLenum* a5, GLchar* a6) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLGETACTIVEUNIFORMPROC* g_lazySlot_glGetActiveUniform = NULL;
+static void APIENTRY lazy_glGetActiveUniform(GLuint a0, GLuint a1, GLsizei a2, GLsizei* a3, GLint* a4, GLenum* a5, GLchar* a6) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6); }
+static PFNGLGETATTACHEDSHADERSPROC* g_lazySlot_glGetAttachedShaders = NULL;
+static void APIENTRY lazy_glGetAttachedShaders(GLuint a0, GLsizei a1, GLsizei* a2, GLuint* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETATTACHEDSHADERSPROC, glGetAttachedShaders); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETATTRIBLOCATIONPROC* g_lazySlot_glGetAttribLocation = NULL;
+static GLint APIENTRY lazy_glGetAttribLocation(GLuint a0, const GLchar* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation); if (f == NULL) { return (GLint)0; } return f(a0, a1); }
+static PFNGLGETPROGRAMIVPROC* g_lazySlot_glGetProgramiv = NULL;
+static void APIENTRY lazy_glGetProgramiv(GLuint a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETPROGRAMIVPROC, glGetProgramiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETPROGRAMINFOLOGPROC* g_lazySlot_glGetProgramInfoLog = NULL;
+static void APIENTRY lazy_glGetProgramInfoLog(GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETPROGRAMINFOLOGPROC, glGetProgramInfoLog); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETSHADERIVPROC* g_lazySlot_glGetShaderiv = NULL;
+static void APIENTRY lazy_glGetShaderiv(GLuint a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETSHADERIVPROC, glGetShaderiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETSHADERINFOLOGPROC* g_lazySlot_glGetShaderInfoLog = NULL;
+static void APIENTRY lazy_glGetShaderInfoLog(GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETSHADERINFOLOGPROC, glGetShaderInfoLog); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETSHADERSOURCEPROC* g_lazySlot_glGetShaderSource = NULL;
+static void APIENTRY lazy_glGetShaderSource(GLuint a0, GLsizei a1, GLsizei* a2, GLchar* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETSHADERSOURCEPROC, glGetShaderSource); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETUNIFORMLOCATIONPROC* g_lazySlot_glGetUniformLocation = NULL;
+static GLint APIENTRY lazy_glGetUniformLocation(GLuint a0, const GLchar* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation); if (f == NULL) { return (GLint)0; } return f(a0, a1); }
+static PFNGLGETUNIFORMFVPROC* g_lazySlot_glGetUniformfv = NULL;
+static void APIENTRY lazy_glGetUniformfv(GLuint a0, GLint a1, GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETUNIFORMFVPROC, glGetUniformfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETUNIFORMIVPROC* g_lazySlot_glGetUniformiv = NULL;
+static void APIENTRY lazy_glGetUniformiv(GLuint a0, GLint a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETUNIFORMIVPROC, glGetUniformiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETVERTEXATTRIBDVPROC* g_lazySlot_glGetVertexAttribdv = NULL;
+static void APIENTRY lazy_glGetVertexAttribdv(GLuint a0, GLenum a1, GLdouble* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETVERTEXATTRIBDVPROC, glGetVertexAttribdv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETVERTEXATTRIBFVPROC* g_lazySlot_glGetVertexAttribfv = NULL;
+static void APIENTRY lazy_glGetVertexAttribfv(GLuint a0, GLenum a1, GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETVERTEXATTRIBFVPROC, glGetVertexAttribfv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETVERTEXATTRIBIVPROC* g_lazySlot_glGetVertexAttribiv = NULL;
+static void APIENTRY lazy_glGetVertexAttribiv(GLuint a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETVERTEXATTRIBIVPROC, glGetVertexAttribiv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETVERTEXATTRIBPOINTERVPROC* g_lazySlot_glGetVertexAttribPointerv = NULL;
+static void APIENTRY lazy_glGetVertexAttribPointerv(GLuint a0, GLenum a1, void** a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETVERTEXATTRIBPOINTERVPROC, glGetVertexAttribPointerv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLISPROGRAMPROC* g_lazySlot_glIsProgram = NULL;
+static GLboolean APIENTRY lazy_glIsProgram(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISPROGRAMPROC, glIsProgram); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLISSHADERPROC* g_lazySlot_glIsShader = NULL;
+static GLboolean APIENTRY lazy_glIsShader(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISSHADERPROC, glIsShader); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLLINKPROGRAMPROC* g_lazySlot_glLinkProgram = NULL;
+static void APIENTRY lazy_glLinkProgram(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLLINKPROGRAMPROC, glLinkProgram); if (f == NULL) { return; } return f(a0); }
+static PFNGLSHADERSOURCEPROC* g_lazySlot_glShaderSource = NULL;
+static void APIENTRY lazy_glShaderSource(GLuint a0, GLsizei a1, const GLchar** a2, const GLint* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLSHADERSOURCEPROC, glShaderSource); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLUSEPROGRAMPROC* g_lazySlot_glUseProgram = NULL;
+static void APIENTRY lazy_glUseProgram(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUSEPROGRAMPROC, glUseProgram); if (f == NULL) { return; } return f(a0); }
+static PFNGLUNIFORM1FPROC* g_lazySlot_glUniform1f = NULL;
+static void APIENTRY lazy_glUniform1f(GLint a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM1FPROC, glUniform1f); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLUNIFORM2FPROC* g_lazySlot_glUniform2f = NULL;
+static void APIENTRY lazy_glUniform2f(GLint a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM2FPROC, glUniform2f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLUNIFORM3FPROC* g_lazySlot_glUniform3f = NULL;
+static void APIENTRY lazy_glUniform3f(GLint a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM3FPROC, glUniform3f); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLUNIFORM4FPROC* g_lazySlot_glUniform4f = NULL;
+static void APIENTRY lazy_glUniform4f(GLint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM4FPROC, glUniform4f); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLUNIFORM1IPROC* g_lazySlot_glUniform1i = NULL;
+static void APIENTRY lazy_glUniform1i(GLint a0, GLint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM1IPROC, glUniform1i); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLUNIFORM2IPROC* g_lazySlot_glUniform2i = NULL;
+static void APIENTRY lazy_glUniform2i(GLint a0, GLint a1, GLint a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM2IPROC, glUniform2i); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLUNIFORM3IPROC* g_lazySlot_glUniform3i = NULL;
+static void APIENTRY lazy_glUniform3i(GLint a0, GLint a1, GLint a2, GLint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM3IPROC, glUniform3i); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLUNIFORM4IPROC* g_lazySlot_glUniform4i = NULL;
+static void APIENTRY lazy_glUniform4i(GLint a0, GLint a1, GLint a2, GLint a3, GLint a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM4IPROC, glUniform4i); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLUNIFORM1FVPROC* g_lazySlot_glUniform1fv = NULL;
+static void APIENTRY lazy_glUniform1fv(GLint a0, GLsizei a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM1FVPROC, glUniform1fv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLUNIFORM2FVPROC* g_lazySlot_glUniform2fv = NULL;
+static void APIENTRY lazy_glUniform2fv(GLint a0, GLsizei a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM2FVPROC, glUniform2fv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLUNIFORM3FVPROC* g_lazySlot_glUniform3fv = NULL;
+static void APIENTRY lazy_glUniform3fv(GLint a0, GLsizei a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM3FVPROC, glUniform3fv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLUNIFORM4FVPROC* g_lazySlot_glUniform4fv = NULL;
+static void APIENTRY lazy_glUniform4fv(GLint a0, GLsizei a1, const GLfloat* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM4FVPROC, glUniform4fv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLUNIFORM1IVPROC* g_lazySlot_glUniform1iv = NULL;
+static void APIENTRY lazy_glUniform1iv(GLint a0, GLsizei a1, const GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM1IVPROC, glUniform1iv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLUNIFORM2IVPROC* g_lazySlot_glUniform2iv = NULL;
+static void APIENTRY lazy_glUniform2iv(GLint a0, GLsizei a1, const GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM2IVPROC, glUniform2iv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLUNIFORM3IVPROC* g_lazySlot_glUniform3iv = NULL;
+static void APIENTRY lazy_glUniform3iv(GLint a0, GLsizei a1, const GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM3IVPROC, glUniform3iv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLUNIFORM4IVPROC* g_lazySlot_glUniform4iv = NULL;
+static void APIENTRY lazy_glUniform4iv(GLint a0, GLsizei a1, const GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORM4IVPROC, glUniform4iv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLUNIFORMMATRIX2FVPROC* g_lazySlot_glUniformMatrix2fv = NULL;
+static void APIENTRY lazy_glUniformMatrix2fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORMMATRIX2FVPROC, glUniformMatrix2fv); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLUNIFORMMATRIX3FVPROC* g_lazySlot_glUniformMatrix3fv = NULL;
+static void APIENTRY lazy_glUniformMatrix3fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORMMATRIX3FVPROC, glUniformMatrix3fv); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLUNIFORMMATRIX4FVPROC* g_lazySlot_glUniformMatrix4fv = NULL;
+static void APIENTRY lazy_glUniformMatrix4fv(GLint a0, GLsizei a1, GLboolean a2, const GLfloat* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLVALIDATEPROGRAMPROC* g_lazySlot_glValidateProgram = NULL;
+static void APIENTRY lazy_glValidateProgram(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVALIDATEPROGRAMPROC, glValidateProgram); if (f == NULL) { return; } return f(a0); }
+static PFNGLVERTEXATTRIB1DPROC* g_lazySlot_glVertexAttrib1d = NULL;
+static void APIENTRY lazy_glVertexAttrib1d(GLuint a0, GLdouble a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB1DPROC, glVertexAttrib1d); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB1DVPROC* g_lazySlot_glVertexAttrib1dv = NULL;
+static void APIENTRY lazy_glVertexAttrib1dv(GLuint a0, const GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB1DVPROC, glVertexAttrib1dv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB1FPROC* g_lazySlot_glVertexAttrib1f = NULL;
+static void APIENTRY lazy_glVertexAttrib1f(GLuint a0, GLfloat a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB1FPROC, glVertexAttrib1f); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB1FVPROC* g_lazySlot_glVertexAttrib1fv = NULL;
+static void APIENTRY lazy_glVertexAttrib1fv(GLuint a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB1FVPROC, glVertexAttrib1fv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB1SPROC* g_lazySlot_glVertexAttrib1s = NULL;
+static void APIENTRY lazy_glVertexAttrib1s(GLuint a0, GLshort a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB1SPROC, glVertexAttrib1s); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB1SVPROC* g_lazySlot_glVertexAttrib1sv = NULL;
+static void APIENTRY lazy_glVertexAttrib1sv(GLuint a0, const GLshort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB1SVPROC, glVertexAttrib1sv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB2DPROC* g_lazySlot_glVertexAttrib2d = NULL;
+static void APIENTRY lazy_glVertexAttrib2d(GLuint a0, GLdouble a1, GLdouble a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB2DPROC, glVertexAttrib2d); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLVERTEXATTRIB2DVPROC* g_lazySlot_glVertexAttrib2dv = NULL;
+static void APIENTRY lazy_glVertexAttrib2dv(GLuint a0, const GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB2DVPROC, glVertexAttrib2dv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB2FPROC* g_lazySlot_glVertexAttrib2f = NULL;
+static void APIENTRY lazy_glVertexAttrib2f(GLuint a0, GLfloat a1, GLfloat a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB2FPROC, glVertexAttrib2f); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLVERTEXATTRIB2FVPROC* g_lazySlot_glVertexAttrib2fv = NULL;
+static void APIENTRY lazy_glVertexAttrib2fv(GLuint a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB2SPROC* g_lazySlot_glVertexAttrib2s = NULL;
+static void APIENTRY lazy_glVertexAttrib2s(GLuint a0, GLshort a1, GLshort a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB2SPROC, glVertexAttrib2s); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLVERTEXATTRIB2SVPROC* g_lazySlot_glVertexAttrib2sv = NULL;
+static void APIENTRY lazy_glVertexAttrib2sv(GLuint a0, const GLshort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB2SVPROC, glVertexAttrib2sv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB3DPROC* g_lazySlot_glVertexAttrib3d = NULL;
+static void APIENTRY lazy_glVertexAttrib3d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB3DPROC, glVertexAttrib3d); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLVERTEXATTRIB3DVPROC* g_lazySlot_glVertexAttrib3dv = NULL;
+static void APIENTRY lazy_glVertexAttrib3dv(GLuint a0, const GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB3DVPROC, glVertexAttrib3dv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB3FPROC* g_lazySlot_glVertexAttrib3f = NULL;
+static void APIENTRY lazy_glVertexAttrib3f(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB3FPROC, glVertexAttrib3f); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLVERTEXATTRIB3FVPROC* g_lazySlot_glVertexAttrib3fv = NULL;
+static void APIENTRY lazy_glVertexAttrib3fv(GLuint a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB3SPROC* g_lazySlot_glVertexAttrib3s = NULL;
+static void APIENTRY lazy_glVertexAttrib3s(GLuint a0, GLshort a1, GLshort a2, GLshort a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB3SPROC, glVertexAttrib3s); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLVERTEXATTRIB3SVPROC* g_lazySlot_glVertexAttrib3sv = NULL;
+static void APIENTRY lazy_glVertexAttrib3sv(GLuint a0, const GLshort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB3SVPROC, glVertexAttrib3sv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4NBVPROC* g_lazySlot_glVertexAttrib4Nbv = NULL;
+static void APIENTRY lazy_glVertexAttrib4Nbv(GLuint a0, const GLbyte* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NBVPROC, glVertexAttrib4Nbv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4NIVPROC* g_lazySlot_glVertexAttrib4Niv = NULL;
+static void APIENTRY lazy_glVertexAttrib4Niv(GLuint a0, const GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NIVPROC, glVertexAttrib4Niv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4NSVPROC* g_lazySlot_glVertexAttrib4Nsv = NULL;
+static void APIENTRY lazy_glVertexAttrib4Nsv(GLuint a0, const GLshort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NSVPROC, glVertexAttrib4Nsv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4NUBPROC* g_lazySlot_glVertexAttrib4Nub = NULL;
+static void APIENTRY lazy_glVertexAttrib4Nub(GLuint a0, GLubyte a1, GLubyte a2, GLubyte a3, GLubyte a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NUBPROC, glVertexAttrib4Nub); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLVERTEXATTRIB4NUBVPROC* g_lazySlot_glVertexAttrib4Nubv = NULL;
+static void APIENTRY lazy_glVertexAttrib4Nubv(GLuint a0, const GLubyte* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NUBVPROC, glVertexAttrib4Nubv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4NUIVPROC* g_lazySlot_glVertexAttrib4Nuiv = NULL;
+static void APIENTRY lazy_glVertexAttrib4Nuiv(GLuint a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NUIVPROC, glVertexAttrib4Nuiv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4NUSVPROC* g_lazySlot_glVertexAttrib4Nusv = NULL;
+static void APIENTRY lazy_glVertexAttrib4Nusv(GLuint a0, const GLushort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4NUSVPROC, glVertexAttrib4Nusv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4BVPROC* g_lazySlot_glVertexAttrib4bv = NULL;
+static void APIENTRY lazy_glVertexAttrib4bv(GLuint a0, const GLbyte* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4BVPROC, glVertexAttrib4bv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4DPROC* g_lazySlot_glVertexAttrib4d = NULL;
+static void APIENTRY lazy_glVertexAttrib4d(GLuint a0, GLdouble a1, GLdouble a2, GLdouble a3, GLdouble a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4DPROC, glVertexAttrib4d); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLVERTEXATTRIB4DVPROC* g_lazySlot_glVertexAttrib4dv = NULL;
+static void APIENTRY lazy_glVertexAttrib4dv(GLuint a0, const GLdouble* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4DVPROC, glVertexAttrib4dv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4FPROC* g_lazySlot_glVertexAttrib4f = NULL;
+static void APIENTRY lazy_glVertexAttrib4f(GLuint a0, GLfloat a1, GLfloat a2, GLfloat a3, GLfloat a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4FPROC, glVertexAttrib4f); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLVERTEXATTRIB4FVPROC* g_lazySlot_glVertexAttrib4fv = NULL;
+static void APIENTRY lazy_glVertexAttrib4fv(GLuint a0, const GLfloat* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4IVPROC* g_lazySlot_glVertexAttrib4iv = NULL;
+static void APIENTRY lazy_glVertexAttrib4iv(GLuint a0, const GLint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4IVPROC, glVertexAttrib4iv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4SPROC* g_lazySlot_glVertexAttrib4s = NULL;
+static void APIENTRY lazy_glVertexAttrib4s(GLuint a0, GLshort a1, GLshort a2, GLshort a3, GLshort a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4SPROC, glVertexAttrib4s); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLVERTEXATTRIB4SVPROC* g_lazySlot_glVertexAttrib4sv = NULL;
+static void APIENTRY lazy_glVertexAttrib4sv(GLuint a0, const GLshort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4SVPROC, glVertexAttrib4sv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4UBVPROC* g_lazySlot_glVertexAttrib4ubv = NULL;
+static void APIENTRY lazy_glVertexAttrib4ubv(GLuint a0, const GLubyte* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4UBVPROC, glVertexAttrib4ubv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4UIVPROC* g_lazySlot_glVertexAttrib4uiv = NULL;
+static void APIENTRY lazy_glVertexAttrib4uiv(GLuint a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4UIVPROC, glVertexAttrib4uiv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIB4USVPROC* g_lazySlot_glVertexAttrib4usv = NULL;
+static void APIENTRY lazy_glVertexAttrib4usv(GLuint a0, const GLushort* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIB4USVPROC, glVertexAttrib4usv); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLVERTEXATTRIBPOINTERPROC* g_lazySlot_glVertexAttribPointer = NULL;
+static void APIENTRY lazy_glVertexAttribPointer(GLuint a0, GLint a1, GLenum a2, GLboolean a3, GLsizei a4, const void* a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLBINDBUFFERARBPROC* g_lazySlot_glBindBufferARB = NULL;
+static void APIENTRY lazy_glBindBufferARB(GLenum a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBINDBUFFERARBPROC, glBindBufferARB); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLDELETEBUFFERSARBPROC* g_lazySlot_glDeleteBuffersARB = NULL;
+static void APIENTRY lazy_glDeleteBuffersARB(GLsizei a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETEBUFFERSARBPROC, glDeleteBuffersARB); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGENBUFFERSARBPROC* g_lazySlot_glGenBuffersARB = NULL;
+static void APIENTRY lazy_glGenBuffersARB(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENBUFFERSARBPROC, glGenBuffersARB); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLISBUFFERARBPROC* g_lazySlot_glIsBufferARB = NULL;
+static GLboolean APIENTRY lazy_glIsBufferARB(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISBUFFERARBPROC, glIsBufferARB); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLBUFFERDATAARBPROC* g_lazySlot_glBufferDataARB = NULL;
+static void APIENTRY lazy_glBufferDataARB(GLenum a0, GLsizeiptrARB a1, const void* a2, GLenum a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBUFFERDATAARBPROC, glBufferDataARB); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLBUFFERSUBDATAARBPROC* g_lazySlot_glBufferSubDataARB = NULL;
+static void APIENTRY lazy_glBufferSubDataARB(GLenum a0, GLintptrARB a1, GLsizeiptrARB a2, const void* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBUFFERSUBDATAARBPROC, glBufferSubDataARB); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETBUFFERSUBDATAARBPROC* g_lazySlot_glGetBufferSubDataARB = NULL;
+static void APIENTRY lazy_glGetBufferSubDataARB(GLenum a0, GLintptrARB a1, GLsizeiptrARB a2, void* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETBUFFERSUBDATAARBPROC, glGetBufferSubDataARB); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLMAPBUFFERARBPROC* g_lazySlot_glMapBufferARB = NULL;
+static void* APIENTRY lazy_glMapBufferARB(GLenum a0, GLenum a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLMAPBUFFERARBPROC, glMapBufferARB); if (f == NULL) { return (void*)0; } return f(a0, a1); }
+static PFNGLUNMAPBUFFERARBPROC* g_lazySlot_glUnmapBufferARB = NULL;
+static GLboolean APIENTRY lazy_glUnmapBufferARB(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLUNMAPBUFFERARBPROC, glUnmapBufferARB); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLGETBUFFERPARAMETERIVARBPROC* g_lazySlot_glGetBufferParameterivARB = NULL;
+static void APIENTRY lazy_glGetBufferParameterivARB(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETBUFFERPARAMETERIVARBPROC, glGetBufferParameterivARB); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLGETBUFFERPOINTERVARBPROC* g_lazySlot_glGetBufferPointervARB = NULL;
+static void APIENTRY lazy_glGetBufferPointervARB(GLenum a0, GLenum a1, void** a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETBUFFERPOINTERVARBPROC, glGetBufferPointervARB); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLBINDVERTEXARRAYPROC* g_lazySlot_glBindVertexArray = NULL;
+static void APIENTRY lazy_glBindVertexArray(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray); if (f == NULL) { return; } return f(a0); }
+static PFNGLDELETEVERTEXARRAYSPROC* g_lazySlot_glDeleteVertexArrays = NULL;
+static void APIENTRY lazy_glDeleteVertexArrays(GLsizei a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGENVERTEXARRAYSPROC* g_lazySlot_glGenVertexArrays = NULL;
+static void APIENTRY lazy_glGenVertexArrays(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLISVERTEXARRAYPROC* g_lazySlot_glIsVertexArray = NULL;
+static GLboolean APIENTRY lazy_glIsVertexArray(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISVERTEXARRAYPROC, glIsVertexArray); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLISRENDERBUFFERPROC* g_lazySlot_glIsRenderbuffer = NULL;
+static GLboolean APIENTRY lazy_glIsRenderbuffer(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISRENDERBUFFERPROC, glIsRenderbuffer); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLBINDRENDERBUFFERPROC* g_lazySlot_glBindRenderbuffer = NULL;
+static void APIENTRY lazy_glBindRenderbuffer(GLenum a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLDELETERENDERBUFFERSPROC* g_lazySlot_glDeleteRenderbuffers = NULL;
+static void APIENTRY lazy_glDeleteRenderbuffers(GLsizei a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGENRENDERBUFFERSPROC* g_lazySlot_glGenRenderbuffers = NULL;
+static void APIENTRY lazy_glGenRenderbuffers(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLRENDERBUFFERSTORAGEPROC* g_lazySlot_glRenderbufferStorage = NULL;
+static void APIENTRY lazy_glRenderbufferStorage(GLenum a0, GLenum a1, GLsizei a2, GLsizei a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC* g_lazySlot_glGetRenderbufferParameteriv = NULL;
+static void APIENTRY lazy_glGetRenderbufferParameteriv(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETRENDERBUFFERPARAMETERIVPROC, glGetRenderbufferParameteriv); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLISFRAMEBUFFERPROC* g_lazySlot_glIsFramebuffer = NULL;
+static GLboolean APIENTRY lazy_glIsFramebuffer(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISFRAMEBUFFERPROC, glIsFramebuffer); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLBINDFRAMEBUFFERPROC* g_lazySlot_glBindFramebuffer = NULL;
+static void APIENTRY lazy_glBindFramebuffer(GLenum a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLDELETEFRAMEBUFFERSPROC* g_lazySlot_glDeleteFramebuffers = NULL;
+static void APIENTRY lazy_glDeleteFramebuffers(GLsizei a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGENFRAMEBUFFERSPROC* g_lazySlot_glGenFramebuffers = NULL;
+static void APIENTRY lazy_glGenFramebuffers(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC* g_lazySlot_glCheckFramebufferStatus = NULL;
+static GLenum APIENTRY lazy_glCheckFramebufferStatus(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCHECKFRAMEBUFFERSTATUSPROC, glCheckFramebufferStatus); if (f == NULL) { return (GLenum)0; } return f(a0); }
+static PFNGLFRAMEBUFFERTEXTURE1DPROC* g_lazySlot_glFramebufferTexture1D = NULL;
+static void APIENTRY lazy_glFramebufferTexture1D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE1DPROC, glFramebufferTexture1D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLFRAMEBUFFERTEXTURE2DPROC* g_lazySlot_glFramebufferTexture2D = NULL;
+static void APIENTRY lazy_glFramebufferTexture2D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLFRAMEBUFFERTEXTURE3DPROC* g_lazySlot_glFramebufferTexture3D = NULL;
+static void APIENTRY lazy_glFramebufferTexture3D(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE3DPROC, glFramebufferTexture3D); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC* g_lazySlot_glFramebufferRenderbuffer = NULL;
+static void APIENTRY lazy_glFramebufferRenderbuffer(GLenum a0, GLenum a1, GLenum a2, GLuint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC* g_lazySlot_glGetFramebufferAttachmentParameteriv = NULL;
+static void APIENTRY lazy_glGetFramebufferAttachmentParameteriv(GLenum a0, GLenum a1, GLenum a2, GLint* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetFramebufferAttachmentParameteriv); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGENERATEMIPMAPPROC* g_lazySlot_glGenerateMipmap = NULL;
+static void APIENTRY lazy_glGenerateMipmap(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap); if (f == NULL) { return; } return f(a0); }
+static PFNGLBLITFRAMEBUFFERPROC* g_lazySlot_glBlitFramebuffer = NULL;
+static void APIENTRY lazy_glBlitFramebuffer(GLint a0, GLint a1, GLint a2, GLint a3, GLint a4, GLint a5, GLint a6, GLint a7, GLbitfield a8, GLenum a9) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9); }
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC* g_lazySlot_glRenderbufferStorageMultisample = NULL;
+static void APIENTRY lazy_glRenderbufferStorageMultisample(GLenum a0, GLsizei a1, GLenum a2, GLsizei a3, GLsizei a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC* g_lazySlot_glFramebufferTextureLayer = NULL;
+static void APIENTRY lazy_glFramebufferTextureLayer(GLenum a0, GLenum a1, GLuint a2, GLint a3, GLint a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLISRENDERBUFFEREXTPROC* g_lazySlot_glIsRenderbufferEXT = NULL;
+static GLboolean APIENTRY lazy_glIsRenderbufferEXT(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISRENDERBUFFEREXTPROC, glIsRenderbufferEXT); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLBINDRENDERBUFFEREXTPROC* g_lazySlot_glBindRenderbufferEXT = NULL;
+static void APIENTRY lazy_glBindRenderbufferEXT(GLenum a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBINDRENDERBUFFEREXTPROC, glBindRenderbufferEXT); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLDELETERENDERBUFFERSEXTPROC* g_lazySlot_glDeleteRenderbuffersEXT = NULL;
+static void APIENTRY lazy_glDeleteRenderbuffersEXT(GLsizei a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETERENDERBUFFERSEXTPROC, glDeleteRenderbuffersEXT); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGENRENDERBUFFERSEXTPROC* g_lazySlot_glGenRenderbuffersEXT = NULL;
+static void APIENTRY lazy_glGenRenderbuffersEXT(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENRENDERBUFFERSEXTPROC, glGenRenderbuffersEXT); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLRENDERBUFFERSTORAGEEXTPROC* g_lazySlot_glRenderbufferStorageEXT = NULL;
+static void APIENTRY lazy_glRenderbufferStorageEXT(GLenum a0, GLenum a1, GLsizei a2, GLsizei a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLRENDERBUFFERSTORAGEEXTPROC, glRenderbufferStorageEXT); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC* g_lazySlot_glGetRenderbufferParameterivEXT = NULL;
+static void APIENTRY lazy_glGetRenderbufferParameterivEXT(GLenum a0, GLenum a1, GLint* a2) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC, glGetRenderbufferParameterivEXT); if (f == NULL) { return; } return f(a0, a1, a2); }
+static PFNGLISFRAMEBUFFEREXTPROC* g_lazySlot_glIsFramebufferEXT = NULL;
+static GLboolean APIENTRY lazy_glIsFramebufferEXT(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISFRAMEBUFFEREXTPROC, glIsFramebufferEXT); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+static PFNGLBINDFRAMEBUFFEREXTPROC* g_lazySlot_glBindFramebufferEXT = NULL;
+static void APIENTRY lazy_glBindFramebufferEXT(GLenum a0, GLuint a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBINDFRAMEBUFFEREXTPROC, glBindFramebufferEXT); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLDELETEFRAMEBUFFERSEXTPROC* g_lazySlot_glDeleteFramebuffersEXT = NULL;
+static void APIENTRY lazy_glDeleteFramebuffersEXT(GLsizei a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETEFRAMEBUFFERSEXTPROC, glDeleteFramebuffersEXT); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGENFRAMEBUFFERSEXTPROC* g_lazySlot_glGenFramebuffersEXT = NULL;
+static void APIENTRY lazy_glGenFramebuffersEXT(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENFRAMEBUFFERSEXTPROC, glGenFramebuffersEXT); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC* g_lazySlot_glCheckFramebufferStatusEXT = NULL;
+static GLenum APIENTRY lazy_glCheckFramebufferStatusEXT(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC, glCheckFramebufferStatusEXT); if (f == NULL) { return (GLenum)0; } return f(a0); }
+static PFNGLFRAMEBUFFERTEXTURE1DEXTPROC* g_lazySlot_glFramebufferTexture1DEXT = NULL;
+static void APIENTRY lazy_glFramebufferTexture1DEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE1DEXTPROC, glFramebufferTexture1DEXT); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLFRAMEBUFFERTEXTURE2DEXTPROC* g_lazySlot_glFramebufferTexture2DEXT = NULL;
+static void APIENTRY lazy_glFramebufferTexture2DEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE2DEXTPROC, glFramebufferTexture2DEXT); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4); }
+static PFNGLFRAMEBUFFERTEXTURE3DEXTPROC* g_lazySlot_glFramebufferTexture3DEXT = NULL;
+static void APIENTRY lazy_glFramebufferTexture3DEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3, GLint a4, GLint a5) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRAMEBUFFERTEXTURE3DEXTPROC, glFramebufferTexture3DEXT); if (f == NULL) { return; } return f(a0, a1, a2, a3, a4, a5); }
+static PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC* g_lazySlot_glFramebufferRenderbufferEXT = NULL;
+static void APIENTRY lazy_glFramebufferRenderbufferEXT(GLenum a0, GLenum a1, GLenum a2, GLuint a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC, glFramebufferRenderbufferEXT); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC* g_lazySlot_glGetFramebufferAttachmentParameterivEXT = NULL;
+static void APIENTRY lazy_glGetFramebufferAttachmentParameterivEXT(GLenum a0, GLenum a1, GLenum a2, GLint* a3) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC, glGetFramebufferAttachmentParameterivEXT); if (f == NULL) { return; } return f(a0, a1, a2, a3); }
+static PFNGLGENERATEMIPMAPEXTPROC* g_lazySlot_glGenerateMipmapEXT = NULL;
+static void APIENTRY lazy_glGenerateMipmapEXT(GLenum a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENERATEMIPMAPEXTPROC, glGenerateMipmapEXT); if (f == NULL) { return; } return f(a0); }
+static PFNGLBINDVERTEXARRAYAPPLEPROC* g_lazySlot_glBindVertexArrayAPPLE = NULL;
+static void APIENTRY lazy_glBindVertexArrayAPPLE(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLBINDVERTEXARRAYAPPLEPROC, glBindVertexArrayAPPLE); if (f == NULL) { return; } return f(a0); }
+static PFNGLDELETEVERTEXARRAYSAPPLEPROC* g_lazySlot_glDeleteVertexArraysAPPLE = NULL;
+static void APIENTRY lazy_glDeleteVertexArraysAPPLE(GLsizei a0, const GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLDELETEVERTEXARRAYSAPPLEPROC, glDeleteVertexArraysAPPLE); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLGENVERTEXARRAYSAPPLEPROC* g_lazySlot_glGenVertexArraysAPPLE = NULL;
+static void APIENTRY lazy_glGenVertexArraysAPPLE(GLsizei a0, GLuint* a1) { OFX_OSMESA_LAZY_RESOLVE(PFNGLGENVERTEXARRAYSAPPLEPROC, glGenVertexArraysAPPLE); if (f == NULL) { return; } return f(a0, a1); }
+static PFNGLISVERTEXARRAYAPPLEPROC* g_lazySlot_glIsVertexArrayAPPLE = NULL;
+static GLboolean APIENTRY lazy_glIsVertexArrayAPPLE(GLuint a0) { OFX_OSMESA_LAZY_RESOLVE(PFNGLISVERTEXARRAYAPPLEPROC, glIsVertexArrayAPPLE); if (f == NULL) { return (GLboolean)0; } return f(a0); }
+#endif // defined(HAVE_OSMESA) && defined(OFX_OPENGL_LAZY_LOAD)
+
 template <>
 void
 OSGLFunctions<false>::load_functions()
 {
 #ifdef HAVE_OSMESA
+#ifdef OFX_OPENGL_LAZY_LOAD
+    OFX_OSMESA_LAZY_INIT(glCullFace);
+    OFX_OSMESA_LAZY_INIT(glFrontFace);
+    OFX_OSMESA_LAZY_INIT(glHint);
+    OFX_OSMESA_LAZY_INIT(glLineWidth);
+    OFX_OSMESA_LAZY_INIT(glPointSize);
+    OFX_OSMESA_LAZY_INIT(glPolygonMode);
+    OFX_OSMESA_LAZY_INIT(glScissor);
+    OFX_OSMESA_LAZY_INIT(glTexParameterf);
+    OFX_OSMESA_LAZY_INIT(glTexParameterfv);
+    OFX_OSMESA_LAZY_INIT(glTexParameteri);
+    OFX_OSMESA_LAZY_INIT(glTexParameteriv);
+    OFX_OSMESA_LAZY_INIT(glTexImage1D);
+    OFX_OSMESA_LAZY_INIT(glTexImage2D);
+    OFX_OSMESA_LAZY_INIT(glDrawBuffer);
+    OFX_OSMESA_LAZY_INIT(glClear);
+    OFX_OSMESA_LAZY_INIT(glClearColor);
+    OFX_OSMESA_LAZY_INIT(glClearStencil);
+    OFX_OSMESA_LAZY_INIT(glClearDepth);
+    OFX_OSMESA_LAZY_INIT(glStencilMask);
+    OFX_OSMESA_LAZY_INIT(glColorMask);
+    OFX_OSMESA_LAZY_INIT(glDepthMask);
+    OFX_OSMESA_LAZY_INIT(glDisable);
+    OFX_OSMESA_LAZY_INIT(glEnable);
+    OFX_OSMESA_LAZY_INIT(glFinish);
+    OFX_OSMESA_LAZY_INIT(glFlush);
+    OFX_OSMESA_LAZY_INIT(glBlendFunc);
+    OFX_OSMESA_LAZY_INIT(glLogicOp);
+    OFX_OSMESA_LAZY_INIT(glStencilFunc);
+    OFX_OSMESA_LAZY_INIT(glStencilOp);
+    OFX_OSMESA_LAZY_INIT(glDepthFunc);
+    OFX_OSMESA_LAZY_INIT(glPixelStoref);
+    OFX_OSMESA_LAZY_INIT(glPixelStorei);
+    OFX_OSMESA_LAZY_INIT(glReadBuffer);
+    OFX_OSMESA_LAZY_INIT(glReadPixels);
+    OFX_OSMESA_LAZY_INIT(glGetBooleanv);
+    OFX_OSMESA_LAZY_INIT(glGetDoublev);
+    OFX_OSMESA_LAZY_INIT(glGetError);
+    OFX_OSMESA_LAZY_INIT(glGetFloatv);
+    OFX_OSMESA_LAZY_INIT(glGetIntegerv);
+    OFX_OSMESA_LAZY_INIT(glGetString);
+    OFX_OSMESA_LAZY_INIT(glGetTexImage);
+    OFX_OSMESA_LAZY_INIT(glGetTexParameterfv);
+    OFX_OSMESA_LAZY_INIT(glGetTexParameteriv);
+    OFX_OSMESA_LAZY_INIT(glGetTexLevelParameterfv);
+    OFX_OSMESA_LAZY_INIT(glGetTexLevelParameteriv);
+    OFX_OSMESA_LAZY_INIT(glIsEnabled);
+    OFX_OSMESA_LAZY_INIT(glDepthRange);
+    OFX_OSMESA_LAZY_INIT(glViewport);
+    OFX_OSMESA_LAZY_INIT(glNewList);
+    OFX_OSMESA_LAZY_INIT(glEndList);
+    OFX_OSMESA_LAZY_INIT(glCallList);
+    OFX_OSMESA_LAZY_INIT(glCallLists);
+    OFX_OSMESA_LAZY_INIT(glDeleteLists);
+    OFX_OSMESA_LAZY_INIT(glGenLists);
+    OFX_OSMESA_LAZY_INIT(glListBase);
+    OFX_OSMESA_LAZY_INIT(glBegin);
+    OFX_OSMESA_LAZY_INIT(glBitmap);
+    OFX_OSMESA_LAZY_INIT(glColor3b);
+    OFX_OSMESA_LAZY_INIT(glColor3bv);
+    OFX_OSMESA_LAZY_INIT(glColor3d);
+    OFX_OSMESA_LAZY_INIT(glColor3dv);
+    OFX_OSMESA_LAZY_INIT(glColor3f);
+    OFX_OSMESA_LAZY_INIT(glColor3fv);
+    OFX_OSMESA_LAZY_INIT(glColor3i);
+    OFX_OSMESA_LAZY_INIT(glColor3iv);
+    OFX_OSMESA_LAZY_INIT(glColor3s);
+    OFX_OSMESA_LAZY_INIT(glColor3sv);
+    OFX_OSMESA_LAZY_INIT(glColor3ub);
+    OFX_OSMESA_LAZY_INIT(glColor3ubv);
+    OFX_OSMESA_LAZY_INIT(glColor3ui);
+    OFX_OSMESA_LAZY_INIT(glColor3uiv);
+    OFX_OSMESA_LAZY_INIT(glColor3us);
+    OFX_OSMESA_LAZY_INIT(glColor3usv);
+    OFX_OSMESA_LAZY_INIT(glColor4b);
+    OFX_OSMESA_LAZY_INIT(glColor4bv);
+    OFX_OSMESA_LAZY_INIT(glColor4d);
+    OFX_OSMESA_LAZY_INIT(glColor4dv);
+    OFX_OSMESA_LAZY_INIT(glColor4f);
+    OFX_OSMESA_LAZY_INIT(glColor4fv);
+    OFX_OSMESA_LAZY_INIT(glColor4i);
+    OFX_OSMESA_LAZY_INIT(glColor4iv);
+    OFX_OSMESA_LAZY_INIT(glColor4s);
+    OFX_OSMESA_LAZY_INIT(glColor4sv);
+    OFX_OSMESA_LAZY_INIT(glColor4ub);
+    OFX_OSMESA_LAZY_INIT(glColor4ubv);
+    OFX_OSMESA_LAZY_INIT(glColor4ui);
+    OFX_OSMESA_LAZY_INIT(glColor4uiv);
+    OFX_OSMESA_LAZY_INIT(glColor4us);
+    OFX_OSMESA_LAZY_INIT(glColor4usv);
+    OFX_OSMESA_LAZY_INIT(glEdgeFlag);
+    OFX_OSMESA_LAZY_INIT(glEdgeFlagv);
+    OFX_OSMESA_LAZY_INIT(glEnd);
+    OFX_OSMESA_LAZY_INIT(glIndexd);
+    OFX_OSMESA_LAZY_INIT(glIndexdv);
+    OFX_OSMESA_LAZY_INIT(glIndexf);
+    OFX_OSMESA_LAZY_INIT(glIndexfv);
+    OFX_OSMESA_LAZY_INIT(glIndexi);
+    OFX_OSMESA_LAZY_INIT(glIndexiv);
+    OFX_OSMESA_LAZY_INIT(glIndexs);
+    OFX_OSMESA_LAZY_INIT(glIndexsv);
+    OFX_OSMESA_LAZY_INIT(glNormal3b);
+    OFX_OSMESA_LAZY_INIT(glNormal3bv);
+    OFX_OSMESA_LAZY_INIT(glNormal3d);
+    OFX_OSMESA_LAZY_INIT(glNormal3dv);
+    OFX_OSMESA_LAZY_INIT(glNormal3f);
+    OFX_OSMESA_LAZY_INIT(glNormal3fv);
+    OFX_OSMESA_LAZY_INIT(glNormal3i);
+    OFX_OSMESA_LAZY_INIT(glNormal3iv);
+    OFX_OSMESA_LAZY_INIT(glNormal3s);
+    OFX_OSMESA_LAZY_INIT(glNormal3sv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos2d);
+    OFX_OSMESA_LAZY_INIT(glRasterPos2dv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos2f);
+    OFX_OSMESA_LAZY_INIT(glRasterPos2fv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos2i);
+    OFX_OSMESA_LAZY_INIT(glRasterPos2iv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos2s);
+    OFX_OSMESA_LAZY_INIT(glRasterPos2sv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos3d);
+    OFX_OSMESA_LAZY_INIT(glRasterPos3dv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos3f);
+    OFX_OSMESA_LAZY_INIT(glRasterPos3fv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos3i);
+    OFX_OSMESA_LAZY_INIT(glRasterPos3iv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos3s);
+    OFX_OSMESA_LAZY_INIT(glRasterPos3sv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos4d);
+    OFX_OSMESA_LAZY_INIT(glRasterPos4dv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos4f);
+    OFX_OSMESA_LAZY_INIT(glRasterPos4fv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos4i);
+    OFX_OSMESA_LAZY_INIT(glRasterPos4iv);
+    OFX_OSMESA_LAZY_INIT(glRasterPos4s);
+    OFX_OSMESA_LAZY_INIT(glRasterPos4sv);
+    OFX_OSMESA_LAZY_INIT(glRectd);
+    OFX_OSMESA_LAZY_INIT(glRectdv);
+    OFX_OSMESA_LAZY_INIT(glRectf);
+    OFX_OSMESA_LAZY_INIT(glRectfv);
+    OFX_OSMESA_LAZY_INIT(glRecti);
+    OFX_OSMESA_LAZY_INIT(glRectiv);
+    OFX_OSMESA_LAZY_INIT(glRects);
+    OFX_OSMESA_LAZY_INIT(glRectsv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord1d);
+    OFX_OSMESA_LAZY_INIT(glTexCoord1dv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord1f);
+    OFX_OSMESA_LAZY_INIT(glTexCoord1fv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord1i);
+    OFX_OSMESA_LAZY_INIT(glTexCoord1iv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord1s);
+    OFX_OSMESA_LAZY_INIT(glTexCoord1sv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord2d);
+    OFX_OSMESA_LAZY_INIT(glTexCoord2dv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord2f);
+    OFX_OSMESA_LAZY_INIT(glTexCoord2fv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord2i);
+    OFX_OSMESA_LAZY_INIT(glTexCoord2iv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord2s);
+    OFX_OSMESA_LAZY_INIT(glTexCoord2sv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord3d);
+    OFX_OSMESA_LAZY_INIT(glTexCoord3dv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord3f);
+    OFX_OSMESA_LAZY_INIT(glTexCoord3fv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord3i);
+    OFX_OSMESA_LAZY_INIT(glTexCoord3iv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord3s);
+    OFX_OSMESA_LAZY_INIT(glTexCoord3sv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord4d);
+    OFX_OSMESA_LAZY_INIT(glTexCoord4dv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord4f);
+    OFX_OSMESA_LAZY_INIT(glTexCoord4fv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord4i);
+    OFX_OSMESA_LAZY_INIT(glTexCoord4iv);
+    OFX_OSMESA_LAZY_INIT(glTexCoord4s);
+    OFX_OSMESA_LAZY_INIT(glTexCoord4sv);
+    OFX_OSMESA_LAZY_INIT(glVertex2d);
+    OFX_OSMESA_LAZY_INIT(glVertex2dv);
+    OFX_OSMESA_LAZY_INIT(glVertex2f);
+    OFX_OSMESA_LAZY_INIT(glVertex2fv);
+    OFX_OSMESA_LAZY_INIT(glVertex2i);
+    OFX_OSMESA_LAZY_INIT(glVertex2iv);
+    OFX_OSMESA_LAZY_INIT(glVertex2s);
+    OFX_OSMESA_LAZY_INIT(glVertex2sv);
+    OFX_OSMESA_LAZY_INIT(glVertex3d);
+    OFX_OSMESA_LAZY_INIT(glVertex3dv);
+    OFX_OSMESA_LAZY_INIT(glVertex3f);
+    OFX_OSMESA_LAZY_INIT(glVertex3fv);
+    OFX_OSMESA_LAZY_INIT(glVertex3i);
+    OFX_OSMESA_LAZY_INIT(glVertex3iv);
+    OFX_OSMESA_LAZY_INIT(glVertex3s);
+    OFX_OSMESA_LAZY_INIT(glVertex3sv);
+    OFX_OSMESA_LAZY_INIT(glVertex4d);
+    OFX_OSMESA_LAZY_INIT(glVertex4dv);
+    OFX_OSMESA_LAZY_INIT(glVertex4f);
+    OFX_OSMESA_LAZY_INIT(glVertex4fv);
+    OFX_OSMESA_LAZY_INIT(glVertex4i);
+    OFX_OSMESA_LAZY_INIT(glVertex4iv);
+    OFX_OSMESA_LAZY_INIT(glVertex4s);
+    OFX_OSMESA_LAZY_INIT(glVertex4sv);
+    OFX_OSMESA_LAZY_INIT(glClipPlane);
+    OFX_OSMESA_LAZY_INIT(glColorMaterial);
+    OFX_OSMESA_LAZY_INIT(glFogf);
+    OFX_OSMESA_LAZY_INIT(glFogfv);
+    OFX_OSMESA_LAZY_INIT(glFogi);
+    OFX_OSMESA_LAZY_INIT(glFogiv);
+    OFX_OSMESA_LAZY_INIT(glLightf);
+    OFX_OSMESA_LAZY_INIT(glLightfv);
+    OFX_OSMESA_LAZY_INIT(glLighti);
+    OFX_OSMESA_LAZY_INIT(glLightiv);
+    OFX_OSMESA_LAZY_INIT(glLightModelf);
+    OFX_OSMESA_LAZY_INIT(glLightModelfv);
+    OFX_OSMESA_LAZY_INIT(glLightModeli);
+    OFX_OSMESA_LAZY_INIT(glLightModeliv);
+    OFX_OSMESA_LAZY_INIT(glLineStipple);
+    OFX_OSMESA_LAZY_INIT(glMaterialf);
+    OFX_OSMESA_LAZY_INIT(glMaterialfv);
+    OFX_OSMESA_LAZY_INIT(glMateriali);
+    OFX_OSMESA_LAZY_INIT(glMaterialiv);
+    OFX_OSMESA_LAZY_INIT(glPolygonStipple);
+    OFX_OSMESA_LAZY_INIT(glShadeModel);
+    OFX_OSMESA_LAZY_INIT(glTexEnvf);
+    OFX_OSMESA_LAZY_INIT(glTexEnvfv);
+    OFX_OSMESA_LAZY_INIT(glTexEnvi);
+    OFX_OSMESA_LAZY_INIT(glTexEnviv);
+    OFX_OSMESA_LAZY_INIT(glTexGend);
+    OFX_OSMESA_LAZY_INIT(glTexGendv);
+    OFX_OSMESA_LAZY_INIT(glTexGenf);
+    OFX_OSMESA_LAZY_INIT(glTexGenfv);
+    OFX_OSMESA_LAZY_INIT(glTexGeni);
+    OFX_OSMESA_LAZY_INIT(glTexGeniv);
+    OFX_OSMESA_LAZY_INIT(glFeedbackBuffer);
+    OFX_OSMESA_LAZY_INIT(glSelectBuffer);
+    OFX_OSMESA_LAZY_INIT(glRenderMode);
+    OFX_OSMESA_LAZY_INIT(glInitNames);
+    OFX_OSMESA_LAZY_INIT(glLoadName);
+    OFX_OSMESA_LAZY_INIT(glPassThrough);
+    OFX_OSMESA_LAZY_INIT(glPopName);
+    OFX_OSMESA_LAZY_INIT(glPushName);
+    OFX_OSMESA_LAZY_INIT(glClearAccum);
+    OFX_OSMESA_LAZY_INIT(glClearIndex);
+    OFX_OSMESA_LAZY_INIT(glIndexMask);
+    OFX_OSMESA_LAZY_INIT(glAccum);
+    OFX_OSMESA_LAZY_INIT(glPopAttrib);
+    OFX_OSMESA_LAZY_INIT(glPushAttrib);
+    OFX_OSMESA_LAZY_INIT(glMap1d);
+    OFX_OSMESA_LAZY_INIT(glMap1f);
+    OFX_OSMESA_LAZY_INIT(glMap2d);
+    OFX_OSMESA_LAZY_INIT(glMap2f);
+    OFX_OSMESA_LAZY_INIT(glMapGrid1d);
+    OFX_OSMESA_LAZY_INIT(glMapGrid1f);
+    OFX_OSMESA_LAZY_INIT(glMapGrid2d);
+    OFX_OSMESA_LAZY_INIT(glMapGrid2f);
+    OFX_OSMESA_LAZY_INIT(glEvalCoord1d);
+    OFX_OSMESA_LAZY_INIT(glEvalCoord1dv);
+    OFX_OSMESA_LAZY_INIT(glEvalCoord1f);
+    OFX_OSMESA_LAZY_INIT(glEvalCoord1fv);
+    OFX_OSMESA_LAZY_INIT(glEvalCoord2d);
+    OFX_OSMESA_LAZY_INIT(glEvalCoord2dv);
+    OFX_OSMESA_LAZY_INIT(glEvalCoord2f);
+    OFX_OSMESA_LAZY_INIT(glEvalCoord2fv);
+    OFX_OSMESA_LAZY_INIT(glEvalMesh1);
+    OFX_OSMESA_LAZY_INIT(glEvalPoint1);
+    OFX_OSMESA_LAZY_INIT(glEvalMesh2);
+    OFX_OSMESA_LAZY_INIT(glEvalPoint2);
+    OFX_OSMESA_LAZY_INIT(glAlphaFunc);
+    OFX_OSMESA_LAZY_INIT(glPixelZoom);
+    OFX_OSMESA_LAZY_INIT(glPixelTransferf);
+    OFX_OSMESA_LAZY_INIT(glPixelTransferi);
+    OFX_OSMESA_LAZY_INIT(glPixelMapfv);
+    OFX_OSMESA_LAZY_INIT(glPixelMapuiv);
+    OFX_OSMESA_LAZY_INIT(glPixelMapusv);
+    OFX_OSMESA_LAZY_INIT(glCopyPixels);
+    OFX_OSMESA_LAZY_INIT(glDrawPixels);
+    OFX_OSMESA_LAZY_INIT(glGetClipPlane);
+    OFX_OSMESA_LAZY_INIT(glGetLightfv);
+    OFX_OSMESA_LAZY_INIT(glGetLightiv);
+    OFX_OSMESA_LAZY_INIT(glGetMapdv);
+    OFX_OSMESA_LAZY_INIT(glGetMapfv);
+    OFX_OSMESA_LAZY_INIT(glGetMapiv);
+    OFX_OSMESA_LAZY_INIT(glGetMaterialfv);
+    OFX_OSMESA_LAZY_INIT(glGetMaterialiv);
+    OFX_OSMESA_LAZY_INIT(glGetPixelMapfv);
+    OFX_OSMESA_LAZY_INIT(glGetPixelMapuiv);
+    OFX_OSMESA_LAZY_INIT(glGetPixelMapusv);
+    OFX_OSMESA_LAZY_INIT(glGetPolygonStipple);
+    OFX_OSMESA_LAZY_INIT(glGetTexEnvfv);
+    OFX_OSMESA_LAZY_INIT(glGetTexEnviv);
+    OFX_OSMESA_LAZY_INIT(glGetTexGendv);
+    OFX_OSMESA_LAZY_INIT(glGetTexGenfv);
+    OFX_OSMESA_LAZY_INIT(glGetTexGeniv);
+    OFX_OSMESA_LAZY_INIT(glIsList);
+    OFX_OSMESA_LAZY_INIT(glFrustum);
+    OFX_OSMESA_LAZY_INIT(glLoadIdentity);
+    OFX_OSMESA_LAZY_INIT(glLoadMatrixf);
+    OFX_OSMESA_LAZY_INIT(glLoadMatrixd);
+    OFX_OSMESA_LAZY_INIT(glMatrixMode);
+    OFX_OSMESA_LAZY_INIT(glMultMatrixf);
+    OFX_OSMESA_LAZY_INIT(glMultMatrixd);
+    OFX_OSMESA_LAZY_INIT(glOrtho);
+    OFX_OSMESA_LAZY_INIT(glPopMatrix);
+    OFX_OSMESA_LAZY_INIT(glPushMatrix);
+    OFX_OSMESA_LAZY_INIT(glRotated);
+    OFX_OSMESA_LAZY_INIT(glRotatef);
+    OFX_OSMESA_LAZY_INIT(glScaled);
+    OFX_OSMESA_LAZY_INIT(glScalef);
+    OFX_OSMESA_LAZY_INIT(glTranslated);
+    OFX_OSMESA_LAZY_INIT(glTranslatef);
+    OFX_OSMESA_LAZY_INIT(glDrawArrays);
+    OFX_OSMESA_LAZY_INIT(glDrawElements);
+    OFX_OSMESA_LAZY_INIT(glGetPointerv);
+    OFX_OSMESA_LAZY_INIT(glPolygonOffset);
+    OFX_OSMESA_LAZY_INIT(glCopyTexImage1D);
+    OFX_OSMESA_LAZY_INIT(glCopyTexImage2D);
+    OFX_OSMESA_LAZY_INIT(glCopyTexSubImage1D);
+    OFX_OSMESA_LAZY_INIT(glCopyTexSubImage2D);
+    OFX_OSMESA_LAZY_INIT(glTexSubImage1D);
+    OFX_OSMESA_LAZY_INIT(glTexSubImage2D);
+    OFX_OSMESA_LAZY_INIT(glBindTexture);
+    OFX_OSMESA_LAZY_INIT(glDeleteTextures);
+    OFX_OSMESA_LAZY_INIT(glGenTextures);
+    OFX_OSMESA_LAZY_INIT(glIsTexture);
+    OFX_OSMESA_LAZY_INIT(glArrayElement);
+    OFX_OSMESA_LAZY_INIT(glColorPointer);
+    OFX_OSMESA_LAZY_INIT(glDisableClientState);
+    OFX_OSMESA_LAZY_INIT(glEdgeFlagPointer);
+    OFX_OSMESA_LAZY_INIT(glEnableClientState);
+    OFX_OSMESA_LAZY_INIT(glIndexPointer);
+    OFX_OSMESA_LAZY_INIT(glInterleavedArrays);
+    OFX_OSMESA_LAZY_INIT(glNormalPointer);
+    OFX_OSMESA_LAZY_INIT(glTexCoordPointer);
+    OFX_OSMESA_LAZY_INIT(glVertexPointer);
+    OFX_OSMESA_LAZY_INIT(glAreTexturesResident);
+    OFX_OSMESA_LAZY_INIT(glPrioritizeTextures);
+    OFX_OSMESA_LAZY_INIT(glIndexub);
+    OFX_OSMESA_LAZY_INIT(glIndexubv);
+    OFX_OSMESA_LAZY_INIT(glPopClientAttrib);
+    OFX_OSMESA_LAZY_INIT(glPushClientAttrib);
+    OFX_OSMESA_LAZY_INIT(glDrawRangeElements);
+    OFX_OSMESA_LAZY_INIT(glTexImage3D);
+    OFX_OSMESA_LAZY_INIT(glTexSubImage3D);
+    OFX_OSMESA_LAZY_INIT(glCopyTexSubImage3D);
+    OFX_OSMESA_LAZY_INIT(glActiveTexture);
+    OFX_OSMESA_LAZY_INIT(glSampleCoverage);
+    OFX_OSMESA_LAZY_INIT(glCompressedTexImage3D);
+    OFX_OSMESA_LAZY_INIT(glCompressedTexImage2D);
+    OFX_OSMESA_LAZY_INIT(glCompressedTexImage1D);
+    OFX_OSMESA_LAZY_INIT(glCompressedTexSubImage3D);
+    OFX_OSMESA_LAZY_INIT(glCompressedTexSubImage2D);
+    OFX_OSMESA_LAZY_INIT(glCompressedTexSubImage1D);
+    OFX_OSMESA_LAZY_INIT(glGetCompressedTexImage);
+    OFX_OSMESA_LAZY_INIT(glClientActiveTexture);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord1d);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord1dv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord1f);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord1fv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord1i);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord1iv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord1s);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord1sv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord2d);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord2dv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord2f);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord2fv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord2i);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord2iv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord2s);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord2sv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord3d);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord3dv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord3f);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord3fv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord3i);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord3iv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord3s);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord3sv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord4d);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord4dv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord4f);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord4fv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord4i);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord4iv);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord4s);
+    OFX_OSMESA_LAZY_INIT(glMultiTexCoord4sv);
+    OFX_OSMESA_LAZY_INIT(glLoadTransposeMatrixf);
+    OFX_OSMESA_LAZY_INIT(glLoadTransposeMatrixd);
+    OFX_OSMESA_LAZY_INIT(glMultTransposeMatrixf);
+    OFX_OSMESA_LAZY_INIT(glMultTransposeMatrixd);
+    OFX_OSMESA_LAZY_INIT(glBlendFuncSeparate);
+    OFX_OSMESA_LAZY_INIT(glMultiDrawArrays);
+    OFX_OSMESA_LAZY_INIT(glMultiDrawElements);
+    OFX_OSMESA_LAZY_INIT(glPointParameterf);
+    OFX_OSMESA_LAZY_INIT(glPointParameterfv);
+    OFX_OSMESA_LAZY_INIT(glPointParameteri);
+    OFX_OSMESA_LAZY_INIT(glPointParameteriv);
+    OFX_OSMESA_LAZY_INIT(glFogCoordf);
+    OFX_OSMESA_LAZY_INIT(glFogCoordfv);
+    OFX_OSMESA_LAZY_INIT(glFogCoordd);
+    OFX_OSMESA_LAZY_INIT(glFogCoorddv);
+    OFX_OSMESA_LAZY_INIT(glFogCoordPointer);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3b);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3bv);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3d);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3dv);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3f);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3fv);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3i);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3iv);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3s);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3sv);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3ub);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3ubv);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3ui);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3uiv);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3us);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColor3usv);
+    OFX_OSMESA_LAZY_INIT(glSecondaryColorPointer);
+    OFX_OSMESA_LAZY_INIT(glWindowPos2d);
+    OFX_OSMESA_LAZY_INIT(glWindowPos2dv);
+    OFX_OSMESA_LAZY_INIT(glWindowPos2f);
+    OFX_OSMESA_LAZY_INIT(glWindowPos2fv);
+    OFX_OSMESA_LAZY_INIT(glWindowPos2i);
+    OFX_OSMESA_LAZY_INIT(glWindowPos2iv);
+    OFX_OSMESA_LAZY_INIT(glWindowPos2s);
+    OFX_OSMESA_LAZY_INIT(glWindowPos2sv);
+    OFX_OSMESA_LAZY_INIT(glWindowPos3d);
+    OFX_OSMESA_LAZY_INIT(glWindowPos3dv);
+    OFX_OSMESA_LAZY_INIT(glWindowPos3f);
+    OFX_OSMESA_LAZY_INIT(glWindowPos3fv);
+    OFX_OSMESA_LAZY_INIT(glWindowPos3i);
+    OFX_OSMESA_LAZY_INIT(glWindowPos3iv);
+    OFX_OSMESA_LAZY_INIT(glWindowPos3s);
+    OFX_OSMESA_LAZY_INIT(glWindowPos3sv);
+    OFX_OSMESA_LAZY_INIT(glBlendColor);
+    OFX_OSMESA_LAZY_INIT(glBlendEquation);
+    OFX_OSMESA_LAZY_INIT(glGenQueries);
+    OFX_OSMESA_LAZY_INIT(glDeleteQueries);
+    OFX_OSMESA_LAZY_INIT(glIsQuery);
+    OFX_OSMESA_LAZY_INIT(glBeginQuery);
+    OFX_OSMESA_LAZY_INIT(glEndQuery);
+    OFX_OSMESA_LAZY_INIT(glGetQueryiv);
+    OFX_OSMESA_LAZY_INIT(glGetQueryObjectiv);
+    OFX_OSMESA_LAZY_INIT(glGetQueryObjectuiv);
+    OFX_OSMESA_LAZY_INIT(glBindBuffer);
+    OFX_OSMESA_LAZY_INIT(glDeleteBuffers);
+    OFX_OSMESA_LAZY_INIT(glGenBuffers);
+    OFX_OSMESA_LAZY_INIT(glIsBuffer);
+    OFX_OSMESA_LAZY_INIT(glBufferData);
+    OFX_OSMESA_LAZY_INIT(glBufferSubData);
+    OFX_OSMESA_LAZY_INIT(glGetBufferSubData);
+    OFX_OSMESA_LAZY_INIT(glMapBuffer);
+    OFX_OSMESA_LAZY_INIT(glUnmapBuffer);
+    OFX_OSMESA_LAZY_INIT(glGetBufferParameteriv);
+    OFX_OSMESA_LAZY_INIT(glGetBufferPointerv);
+    OFX_OSMESA_LAZY_INIT(glBlendEquationSeparate);
+    OFX_OSMESA_LAZY_INIT(glDrawBuffers);
+    OFX_OSMESA_LAZY_INIT(glStencilOpSeparate);
+    OFX_OSMESA_LAZY_INIT(glStencilFuncSeparate);
+    OFX_OSMESA_LAZY_INIT(glStencilMaskSeparate);
+    OFX_OSMESA_LAZY_INIT(glAttachShader);
+    OFX_OSMESA_LAZY_INIT(glBindAttribLocation);
+    OFX_OSMESA_LAZY_INIT(glCompileShader);
+    OFX_OSMESA_LAZY_INIT(glCreateProgram);
+    OFX_OSMESA_LAZY_INIT(glCreateShader);
+    OFX_OSMESA_LAZY_INIT(glDeleteProgram);
+    OFX_OSMESA_LAZY_INIT(glDeleteShader);
+    OFX_OSMESA_LAZY_INIT(glDetachShader);
+    OFX_OSMESA_LAZY_INIT(glDisableVertexAttribArray);
+    OFX_OSMESA_LAZY_INIT(glEnableVertexAttribArray);
+    OFX_OSMESA_LAZY_INIT(glGetActiveAttrib);
+    OFX_OSMESA_LAZY_INIT(glGetActiveUniform);
+    OFX_OSMESA_LAZY_INIT(glGetAttachedShaders);
+    OFX_OSMESA_LAZY_INIT(glGetAttribLocation);
+    OFX_OSMESA_LAZY_INIT(glGetProgramiv);
+    OFX_OSMESA_LAZY_INIT(glGetProgramInfoLog);
+    OFX_OSMESA_LAZY_INIT(glGetShaderiv);
+    OFX_OSMESA_LAZY_INIT(glGetShaderInfoLog);
+    OFX_OSMESA_LAZY_INIT(glGetShaderSource);
+    OFX_OSMESA_LAZY_INIT(glGetUniformLocation);
+    OFX_OSMESA_LAZY_INIT(glGetUniformfv);
+    OFX_OSMESA_LAZY_INIT(glGetUniformiv);
+    OFX_OSMESA_LAZY_INIT(glGetVertexAttribdv);
+    OFX_OSMESA_LAZY_INIT(glGetVertexAttribfv);
+    OFX_OSMESA_LAZY_INIT(glGetVertexAttribiv);
+    OFX_OSMESA_LAZY_INIT(glGetVertexAttribPointerv);
+    OFX_OSMESA_LAZY_INIT(glIsProgram);
+    OFX_OSMESA_LAZY_INIT(glIsShader);
+    OFX_OSMESA_LAZY_INIT(glLinkProgram);
+    OFX_OSMESA_LAZY_INIT(glShaderSource);
+    OFX_OSMESA_LAZY_INIT(glUseProgram);
+    OFX_OSMESA_LAZY_INIT(glUniform1f);
+    OFX_OSMESA_LAZY_INIT(glUniform2f);
+    OFX_OSMESA_LAZY_INIT(glUniform3f);
+    OFX_OSMESA_LAZY_INIT(glUniform4f);
+    OFX_OSMESA_LAZY_INIT(glUniform1i);
+    OFX_OSMESA_LAZY_INIT(glUniform2i);
+    OFX_OSMESA_LAZY_INIT(glUniform3i);
+    OFX_OSMESA_LAZY_INIT(glUniform4i);
+    OFX_OSMESA_LAZY_INIT(glUniform1fv);
+    OFX_OSMESA_LAZY_INIT(glUniform2fv);
+    OFX_OSMESA_LAZY_INIT(glUniform3fv);
+    OFX_OSMESA_LAZY_INIT(glUniform4fv);
+    OFX_OSMESA_LAZY_INIT(glUniform1iv);
+    OFX_OSMESA_LAZY_INIT(glUniform2iv);
+    OFX_OSMESA_LAZY_INIT(glUniform3iv);
+    OFX_OSMESA_LAZY_INIT(glUniform4iv);
+    OFX_OSMESA_LAZY_INIT(glUniformMatrix2fv);
+    OFX_OSMESA_LAZY_INIT(glUniformMatrix3fv);
+    OFX_OSMESA_LAZY_INIT(glUniformMatrix4fv);
+    OFX_OSMESA_LAZY_INIT(glValidateProgram);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib1d);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib1dv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib1f);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib1fv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib1s);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib1sv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib2d);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib2dv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib2f);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib2fv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib2s);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib2sv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib3d);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib3dv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib3f);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib3fv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib3s);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib3sv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4Nbv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4Niv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4Nsv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4Nub);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4Nubv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4Nuiv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4Nusv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4bv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4d);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4dv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4f);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4fv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4iv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4s);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4sv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4ubv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4uiv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttrib4usv);
+    OFX_OSMESA_LAZY_INIT(glVertexAttribPointer);
+    OFX_OSMESA_LAZY_INIT(glBindBufferARB);
+    OFX_OSMESA_LAZY_INIT(glDeleteBuffersARB);
+    OFX_OSMESA_LAZY_INIT(glGenBuffersARB);
+    OFX_OSMESA_LAZY_INIT(glIsBufferARB);
+    OFX_OSMESA_LAZY_INIT(glBufferDataARB);
+    OFX_OSMESA_LAZY_INIT(glBufferSubDataARB);
+    OFX_OSMESA_LAZY_INIT(glGetBufferSubDataARB);
+    OFX_OSMESA_LAZY_INIT(glMapBufferARB);
+    OFX_OSMESA_LAZY_INIT(glUnmapBufferARB);
+    OFX_OSMESA_LAZY_INIT(glGetBufferParameterivARB);
+    OFX_OSMESA_LAZY_INIT(glGetBufferPointervARB);
+    OFX_OSMESA_LAZY_INIT(glBindVertexArray);
+    OFX_OSMESA_LAZY_INIT(glDeleteVertexArrays);
+    OFX_OSMESA_LAZY_INIT(glGenVertexArrays);
+    OFX_OSMESA_LAZY_INIT(glIsVertexArray);
+    OFX_OSMESA_LAZY_INIT(glIsRenderbuffer);
+    OFX_OSMESA_LAZY_INIT(glBindRenderbuffer);
+    OFX_OSMESA_LAZY_INIT(glDeleteRenderbuffers);
+    OFX_OSMESA_LAZY_INIT(glGenRenderbuffers);
+    OFX_OSMESA_LAZY_INIT(glRenderbufferStorage);
+    OFX_OSMESA_LAZY_INIT(glGetRenderbufferParameteriv);
+    OFX_OSMESA_LAZY_INIT(glIsFramebuffer);
+    OFX_OSMESA_LAZY_INIT(glBindFramebuffer);
+    OFX_OSMESA_LAZY_INIT(glDeleteFramebuffers);
+    OFX_OSMESA_LAZY_INIT(glGenFramebuffers);
+    OFX_OSMESA_LAZY_INIT(glCheckFramebufferStatus);
+    OFX_OSMESA_LAZY_INIT(glFramebufferTexture1D);
+    OFX_OSMESA_LAZY_INIT(glFramebufferTexture2D);
+    OFX_OSMESA_LAZY_INIT(glFramebufferTexture3D);
+    OFX_OSMESA_LAZY_INIT(glFramebufferRenderbuffer);
+    OFX_OSMESA_LAZY_INIT(glGetFramebufferAttachmentParameteriv);
+    OFX_OSMESA_LAZY_INIT(glGenerateMipmap);
+    OFX_OSMESA_LAZY_INIT(glBlitFramebuffer);
+    OFX_OSMESA_LAZY_INIT(glRenderbufferStorageMultisample);
+    OFX_OSMESA_LAZY_INIT(glFramebufferTextureLayer);
+    OFX_OSMESA_LAZY_INIT(glIsRenderbufferEXT);
+    OFX_OSMESA_LAZY_INIT(glBindRenderbufferEXT);
+    OFX_OSMESA_LAZY_INIT(glDeleteRenderbuffersEXT);
+    OFX_OSMESA_LAZY_INIT(glGenRenderbuffersEXT);
+    OFX_OSMESA_LAZY_INIT(glRenderbufferStorageEXT);
+    OFX_OSMESA_LAZY_INIT(glGetRenderbufferParameterivEXT);
+    OFX_OSMESA_LAZY_INIT(glIsFramebufferEXT);
+    OFX_OSMESA_LAZY_INIT(glBindFramebufferEXT);
+    OFX_OSMESA_LAZY_INIT(glDeleteFramebuffersEXT);
+    OFX_OSMESA_LAZY_INIT(glGenFramebuffersEXT);
+    OFX_OSMESA_LAZY_INIT(glCheckFramebufferStatusEXT);
+    OFX_OSMESA_LAZY_INIT(glFramebufferTexture1DEXT);
+    OFX_OSMESA_LAZY_INIT(glFramebufferTexture2DEXT);
+    OFX_OSMESA_LAZY_INIT(glFramebufferTexture3DEXT);
+    OFX_OSMESA_LAZY_INIT(glFramebufferRenderbufferEXT);
+    OFX_OSMESA_LAZY_INIT(glGetFramebufferAttachmentParameterivEXT);
+    OFX_OSMESA_LAZY_INIT(glGenerateMipmapEXT);
+    OFX_OSMESA_LAZY_INIT(glBindVertexArrayAPPLE);
+    OFX_OSMESA_LAZY_INIT(glDeleteVertexArraysAPPLE);
+    OFX_OSMESA_LAZY_INIT(glGenVertexArraysAPPLE);
+    OFX_OSMESA_LAZY_INIT(glIsVertexArrayAPPLE);
+#else
 
     _mglCullFace = (PFNGLCULLFACEPROC)OSMesaGetProcAddress("glCullFace");
     _mglFrontFace = (PFNGLFRONTFACEPROC)OSMesaGetProcAddress("glFrontFace");
@@ -620,6 +2437,7 @@ OSGLFunctions<false>::load_functions()
     _mglDeleteVertexArraysAPPLE = (PFNGLDELETEVERTEXARRAYSAPPLEPROC)OSMesaGetProcAddress("glDeleteVertexArraysAPPLE");
     _mglGenVertexArraysAPPLE = (PFNGLGENVERTEXARRAYSAPPLEPROC)OSMesaGetProcAddress("glGenVertexArraysAPPLE");
     _mglIsVertexArrayAPPLE = (PFNGLISVERTEXARRAYAPPLEPROC)OSMesaGetProcAddress("glIsVertexArrayAPPLE");
+#endif // OFX_OPENGL_LAZY_LOAD
 #endif // HAVE_OSMESA
 } // load_functions
 
@@ -0,0 +1,304 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; -*- */
+/* ***** BEGIN LICENSE BLOCK *****
+ * This file is part of openfx-supportext <https://github.com/NatronGitHub/openfx-supportext>,
+ * (C) 2018-2021 The Natron Developers
+ * (C) 2013-2018 INRIA
+ *
+ * openfx-supportext is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * openfx-supportext is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openfx-supportext.  If not, see <http://www.gnu.org/licenses/gpl-2.0.html>
+ * ***** END LICENSE BLOCK ***** */
+
+/*
+ * OFX utilities for rendering with OpenGL on the CPU, using OSMesa.
+ */
+
+#include "ofxsOGLOSMesa.h"
+
+#include <cstring>
+#include <list>
+#include <vector>
+
+#include "ofxsOGLFunctions.h"
+
+#ifdef HAVE_OSMESA
+#include <GL/gl_mangle.h>
+#include <GL/glu_mangle.h>
+#include <GL/osmesa.h>
+#endif // HAVE_OSMESA
+
+#include "ofxsMultiThread.h"
+#ifndef OFX_USE_MULTITHREAD_MUTEX
+// some OFX hosts do not have mutex handling in the MT-Suite (e.g. Sony Catalyst Edit)
+// prefer using the fast mutex by Marcus Geelnard http://tinythreadpp.bitsnbites.eu/
+#include "fast_mutex.h"
+#endif
+#ifdef OFX_USE_MULTITHREAD_MUTEX
+typedef OFX::MultiThread::Mutex Mutex;
+typedef OFX::MultiThread::AutoMutex AutoMutex;
+#else
+typedef tthread::fast_mutex Mutex;
+typedef OFX::MultiThread::AutoMutexT<tthread::fast_mutex> AutoMutex;
+#endif
+
+namespace OFX {
+struct OSMesaContextData
+{
+#ifdef HAVE_OSMESA
+    OSMesaContext context;
+#endif
+    std::vector<unsigned char> buffer; // the render buffer, if the destination image cannot be rendered to directly
+
+    OSMesaContextData()
+#ifdef HAVE_OSMESA
+        : context(NULL)
+        , buffer()
+#else
+        : buffer()
+#endif
+    {
+    }
+};
+
+struct OSMesaContextPoolPrivate
+{
+    int depthBits;
+    int stencilBits;
+    int accumBits;
+    Mutex mutex; // protects freeContexts and nInUse
+    std::list<OSMesaContextData*> freeContexts;
+    int nInUse;
+
+    OSMesaContextPoolPrivate(int depthBits,
+                             int stencilBits,
+                             int accumBits)
+        : depthBits(depthBits)
+        , stencilBits(stencilBits)
+        , accumBits(accumBits)
+        , mutex()
+        , freeContexts()
+        , nInUse(0)
+    {
+    }
+};
+
+static void
+destroyContext(OSMesaContextData* data)
+{
+#ifdef HAVE_OSMESA
+    if (data->context) {
+        OSMesaDestroyContext(data->context);
+    }
+#endif
+    delete data;
+}
+
+OSMesaContextPool::OSMesaContextPool(int depthBits,
+                                     int stencilBits,
+                                     int accumBits)
+    : _imp( new OSMesaContextPoolPrivate(depthBits, stencilBits, accumBits) )
+{
+}
+
+OSMesaContextPool::~OSMesaContextPool()
+{
+    assert(_imp->nInUse == 0);
+    purge();
+}
+
+bool
+OSMesaContextPool::isAvailable()
+{
+#ifdef HAVE_OSMESA
+
+    return true;
+#else
+
+    return false;
+#endif
+}
+
+void
+OSMesaContextPool::purge()
+{
+    std::list<OSMesaContextData*> contexts;
+    {
+        AutoMutex lock(&_imp->mutex);
+        contexts.swap(_imp->freeContexts);
+    }
+    for (std::list<OSMesaContextData*>::iterator it = contexts.begin(); it != contexts.end(); ++it) {
+        destroyContext(*it);
+    }
+}
+
+OSMesaContextData*
+OSMesaContextPool::acquire(bool* isNew)
+{
+    {
+        AutoMutex lock(&_imp->mutex);
+        ++_imp->nInUse;
+        if ( !_imp->freeContexts.empty() ) {
+            OSMesaContextData* data = _imp->freeContexts.front();
+            _imp->freeContexts.pop_front();
+            *isNew = false;
+
+            return data;
+        }
+    }
+
+    // no free context: create one, outside of the lock
+    OSMesaContextData* data = new OSMesaContextData;
+#ifdef HAVE_OSMESA
+    data->context = OSMesaCreateContextExt(OSMESA_RGBA, _imp->depthBits, _imp->stencilBits, _imp->accumBits, NULL);
+    if (!data->context) {
+        delete data;
+        {
+            AutoMutex lock(&_imp->mutex);
+            --_imp->nInUse;
+        }
+        throwSuiteStatusException(kOfxStatErrMemory);
+
+        return NULL;
+    }
+#endif
+    *isNew = true;
+
+    return data;
+}
+
+void
+OSMesaContextPool::release(OSMesaContextData* data)
+{
+    AutoMutex lock(&_imp->mutex);
+
+    --_imp->nInUse;
+    // the most recently used context is given first, its buffer is probably still in the CPU cache
+    _imp->freeContexts.push_front(data);
+}
+
+OSMesaRenderContext::OSMesaRenderContext(OSMesaContextPool & pool,
+                                         Image* dstImg,
+                                         const OfxRectI & renderWindow)
+    : _pool(pool)
+    , _data(NULL)
+    , _dstImg(dstImg)
+    , _renderWindow(renderWindow)
+    , _bytesPerComponent(0)
+    , _isNew(false)
+    , _direct(false)
+{
+#ifdef HAVE_OSMESA
+    assert(dstImg);
+    const OfxRectI & bounds = dstImg->getBounds();
+    assert(bounds.x1 <= renderWindow.x1 && renderWindow.x2 <= bounds.x2 &&
+           bounds.y1 <= renderWindow.y1 && renderWindow.y2 <= bounds.y2);
+    (void)bounds;
+    GLenum type;
+    switch ( dstImg->getPixelDepth() ) {
+    case eBitDepthUByte:
+        type = GL_UNSIGNED_BYTE;
+        _bytesPerComponent = 1;
+        break;
+    case eBitDepthUShort:
+        type = GL_UNSIGNED_SHORT;
+        _bytesPerComponent = 2;
+        break;
+    case eBitDepthFloat:
+        type = GL_FLOAT;
+        _bytesPerComponent = 4;
+        break;
+    default:
+        throwSuiteStatusException(kOfxStatErrImageFormat);
+
+        return;
+    }
+    int width = renderWindow.x2 - renderWindow.x1;
+    int height = renderWindow.y2 - renderWindow.y1;
+    if ( (width <= 0) || (height <= 0) ) {
+        throwSuiteStatusException(kOfxStatFailed);
+
+        return;
+    }
+    int pixelBytes = dstImg->getPixelComponentCount() * _bytesPerComponent;
+    int rowBytes = dstImg->getRowBytes();
+    // OSMesa renders RGBA pixels, with rows that are a whole number of pixels apart
+    _direct = ( dstImg->getPixelComponentCount() == 4 && rowBytes > 0 && (rowBytes % pixelBytes) == 0 );
+
+    _data = pool.acquire(&_isNew);
+    void* buffer;
+    GLint rowLength;
+    if (_direct) {
+        buffer = dstImg->getPixelAddress(renderWindow.x1, renderWindow.y1);
+        rowLength = rowBytes / pixelBytes;
+    } else {
+        std::size_t size = (std::size_t)width * height * 4 * _bytesPerComponent;
+        if (_data->buffer.size() < size) {
+            _data->buffer.resize(size);
+        }
+        buffer = &_data->buffer.front();
+        rowLength = width;
+    }
+    if ( !OSMesaMakeCurrent(_data->context, buffer, type, width, height) ) {
+        pool.release(_data);
+        _data = NULL;
+        throwSuiteStatusException(kOfxStatFailed);
+
+        return;
+    }
+    // OFX images are bottom-up, like OpenGL
+    OSMesaPixelStore(OSMESA_Y_UP, 1);
+    OSMesaPixelStore(OSMESA_ROW_LENGTH, rowLength);
+#else
+    (void)pool;
+    throwSuiteStatusException(kOfxStatErrUnsupported);
+#endif
+}
+
+OSMesaRenderContext::~OSMesaRenderContext()
+{
+    if (!_data) {
+        return;
+    }
+#ifdef HAVE_OSMESA
+    // unbind the context from this thread, so that another thread may use it
+    OSMesaMakeCurrent(NULL, NULL, 0, 0, 0);
+#endif
+    _pool.release(_data);
+}
+
+void
+OSMesaRenderContext::finish()
+{
+    if (!_data) {
+        return;
+    }
+    GL_CPU::glFinish();
+    if (_direct) {
+        return;
+    }
+
+    // copy the rendered channels: RGB for RGB images, A for Alpha images
+    int nComponents = _dstImg->getPixelComponentCount();
+    int firstComponent = (nComponents == 1) ? 3 : 0;
+    int width = _renderWindow.x2 - _renderWindow.x1;
+    int height = _renderWindow.y2 - _renderWindow.y1;
+    std::size_t srcPixelBytes = 4 * _bytesPerComponent;
+    std::size_t dstPixelBytes = nComponents * _bytesPerComponent;
+    for (int y = 0; y < height; ++y) {
+        const unsigned char* src = &_data->buffer.front() + (std::size_t)y * width * srcPixelBytes + firstComponent * _bytesPerComponent;
+        unsigned char* dst = (unsigned char*)_dstImg->getPixelAddress(_renderWindow.x1, _renderWindow.y1 + y);
+        for (int x = 0; x < width; ++x, src += srcPixelBytes, dst += dstPixelBytes) {
+            std::memcpy(dst, src, dstPixelBytes);
+        }
+    }
+}
+} // namespace OFX
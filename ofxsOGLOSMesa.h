@@ -0,0 +1,130 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; -*- */
+/* ***** BEGIN LICENSE BLOCK *****
+ * This file is part of openfx-supportext <https://github.com/NatronGitHub/openfx-supportext>,
+ * (C) 2018-2021 The Natron Developers
+ * (C) 2013-2018 INRIA
+ *
+ * openfx-supportext is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * openfx-supportext is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openfx-supportext.  If not, see <http://www.gnu.org/licenses/gpl-2.0.html>
+ * ***** END LICENSE BLOCK ***** */
+
+/*
+ * OFX utilities for rendering with OpenGL on the CPU, using OSMesa.
+ */
+
+#ifndef openfx_supportext_ofxsOGLOSMesa_h
+#define openfx_supportext_ofxsOGLOSMesa_h
+
+#include "ofxsImageEffect.h"
+
+namespace OFX {
+struct OSMesaContextData;
+struct OSMesaContextPoolPrivate;
+
+/**
+ * @brief A pool of OSMesa contexts, for effects that render with OpenGL on hosts without a GPU.
+ * Contexts are created lazily, when a render thread needs one and no context is free, and are given
+ * back to the pool at the end of the render. There are thus never more contexts than concurrent renders,
+ * and each context keeps its OpenGL objects (shaders, textures...) from one render to the next.
+ * The pool is usually a member of the effect instance.
+ * All functions are thread-safe.
+ * OSMesa is available if HAVE_OSMESA was defined when compiling ofxsOGLOSMesa.cpp and ofxsOGLFunctions_mesa.cpp.
+ **/
+class OSMesaContextPool
+{
+public:
+    explicit OSMesaContextPool(int depthBits = 24,
+                               int stencilBits = 0,
+                               int accumBits = 0);
+
+    /// All the contexts must have been given back to the pool.
+    ~OSMesaContextPool();
+
+    /// Returns true if OSMesa is available.
+    static bool isAvailable();
+
+    /// Destroy the contexts that are not in use, e.g. in the purgeCaches action.
+    void purge();
+
+private:
+    friend class OSMesaRenderContext;
+
+    OSMesaContextData* acquire(bool* isNew);
+    void release(OSMesaContextData* data);
+
+    auto_ptr<OSMesaContextPoolPrivate> _imp;
+};
+
+/**
+ * @brief Binds a context of the pool to the current thread, to render the render window of the destination image.
+ * If the destination image is RGBA, OSMesa renders directly into the image memory, so there is no readback.
+ * Otherwise, rendering is done in a buffer owned by the context, which is reused by the following renders,
+ * and finish() copies the rendered channels to the destination image.
+ * The viewport is the render window: pixel (x,y) of the viewport is pixel (renderWindow.x1 + x, renderWindow.y1 + y)
+ * of the destination image.
+ * The OpenGL functions must be called through GL_CPU (see ofxsOGLFunctions.h).
+ *
+ * Typical use in render():
+ *
+ *     OSMesaRenderContext context(_osmesaPool, dst.get(), args.renderWindow);
+ *     if ( context.isNew() ) {
+ *         // create the shaders and textures of this context
+ *     }
+ *     GL_CPU::glViewport(0, 0, args.renderWindow.x2 - args.renderWindow.x1, args.renderWindow.y2 - args.renderWindow.y1);
+ *     // ... render
+ *     context.finish();
+ *
+ * The constructor throws an OFX::Exception::Suite if OSMesa is not available, if the pixel depth is not
+ * supported (half-float images are not), or if the context cannot be bound.
+ **/
+class OSMesaRenderContext
+{
+public:
+    OSMesaRenderContext(OSMesaContextPool & pool,
+                        OFX::Image* dstImg,
+                        const OfxRectI & renderWindow);
+
+    /// Unbinds the context and gives it back to the pool. This does not call finish().
+    ~OSMesaRenderContext();
+
+    /// True if the context was created for this render, and has no OpenGL objects yet.
+    bool isNew() const
+    {
+        return _isNew;
+    }
+
+    /// True if OSMesa renders directly into the destination image.
+    bool rendersDirectly() const
+    {
+        return _direct;
+    }
+
+    /// Wait for the end of rendering, and copy the result to the destination image if necessary.
+    void finish();
+
+private:
+    // non-copyable
+    OSMesaRenderContext(const OSMesaRenderContext &);
+    OSMesaRenderContext & operator=(const OSMesaRenderContext &);
+
+    OSMesaContextPool & _pool;
+    OSMesaContextData* _data;
+    OFX::Image* _dstImg;
+    OfxRectI _renderWindow;
+    int _bytesPerComponent;
+    bool _isNew;
+    bool _direct;
+};
+} // namespace OFX
+
+#endif /* defined(openfx_supportext_ofxsOGLOSMesa_h) */
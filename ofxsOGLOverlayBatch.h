@@ -0,0 +1,316 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; -*- */
+/* ***** BEGIN LICENSE BLOCK *****
+ * This file is part of openfx-supportext <https://github.com/NatronGitHub/openfx-supportext>,
+ * (C) 2018-2021 The Natron Developers
+ * (C) 2013-2018 INRIA
+ *
+ * openfx-supportext is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * openfx-supportext is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openfx-supportext.  If not, see <http://www.gnu.org/licenses/gpl-2.0.html>
+ * ***** END LICENSE BLOCK ***** */
+
+/*
+ * OFX overlay batch: draw the geometry of an interact with a few draw calls.
+ */
+
+#ifndef openfx_supportext_ofxsOGLOverlayBatch_h
+#define openfx_supportext_ofxsOGLOverlayBatch_h
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#ifdef __APPLE__
+#ifndef GL_SILENCE_DEPRECATION
+#define GL_SILENCE_DEPRECATION // Yes, we are still doing OpenGL 2.1
+#endif
+#include <OpenGL/gl.h>
+#else
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+#include <GL/gl.h>
+#endif
+
+namespace OFX {
+/**
+ * @brief Collects the points, lines and quads of an overlay, and draws them with a few draw calls.
+ * Interacts draw everything twice (shadow and drawing), with hundreds of glVertex calls each time:
+ * with OverlayBatch, the geometry is collected once per draw action, and each pass is drawn from
+ * client-side vertex arrays (OpenGL 1.1), one glDrawArrays per run of consecutive primitives of the
+ * same type and state.
+ *
+ * The color, point size, line width, point smoothing, line stippling and modelview matrix are set
+ * as in OpenGL, and apply to the primitives added afterwards. Vertices are transformed by the
+ * current matrix when they are added. Line strips and loops are split into segments.
+ **/
+class OverlayBatch
+{
+public:
+    OverlayBatch()
+        : _vertices()
+        , _colors()
+        , _runs()
+        , _pointSize(1.f)
+        , _lineWidth(1.f)
+        , _pointSmooth(false)
+        , _lineStipple(false)
+        , _matrixStack()
+    {
+        _color[0] = _color[1] = _color[2] = _color[3] = 1.f;
+        loadIdentity();
+    }
+
+    /** @brief remove all primitives and reset the matrix, to start a new frame (the other states are kept) */
+    void clear()
+    {
+        _vertices.clear();
+        _colors.clear();
+        _runs.clear();
+        _matrixStack.clear();
+        loadIdentity();
+    }
+
+    bool empty() const
+    {
+        return _runs.empty();
+    }
+
+    /** @brief the color of the vertices added after this call */
+    void setColor(float r,
+                  float g,
+                  float b,
+                  float a = 1.f)
+    {
+        _color[0] = r;
+        _color[1] = g;
+        _color[2] = b;
+        _color[3] = a;
+    }
+
+    void setPointSize(float size)
+    {
+        _pointSize = size;
+    }
+
+    void setLineWidth(float width)
+    {
+        _lineWidth = width;
+    }
+
+    /** @brief enable GL_POINT_SMOOTH for the points added after this call */
+    void setPointSmooth(bool enable)
+    {
+        _pointSmooth = enable;
+    }
+
+    /** @brief enable GL_LINE_STIPPLE for the lines added after this call (the pattern is set by the caller with glLineStipple) */
+    void setLineStipple(bool enable)
+    {
+        _lineStipple = enable;
+    }
+
+    void pushMatrix()
+    {
+        _matrixStack.insert(_matrixStack.end(), _matrix, _matrix + 6);
+    }
+
+    void popMatrix()
+    {
+        if ( _matrixStack.empty() ) {
+            return;
+        }
+        std::copy(_matrixStack.end() - 6, _matrixStack.end(), _matrix);
+        _matrixStack.resize(_matrixStack.size() - 6);
+    }
+
+    void translate(double x,
+                   double y)
+    {
+        const double m[6] = { 1., 0., 0., 1., x, y };
+
+        multMatrix2D(m);
+    }
+
+    /** @brief rotate by angle degrees around the z axis, as glRotated(angle, 0, 0, 1) */
+    void rotate(double angle)
+    {
+        const double a = angle * 3.14159265358979323846264338327950288 / 180.;
+        const double c = std::cos(a);
+        const double s = std::sin(a);
+        const double m[6] = { c, s, -s, c, 0., 0. };
+
+        multMatrix2D(m);
+    }
+
+    /** @brief multiply by the xy part of a column-major 4x4 matrix, as glMultMatrixd() */
+    void multMatrix(const double m[16])
+    {
+        const double m2[6] = { m[0], m[1], m[4], m[5], m[12], m[13] };
+
+        multMatrix2D(m2);
+    }
+
+    void addPoint(double x,
+                  double y)
+    {
+        addVertex(GL_POINTS, x, y);
+    }
+
+    void addLine(double x1,
+                 double y1,
+                 double x2,
+                 double y2)
+    {
+        addVertex(GL_LINES, x1, y1);
+        addVertex(GL_LINES, x2, y2);
+    }
+
+    /** @brief add a line strip (or a line loop if closed is true) through n points, given as x,y pairs */
+    void addLineStrip(const double* xy,
+                      int n,
+                      bool closed)
+    {
+        for (int i = 0; i + 1 < n; ++i) {
+            addLine(xy[2 * i], xy[2 * i + 1], xy[2 * i + 2], xy[2 * i + 3]);
+        }
+        if ( closed && (n > 2) ) {
+            addLine(xy[2 * (n - 1)], xy[2 * (n - 1) + 1], xy[0], xy[1]);
+        }
+    }
+
+    /** @brief add a filled rectangle (which is not axis-aligned if the current matrix is not) */
+    void addQuad(double x1,
+                 double y1,
+                 double x2,
+                 double y2)
+    {
+        addVertex(GL_QUADS, x1, y1);
+        addVertex(GL_QUADS, x1, y2);
+        addVertex(GL_QUADS, x2, y2);
+        addVertex(GL_QUADS, x2, y1);
+    }
+
+    /**
+     * @brief Draw all the primitives, in the order they were added.
+     * If shadow is true, they are drawn in opaque black (the caller translates GL_PROJECTION by one pixel).
+     * Sets the point size, line width, GL_POINT_SMOOTH and GL_LINE_STIPPLE (the caller is responsible for protecting attribs).
+     **/
+    void draw(bool shadow) const
+    {
+        if ( empty() ) {
+            return;
+        }
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glVertexPointer(2, GL_DOUBLE, 0, &_vertices.front());
+        if (shadow) {
+            glColor4f(0.f, 0.f, 0.f, 1.f);
+        } else {
+            glEnableClientState(GL_COLOR_ARRAY);
+            glColorPointer(4, GL_FLOAT, 0, &_colors.front());
+        }
+        for (std::vector<Run>::const_iterator it = _runs.begin(); it != _runs.end(); ++it) {
+            if (it->mode == GL_POINTS) {
+                glPointSize(it->size);
+                enable(GL_POINT_SMOOTH, it->smoothOrStipple);
+            } else if (it->mode == GL_LINES) {
+                glLineWidth(it->size);
+                enable(GL_LINE_STIPPLE, it->smoothOrStipple);
+            }
+            glDrawArrays(it->mode, it->first, it->count);
+        }
+        if (!shadow) {
+            glDisableClientState(GL_COLOR_ARRAY);
+        }
+        glDisableClientState(GL_VERTEX_ARRAY);
+    }
+
+private:
+    // a run of consecutive primitives of the same type and state
+    struct Run
+    {
+        GLenum mode;
+        float size; // point size or line width
+        bool smoothOrStipple; // GL_POINT_SMOOTH for points, GL_LINE_STIPPLE for lines
+        GLint first; // first vertex
+        GLsizei count; // number of vertices
+    };
+
+    static void enable(GLenum cap,
+                       bool enabled)
+    {
+        if (enabled) {
+            glEnable(cap);
+        } else {
+            glDisable(cap);
+        }
+    }
+
+    void loadIdentity()
+    {
+        _matrix[0] = 1.; _matrix[1] = 0.; _matrix[2] = 0.; _matrix[3] = 1.; _matrix[4] = 0.; _matrix[5] = 0.;
+    }
+
+    // _matrix = _matrix * m, where m = [m0 m2 m4; m1 m3 m5]
+    void multMatrix2D(const double m[6])
+    {
+        const double* a = _matrix;
+        const double r[6] = {
+            a[0] * m[0] + a[2] * m[1], a[1] * m[0] + a[3] * m[1],
+            a[0] * m[2] + a[2] * m[3], a[1] * m[2] + a[3] * m[3],
+            a[0] * m[4] + a[2] * m[5] + a[4], a[1] * m[4] + a[3] * m[5] + a[5]
+        };
+
+        std::copy(r, r + 6, _matrix);
+    }
+
+    void addVertex(GLenum mode,
+                   double x,
+                   double y)
+    {
+        const float size = (mode == GL_POINTS) ? _pointSize : ( (mode == GL_LINES) ? _lineWidth : 0.f );
+        const bool smoothOrStipple = (mode == GL_POINTS) ? _pointSmooth : ( (mode == GL_LINES) ? _lineStipple : false );
+
+        if ( _runs.empty() || (_runs.back().mode != mode) || (_runs.back().size != size) || (_runs.back().smoothOrStipple != smoothOrStipple) ) {
+            Run run;
+            run.mode = mode;
+            run.size = size;
+            run.smoothOrStipple = smoothOrStipple;
+            run.first = (GLint)(_vertices.size() / 2);
+            run.count = 0;
+            _runs.push_back(run);
+        }
+        ++_runs.back().count;
+        _vertices.push_back(_matrix[0] * x + _matrix[2] * y + _matrix[4]);
+        _vertices.push_back(_matrix[1] * x + _matrix[3] * y + _matrix[5]);
+        _colors.insert(_colors.end(), _color, _color + 4);
+    }
+
+    std::vector<GLdouble> _vertices; // x, y
+    std::vector<GLfloat> _colors; // r, g, b, a
+    std::vector<Run> _runs;
+    float _color[4];
+    float _pointSize;
+    float _lineWidth;
+    bool _pointSmooth;
+    bool _lineStipple;
+    double _matrix[6]; // the 2D affine part of the modelview matrix: x' = m0 x + m2 y + m4, y' = m1 x + m3 y + m5
+    std::vector<double> _matrixStack;
+};
+} // namespace OFX
+
+#endif /* defined(openfx_supportext_ofxsOGLOverlayBatch_h) */
@@ -0,0 +1,704 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; -*- */
+/* ***** BEGIN LICENSE BLOCK *****
+ * This file is part of openfx-supportext <https://github.com/NatronGitHub/openfx-supportext>,
+ * (C) 2018-2021 The Natron Developers
+ * (C) 2013-2018 INRIA
+ *
+ * openfx-supportext is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * openfx-supportext is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openfx-supportext.  If not, see <http://www.gnu.org/licenses/gpl-2.0.html>
+ * ***** END LICENSE BLOCK ***** */
+
+/*
+ * OFX utilities for transferring pixels between OFX images and OpenGL, for effects that render with OpenGL.
+ *
+ * The classes are templated by the OpenGL functions to use, GL_GPU or GL_CPU (see ofxsOGLFunctions.h),
+ * so that the same code works with the host's OpenGL context and with an OSMesa context.
+ * All the OpenGL objects belong to the context that was bound when they were created: an object of these
+ * classes must only be used with one context, e.g. an effect member used between the contextAttached and
+ * contextDetached actions, or a local variable of the render action. release() must be called with that
+ * context bound: the destructor does not call OpenGL.
+ * With GL_GPU, ofxsLoadOpenGLOnce() must have been called.
+ */
+
+#ifndef openfx_supportext_ofxsOGLPixelTransfer_h
+#define openfx_supportext_ofxsOGLPixelTransfer_h
+
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+#include "ofxsImageEffect.h"
+#include "ofxsOGLFunctions.h"
+#include "ofxsOGLUtilities.h"
+
+namespace OFX {
+/**
+ * @brief Returns the number of bytes of a pixel in the given format and type, as used by glTexImage2D
+ * and glReadPixels. Throws kOfxStatErrImageFormat if the format or type is not supported.
+ **/
+inline int
+getOpenGLPixelBytes(GLenum format,
+                    GLenum type)
+{
+    int nComponents;
+
+    switch (format) {
+    case GL_RGBA:
+    case GL_BGRA:
+        nComponents = 4;
+        break;
+    case GL_RGB:
+        nComponents = 3;
+        break;
+    case GL_LUMINANCE_ALPHA:
+        nComponents = 2;
+        break;
+    case GL_ALPHA:
+    case GL_LUMINANCE:
+    case GL_RED:
+        nComponents = 1;
+        break;
+    default:
+        throwSuiteStatusException(kOfxStatErrImageFormat);
+
+        return 0;
+    }
+    switch (type) {
+    case GL_UNSIGNED_BYTE:
+
+        return nComponents;
+    case GL_UNSIGNED_SHORT:
+
+        return nComponents * 2;
+    case GL_FLOAT:
+
+        return nComponents * 4;
+    default:
+        throwSuiteStatusException(kOfxStatErrImageFormat);
+
+        return 0;
+    }
+}
+
+/**
+ * @brief Gets the OpenGL format and type of the pixels of an image: RGBA, RGB and Alpha images
+ * of 8 bits, 16 bits or float components are supported.
+ * Throws kOfxStatErrImageFormat for other images (e.g. half-float images).
+ **/
+inline void
+getOpenGLImageFormat(const Image* img,
+                     GLenum* format,
+                     GLenum* type)
+{
+    assert(img);
+    switch ( img->getPixelComponentCount() ) {
+    case 4:
+        *format = GL_RGBA;
+        break;
+    case 3:
+        *format = GL_RGB;
+        break;
+    case 1:
+        *format = GL_ALPHA;
+        break;
+    default:
+        throwSuiteStatusException(kOfxStatErrImageFormat);
+
+        return;
+    }
+    switch ( img->getPixelDepth() ) {
+    case eBitDepthUByte:
+        *type = GL_UNSIGNED_BYTE;
+        break;
+    case eBitDepthUShort:
+        *type = GL_UNSIGNED_SHORT;
+        break;
+    case eBitDepthFloat:
+        *type = GL_FLOAT;
+        break;
+    default:
+        throwSuiteStatusException(kOfxStatErrImageFormat);
+
+        return;
+    }
+}
+
+/**
+ * @brief Returns true if pixel buffer objects can be used with the OpenGL functions GL.
+ * OSMesa always supports them.
+ **/
+template <typename GL>
+bool
+getOpenGLSupportPixelbuffer()
+{
+    if ( !GL::isGPU() ) {
+        return true;
+    }
+
+    // the buffer functions are core since OpenGL 1.5
+    return getOpenGLSupportPixelbuffer() && ( getOpenGLMajorVersion() > 1 || getOpenGLMinorVersion() >= 5 );
+}
+
+/**
+ * @brief Uploads pixels to textures through two pixel buffer objects, used in turn.
+ * map() gives a buffer to fill, and upload() starts the copy from that buffer to the texture and returns
+ * immediately: the transfer is done by the driver while the next buffer is filled, e.g. with the next tile
+ * or the next input image converted on the CPU.
+ * If pixel buffer objects are not supported, map() gives memory owned by the uploader, and upload() is synchronous.
+ *
+ * Typical use:
+ *
+ *     _uploader.uploadImage(src.get(), renderWindow, GL_TEXTURE_2D, 0, 0, 0); // texture is bound
+ **/
+template <typename GL>
+class TextureUploader
+{
+public:
+    TextureUploader()
+        : _checked(false)
+        , _usePBO(false)
+        , _next(0)
+        , _mapped(NULL)
+        , _mappedPBO(false)
+        , _width(0)
+        , _height(0)
+        , _format(GL_RGBA)
+        , _type(GL_UNSIGNED_BYTE)
+        , _data()
+    {
+        _buffers[0] = _buffers[1] = 0;
+    }
+
+    /// Deletes the buffers. The OpenGL context must be bound.
+    void release()
+    {
+        assert(!_mapped);
+        if (_buffers[0]) {
+            GL::glDeleteBuffers(2, _buffers);
+            _buffers[0] = _buffers[1] = 0;
+        }
+        _checked = false;
+        std::vector<unsigned char>().swap(_data);
+    }
+
+    /**
+     * @brief Returns memory for width x height pixels of the given format and type, to be filled before calling upload().
+     * The rows are bottom-up and contiguous, without padding.
+     **/
+    void* map(int width,
+              int height,
+              GLenum format,
+              GLenum type)
+    {
+        assert(!_mapped && width > 0 && height > 0);
+        std::size_t size = (std::size_t)width * height * getOpenGLPixelBytes(format, type);
+        _width = width;
+        _height = height;
+        _format = format;
+        _type = type;
+        _mappedPBO = false;
+        if (!_checked) {
+            _checked = true;
+            _usePBO = getOpenGLSupportPixelbuffer<GL>();
+            if (_usePBO) {
+                GL::glGenBuffers(2, _buffers);
+            }
+        }
+        if (_usePBO) {
+            GL::glBindBuffer(GL_PIXEL_UNPACK_BUFFER_ARB, _buffers[_next]);
+            // reallocating the storage lets the driver keep the previous one until its transfer is done
+            GL::glBufferData(GL_PIXEL_UNPACK_BUFFER_ARB, size, NULL, GL_STREAM_DRAW);
+            _mapped = GL::glMapBuffer(GL_PIXEL_UNPACK_BUFFER_ARB, GL_WRITE_ONLY);
+            GL::glBindBuffer(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
+            _mappedPBO = (_mapped != NULL);
+        }
+        if (!_mappedPBO) {
+            if (_data.size() < size) {
+                _data.resize(size);
+            }
+            _mapped = &_data.front();
+        }
+
+        return _mapped;
+    }
+
+    /**
+     * @brief Copies the pixels of the last map() to the region of the texture currently bound to target,
+     * which must have been allocated (e.g. with glTexImage2D and NULL data) and be large enough.
+     **/
+    void upload(GLenum target,
+                GLint level,
+                GLint xoffset,
+                GLint yoffset)
+    {
+        assert(_mapped);
+        GL::glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+        GL::glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        GL::glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        GL::glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+        GL::glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+        if (_mappedPBO) {
+            GL::glBindBuffer(GL_PIXEL_UNPACK_BUFFER_ARB, _buffers[_next]);
+            GL::glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER_ARB);
+            // the data is an offset in the bound buffer
+            GL::glTexSubImage2D(target, level, xoffset, yoffset, _width, _height, _format, _type, NULL);
+            GL::glBindBuffer(GL_PIXEL_UNPACK_BUFFER_ARB, 0);
+            _next = 1 - _next;
+        } else {
+            GL::glTexSubImage2D(target, level, xoffset, yoffset, _width, _height, _format, _type, _mapped);
+        }
+        GL::glPopClientAttrib();
+        _mapped = NULL;
+        _mappedPBO = false;
+    }
+
+    /**
+     * @brief Uploads the pixels of the window of an image to the region at (xoffset,yoffset) of the texture currently
+     * bound to target. The window must be inside the image bounds.
+     **/
+    void uploadImage(const Image* img,
+                     const OfxRectI & window,
+                     GLenum target,
+                     GLint level,
+                     GLint xoffset,
+                     GLint yoffset)
+    {
+        GLenum format, type;
+
+        getOpenGLImageFormat(img, &format, &type);
+        int width = window.x2 - window.x1;
+        int height = window.y2 - window.y1;
+        if ( (width <= 0) || (height <= 0) ) {
+            return;
+        }
+        std::size_t rowSize = (std::size_t)width * getOpenGLPixelBytes(format, type);
+        unsigned char* dst = (unsigned char*)map(width, height, format, type);
+        for (int y = window.y1; y < window.y2; ++y, dst += rowSize) {
+            const void* src = img->getPixelAddress(window.x1, y);
+            assert(src);
+            std::memcpy(dst, src, rowSize);
+        }
+        upload(target, level, xoffset, yoffset);
+    }
+
+private:
+    // non-copyable
+    TextureUploader(const TextureUploader &);
+    TextureUploader & operator=(const TextureUploader &);
+
+    bool _checked; // true if _usePBO was set
+    bool _usePBO;
+    GLuint _buffers[2];
+    int _next; // the buffer used by the next map()
+    void* _mapped;
+    bool _mappedPBO; // true if _mapped is in _buffers[_next]
+    int _width;
+    int _height;
+    GLenum _format;
+    GLenum _type;
+    std::vector<unsigned char> _data; // used if pixel buffer objects cannot be used
+};
+
+/**
+ * @brief Reads pixels of the read framebuffer asynchronously, through two pixel buffer objects used in turn.
+ * start() starts reading a rectangle and returns immediately. The pixels are only waited for by finish()
+ * (or map()), so that work can be done in between: rendering the next tile, or converting the previous one.
+ * At most two reads can be pending: finish() must be called before the third start().
+ * If pixel buffer objects are not supported, start() reads the pixels synchronously.
+ *
+ * Typical use, with two tiles:
+ *
+ *     // render tile 0
+ *     readback.start(tile0, GL_RGBA, GL_FLOAT);
+ *     // render tile 1
+ *     readback.start(tile1, GL_RGBA, GL_FLOAT);
+ *     readback.finish(dst.get(), dstWindow0); // tile 1 is still being read
+ *     readback.finish(dst.get(), dstWindow1);
+ **/
+template <typename GL>
+class PixelReadback
+{
+public:
+    PixelReadback()
+        : _checked(false)
+        , _usePBO(false)
+        , _first(0)
+        , _count(0)
+        , _mapped(NULL)
+    {
+        for (int i = 0; i < 2; ++i) {
+            _reads[i].buffer = 0;
+            _reads[i].rect.x1 = _reads[i].rect.y1 = _reads[i].rect.x2 = _reads[i].rect.y2 = 0;
+            _reads[i].format = GL_RGBA;
+            _reads[i].type = GL_UNSIGNED_BYTE;
+        }
+    }
+
+    /// Deletes the buffers, and drops the pending reads. The OpenGL context must be bound.
+    void release()
+    {
+        assert(!_mapped);
+        for (int i = 0; i < 2; ++i) {
+            if (_reads[i].buffer) {
+                GL::glDeleteBuffers(1, &_reads[i].buffer);
+                _reads[i].buffer = 0;
+            }
+            std::vector<unsigned char>().swap(_reads[i].data);
+        }
+        _checked = false;
+        _first = 0;
+        _count = 0;
+    }
+
+    /// The number of reads started and not finished.
+    int pendingCount() const
+    {
+        return _count;
+    }
+
+    /**
+     * @brief Starts reading the rectangle of the read buffer of the bound framebuffer, in window coordinates.
+     * Throws kOfxStatFailed if two reads are already pending.
+     **/
+    void start(const OfxRectI & rect,
+               GLenum format,
+               GLenum type)
+    {
+        if (_count == 2) {
+            throwSuiteStatusException(kOfxStatFailed);
+
+            return;
+        }
+        int width = rect.x2 - rect.x1;
+        int height = rect.y2 - rect.y1;
+        assert(width > 0 && height > 0);
+        std::size_t size = (std::size_t)width * height * getOpenGLPixelBytes(format, type);
+        if (!_checked) {
+            _checked = true;
+            _usePBO = getOpenGLSupportPixelbuffer<GL>();
+        }
+        Read & read = _reads[(_first + _count) % 2];
+        read.rect = rect;
+        read.format = format;
+        read.type = type;
+        GL::glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+        GL::glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        GL::glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+        GL::glPixelStorei(GL_PACK_SKIP_PIXELS, 0);
+        GL::glPixelStorei(GL_PACK_SKIP_ROWS, 0);
+        if (_usePBO) {
+            if (!read.buffer) {
+                GL::glGenBuffers(1, &read.buffer);
+            }
+            GL::glBindBuffer(GL_PIXEL_PACK_BUFFER_ARB, read.buffer);
+            GL::glBufferData(GL_PIXEL_PACK_BUFFER_ARB, size, NULL, GL_STREAM_READ);
+            // the data is an offset in the bound buffer: this returns without waiting for the pixels
+            GL::glReadPixels(rect.x1, rect.y1, width, height, format, type, NULL);
+            GL::glBindBuffer(GL_PIXEL_PACK_BUFFER_ARB, 0);
+        } else {
+            if (read.data.size() < size) {
+                read.data.resize(size);
+            }
+            GL::glReadPixels(rect.x1, rect.y1, width, height, format, type, &read.data.front());
+        }
+        GL::glPopClientAttrib();
+        ++_count;
+    }
+
+    /**
+     * @brief Waits for the oldest pending read, and returns its pixels, which are valid until unmap().
+     * The rows are bottom-up and contiguous, without padding.
+     * rect, format and type, if not NULL, are set to the parameters of start().
+     * Returns NULL if there is no pending read, or if the buffer cannot be mapped.
+     **/
+    const void* map(OfxRectI* rect = NULL,
+                    GLenum* format = NULL,
+                    GLenum* type = NULL)
+    {
+        assert(!_mapped);
+        if (_count == 0) {
+            return NULL;
+        }
+        Read & read = _reads[_first];
+        if (rect) {
+            *rect = read.rect;
+        }
+        if (format) {
+            *format = read.format;
+        }
+        if (type) {
+            *type = read.type;
+        }
+        if (_usePBO) {
+            GL::glBindBuffer(GL_PIXEL_PACK_BUFFER_ARB, read.buffer);
+            _mapped = GL::glMapBuffer(GL_PIXEL_PACK_BUFFER_ARB, GL_READ_ONLY);
+            GL::glBindBuffer(GL_PIXEL_PACK_BUFFER_ARB, 0);
+            if (!_mapped) {
+                // drop this read
+                _first = 1 - _first;
+                --_count;
+            }
+        } else {
+            _mapped = &read.data.front();
+        }
+
+        return _mapped;
+    }
+
+    /// Gives back the pixels returned by map(), and ends the oldest pending read.
+    void unmap()
+    {
+        assert(_mapped && _count > 0);
+        if (_usePBO) {
+            GL::glBindBuffer(GL_PIXEL_PACK_BUFFER_ARB, _reads[_first].buffer);
+            GL::glUnmapBuffer(GL_PIXEL_PACK_BUFFER_ARB);
+            GL::glBindBuffer(GL_PIXEL_PACK_BUFFER_ARB, 0);
+        }
+        _mapped = NULL;
+        _first = 1 - _first;
+        --_count;
+    }
+
+    /**
+     * @brief Waits for the oldest pending read, and copies its pixels to the window of the image,
+     * which must have the size of the rectangle read, and be inside the image bounds.
+     * The read must have been started with the format and type of the image (see getOpenGLImageFormat()).
+     * Throws kOfxStatErrImageFormat if this is not the case, and kOfxStatFailed if there is no pending read
+     * or if the pixels cannot be mapped.
+     **/
+    void finish(Image* dstImg,
+                const OfxRectI & dstWindow)
+    {
+        GLenum dstFormat, dstType;
+
+        getOpenGLImageFormat(dstImg, &dstFormat, &dstType);
+        OfxRectI rect;
+        GLenum format, type;
+        const unsigned char* src = (const unsigned char*)map(&rect, &format, &type);
+        if (!src) {
+            throwSuiteStatusException(kOfxStatFailed);
+
+            return;
+        }
+        if ( (format != dstFormat) || (type != dstType) ||
+             ( (rect.x2 - rect.x1) != (dstWindow.x2 - dstWindow.x1) ) || ( (rect.y2 - rect.y1) != (dstWindow.y2 - dstWindow.y1) ) ) {
+            unmap();
+            throwSuiteStatusException(kOfxStatErrImageFormat);
+
+            return;
+        }
+        std::size_t rowSize = (std::size_t)(rect.x2 - rect.x1) * getOpenGLPixelBytes(format, type);
+        for (int y = dstWindow.y1; y < dstWindow.y2; ++y, src += rowSize) {
+            void* dst = dstImg->getPixelAddress(dstWindow.x1, y);
+            assert(dst);
+            std::memcpy(dst, src, rowSize);
+        }
+        unmap();
+    }
+
+private:
+    // non-copyable
+    PixelReadback(const PixelReadback &);
+    PixelReadback & operator=(const PixelReadback &);
+
+    struct Read
+    {
+        GLuint buffer;
+        std::vector<unsigned char> data; // used if pixel buffer objects cannot be used
+        OfxRectI rect;
+        GLenum format;
+        GLenum type;
+    };
+
+    bool _checked; // true if _usePBO was set
+    bool _usePBO;
+    Read _reads[2];
+    int _first; // the oldest pending read
+    int _count; // the number of pending reads
+    const void* _mapped;
+};
+
+/**
+ * @brief Framebuffer objects rendering to a texture, kept from one render to the next.
+ * bind() binds a framebuffer object whose color attachment is a texture of the given size and internal format,
+ * and creates it if none of the cached ones matches. At most maxTargets are kept: the least recently
+ * used one is deleted when a new one is needed, except the one that is bound, so that its texture can be
+ * read while rendering to the next one (e.g. in multi-pass rendering). maxTargets is at least 2.
+ * Throws kOfxStatErrUnsupported if framebuffer objects are not supported, or if the framebuffer
+ * is not complete (e.g. float textures are not supported).
+ *
+ * Typical use:
+ *
+ *     GLuint texture = _targets.bind(width, height, GL_RGBA32F_ARB);
+ *     GL::glViewport(0, 0, width, height);
+ *     // render...
+ *     _readback.start(rect, GL_RGBA, GL_FLOAT);
+ *     _targets.unbind();
+ **/
+template <typename GL>
+class RenderTargetCache
+{
+public:
+    explicit RenderTargetCache(int maxTargets = 4)
+        : _maxTargets(maxTargets > 2 ? maxTargets : 2)
+        , _targets()
+        , _useCount(0)
+        , _bound(-1)
+        , _previousFramebuffer(0)
+    {
+    }
+
+    /// Deletes the framebuffers and their textures. The OpenGL context must be bound.
+    void release()
+    {
+        assert(_bound < 0);
+        for (std::size_t i = 0; i < _targets.size(); ++i) {
+            deleteTarget(_targets[i]);
+        }
+        _targets.clear();
+    }
+
+    /**
+     * @brief Binds a framebuffer rendering to a texture of the given size and internal format, and returns the texture.
+     * The framebuffer that was bound is restored by unbind(). The viewport is not changed.
+     **/
+    GLuint bind(int width,
+                int height,
+                GLenum internalFormat)
+    {
+        assert(width > 0 && height > 0);
+        if ( GL::isGPU() && !getOpenGLSupportFramebuffer() ) {
+            throwSuiteStatusException(kOfxStatErrUnsupported);
+
+            return 0;
+        }
+        if (_bound < 0) {
+            GLint framebuffer = 0;
+            GL::glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+            _previousFramebuffer = (GLuint)framebuffer;
+        }
+        ++_useCount;
+        for (std::size_t i = 0; i < _targets.size(); ++i) {
+            Target & t = _targets[i];
+            if ( (t.width == width) && (t.height == height) && (t.internalFormat == internalFormat) ) {
+                t.lastUse = _useCount;
+                _bound = (int)i;
+                GL::glBindFramebuffer(GL_FRAMEBUFFER, t.framebuffer);
+
+                return t.texture;
+            }
+        }
+
+        // no matching target: replace the least recently used one if the cache is full, but never the bound one
+        std::size_t index = _targets.size();
+        if ( (int)_targets.size() >= _maxTargets ) {
+            index = (_bound == 0) ? 1 : 0;
+            for (std::size_t i = index + 1; i < _targets.size(); ++i) {
+                if ( ( (int)i != _bound ) && (_targets[i].lastUse < _targets[index].lastUse) ) {
+                    index = i;
+                }
+            }
+            deleteTarget(_targets[index]);
+        } else {
+            _targets.push_back( Target() );
+        }
+        Target & t = _targets[index];
+        t.width = width;
+        t.height = height;
+        t.internalFormat = internalFormat;
+        t.lastUse = _useCount;
+
+        GLint previousTexture = 0;
+        GL::glGetIntegerv(GL_TEXTURE_BINDING_2D, &previousTexture);
+        GL::glGenTextures(1, &t.texture);
+        GL::glBindTexture(GL_TEXTURE_2D, t.texture);
+        GL::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        GL::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        GL::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        GL::glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        GL::glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        GL::glBindTexture(GL_TEXTURE_2D, (GLuint)previousTexture);
+
+        GL::glGenFramebuffers(1, &t.framebuffer);
+        GL::glBindFramebuffer(GL_FRAMEBUFFER, t.framebuffer);
+        GL::glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, t.texture, 0);
+        if (GL::glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            GL::glBindFramebuffer(GL_FRAMEBUFFER, _previousFramebuffer);
+            deleteTarget(t);
+            _targets.erase( _targets.begin() + index );
+            _bound = -1;
+            throwSuiteStatusException(kOfxStatErrUnsupported);
+
+            return 0;
+        }
+        _bound = (int)index;
+
+        return t.texture;
+    }
+
+    /// Binds the framebuffer that was bound before bind().
+    void unbind()
+    {
+        if (_bound < 0) {
+            return;
+        }
+        GL::glBindFramebuffer(GL_FRAMEBUFFER, _previousFramebuffer);
+        _bound = -1;
+    }
+
+private:
+    // non-copyable
+    RenderTargetCache(const RenderTargetCache &);
+    RenderTargetCache & operator=(const RenderTargetCache &);
+
+    struct Target
+    {
+        GLuint framebuffer;
+        GLuint texture;
+        int width;
+        int height;
+        GLenum internalFormat;
+        unsigned int lastUse;
+
+        Target()
+            : framebuffer(0)
+            , texture(0)
+            , width(0)
+            , height(0)
+            , internalFormat(0)
+            , lastUse(0)
+        {
+        }
+    };
+
+    static void deleteTarget(Target & t)
+    {
+        if (t.framebuffer) {
+            GL::glDeleteFramebuffers(1, &t.framebuffer);
+            t.framebuffer = 0;
+        }
+        if (t.texture) {
+            GL::glDeleteTextures(1, &t.texture);
+            t.texture = 0;
+        }
+    }
+
+    int _maxTargets;
+    std::vector<Target> _targets;
+    unsigned int _useCount;
+    int _bound; // index of the bound target, or -1
+    GLuint _previousFramebuffer;
+};
+} // namespace OFX
+
+#endif /* defined(openfx_supportext_ofxsOGLPixelTransfer_h) */
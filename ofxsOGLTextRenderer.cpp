@@ -49,6 +49,20 @@
 #include "ofxsOGLFontUtils.h"
 
 #include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#ifdef __APPLE__
+#include <OpenGL/OpenGL.h>
+#elif !defined(_WIN32) && defined(OFX_TEXTRENDERER_GLX)
+#include <GL/glx.h>
+#endif
+
+// Maximum number of string layouts kept in the cache. Overlays usually draw a small
+// set of labels over and over, so the cache is simply flushed when it gets bigger.
+#define kTextRendererLayoutCacheSize 1024
 
 namespace  {
 const OFX::SFG_Font*
@@ -89,23 +103,356 @@ getFont(OFX::TextRenderer::Font font)
         break;
     }
 }
+
+// Texture names only make sense in the context (or share group) they were created in,
+// and overlays of different viewers may be drawn from different contexts.
+// Returns NULL if the current context cannot be known, in which case nothing is cached.
+// On X11, GLX is only used if OFX_TEXTRENDERER_GLX is defined, so that plugins do not depend on it.
+const void*
+getCurrentContext()
+{
+#if defined(__APPLE__)
+
+    return CGLGetCurrentContext();
+#elif defined(_WIN32)
+
+    return wglGetCurrentContext();
+#elif defined(OFX_TEXTRENDERER_GLX)
+
+    return glXGetCurrentContext();
+#else
+
+    return NULL;
+#endif
 }
 
-void
-OFX::TextRenderer::bitmapString(const char *string,
-                                TextRenderer::Font f)
+unsigned int
+nextPowerOfTwo(unsigned int v)
+{
+    unsigned int p = 1;
+
+    while (p < v) {
+        p <<= 1;
+    }
+
+    return p;
+}
+
+/*
+ * All the glyphs of a font, uploaded once in a 16x16 grid of cells to an alpha texture.
+ * Glyph c is in cell (c % 16, c / 16), with its bottom row at the bottom of the cell.
+ */
+struct FontAtlas
 {
+    GLuint texture;
+    int cellWidth;
+    int cellHeight;
+    int width;
+    int height;
+
+    FontAtlas()
+        : texture(0)
+        , cellWidth(0)
+        , cellHeight(0)
+        , width(0)
+        , height(0)
+    {
+    }
+};
+
+// One glyph of a laid out string, positioned relative to the raster position.
+struct GlyphQuad
+{
+    int c;
+    int x;
+    int y;
+};
+
+struct StringLayout
+{
+    std::vector<GlyphQuad> quads;
+    float dx; // raster advance after the whole string, as glBitmap would have done it
+    float dy;
+};
+
+typedef std::pair<const void*, OFX::TextRenderer::Font> AtlasKey;
+typedef std::map<AtlasKey, FontAtlas> AtlasMap;
+typedef std::pair<OFX::TextRenderer::Font, std::string> LayoutKey;
+typedef std::map<LayoutKey, StringLayout> LayoutMap;
+
+// Overlays are drawn from the main thread only, like all other OpenGL calls in interacts.
+AtlasMap&
+getAtlases()
+{
+    static AtlasMap atlases;
+
+    return atlases;
+}
+
+LayoutMap&
+getLayouts()
+{
+    static LayoutMap layouts;
+
+    return layouts;
+}
+
+bool
+buildAtlas(const OFX::SFG_Font* font,
+           FontAtlas* atlas)
+{
+    int quantity = std::min(font->Quantity, 256);
+
+    atlas->cellWidth = 1;
+    for (int c = 0; c < quantity; ++c) {
+        atlas->cellWidth = std::max(atlas->cellWidth, (int)font->Characters[c][0]);
+    }
+    atlas->cellHeight = font->Height;
+    atlas->width = (int)nextPowerOfTwo(16 * atlas->cellWidth);
+    atlas->height = (int)nextPowerOfTwo(16 * atlas->cellHeight);
+
+    // unpack the 1-bit glyphs (MSB first, rows bottom to top) to an alpha texture
+    std::vector<GLubyte> texels(atlas->width * atlas->height, 0);
+    for (int c = 0; c < quantity; ++c) {
+        const GLubyte* face = font->Characters[c];
+        int w = face[0];
+        int rowBytes = (w + 7) / 8;
+        const GLubyte* bits = face + 1;
+        GLubyte* cell = &texels[(c / 16) * atlas->cellHeight * atlas->width + (c % 16) * atlas->cellWidth];
+        for (int row = 0; row < font->Height; ++row) {
+            for (int col = 0; col < w; ++col) {
+                if ( bits[row * rowBytes + col / 8] & (0x80 >> (col % 8)) ) {
+                    cell[row * atlas->width + col] = 255;
+                }
+            }
+        }
+    }
+
+    while ( glGetError() != GL_NO_ERROR ) {
+        // clear previous errors, so that a failed upload can be detected
+    }
+    glGenTextures(1, &atlas->texture);
+    if (atlas->texture == 0) {
+        return false;
+    }
+    glPushAttrib(GL_TEXTURE_BIT);
+    glPushClientAttrib(GL_CLIENT_PIXEL_STORE_BIT);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH,  0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS,   0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT,   1);
+    glBindTexture(GL_TEXTURE_2D, atlas->texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA8, atlas->width, atlas->height, 0, GL_ALPHA, GL_UNSIGNED_BYTE, &texels.front());
+    glPopClientAttrib();
+    glPopAttrib();
+    if ( glGetError() != GL_NO_ERROR ) {
+        glDeleteTextures(1, &atlas->texture);
+        atlas->texture = 0;
+
+        return false;
+    }
+
+    return true;
+}
+
+// A context may have been destroyed and another one created at the same address, where the
+// texture name of the atlas may be used by a texture of the host: check that the texture is
+// still the one uploaded by buildAtlas().
+bool
+isAtlasTexture(const FontAtlas& atlas)
+{
+    if ( !glIsTexture(atlas.texture) ) {
+        return false;
+    }
+    GLint width = 0, height = 0, format = 0, minFilter = 0;
+    glPushAttrib(GL_TEXTURE_BIT);
+    glBindTexture(GL_TEXTURE_2D, atlas.texture);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &minFilter);
+    glPopAttrib();
+
+    return width == atlas.width && height == atlas.height && format == GL_ALPHA8 && minFilter == GL_NEAREST;
+}
+
+// Returns the atlas for the font in the current context, or NULL if textures cannot be used.
+const FontAtlas*
+getAtlas(const OFX::SFG_Font* font,
+         OFX::TextRenderer::Font f)
+{
+    const void* context = getCurrentContext();
+
+    if (context == NULL) {
+        // the atlas could not be found again in the next draw: use glBitmap
+        return NULL;
+    }
+    AtlasMap& atlases = getAtlases();
+    AtlasKey key(context, f);
+    AtlasMap::iterator it = atlases.find(key);
+
+    if ( it != atlases.end() ) {
+        if (it->second.texture == 0) {
+            // the atlas could not be built in this context
+            return NULL;
+        }
+        if ( isAtlasTexture(it->second) ) {
+            return &it->second;
+        }
+        // the texture does not belong to us anymore: forget it, but do not delete it
+        atlases.erase(it);
+    }
+    FontAtlas atlas;
+    if ( !buildAtlas(font, &atlas) ) {
+        // remember the failure, to avoid retrying at each redraw
+        atlas.texture = 0;
+    }
+    it = atlases.insert( std::make_pair(key, atlas) ).first;
+
+    return it->second.texture ? &it->second : NULL;
+}
+
+const StringLayout&
+getLayout(const OFX::SFG_Font* font,
+          OFX::TextRenderer::Font f,
+          const char* string)
+{
+    LayoutMap& layouts = getLayouts();
+    LayoutKey key( f, std::string(string) );
+    LayoutMap::iterator it = layouts.find(key);
+
+    if ( it != layouts.end() ) {
+        return it->second;
+    }
+    if (layouts.size() >= kTextRendererLayoutCacheSize) {
+        layouts.clear();
+    }
+
+    StringLayout& layout = layouts[key];
+    int x = 0;
+    int y = 0;
     unsigned char c;
-    float x = 0.0f;
-    const SFG_Font* font = getFont(f);
+    layout.dx = 0.f;
+    layout.dy = 0.f;
+    while ( ( c = *string++) ) {
+        if (c == '\n') {
+            x = 0;
+            y -= font->Height;
+        } else if ( (int)c < font->Quantity ) {
+            GlyphQuad q;
+            q.c = c;
+            q.x = x;
+            q.y = y;
+            layout.quads.push_back(q);
+            x += font->Characters[c][0];
+        }
+    }
+    layout.dx = (float)x;
+    layout.dy = (float)y;
 
-    if (!font) {
-        return;
+    return layout;
+}
+
+/*
+ * Emits the quads of a laid out string, with the raster position at window coordinates (rx,ry).
+ * The glyph origin is snapped to the pixel grid so that texels map exactly to pixels, like glBitmap.
+ * The epsilon is the one used by Mesa, so that raster positions computed as 99.99999 for 100 land on
+ * the same pixel row.
+ */
+void
+emitQuads(const OFX::SFG_Font* font,
+          const FontAtlas& atlas,
+          const StringLayout& layout,
+          double rx,
+          double ry)
+{
+    double x0 = std::floor(rx + 0.0001 - font->xorig);
+    double y0 = std::floor(ry + 0.0001 - font->yorig);
+    double tw = 1. / atlas.width;
+    double th = 1. / atlas.height;
+
+    for (std::vector<GlyphQuad>::const_iterator it = layout.quads.begin(); it != layout.quads.end(); ++it) {
+        int w = font->Characters[it->c][0];
+        if (w == 0) {
+            continue;
+        }
+        double x = x0 + it->x;
+        double y = y0 + it->y;
+        double u = (it->c % 16) * atlas.cellWidth * tw;
+        double v = (it->c / 16) * atlas.cellHeight * th;
+        double u1 = u + w * tw;
+        double v1 = v + font->Height * th;
+        glTexCoord2d(u, v);   glVertex2d(x, y);
+        glTexCoord2d(u1, v);  glVertex2d(x + w, y);
+        glTexCoord2d(u1, v1); glVertex2d(x + w, y + font->Height);
+        glTexCoord2d(u, v1);  glVertex2d(x, y + font->Height);
     }
-    if (!string || !*string) {
-        return;
+}
+
+/*
+ * Sets up the state to draw textured glyphs in window coordinates, and restores it.
+ * Alpha testing keeps exactly the texels that glBitmap would have drawn, so the fragments
+ * go through blending, depth test, etc. the same way. The texels are 0 or 1 (GL_NEAREST),
+ * so the fragments of a glyph keep the alpha of the current color.
+ */
+class WindowTextState
+{
+public:
+    explicit WindowTextState(const FontAtlas& atlas)
+        : _texture(0)
+        , _texEnvMode(GL_MODULATE)
+    {
+        GLint viewport[4];
+
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        // GL_TEXTURE_BIT would save the state of all texture units: only save what is modified
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, &_texture);
+        glGetTexEnviv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, &_texEnvMode);
+        glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TRANSFORM_BIT | GL_CURRENT_BIT);
+        glMatrixMode(GL_PROJECTION);
+        glPushMatrix();
+        glLoadIdentity();
+        glOrtho(viewport[0], viewport[0] + viewport[2], viewport[1], viewport[1] + viewport[3], -1., 1.);
+        glMatrixMode(GL_MODELVIEW);
+        glPushMatrix();
+        glLoadIdentity();
+        glDisable(GL_LIGHTING);
+        glDisable(GL_CULL_FACE);
+        glEnable(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, atlas.texture);
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+        glEnable(GL_ALPHA_TEST);
+        glAlphaFunc(GL_GREATER, 0.f);
+    }
+
+    ~WindowTextState()
+    {
+        glMatrixMode(GL_MODELVIEW);
+        glPopMatrix();
+        glMatrixMode(GL_PROJECTION);
+        glPopMatrix();
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, _texEnvMode);
+        glBindTexture(GL_TEXTURE_2D, _texture);
+        glPopAttrib();
     }
 
+private:
+    GLint _texture;
+    GLint _texEnvMode;
+};
+
+// Draws the string with one glBitmap per glyph. This is used when textures are not available.
+void
+bitmapStringGlyphs(const OFX::SFG_Font* font,
+                   const char *string)
+{
+    unsigned char c;
+    float x = 0.0f;
+
     glPushClientAttrib( GL_CLIENT_PIXEL_STORE_BIT );
     glPixelStorei( GL_UNPACK_SWAP_BYTES,  GL_FALSE );
     glPixelStorei( GL_UNPACK_LSB_FIRST,   GL_FALSE );
@@ -139,6 +486,50 @@ OFX::TextRenderer::bitmapString(const char *string,
 
     glPopClientAttrib( );
 }
+} // anon namespace
+
+void
+OFX::TextRenderer::bitmapString(const char *string,
+                                TextRenderer::Font f)
+{
+    const SFG_Font* font = getFont(f);
+
+    if (!font) {
+        return;
+    }
+    if (!string || !*string) {
+        return;
+    }
+
+    GLboolean valid = GL_FALSE;
+    glGetBooleanv(GL_CURRENT_RASTER_POSITION_VALID, &valid);
+    if (!valid) {
+        // glBitmap would not draw anything either
+        return;
+    }
+
+    const FontAtlas* atlas = getAtlas(font, f);
+    if (!atlas) {
+        bitmapStringGlyphs(font, string);
+
+        return;
+    }
+
+    const StringLayout& layout = getLayout(font, f, string);
+    GLdouble rasterPos[4];
+    GLdouble rasterColor[4];
+    glGetDoublev(GL_CURRENT_RASTER_POSITION, rasterPos);
+    glGetDoublev(GL_CURRENT_RASTER_COLOR, rasterColor);
+    {
+        WindowTextState state(*atlas);
+        glColor4dv(rasterColor);
+        glBegin(GL_QUADS);
+        emitQuads(font, *atlas, layout, rasterPos[0], rasterPos[1]);
+        glEnd();
+    }
+    // advance the raster position past the string, as the glyph-by-glyph version does
+    glBitmap(0, 0, 0, 0, layout.dx, layout.dy, NULL);
+} // OFX::TextRenderer::bitmapString
 
 void
 OFX::TextRenderer::bitmapString(double x,
@@ -151,3 +542,81 @@ OFX::TextRenderer::bitmapString(double x,
     bitmapString(string, font);
     //glPopAttrib();
 }
+
+void
+OFX::TextRenderer::bitmapStrings(const std::vector<OfxPointD>& positions,
+                                 const std::vector<std::string>& strings,
+                                 TextRenderer::Font f)
+{
+    const SFG_Font* font = getFont(f);
+
+    if ( !font || positions.empty() || ( positions.size() != strings.size() ) ) {
+        return;
+    }
+
+    const FontAtlas* atlas = getAtlas(font, f);
+    if (!atlas) {
+        for (std::size_t i = 0; i < strings.size(); ++i) {
+            bitmapString(positions[i].x, positions[i].y, strings[i].c_str(), f);
+        }
+
+        return;
+    }
+
+    // project the positions to window coordinates, the same way glRasterPos does
+    GLdouble modelview[16];
+    GLdouble projection[16];
+    GLint viewport[4];
+    GLdouble color[4];
+    glGetDoublev(GL_MODELVIEW_MATRIX, modelview);
+    glGetDoublev(GL_PROJECTION_MATRIX, projection);
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    glGetDoublev(GL_CURRENT_COLOR, color);
+
+    WindowTextState state(*atlas);
+    glColor4dv(color);
+    glBegin(GL_QUADS);
+    for (std::size_t i = 0; i < strings.size(); ++i) {
+        if ( strings[i].empty() ) {
+            continue;
+        }
+        const double p[4] = { positions[i].x, positions[i].y, 0., 1. };
+        double eye[4];
+        double clip[4];
+        for (int r = 0; r < 4; ++r) {
+            eye[r] = modelview[r] * p[0] + modelview[4 + r] * p[1] + modelview[8 + r] * p[2] + modelview[12 + r] * p[3];
+        }
+        for (int r = 0; r < 4; ++r) {
+            clip[r] = projection[r] * eye[0] + projection[4 + r] * eye[1] + projection[8 + r] * eye[2] + projection[12 + r] * eye[3];
+        }
+        // a raster position outside of the clip volume is invalid, and nothing is drawn
+        if ( (clip[3] <= 0.) ||
+             ( std::fabs(clip[0]) > clip[3] ) || ( std::fabs(clip[1]) > clip[3] ) || ( std::fabs(clip[2]) > clip[3] ) ) {
+            continue;
+        }
+        double rx = viewport[0] + (clip[0] / clip[3] + 1.) * 0.5 * viewport[2];
+        double ry = viewport[1] + (clip[1] / clip[3] + 1.) * 0.5 * viewport[3];
+        emitQuads(font, *atlas, getLayout(font, f, strings[i].c_str()), rx, ry);
+    }
+    glEnd();
+} // OFX::TextRenderer::bitmapStrings
+
+void
+OFX::TextRenderer::releaseContextResources()
+{
+    const void* context = getCurrentContext();
+
+    if (context == NULL) {
+        return;
+    }
+    AtlasMap& atlases = getAtlases();
+    // the keys of the current context are contiguous, starting at (context, first font)
+    AtlasMap::iterator it = atlases.lower_bound( AtlasKey(context, FONT_FIXED_8_X_13) );
+
+    while ( it != atlases.end() && it->first.first == context ) {
+        if ( isAtlasTexture(it->second) ) {
+            glDeleteTextures(1, &it->second.texture);
+        }
+        atlases.erase(it++);
+    }
+}
@@ -48,6 +48,10 @@
 #ifndef openfx_supportext_ofxsOGLTextRenderer_h
 #define openfx_supportext_ofxsOGLTextRenderer_h
 
+#include <string>
+#include <vector>
+
+#include "ofxCore.h"
 
 namespace OFX {
 namespace TextRenderer {
@@ -66,6 +70,11 @@ enum Font
  * @brief Draws the text contained in string. This must be a NULL terminated string.
  * @param font The font to use to render. If it doesn't correspond to one of the enum
  * this function will not draw anything.
+ * The glyphs of each font are uploaded once per OpenGL context to a texture, and the
+ * string is drawn at the current raster position as textured quads, with the pixels
+ * glBitmap would give. Falls back to glBitmap if the texture cannot be created, or if the
+ * current context cannot be identified: on X11, define OFX_TEXTRENDERER_GLX to identify it
+ * with GLX (this requires the GLX headers and libGL).
  **/
 void bitmapString(const char *string, TextRenderer::Font font = FONT_HELVETICA_12);
 
@@ -73,6 +82,21 @@ void bitmapString(const char *string, TextRenderer::Font font = FONT_HELVETICA_1
  *@brief Same as strokeString() but translates the OpenGL matrix to the (x,y) position before drawing.
  **/
 void bitmapString(double x, double y, const char*string, TextRenderer::Font font = FONT_HELVETICA_12);
+
+/**
+ * @brief Draws strings[i] at positions[i] for all i, with the current color, in a single
+ * batch of textured quads. This is cheaper than calling bitmapString() for each label of an overlay.
+ * Like bitmapString(), a string whose position is outside of the viewing volume is not drawn.
+ * The current raster position is not modified.
+ **/
+void bitmapStrings(const std::vector<OfxPointD>& positions, const std::vector<std::string>& strings, TextRenderer::Font font = FONT_HELVETICA_12);
+
+/**
+ * @brief Deletes the font textures created in the current OpenGL context, and forgets them.
+ * Call it while the context is still current, before it is destroyed, e.g. from the
+ * kOfxActionOpenGLContextDetached action or when the interact is destroyed.
+ **/
+void releaseContextResources();
 } // TextRendered
 } // OFX
 
@@ -36,6 +36,20 @@ typedef tthread::fast_mutex Mutex;
 typedef OFX::MultiThread::AutoMutexT<tthread::fast_mutex> AutoMutex;
 #endif
 
+#ifdef DEBUG
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <vector>
+#ifndef _WIN32
+#include <sys/time.h>
+#endif
+#include "tinythread.h" // for thread_local
+#include "ofxsOGLDebug.h"
+#endif
+
 static Mutex g_glLoadOnceMutex;
 static bool g_glLoaded = false;
 
@@ -51,6 +65,7 @@ typedef void (* GLADcallback)(const char *name, void *funcptr, int len_args, ...
 extern void glad_set_pre_callback(GLADcallback);
 extern void glad_set_post_callback(GLADcallback);
 extern gladGLversionStruct GLVersion;
+extern PFNGLGETERRORPROC glad_glGetError;
 extern int GLAD_GL_ARB_vertex_buffer_object;
 extern int GLAD_GL_ARB_framebuffer_object;
 extern int GLAD_GL_ARB_pixel_buffer_object;
@@ -156,6 +171,132 @@ extern PFNGLISVERTEXARRAYAPPLEPROC glad_glIsVertexArray;
 } // extern "C"
 
 namespace OFX {
+#ifdef DEBUG
+// In debug builds, the functions loaded by GLAD are wrapped (see glad.cpp), and these callbacks
+// count the calls, the time spent and the errors of each function.
+namespace {
+struct GLFunctionStatistics
+{
+    unsigned long calls;
+    double seconds;
+    unsigned long errors;
+    GLenum lastError;
+};
+
+// keyed by the function name, which is a string literal in glad.cpp
+typedef std::map<const char*, GLFunctionStatistics> GLStatisticsMap;
+
+Mutex g_glStatisticsMutex;
+GLStatisticsMap g_glStatistics;
+thread_local double t_glCallStart = 0.;
+thread_local bool t_glInsideBeginEnd = false; // glGetError cannot be called between glBegin and glEnd
+
+double
+getTimeSeconds()
+{
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    timeval tv;
+    gettimeofday(&tv, NULL);
+
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+struct GLFunctionStatisticsGreater
+{
+    bool operator()(const GLStatisticsMap::value_type* a,
+                    const GLStatisticsMap::value_type* b) const
+    {
+        return a->second.seconds > b->second.seconds;
+    }
+};
+} // anon namespace
+
+extern "C" {
+static void
+glDebugPreCallback(const char* /*name*/,
+                   void* /*funcptr*/,
+                   int /*len_args*/,
+                   ...)
+{
+    t_glCallStart = getTimeSeconds();
+}
+
+static void
+glDebugPostCallback(const char* name,
+                    void* /*funcptr*/,
+                    int /*len_args*/,
+                    ...)
+{
+    double seconds = getTimeSeconds() - t_glCallStart;
+    GLenum error = GL_NO_ERROR;
+
+    if ( !std::strcmp(name, "glBegin") ) {
+        t_glInsideBeginEnd = true;
+    } else if ( !std::strcmp(name, "glEnd") ) {
+        t_glInsideBeginEnd = false;
+    }
+    if (!t_glInsideBeginEnd) {
+        // glGetError is not wrapped
+        error = glad_glGetError();
+    }
+    {
+        AutoMutex locker(&g_glStatisticsMutex);
+        GLFunctionStatistics & stats = g_glStatistics[name]; // value-initialized on first call
+        ++stats.calls;
+        stats.seconds += seconds;
+        if (error != GL_NO_ERROR) {
+            ++stats.errors;
+            stats.lastError = error;
+        }
+    }
+    if (error != GL_NO_ERROR) {
+        // the error flag was cleared by glGetError above, so glCheckError() in the caller cannot see it: report it here
+        std::cout << "GL_ERROR: " << name << " " << glErrorString(error) << std::endl;
+        glError();
+    }
+}
+} // extern "C"
+
+void
+ofxsReportOpenGLStatistics()
+{
+    GLStatisticsMap statistics;
+    {
+        AutoMutex locker(&g_glStatisticsMutex);
+        statistics.swap(g_glStatistics);
+    }
+    if ( statistics.empty() ) {
+        return;
+    }
+    std::vector<const GLStatisticsMap::value_type*> sorted;
+    for (GLStatisticsMap::const_iterator it = statistics.begin(); it != statistics.end(); ++it) {
+        sorted.push_back(&*it);
+    }
+    std::sort( sorted.begin(), sorted.end(), GLFunctionStatisticsGreater() );
+    std::cout << "OpenGL statistics (function, calls, total ms, errors):" << std::endl;
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        const GLFunctionStatistics & stats = sorted[i]->second;
+        std::cout << "  " << std::left << std::setw(32) << sorted[i]->first << std::right
+                  << std::setw(10) << stats.calls
+                  << std::setw(12) << std::fixed << std::setprecision(3) << stats.seconds * 1000.
+                  << std::setw(8) << stats.errors;
+        if (stats.errors) {
+            const char* errorString = glErrorString(stats.lastError);
+            std::cout << " (last: " << (errorString ? errorString : "unknown error") << ")";
+        }
+        std::cout << std::endl;
+    }
+}
+
+#endif // DEBUG
+
 bool
 ofxsLoadOpenGLOnce()
 {
@@ -175,6 +316,13 @@ ofxsLoadOpenGLOnce()
 
     g_glLoaded = glLoaded;
 
+#ifdef DEBUG
+    if (glLoaded) {
+        glad_set_pre_callback(&glDebugPreCallback);
+        glad_set_post_callback(&glDebugPostCallback);
+    }
+#endif
+
     // If only EXT_framebuffer is present and not ARB link functions
     if (glLoaded && GLAD_GL_EXT_framebuffer_object && !GLAD_GL_ARB_framebuffer_object) {
         glad_glIsRenderbuffer = glad_glIsRenderbufferEXT;
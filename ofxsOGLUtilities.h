@@ -30,6 +30,8 @@ namespace OFX {
  * draw function of an interact (if you only use interacts) or in the contextAttached action of your
  * plug-in if you support OpenGL rendering.
  * Note that the OpenGL version loaded is the one specified when generating glad.h
+ * If OFX_OPENGL_LAZY_LOAD is defined when compiling glad.cpp, only the version and the extensions are
+ * checked here, and each function is resolved on its first call (see ofxsOGLFunctions-README.md).
  * @returns true if OpenGL was load successfully, false otherwise.
  * Reasons for failure might be:
  * - opengl32.dll was not found, or libGL.so was not found or OpenGL.framework was not found
@@ -40,6 +42,26 @@ namespace OFX {
  **/
 bool ofxsLoadOpenGLOnce();
 
+/**
+ * @brief In debug builds, the OpenGL functions loaded by GLAD (except glGetError) call glGetError after each call,
+ * and the number of calls, the time spent and the errors of each function are counted.
+ * This prints them, sorted by decreasing time, and resets them. A good place to call it is the unload()
+ * function of the plug-in factory.
+ * Each error is also printed with the name of the function, and glError() (see ofxsOGLDebug.h) is called,
+ * so that a breakpoint can be set there. Since the error flag is cleared after each call, glGetError() and
+ * glCheckError() in the caller always return GL_NO_ERROR in debug builds.
+ * In release builds, the OpenGL functions are not wrapped, and this function does nothing.
+ **/
+#ifdef DEBUG
+void ofxsReportOpenGLStatistics();
+#else
+inline void
+ofxsReportOpenGLStatistics()
+{
+}
+
+#endif
+
 /**
  * @brief Returns the OpenGL major version loaded by GLAD. This is the version of the client driver
  * and may differ from the version for which GLAD was generated.
@@ -31,6 +31,7 @@
 
 #include "ofxsImageEffect.h"
 #include "ofxsMultiThread.h"
+#include "ofxsProfiling.h"
 #include "ofxsThreadSuite.h"
 
 /** @file This file contains a useful base class that can be used to process images
@@ -243,6 +244,8 @@ public:
 
         MultiThread::getThreadRange(threadId, nThreads, _renderWindow.y1, _renderWindow.y2, &win.y1, &win.y2);
         if ( (win.y2 - win.y1) > 0 ) {
+            OFX_PROFILE_SCOPE(timer, "PixelProcessor", "multiThreadProcessImages");
+            OFX_PROFILE_ARG(timer, "pixels", (double)(win.x2 - win.x1) * (win.y2 - win.y1));
             // and render that thread on each
             multiThreadProcessImages(win, _renderScale);
         }
@@ -276,20 +279,30 @@ public:
             return;
         }
 
+        OFX_PROFILE_SCOPE(timer, "PixelProcessor", "process");
+        OFX_PROFILE_ARG(timer, "pixels", (double)(_renderWindow.x2 - _renderWindow.x1) * (_renderWindow.y2 - _renderWindow.y1));
+
         // call the pre MP pass
-        preProcess();
+        {
+            OFX_PROFILE_SCOPE(preTimer, "PixelProcessor", "preProcess");
+            preProcess();
+        }
 
         // make sure there are at least 4096 pixels per CPU and at least 1 line par CPU
         unsigned int nCPUs = (unsigned int)( (std::min)(_renderWindow.x2 - _renderWindow.x1, 4096) *
                                             (_renderWindow.y2 - _renderWindow.y1) ) / 4096;
         // make sure the number of CPUs is valid (and use at least 1 CPU)
         nCPUs = (std::max)( 1u, (std::min)( nCPUs, OFX::MultiThread::getNumCPUs() ) );
+        OFX_PROFILE_ARG(timer, "threads", (double)nCPUs);
 
         // call the base multi threading code, should put a pre & post thread calls in too
         multiThread(nCPUs);
 
         // call the post MP pass
-        postProcess();
+        {
+            OFX_PROFILE_SCOPE(postTimer, "PixelProcessor", "postProcess");
+            postProcess();
+        }
     }
 
 protected:
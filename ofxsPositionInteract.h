@@ -26,6 +26,8 @@
 #define openfx_supportext_ofxsPositionInteract_h
 
 #include <cmath>
+#include <vector>
+#include <algorithm>
 
 #ifdef __APPLE__
 #ifndef GL_SILENCE_DEPRECATION
@@ -40,6 +42,7 @@
 #include <ofxsImageEffect.h>
 #include "ofxsOGLTextRenderer.h"
 #include "ofxsOGLHiDPI.h"
+#include "ofxsOGLOverlayBatch.h"
 #include "ofxsMacros.h"
 
 #define kDrawPointTrajectoryMaxPoints 1000
@@ -47,41 +50,120 @@
 
 namespace OFX {
 
-// Before calling this function: make sure the OpenGL props are correctly set.
-// Try to draw one point per frame, but no more thankDrawPointTrajectoryMaxPoints
-// in total, and at least kDrawPointTrajectoryMinStepsPerKey between two keys.
-inline void
-drawPointTrajectory(Double2DParam* p)
+/**
+ * @brief The trajectory of an animated Double2DParam, sampled as in drawPointTrajectory() and cached as vertex arrays.
+ * The keyframe times and values are checked by update(), and the trajectory is only resampled if they changed,
+ * which costs 2*numKeys+1 calls to the host instead of up to kDrawPointTrajectoryMaxPoints.
+ * Note that a change of the interpolation of a key cannot be detected by OFX, call invalidate() if needed.
+ **/
+class PointTrajectory
 {
-    int numKeys = p->getNumKeys();
+public:
+    PointTrajectory()
+        : _keyTimes()
+        , _keyVertices()
+        , _lineVertices()
+        , _valid(false)
+    {
+    }
+
+    void invalidate()
+    {
+        _valid = false;
+    }
 
-    if (numKeys > 0) {
-        int maxStepsPerKey = int(kDrawPointTrajectoryMaxPoints / numKeys);
-        glBegin(GL_POINTS);
-        for (int i=0; i < numKeys; ++i) {
-            double time = p->getKeyTime(i);
-            OfxPointD pt;
-            p->getValueAtTime(time, pt.x, pt.y);
-            glVertex2d(pt.x, pt.y);
+    /**
+     * @brief Check the keyframes of p and resample the trajectory if they changed.
+     * Returns true if the trajectory was resampled.
+     **/
+    bool update(Double2DParam* p)
+    {
+        int numKeys = p->getNumKeys();
+        std::vector<double> keyTimes(numKeys);
+        std::vector<GLdouble> keyVertices(2 * numKeys);
 
+        for (int i = 0; i < numKeys; ++i) {
+            keyTimes[i] = p->getKeyTime(i);
+            p->getValueAtTime(keyTimes[i], keyVertices[2 * i], keyVertices[2 * i + 1]);
         }
-        glEnd();
-        glBegin(GL_LINE_STRIP);
-        double time = p->getKeyTime(0);
-        for (int i = 1; i < numKeys; ++i) {
-            double timeNext = p->getKeyTime(i);
-            int steps = std::max(kDrawPointTrajectoryMinStepsPerKey, std::min(int(timeNext - time), maxStepsPerKey));
-            for (int j = (i == 1 ? 0 : 1); j <= steps; ++j) {
-                double timeStep = time + j * (timeNext - time) / steps;
-
-                OfxPointD pt;
-                p->getValueAtTime(timeStep, pt.x, pt.y);
-                glVertex2d(pt.x, pt.y);
+        if ( _valid && (keyTimes == _keyTimes) && (keyVertices == _keyVertices) ) {
+            return false;
+        }
+        _keyTimes.swap(keyTimes);
+        _keyVertices.swap(keyVertices);
+        _lineVertices.clear();
+        if (numKeys > 0) {
+            int maxStepsPerKey = int(kDrawPointTrajectoryMaxPoints / numKeys);
+            double time = _keyTimes[0];
+            for (int i = 1; i < numKeys; ++i) {
+                double timeNext = _keyTimes[i];
+                int steps = std::max(kDrawPointTrajectoryMinStepsPerKey, std::min(int(timeNext - time), maxStepsPerKey));
+                for (int j = (i == 1 ? 0 : 1); j <= steps; ++j) {
+                    OfxPointD pt;
+                    if (j == 0) {
+                        pt.x = _keyVertices[2 * (i - 1)];
+                        pt.y = _keyVertices[2 * (i - 1) + 1];
+                    } else if (j == steps) {
+                        pt.x = _keyVertices[2 * i];
+                        pt.y = _keyVertices[2 * i + 1];
+                    } else {
+                        double timeStep = time + j * (timeNext - time) / steps;
+                        p->getValueAtTime(timeStep, pt.x, pt.y);
+                    }
+                    _lineVertices.push_back(pt.x);
+                    _lineVertices.push_back(pt.y);
+                }
+                time = timeNext;
             }
-            time = timeNext;
         }
-        glEnd();
+        _valid = true;
+
+        return true;
+    } // update
+
+    // Before calling this function: make sure the OpenGL props are correctly set.
+    void draw() const
+    {
+        if ( _keyVertices.empty() ) {
+            return;
+        }
+        glEnableClientState(GL_VERTEX_ARRAY);
+        glVertexPointer(2, GL_DOUBLE, 0, &_keyVertices[0]);
+        glDrawArrays(GL_POINTS, 0, (GLsizei)(_keyVertices.size() / 2));
+        if ( !_lineVertices.empty() ) {
+            glVertexPointer(2, GL_DOUBLE, 0, &_lineVertices[0]);
+            glDrawArrays(GL_LINE_STRIP, 0, (GLsizei)(_lineVertices.size() / 2));
+        }
+        glDisableClientState(GL_VERTEX_ARRAY);
     }
+
+    /// add the keys (as points) and the line strip to batch, with its current color and state
+    void addTo(OverlayBatch* batch) const
+    {
+        for (std::size_t i = 0; i + 1 < _keyVertices.size(); i += 2) {
+            batch->addPoint(_keyVertices[i], _keyVertices[i + 1]);
+        }
+        batch->addLineStrip(_lineVertices.empty() ? NULL : &_lineVertices[0], (int)(_lineVertices.size() / 2), false);
+    }
+
+private:
+    std::vector<double> _keyTimes;
+    std::vector<GLdouble> _keyVertices; // x,y of each key
+    std::vector<GLdouble> _lineVertices; // x,y of each point of the line strip
+    bool _valid;
+};
+
+// Before calling this function: make sure the OpenGL props are correctly set.
+// Try to draw one point per frame, but no more thankDrawPointTrajectoryMaxPoints
+// in total, and at least kDrawPointTrajectoryMinStepsPerKey between two keys.
+// Interacts that redraw often should rather keep a PointTrajectory.
+inline void
+drawPointTrajectory(Double2DParam* p)
+{
+    PointTrajectory trajectory;
+
+    trajectory.update(p);
+    trajectory.draw();
 }
 
 
@@ -123,6 +205,7 @@ public:
         , _hiDPI(NULL)
         , _interactiveDrag(false)
         , _hasNativeHostPositionHandle(false)
+        , _trajectory()
     {
         _position = effect->fetchDouble2DParam( PositionInteractParam::name() );
         assert(_position);
@@ -163,6 +246,7 @@ private:
     OfxPointD _penPosition;
     bool _interactiveDrag;
     bool _hasNativeHostPositionHandle;
+    PointTrajectory _trajectory; // cached trajectory of _position, shared by the shadow and drawing passes
 
     double pointSize() const
     {
@@ -235,13 +319,26 @@ PositionInteract<ParamName>::draw(const OFX::DrawArgs &args)
         _position->getValueAtTime(args.time, pos.x, pos.y);
     }
     //glPushAttrib(GL_ALL_ATTRIB_BITS); // caller is responsible for protecting attribs
-    glPointSize( (float)pointSize() * screenPixelRatio);
     glEnable(GL_LINE_SMOOTH);
     glEnable(GL_BLEND);
     glHint(GL_LINE_SMOOTH_HINT, GL_DONT_CARE);
-    glLineWidth(1.5f * screenPixelRatio);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
+    // only resampled if the keyframes changed
+    _trajectory.update(_position);
+
+    // the geometry is built once, and drawn in both passes
+    OverlayBatch batch;
+    batch.setPointSize( (float)pointSize() * screenPixelRatio );
+    batch.setLineWidth(1.5f * screenPixelRatio);
+    batch.setPointSmooth(true);
+    const double darken = 0.5;
+    batch.setColor(color.r * darken, color.g * darken, color.b * darken);
+    _trajectory.addTo(&batch);
+    batch.setPointSmooth(false);
+    batch.setColor(col.r, col.g, col.b);
+    batch.addPoint(pos.x, pos.y);
+
     // Draw everything twice
     // l = 0: shadow
     // l = 1: drawing
@@ -253,16 +350,8 @@ PositionInteract<ParamName>::draw(const OFX::DrawArgs &args)
         glTranslated(direction * shadow.x, -direction * shadow.y, 0);
         glMatrixMode(GL_MODELVIEW); // Modelview should be used on Nuke
 
-        glEnable(GL_POINT_SMOOTH);
-        const double darken = 0.5;
-        glColor3f(color.r * l * darken, color.g * l * darken, color.b * l * darken);
-        drawPointTrajectory(_position);
-
-        glDisable(GL_POINT_SMOOTH);
+        batch.draw(l == 0);
         glColor3f(col.r * l, col.g * l, col.b * l);
-        glBegin(GL_POINTS);
-        glVertex2d(pos.x, pos.y);
-        glEnd();
         OFX::TextRenderer::bitmapString( pos.x, pos.y + pointSize() * screenPixelRatio, ParamName::name(), font );
     }
 
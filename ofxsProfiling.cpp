@@ -0,0 +1,404 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; -*- */
+/* ***** BEGIN LICENSE BLOCK *****
+ * This file is part of openfx-supportext <https://github.com/NatronGitHub/openfx-supportext>,
+ * (C) 2018-2021 The Natron Developers
+ * (C) 2013-2018 INRIA
+ *
+ * openfx-supportext is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * openfx-supportext is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openfx-supportext.  If not, see <http://www.gnu.org/licenses/gpl-2.0.html>
+ * ***** END LICENSE BLOCK ***** */
+
+/*
+ * OFX profiling instrumentation: scoped timers around actions and pixel processing.
+ */
+
+#include "ofxsProfiling.h"
+
+#ifdef OFX_PROFILING
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+#include "tinythread.h" // for thread_local
+
+#include "ofxsMultiThread.h"
+#ifndef OFX_USE_MULTITHREAD_MUTEX
+// some OFX hosts do not have mutex handling in the MT-Suite (e.g. Sony Catalyst Edit)
+// prefer using the fast mutex by Marcus Geelnard http://tinythreadpp.bitsnbites.eu/
+#include "fast_mutex.h"
+#endif
+#ifdef OFX_USE_MULTITHREAD_MUTEX
+typedef OFX::MultiThread::Mutex Mutex;
+typedef OFX::MultiThread::AutoMutex AutoMutex;
+#else
+typedef tthread::fast_mutex Mutex;
+typedef OFX::MultiThread::AutoMutexT<tthread::fast_mutex> AutoMutex;
+#endif
+
+// beyond this number of events, only the summary is updated, to bound the memory used on long renders
+#define kProfilingMaxEvents (1 << 20)
+
+namespace OFX {
+namespace Profiling {
+namespace {
+struct Event
+{
+    const char* category;
+    const char* name;
+    unsigned int thread;
+    double start; // seconds
+    double duration; // seconds
+    int nArgs;
+    const char* argKeys[ScopedTimer::kMaxArgs];
+    double argValues[ScopedTimer::kMaxArgs];
+};
+
+struct Summary
+{
+    unsigned long count;
+    double total; // seconds
+    double max; // seconds
+    std::vector<std::pair<const char*, double> > argTotals;
+
+    Summary()
+        : count(0)
+        , total(0.)
+        , max(0.)
+        , argTotals()
+    {
+    }
+
+    void add(const Event& e)
+    {
+        ++count;
+        total += e.duration;
+        max = (std::max)(max, e.duration);
+        for (int i = 0; i < e.nArgs; ++i) {
+            addArg(e.argKeys[i], e.argValues[i]);
+        }
+    }
+
+    void addArg(const char* key,
+                double value)
+    {
+        for (std::size_t j = 0; j < argTotals.size(); ++j) {
+            if ( (argTotals[j].first == key) || !std::strcmp(argTotals[j].first, key) ) {
+                argTotals[j].second += value;
+
+                return;
+            }
+        }
+        argTotals.push_back( std::make_pair(key, value) );
+    }
+
+    void merge(const Summary& other)
+    {
+        count += other.count;
+        total += other.total;
+        max = (std::max)(max, other.max);
+        for (std::size_t j = 0; j < other.argTotals.size(); ++j) {
+            addArg(other.argTotals[j].first, other.argTotals[j].second);
+        }
+    }
+};
+
+// keyed by the category and name pointers, which are string literals: the same name
+// may have several keys (one per translation unit), they are merged by writeSummary()
+typedef std::map<std::pair<const char*, const char*>, Summary> SummaryMap;
+
+Mutex g_mutex; // protects the variables below
+std::vector<Event> g_events;
+unsigned long g_droppedEvents = 0;
+SummaryMap g_summaries;
+unsigned int g_threadCount = 0;
+
+thread_local unsigned int t_thread = 0; // 0 until the thread records its first event
+thread_local unsigned long t_abortChecks = 0;
+thread_local double t_abortSeconds = 0.;
+
+double
+getTimeSeconds()
+{
+#ifdef _WIN32
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    timeval tv;
+    gettimeofday(&tv, NULL);
+
+    return tv.tv_sec + tv.tv_usec * 1e-6;
+#endif
+}
+
+// the origin of the trace timestamps
+const double g_origin = getTimeSeconds();
+
+int
+getProcessId()
+{
+#ifdef _WIN32
+
+    return (int)GetCurrentProcessId();
+#else
+
+    return (int)getpid();
+#endif
+}
+
+void
+record(Event& e)
+{
+    AutoMutex locker(&g_mutex);
+
+    if (t_thread == 0) {
+        t_thread = ++g_threadCount;
+    }
+    e.thread = t_thread;
+    g_summaries[std::make_pair(e.category, e.name)].add(e);
+    if (g_events.size() < kProfilingMaxEvents) {
+        g_events.push_back(e);
+    } else {
+        ++g_droppedEvents;
+    }
+}
+
+void
+writeJSONString(std::ostream& os,
+                const char* s)
+{
+    os << '"';
+    for (; *s; ++s) {
+        if ( (*s == '"') || (*s == '\\') ) {
+            os << '\\';
+        }
+        os << *s;
+    }
+    os << '"';
+}
+} // anon namespace
+
+ScopedTimer::ScopedTimer(const char* category,
+                         const char* name)
+    : _category(category)
+    , _name(name)
+    , _start( getTimeSeconds() )
+    , _abortChecks(t_abortChecks)
+    , _abortSeconds(t_abortSeconds)
+    , _nArgs(0)
+{
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    Event e;
+
+    e.category = _category;
+    e.name = _name;
+    e.thread = 0;
+    e.start = _start;
+    e.duration = getTimeSeconds() - _start;
+    e.nArgs = _nArgs;
+    for (int i = 0; i < _nArgs; ++i) {
+        e.argKeys[i] = _argKeys[i];
+        e.argValues[i] = _argValues[i];
+    }
+    unsigned long abortChecks = t_abortChecks - _abortChecks;
+    if ( abortChecks && (e.nArgs + 2 <= kMaxArgs) ) {
+        e.argKeys[e.nArgs] = "abortChecks";
+        e.argValues[e.nArgs] = (double)abortChecks;
+        ++e.nArgs;
+        e.argKeys[e.nArgs] = "abortMs";
+        e.argValues[e.nArgs] = (t_abortSeconds - _abortSeconds) * 1000.;
+        ++e.nArgs;
+    }
+    record(e);
+}
+
+void
+ScopedTimer::setArg(const char* key,
+                    double value)
+{
+    for (int i = 0; i < _nArgs; ++i) {
+        if (_argKeys[i] == key) {
+            _argValues[i] = value;
+
+            return;
+        }
+    }
+    if (_nArgs < kMaxArgs) {
+        _argKeys[_nArgs] = key;
+        _argValues[_nArgs] = value;
+        ++_nArgs;
+    }
+}
+
+AbortCheckTimer::AbortCheckTimer()
+    : _start( getTimeSeconds() )
+{
+}
+
+AbortCheckTimer::~AbortCheckTimer()
+{
+    ++t_abortChecks;
+    t_abortSeconds += getTimeSeconds() - _start;
+}
+
+bool
+writeChromeTrace(const std::string& filename)
+{
+    std::ofstream os( filename.c_str() );
+
+    if (!os) {
+        return false;
+    }
+    int pid = getProcessId();
+    AutoMutex locker(&g_mutex);
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    os << std::fixed << std::setprecision(3);
+    for (std::size_t i = 0; i < g_events.size(); ++i) {
+        const Event& e = g_events[i];
+        os << (i ? ",\n" : "\n") << "{\"name\":";
+        writeJSONString(os, e.name);
+        os << ",\"cat\":";
+        writeJSONString(os, e.category);
+        // complete events, timestamps in microseconds
+        os << ",\"ph\":\"X\",\"ts\":" << (e.start - g_origin) * 1e6 << ",\"dur\":" << e.duration * 1e6
+           << ",\"pid\":" << pid << ",\"tid\":" << e.thread;
+        if (e.nArgs) {
+            os << ",\"args\":{";
+            for (int j = 0; j < e.nArgs; ++j) {
+                if (j) {
+                    os << ',';
+                }
+                writeJSONString(os, e.argKeys[j]);
+                os << ':' << e.argValues[j];
+            }
+            os << '}';
+        }
+        os << '}';
+    }
+    os << "\n],\"otherData\":{\"droppedEvents\":" << g_droppedEvents << "}}\n";
+
+    return (bool)os;
+}
+
+void
+writeSummary(std::ostream& os)
+{
+    // merge the entries with the same category and name
+    std::map<std::pair<std::string, std::string>, Summary> summaries;
+    unsigned long droppedEvents;
+    {
+        AutoMutex locker(&g_mutex);
+        for (SummaryMap::const_iterator it = g_summaries.begin(); it != g_summaries.end(); ++it) {
+            summaries[std::make_pair( std::string(it->first.first), std::string(it->first.second) )].merge(it->second);
+        }
+        droppedEvents = g_droppedEvents;
+    }
+
+    std::ios::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << "OFX profiling summary (pid " << getProcessId() << ")" << std::endl;
+    os << std::left << std::setw(16) << "category" << std::setw(48) << "name" << std::right
+       << std::setw(10) << "count" << std::setw(14) << "total ms" << std::setw(12) << "mean ms" << std::setw(12) << "max ms"
+       << "  arguments (total)" << std::endl;
+    os << std::fixed << std::setprecision(3);
+    for (std::map<std::pair<std::string, std::string>, Summary>::const_iterator it = summaries.begin(); it != summaries.end(); ++it) {
+        const Summary& s = it->second;
+        os << std::left << std::setw(16) << it->first.first << std::setw(48) << it->first.second << std::right
+           << std::setw(10) << s.count
+           << std::setw(14) << s.total * 1000.
+           << std::setw(12) << (s.count ? s.total * 1000. / s.count : 0.)
+           << std::setw(12) << s.max * 1000.
+           << " ";
+        for (std::size_t j = 0; j < s.argTotals.size(); ++j) {
+            os << ' ' << s.argTotals[j].first << '=' << s.argTotals[j].second;
+        }
+        os << std::endl;
+    }
+    if (droppedEvents) {
+        os << droppedEvents << " events were not kept for the trace" << std::endl;
+    }
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void
+clear()
+{
+    AutoMutex locker(&g_mutex);
+
+    std::vector<Event>().swap(g_events);
+    g_droppedEvents = 0;
+    g_summaries.clear();
+}
+
+void
+report()
+{
+    {
+        AutoMutex locker(&g_mutex);
+        if ( g_summaries.empty() ) {
+            return;
+        }
+    }
+    const char* output = std::getenv("OFX_PROFILING_OUTPUT");
+    if ( !output || !*output ) {
+        writeSummary(std::cout);
+    } else {
+        std::string filename(output);
+        std::size_t pos = filename.find("%p");
+        if (pos != std::string::npos) {
+            std::ostringstream pid;
+            pid << getProcessId();
+            filename.replace( pos, 2, pid.str() );
+        }
+        if ( (filename.size() >= 5) && (filename.compare(filename.size() - 5, 5, ".json") == 0) ) {
+            if ( !writeChromeTrace(filename) ) {
+                std::cerr << "OFX profiling: cannot write " << filename << std::endl;
+            }
+        } else {
+            std::ofstream os( filename.c_str() );
+            if (os) {
+                writeSummary(os);
+            } else {
+                std::cerr << "OFX profiling: cannot write " << filename << std::endl;
+            }
+        }
+    }
+    clear();
+}
+} // namespace Profiling
+} // namespace OFX
+
+#endif // OFX_PROFILING
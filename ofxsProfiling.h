@@ -0,0 +1,154 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4; -*- */
+/* ***** BEGIN LICENSE BLOCK *****
+ * This file is part of openfx-supportext <https://github.com/NatronGitHub/openfx-supportext>,
+ * (C) 2018-2021 The Natron Developers
+ * (C) 2013-2018 INRIA
+ *
+ * openfx-supportext is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * openfx-supportext is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with openfx-supportext.  If not, see <http://www.gnu.org/licenses/gpl-2.0.html>
+ * ***** END LICENSE BLOCK ***** */
+
+/*
+ * OFX profiling instrumentation: scoped timers around actions and pixel processing.
+ *
+ * Profiling is compiled in only if OFX_PROFILING is defined when compiling the plug-in and ofxsProfiling.cpp.
+ * Otherwise the macros below expand to nothing, and their arguments are not evaluated.
+ *
+ * Each scope records an event with its category, name, thread, start time, duration and numeric
+ * arguments (e.g. the number of pixels). Abort checks (see checkAbort()) done by the thread
+ * during the scope are added as the abortChecks and abortMs arguments.
+ * report(), which should be called from the unload() function of the plug-in factory, writes the events
+ * to the file given by the OFX_PROFILING_OUTPUT environment variable:
+ * - a Chrome trace (to be opened with chrome://tracing or https://ui.perfetto.dev) if the name ends with .json,
+ * - a summary table (count, total and mean time, and argument totals of each event name) otherwise,
+ *   or on the standard output if the variable is not set.
+ * In the file name, %p is replaced by the process ID, so that each process of a render farm has its own file.
+ *
+ * Typical use:
+ *
+ *     void MyPlugin::render(const RenderArguments &args)
+ *     {
+ *         OFX_PROFILE_SCOPE(timer, "action", "MyPlugin::render");
+ *         OFX_PROFILE_ARG(timer, "pixels", (double)(args.renderWindow.x2 - args.renderWindow.x1) * (args.renderWindow.y2 - args.renderWindow.y1));
+ *         ...
+ *     }
+ */
+
+#ifndef openfx_supportext_ofxsProfiling_h
+#define openfx_supportext_ofxsProfiling_h
+
+#ifdef OFX_PROFILING
+
+#include <iostream>
+#include <string>
+
+#define OFX_PROFILE_SCOPE(timer, category, name) OFX::Profiling::ScopedTimer timer(category, name)
+#define OFX_PROFILE_ARG(timer, key, value) timer.setArg(key, value)
+
+#else
+
+#define OFX_PROFILE_SCOPE(timer, category, name) ( (void)0 )
+#define OFX_PROFILE_ARG(timer, key, value) ( (void)0 )
+
+#endif // OFX_PROFILING
+
+namespace OFX {
+namespace Profiling {
+#ifdef OFX_PROFILING
+
+/**
+ * @brief Records an event from its construction to its destruction.
+ * category, name and the argument keys must be string literals (they are not copied).
+ **/
+class ScopedTimer
+{
+public:
+    ScopedTimer(const char* category,
+                const char* name);
+
+    ~ScopedTimer();
+
+    /// Set a numeric argument of the event. At most kMaxArgs arguments are kept.
+    void setArg(const char* key, double value);
+
+    enum { kMaxArgs = 4 };
+
+private:
+    // non-copyable
+    ScopedTimer(const ScopedTimer &);
+    ScopedTimer & operator=(const ScopedTimer &);
+
+    const char* _category;
+    const char* _name;
+    double _start;
+    unsigned long _abortChecks; // abort checks of this thread at construction
+    double _abortSeconds;
+    int _nArgs;
+    const char* _argKeys[kMaxArgs];
+    double _argValues[kMaxArgs];
+};
+
+/// Counts one abort check of the current thread, and the time spent in it (see checkAbort()).
+class AbortCheckTimer
+{
+public:
+    AbortCheckTimer();
+
+    ~AbortCheckTimer();
+
+private:
+    double _start;
+};
+
+/// Writes the events recorded so far as a Chrome trace (JSON), and returns false if the file cannot be written.
+bool writeChromeTrace(const std::string& filename);
+
+/// Writes a summary table of the events recorded so far.
+void writeSummary(std::ostream& os);
+
+/// Removes all the events recorded so far.
+void clear();
+
+/**
+ * @brief Writes the events recorded so far as selected by the OFX_PROFILING_OUTPUT environment variable
+ * (see above), and removes them. Call it from the unload() function of the plug-in factory.
+ **/
+void report();
+
+#else // !OFX_PROFILING
+
+inline void
+report()
+{
+}
+
+#endif // OFX_PROFILING
+
+/**
+ * @brief Returns effect.abort(). Processors should call this rather than _effect.abort(),
+ * so that abort checks are counted when profiling.
+ **/
+template <class EFFECT>
+inline bool
+checkAbort(EFFECT& effect)
+{
+#ifdef OFX_PROFILING
+    AbortCheckTimer timer;
+#endif
+
+    return effect.abort();
+}
+} // namespace Profiling
+} // namespace OFX
+
+#endif /* defined(openfx_supportext_ofxsProfiling_h) */
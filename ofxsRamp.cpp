@@ -201,14 +201,37 @@ RampInteractHelper::draw(const DrawArgs &args)
     //glPushAttrib(GL_ALL_ATTRIB_BITS); // caller is responsible for protecting attribs
 
     glEnable(GL_LINE_SMOOTH);
-    glDisable(GL_POINT_SMOOTH);
     glEnable(GL_BLEND);
     glHint(GL_LINE_SMOOTH_HINT, GL_DONT_CARE);
-    glLineWidth(1.5f * screenPixelRatio);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     glLineStipple(2, 0xAAAA);
 
-    glPointSize(POINT_SIZE * screenPixelRatio);
+    // the geometry is built once, and drawn in both passes
+    OverlayBatch batch;
+    batch.setLineWidth(1.5f * screenPixelRatio);
+    batch.setPointSize(POINT_SIZE * screenPixelRatio);
+    for (int i = 0; i < 2; ++i) {
+        batch.setLineStipple(false);
+        batch.setPointSmooth(true);
+        const double darken = 0.5;
+        batch.setColor(color.r * darken, color.g * darken, color.b * darken);
+        PointTrajectory trajectory;
+        trajectory.update(i == 0 ? _point0 : _point1);
+        trajectory.addTo(&batch);
+
+        batch.setLineStipple(true);
+        batch.setPointSmooth(false);
+        bool dragging = _state == (i == 0 ? eInteractStateDraggingPoint0 : eInteractStateDraggingPoint1);
+        if (dragging) {
+            batch.setColor(0.f, 1.f, 0.f);
+        } else {
+            batch.setColor( (float)color.r, (float)color.g, (float)color.b );
+        }
+        batch.addPoint(p[i].x, p[i].y);
+
+        batch.setColor( (float)color.r, (float)color.g, (float)color.b );
+        batch.addLine(pline1[i].x, pline1[i].y, pline2[i].x, pline2[i].y);
+    }
 
     // Draw everything twice
     // l = 0: shadow
@@ -221,32 +244,9 @@ RampInteractHelper::draw(const DrawArgs &args)
         glTranslated(direction * shadow.x, -direction * shadow.y, 0);
         glMatrixMode(GL_MODELVIEW); // Modelview should be used on Nuke
 
-        
+        batch.draw(l == 0);
+        glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
         for (int i = 0; i < 2; ++i) {
-            glDisable(GL_LINE_STIPPLE);
-            glEnable(GL_POINT_SMOOTH);
-            const double darken = 0.5;
-            glColor3f(color.r * l * darken, color.g * l * darken, color.b * l * darken);
-            drawPointTrajectory(i ==0 ? _point0 : _point1);
-
-            glEnable(GL_LINE_STIPPLE);
-            glDisable(GL_POINT_SMOOTH);
-            bool dragging = _state == (i == 0 ? eInteractStateDraggingPoint0 : eInteractStateDraggingPoint1);
-            glBegin(GL_POINTS);
-            if (dragging) {
-                glColor3f(0.f * l, 1.f * l, 0.f * l);
-            } else {
-                glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
-            }
-            glVertex2d(p[i].x, p[i].y);
-            glEnd();
-
-            glBegin(GL_LINES);
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
-            glVertex2d(pline1[i].x, pline1[i].y);
-            glVertex2d(pline2[i].x, pline2[i].y);
-            glEnd();
-
             TextRenderer::bitmapString(p[i].x, p[i].y + POINT_SIZE * screenPixelRatio, i == 0 ? kParamRampPoint0Label : kParamRampPoint1Label, font);
         }
     }
@@ -27,10 +27,12 @@
 #define openfx_supportext_ofxsRamp_h
 
 #include <cmath>
+#include <algorithm>
 
 #include <ofxsInteract.h>
 #include <ofxsImageEffect.h>
 #include "ofxsMacros.h"
+#include "ofxsMaskMix.h"
 #include "ofxsOGLTextRenderer.h"
 #include "ofxsOGLHiDPI.h"
 
@@ -228,6 +230,62 @@ class RampOverlayDescriptorOldParams
 };
 
 
+// the ramp curve, for t in [0,1]
+template<RampTypeEnum type, typename T>
+inline T
+ofxsRampCurve(T t)
+{
+    // from http://www.comp-fu.com/2012/01/nukes-smooth-ramp-functions/
+    // linear
+    //y = x
+    // plinear: perceptually linear in rec709
+    //y = pow(x, 3)
+    // smooth: traditional smoothstep
+    //y = x*x*(3 - 2*x)
+    // smooth0: Catmull-Rom spline, smooth start, linear end
+    //y = x*x*(2 - x)
+    // smooth1: Catmull-Rom spline, linear start, smooth end
+    //y = x*(1 + x*(1 - x))
+    switch (type) {
+    case eRampTypeLinear:
+        break;
+    case eRampTypePLinear:
+        // plinear: perceptually linear in rec709
+        t = t * t * t;
+        break;
+    case eRampTypeEaseIn:
+        //t *= t; // old version, end of curve is too sharp
+        // smooth0: Catmull-Rom spline, smooth start, linear end
+        t = t * t * (2 - t);
+        break;
+    case eRampTypeEaseOut:
+        //t = - t * (t - 2); // old version, start of curve is too sharp
+        // smooth1: Catmull-Rom spline, linear start, smooth end
+        t = t * ( 1 + t * (1 - t) );
+        break;
+    case eRampTypeSmooth:
+        /*
+           t *= 2.;
+           if (t < 1) {
+           t = t * t / (2.);
+           } else {
+           --t;
+           t =  -0.5 * (t * (t - 2) - 1);
+           }
+         */
+        // smooth: traditional smoothstep
+        t = t * t * (3 - 2 * t);
+        break;
+    case eRampTypeNone:
+        t = 1;
+        break;
+    default:
+        break;
+    }
+
+    return t;
+} // ofxsRampCurve
+
 template<RampTypeEnum type>
 double
 ofxsRampFunc(double t)
@@ -237,53 +295,7 @@ ofxsRampFunc(double t)
     } else if (t <= 0) {
         t = 0.;
     } else {
-        // from http://www.comp-fu.com/2012/01/nukes-smooth-ramp-functions/
-        // linear
-        //y = x
-        // plinear: perceptually linear in rec709
-        //y = pow(x, 3)
-        // smooth: traditional smoothstep
-        //y = x*x*(3 - 2*x)
-        // smooth0: Catmull-Rom spline, smooth start, linear end
-        //y = x*x*(2 - x)
-        // smooth1: Catmull-Rom spline, linear start, smooth end
-        //y = x*(1 + x*(1 - x))
-        switch (type) {
-        case eRampTypeLinear:
-            break;
-        case eRampTypePLinear:
-            // plinear: perceptually linear in rec709
-            t = t * t * t;
-            break;
-        case eRampTypeEaseIn:
-            //t *= t; // old version, end of curve is too sharp
-            // smooth0: Catmull-Rom spline, smooth start, linear end
-            t = t * t * (2 - t);
-            break;
-        case eRampTypeEaseOut:
-            //t = - t * (t - 2); // old version, start of curve is too sharp
-            // smooth1: Catmull-Rom spline, linear start, smooth end
-            t = t * ( 1 + t * (1 - t) );
-            break;
-        case eRampTypeSmooth:
-            /*
-               t *= 2.;
-               if (t < 1) {
-               t = t * t / (2.);
-               } else {
-               --t;
-               t =  -0.5 * (t * (t - 2) - 1);
-               }
-             */
-            // smooth: traditional smoothstep
-            t = t * t * (3 - 2 * t);
-            break;
-        case eRampTypeNone:
-            t = 1.;
-            break;
-        default:
-            break;
-        }
+        t = ofxsRampCurve<type, double>(t);
     }
 
     return t;
@@ -341,6 +353,192 @@ ofxsRampFunc(const OfxPointD& p0,
     return t;
 }
 
+// number of pixels evaluated at once by ofxsRampFillRow
+#define kRampRowBlockSize 64
+
+/**
+ * @brief Get the range [*i0,*i1) of the indices i in [0,n) for which t = t0 + i*dt is strictly between 0 and 1.
+ * Outside of this range, t is clamped to 0 or 1, and the ramp is constant on each side.
+ * If the range is empty, *i0 = *i1 is the index where t goes from one side to the other (or n).
+ **/
+inline void
+ofxsRampRowRange(double t0,
+                 double dt,
+                 int n,
+                 int* i0,
+                 int* i1)
+{
+    if (dt == 0.) {
+        bool inside = (t0 > 0.) && (t0 < 1.);
+        *i0 = inside ? 0 : n;
+        *i1 = n;
+
+        return;
+    }
+    // first guess, from the exact solution, then fix it so that it matches the values of t actually computed
+    double a = -t0 / dt;
+    double b = (1. - t0) / dt;
+    double lo = (std::max)( 0., (std::min)( (double)n, std::floor( (std::min)(a, b) ) ) );
+    double hi = (std::max)( lo, (std::min)( (double)n, std::ceil( (std::max)(a, b) ) ) );
+    int begin = (int)lo;
+    int end = (int)hi;
+#define RAMP_INSIDE(i) ( (t0 + (i) * dt > 0.) && (t0 + (i) * dt < 1.) )
+    while ( begin < end && !RAMP_INSIDE(begin) ) {
+        ++begin;
+    }
+    while ( begin > 0 && RAMP_INSIDE(begin - 1) ) {
+        --begin;
+    }
+    while ( end > begin && !RAMP_INSIDE(end - 1) ) {
+        --end;
+    }
+    while ( end < n && RAMP_INSIDE(end) ) {
+        ++end;
+    }
+#undef RAMP_INSIDE
+    if (begin == end) {
+        // no t value strictly between 0 and 1, but t may still jump from one side to the other:
+        // return the first index on the other side
+#define RAMP_POSITIVE(i) (t0 + (i) * dt > 0.)
+        int c = (int)(std::max)( 0., (std::min)( (double)n, std::ceil(a) ) );
+        while ( c > 0 && RAMP_POSITIVE(c - 1) != RAMP_POSITIVE(0) ) {
+            --c;
+        }
+        while ( c < n && RAMP_POSITIVE(c) == RAMP_POSITIVE(0) ) {
+            ++c;
+        }
+#undef RAMP_POSITIVE
+        begin = end = c;
+    }
+    *i0 = begin;
+    *i1 = end;
+}
+
+/**
+ * @brief Fill n pixels with the same ramp value
+ **/
+template<class PIX, int nComponents, int maxValue>
+void
+ofxsRampFillSolid(double t,
+                  const double color0[4],
+                  const double color1[4],
+                  PIX* dstPix,
+                  int n)
+{
+    PIX pix[nComponents];
+
+    for (int c = 0; c < nComponents; ++c) {
+        // a single-channel image is alpha
+        int k = (nComponents == 1) ? 3 : c;
+        pix[c] = ofxsClampIfInt<PIX, maxValue>( (float)( (color0[k] * (1. - t) + color1[k] * t) * maxValue ), 0, maxValue );
+    }
+    for (int i = 0; i < n; ++i, dstPix += nComponents) {
+        for (int c = 0; c < nComponents; ++c) {
+            dstPix[c] = pix[c];
+        }
+    }
+}
+
+/**
+ * @brief Fill a row of n pixels with the ramp blended between color0 and color1.
+ * p is the canonical position of the first pixel, and the pixels are dx apart in canonical coordinates along x.
+ * This gives the same result as ofxsRampFunc<type>() on each pixel, but the parts of the row where the
+ * ramp is constant are solid fills, and the rest is evaluated in single precision, in blocks of
+ * kRampRowBlockSize pixels without branches so that the compiler can vectorize it.
+ **/
+template<class PIX, int nComponents, int maxValue, RampTypeEnum type>
+void
+ofxsRampFillRow(const OfxPointD& p0,
+                double nx,
+                double ny,
+                const OfxPointD& p,
+                double dx,
+                const double color0[4],
+                const double color1[4],
+                PIX* dstPix,
+                int n)
+{
+    if (n <= 0) {
+        return;
+    }
+    double t0 = (p.x - p0.x) * nx + (p.y - p0.y) * ny;
+    double dt = dx * nx;
+    if ( (type == eRampTypeNone) || (dt == 0.) ) {
+        ofxsRampFillSolid<PIX, nComponents, maxValue>(ofxsRampFunc<type>(t0), color0, color1, dstPix, n);
+
+        return;
+    }
+    int i0, i1;
+    ofxsRampRowRange(t0, dt, n, &i0, &i1);
+    if (i0 > 0) {
+        ofxsRampFillSolid<PIX, nComponents, maxValue>(ofxsRampFunc<type>(t0), color0, color1, dstPix, i0);
+    }
+    if (i1 < n) {
+        ofxsRampFillSolid<PIX, nComponents, maxValue>(ofxsRampFunc<type>(t0 + (n - 1) * dt), color0, color1, dstPix + i1 * nComponents, n - i1);
+    }
+
+    float c0[nComponents], dc[nComponents];
+    for (int c = 0; c < nComponents; ++c) {
+        int k = (nComponents == 1) ? 3 : c;
+        c0[c] = (float)(color0[k] * maxValue);
+        dc[c] = (float)( (color1[k] - color0[k]) * maxValue );
+    }
+    const float dtf = (float)dt;
+    float t[kRampRowBlockSize];
+    for (int i = i0; i < i1; i += kRampRowBlockSize) {
+        const int m = (std::min)(kRampRowBlockSize, i1 - i);
+        const float tb = (float)(t0 + i * dt);
+        for (int j = 0; j < m; ++j) {
+            // t is within (0,1) up to rounding errors
+            float tj = (std::min)( 1.f, (std::max)(0.f, tb + j * dtf) );
+            t[j] = ofxsRampCurve<type, float>(tj);
+        }
+        PIX* dst = dstPix + i * nComponents;
+        for (int j = 0; j < m; ++j) {
+            for (int c = 0; c < nComponents; ++c) {
+                dst[j * nComponents + c] = ofxsClampIfInt<PIX, maxValue>(c0[c] + dc[c] * t[j], 0, maxValue);
+            }
+        }
+    }
+} // ofxsRampFillRow
+
+// same as above, the ramp type is only checked once per row
+template<class PIX, int nComponents, int maxValue>
+void
+ofxsRampFillRow(const OfxPointD& p0,
+                double nx,
+                double ny,
+                RampTypeEnum type,
+                const OfxPointD& p,
+                double dx,
+                const double color0[4],
+                const double color1[4],
+                PIX* dstPix,
+                int n)
+{
+    switch (type) {
+    case eRampTypeLinear:
+        ofxsRampFillRow<PIX, nComponents, maxValue, eRampTypeLinear>(p0, nx, ny, p, dx, color0, color1, dstPix, n);
+        break;
+    case eRampTypePLinear:
+        ofxsRampFillRow<PIX, nComponents, maxValue, eRampTypePLinear>(p0, nx, ny, p, dx, color0, color1, dstPix, n);
+        break;
+    case eRampTypeEaseIn:
+        ofxsRampFillRow<PIX, nComponents, maxValue, eRampTypeEaseIn>(p0, nx, ny, p, dx, color0, color1, dstPix, n);
+        break;
+    case eRampTypeEaseOut:
+        ofxsRampFillRow<PIX, nComponents, maxValue, eRampTypeEaseOut>(p0, nx, ny, p, dx, color0, color1, dstPix, n);
+        break;
+    case eRampTypeSmooth:
+        ofxsRampFillRow<PIX, nComponents, maxValue, eRampTypeSmooth>(p0, nx, ny, p, dx, color0, color1, dstPix, n);
+        break;
+    case eRampTypeNone:
+    default:
+        ofxsRampFillRow<PIX, nComponents, maxValue, eRampTypeNone>(p0, nx, ny, p, dx, color0, color1, dstPix, n);
+        break;
+    }
+}
+
 void ofxsRampDescribeParams(OFX::ImageEffectDescriptor &desc,
                             OFX::PageParamDescriptor *page,
                             OFX::GroupParamDescriptor *group,
@@ -26,14 +26,7 @@
 #include "ofxsRectangleInteract.h"
 #include <cmath>
 
-#ifdef __APPLE__
-#ifndef GL_SILENCE_DEPRECATION
-#define GL_SILENCE_DEPRECATION // Yes, we are still doing OpenGL 2.1
-#endif
-#include <OpenGL/gl.h>
-#else
-#include <GL/gl.h>
-#endif
+#include "ofxsOGLOverlayBatch.h"
 
 #define POINT_SIZE 5
 #define POINT_TOLERANCE 6
@@ -71,26 +64,26 @@ fround(double val,
 }
 
 static void
-drawPoint(const OfxRGBColourD &color,
-          bool draw,
-          double x,
-          double y,
-          RectangleInteract::DrawStateEnum id,
-          RectangleInteract::DrawStateEnum ds,
-          bool keepAR,
-          int l)
+addPoint(OverlayBatch* batch,
+         const OfxRGBColourD &color,
+         bool draw,
+         double x,
+         double y,
+         RectangleInteract::DrawStateEnum id,
+         RectangleInteract::DrawStateEnum ds,
+         bool keepAR)
 {
     if (draw) {
         if (ds == id) {
             if (keepAR) {
-                glColor3f(1.f * l, 0.f * l, 0.f * l);
+                batch->setColor(1.f, 0.f, 0.f);
             } else {
-                glColor3f(0.f * l, 1.f * l, 0.f * l);
+                batch->setColor(0.f, 1.f, 0.f);
             }
         } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+            batch->setColor( (float)color.r, (float)color.g, (float)color.b );
         }
-        glVertex2d(x, y);
+        batch->addPoint(x, y);
     }
 }
 
@@ -142,14 +135,41 @@ RectangleInteract::draw(const DrawArgs &args)
     //glPushAttrib(GL_ALL_ATTRIB_BITS); // caller is responsible for protecting attribs
     aboutToCheckInteractivity(args.time);
 
-    glDisable(GL_LINE_STIPPLE);
     glEnable(GL_LINE_SMOOTH);
-    glDisable(GL_POINT_SMOOTH);
     glEnable(GL_BLEND);
     glHint(GL_LINE_SMOOTH_HINT, GL_DONT_CARE);
-    glLineWidth(1.5f * screenPixelRatio);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
+    // the geometry is built once, and drawn in both passes
+    OverlayBatch batch;
+    batch.setLineWidth(1.5f * screenPixelRatio);
+    batch.setPointSize(POINT_SIZE * screenPixelRatio);
+
+    batch.setColor( (float)color.r, (float)color.g, (float)color.b );
+    const double rect[8] = { x1, y1, x1, y2, x2, y2, x2, y1 };
+    batch.addLineStrip(rect, 4, true);
+
+    addPoint(&batch, color, allowBtmLeftInteraction(),  x1, y1, eDrawStateHoveringBtmLeft,  _drawState, keepAR);
+    addPoint(&batch, color, allowMidLeftInteraction(),  x1, yc, eDrawStateHoveringMidLeft,  _drawState, false);
+    addPoint(&batch, color, allowTopLeftInteraction(),  x1, y2, eDrawStateHoveringTopLeft,  _drawState, keepAR);
+    addPoint(&batch, color, allowBtmMidInteraction(),   xc, y1, eDrawStateHoveringBtmMid,   _drawState, false);
+    addPoint(&batch, color, allowCenterInteraction(),   xc, yc, eDrawStateHoveringCenter,   _drawState, false);
+    addPoint(&batch, color, allowTopMidInteraction(),   xc, y2, eDrawStateHoveringTopMid,   _drawState, false);
+    addPoint(&batch, color, allowBtmRightInteraction(), x2, y1, eDrawStateHoveringBtmRight, _drawState, keepAR);
+    addPoint(&batch, color, allowMidRightInteraction(), x2, yc, eDrawStateHoveringMidRight, _drawState, false);
+    addPoint(&batch, color, allowTopRightInteraction(), x2, y2, eDrawStateHoveringTopRight, _drawState, keepAR);
+
+    ///center cross hair
+    if ( (_drawState == eDrawStateHoveringCenter) || ( centered && (_drawState != eDrawStateInactive) ) ) {
+        batch.setColor(0.f, 1.f, 0.f);
+    } else if ( !allowCenterInteraction() ) {
+        batch.setColor( (float)(color.r / 2), (float)(color.g / 2), (float)(color.b / 2) );
+    } else {
+        batch.setColor( (float)color.r, (float)color.g, (float)color.b );
+    }
+    batch.addLine(xc - CROSS_SIZE * pscale.x, yc, xc + CROSS_SIZE * pscale.x, yc);
+    batch.addLine(xc, yc - CROSS_SIZE * pscale.y, xc, yc + CROSS_SIZE * pscale.y);
+
     // Draw everything twice
     // l = 0: shadow
     // l = 1: drawing
@@ -161,43 +181,7 @@ RectangleInteract::draw(const DrawArgs &args)
         glTranslated(direction * shadow.x, -direction * shadow.y, 0);
         glMatrixMode(GL_MODELVIEW); // Modelview should be used on Nuke
 
-        glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
-
-        glBegin(GL_LINE_LOOP);
-        glVertex2d(x1, y1);
-        glVertex2d(x1, y2);
-        glVertex2d(x2, y2);
-        glVertex2d(x2, y1);
-        glEnd();
-
-        glPointSize(POINT_SIZE * screenPixelRatio);
-        glBegin(GL_POINTS);
-        drawPoint(color, allowBtmLeftInteraction(),  x1, y1, eDrawStateHoveringBtmLeft,  _drawState, keepAR, l);
-        drawPoint(color, allowMidLeftInteraction(),  x1, yc, eDrawStateHoveringMidLeft,  _drawState, false,  l);
-        drawPoint(color, allowTopLeftInteraction(),  x1, y2, eDrawStateHoveringTopLeft,  _drawState, keepAR, l);
-        drawPoint(color, allowBtmMidInteraction(),   xc, y1, eDrawStateHoveringBtmMid,   _drawState, false,  l);
-        drawPoint(color, allowCenterInteraction(),   xc, yc, eDrawStateHoveringCenter,   _drawState, false,  l);
-        drawPoint(color, allowTopMidInteraction(),   xc, y2, eDrawStateHoveringTopMid,   _drawState, false,  l);
-        drawPoint(color, allowBtmRightInteraction(), x2, y1, eDrawStateHoveringBtmRight, _drawState, keepAR, l);
-        drawPoint(color, allowMidRightInteraction(), x2, yc, eDrawStateHoveringMidRight, _drawState, false,  l);
-        drawPoint(color, allowTopRightInteraction(), x2, y2, eDrawStateHoveringTopRight, _drawState, keepAR, l);
-        glEnd();
-        glPointSize(1);
-
-        ///draw center cross hair
-        glBegin(GL_LINES);
-        if ( (_drawState == eDrawStateHoveringCenter) || ( centered && (_drawState != eDrawStateInactive) ) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-        } else if ( !allowCenterInteraction() ) {
-            glColor3f( (float)(color.r / 2) * l, (float)(color.g / 2) * l, (float)(color.b / 2) * l );
-        } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
-        }
-        glVertex2d(xc - CROSS_SIZE * pscale.x, yc);
-        glVertex2d(xc + CROSS_SIZE * pscale.x, yc);
-        glVertex2d(xc, yc - CROSS_SIZE * pscale.y);
-        glVertex2d(xc, yc + CROSS_SIZE * pscale.y);
-        glEnd();
+        batch.draw(l == 0);
     }
     //glPopAttrib();
 
@@ -24,23 +24,25 @@
 
 #include "ofxsTracking.h"
 #include <cmath>
+#include <algorithm>
+#include <map>
 
+#include "ofxsCoords.h"
+#include "ofxsMultiThread.h"
+#include "tinythread.h"
 #include "ofxsOGLTextRenderer.h"
+#include "ofxsProfiling.h"
 
-#ifdef __APPLE__
-#ifndef GL_SILENCE_DEPRECATION
-#define GL_SILENCE_DEPRECATION // Yes, we are still doing OpenGL 2.1
-#endif
-#include <OpenGL/gl.h>
-#else
-#include <GL/gl.h>
-#endif
+#include "ofxsOGLOverlayBatch.h"
 
 #define kSupportsTiles 1
 #define kSupportsMultiResolution 1
 #define kSupportsRenderScale 0 // we need full-res images
 #define kRenderThreadSafety eRenderFullySafe
 
+#define kTrackerPrefetchFrames 0 // prefetching is opt-in, see GenericTrackerPlugin::_prefetchFrames
+#define kTrackerPrefetchMemory (256 * 1024 * 1024)
+
 #define POINT_SIZE 5
 #define POINT_TOLERANCE 6
 #define HANDLE_SIZE 6
@@ -58,6 +60,17 @@ GenericTrackerPlugin::GenericTrackerPlugin(OfxImageEffectHandle handle)
     , _nextButton(NULL)
     , _forwardButton(NULL)
     , _instanceName(NULL)
+    , _center(NULL)
+    , _offset(NULL)
+    , _patternBtmLeft(NULL)
+    , _patternTopRight(NULL)
+    , _searchBtmLeft(NULL)
+    , _searchTopRight(NULL)
+    , _correlation(NULL)
+    , _refFrame(NULL)
+    , _enableRefFrame(NULL)
+    , _prefetchFrames(kTrackerPrefetchFrames)
+    , _prefetchMemory(kTrackerPrefetchMemory)
 {
     _dstClip = fetchClip(kOfxImageEffectOutputClipName);
     assert(_dstClip->getPixelComponents() == ePixelComponentAlpha ||
@@ -76,6 +89,35 @@ GenericTrackerPlugin::GenericTrackerPlugin(OfxImageEffectHandle handle)
     _forwardButton = fetchPushButtonParam(kParamTrackingForward);
     _instanceName = fetchStringParam(kNatronOfxParamStringSublabelName);
     assert(_backwardButton && _prevButton && _nextButton && _forwardButton && _instanceName);
+
+    // the track parameters are defined by the plugin, see trackRange()
+    if ( paramExists(kParamTrackingCenterPoint) ) {
+        _center = fetchDouble2DParam(kParamTrackingCenterPoint);
+    }
+    if ( paramExists(kParamTrackingOffset) ) {
+        _offset = fetchDouble2DParam(kParamTrackingOffset);
+    }
+    if ( paramExists(kParamTrackingPatternBoxBtmLeft) ) {
+        _patternBtmLeft = fetchDouble2DParam(kParamTrackingPatternBoxBtmLeft);
+    }
+    if ( paramExists(kParamTrackingPatternBoxTopRight) ) {
+        _patternTopRight = fetchDouble2DParam(kParamTrackingPatternBoxTopRight);
+    }
+    if ( paramExists(kParamTrackingSearchBoxBtmLeft) ) {
+        _searchBtmLeft = fetchDouble2DParam(kParamTrackingSearchBoxBtmLeft);
+    }
+    if ( paramExists(kParamTrackingSearchBoxTopRight) ) {
+        _searchTopRight = fetchDouble2DParam(kParamTrackingSearchBoxTopRight);
+    }
+    if ( paramExists(kParamTrackingCorrelationScore) ) {
+        _correlation = fetchDoubleParam(kParamTrackingCorrelationScore);
+    }
+    if ( paramExists(kParamTrackingReferenceFrame) ) {
+        _refFrame = fetchIntParam(kParamTrackingReferenceFrame);
+    }
+    if ( paramExists(kParamTrackingEnableReferenceFrame) ) {
+        _enableRefFrame = fetchBooleanParam(kParamTrackingEnableReferenceFrame);
+    }
 }
 
 bool
@@ -83,6 +125,8 @@ GenericTrackerPlugin::isIdentity(const IsIdentityArguments &args,
                                  Clip * &identityClip,
                                  double &identityTime, int& /*view*/, std::string& /*plane*/)
 {
+    OFX_PROFILE_SCOPE(timer, "action", "GenericTrackerPlugin::isIdentity");
+
     if ( !kSupportsRenderScale && ( (args.renderScale.x != 1.) || (args.renderScale.y != 1.) ) ) {
         throwSuiteStatusException(kOfxStatFailed);
 
@@ -146,6 +190,8 @@ bool
 GenericTrackerPlugin::getRegionOfDefinition(const RegionOfDefinitionArguments &args,
                                             OfxRectD & /*rod*/)
 {
+    OFX_PROFILE_SCOPE(timer, "action", "GenericTrackerPlugin::getRegionOfDefinition");
+
     if ( !kSupportsRenderScale && ( (args.renderScale.x != 1.) || (args.renderScale.y != 1.) ) ) {
         throwSuiteStatusException(kOfxStatFailed);
     }
@@ -153,6 +199,164 @@ GenericTrackerPlugin::getRegionOfDefinition(const RegionOfDefinitionArguments &a
     return false;
 }
 
+void
+GenericTrackerPlugin::getOverlayTracks(std::vector<TrackerRegionOverlay::Track>* tracks)
+{
+    if ( !_center || !_patternBtmLeft || !_patternTopRight || !_searchBtmLeft || !_searchTopRight ) {
+        return;
+    }
+    TrackerRegionOverlay::Track track;
+    track.params.center = _center;
+    track.params.offset = _offset;
+    track.params.patternBtmLeft = _patternBtmLeft;
+    track.params.patternTopRight = _patternTopRight;
+    track.params.searchBtmLeft = _searchBtmLeft;
+    track.params.searchTopRight = _searchTopRight;
+    track.params.correlation = _correlation;
+    track.params.refFrame = _refFrame;
+    track.params.enableRefFrame = _enableRefFrame;
+    track.name = _instanceName;
+    tracks->push_back(track);
+}
+
+void
+GenericTrackerPlugin::trackRange(const TrackArguments & args)
+{
+    OFX_PROFILE_SCOPE(timer, "action", "GenericTrackerPlugin::trackRange");
+    OFX_PROFILE_ARG(timer, "frames", std::fabs(args.last - args.first) + 1);
+
+    if ( !_center || !_patternBtmLeft || !_patternTopRight || !_searchBtmLeft || !_searchTopRight ) {
+        // the plugin did not define the track parameters, and must override trackRange()
+        throwSuiteStatusException(kOfxStatFailed);
+
+        return;
+    }
+
+    std::vector<TrackerTrackParams> tracks(1);
+    TrackerTrackParams & track = tracks[0];
+    track.center = _center;
+    track.offset = _offset;
+    track.patternBtmLeft = _patternBtmLeft;
+    track.patternTopRight = _patternTopRight;
+    track.searchBtmLeft = _searchBtmLeft;
+    track.searchTopRight = _searchTopRight;
+    track.correlation = _correlation;
+    track.refFrame = _refFrame;
+    track.enableRefFrame = _enableRefFrame;
+    trackTracks(args, tracks);
+}
+
+// get the values of the track parameters, to track from time
+static void
+getTrackerTrack(const TrackerTrackParams & params,
+                OfxTime time,
+                TrackerTrack* track)
+{
+    assert(params.center && params.patternBtmLeft && params.patternTopRight && params.searchBtmLeft && params.searchTopRight);
+    track->refTime = time;
+    if ( params.refFrame && params.enableRefFrame && params.enableRefFrame->getValueAtTime(time) ) {
+        track->refTime = params.refFrame->getValueAtTime(time);
+    }
+    track->refCenter = params.center->getValueAtTime(track->refTime);
+    track->refOffset.x = track->refOffset.y = 0.;
+    track->offset.x = track->offset.y = 0.;
+    if (params.offset) {
+        track->refOffset = params.offset->getValueAtTime(track->refTime);
+        track->offset = params.offset->getValueAtTime(time);
+    }
+    track->patternBtmLeft = params.patternBtmLeft->getValueAtTime(track->refTime);
+    track->patternTopRight = params.patternTopRight->getValueAtTime(track->refTime);
+    track->center = params.center->getValueAtTime(time);
+    track->searchBtmLeft = params.searchBtmLeft->getValueAtTime(time);
+    track->searchTopRight = params.searchTopRight->getValueAtTime(time);
+    track->found = false;
+    track->newCenter = track->center;
+    track->score = 0.;
+}
+
+void
+GenericTrackerPlugin::trackTracks(const TrackArguments & args,
+                                  const std::vector<TrackerTrackParams> & tracks)
+{
+    if (!_srcClip) {
+        throwSuiteStatusException(kOfxStatFailed);
+
+        return;
+    }
+
+    const OfxTime step = args.forward ? 1 : -1;
+    const int nFrames = (int)std::floor(std::fabs(args.last - args.first) + 0.5) + 1;
+    const bool showProgress = nFrames > 1;
+    // the indices of the tracks that are still tracked
+    std::vector<std::size_t> active( tracks.size() );
+    for (std::size_t i = 0; i < tracks.size(); ++i) {
+        active[i] = i;
+    }
+    std::vector<TrackerTrack> batch;
+    auto_ptr<TrackerFramePrefetcher> prefetcher;
+    if ( (_prefetchFrames > 0) && (nFrames > 1) ) {
+        prefetcher.reset( new TrackerFramePrefetcher(_srcClip, args, _prefetchFrames, _prefetchMemory) );
+    }
+
+    if (showProgress) {
+        progressStart("Tracking...");
+    }
+    beginEditBlock("trackRange");
+    try {
+        for (int f = 0; f < nFrames && !active.empty(); ++f) {
+            const OfxTime t = args.first + f * step;
+            batch.resize( active.size() );
+            // the region to prefetch: the search areas, grown by half their size to allow for the motion
+            OfxRectD region = {0., 0., 0., 0.};
+            for (std::size_t k = 0; k < active.size(); ++k) {
+                TrackerTrack & track = batch[k];
+                getTrackerTrack(tracks[active[k]], t, &track);
+                const double w = track.searchTopRight.x - track.searchBtmLeft.x;
+                const double h = track.searchTopRight.y - track.searchBtmLeft.y;
+                OfxRectD r;
+                r.x1 = track.center.x + track.offset.x + track.searchBtmLeft.x - w / 2;
+                r.y1 = track.center.y + track.offset.y + track.searchBtmLeft.y - h / 2;
+                r.x2 = track.center.x + track.offset.x + track.searchTopRight.x + w / 2;
+                r.y2 = track.center.y + track.offset.y + track.searchTopRight.y + h / 2;
+                Coords::rectBoundingBox(region, r, &region);
+            }
+            if ( prefetcher.get() ) {
+                prefetcher->setCurrentFrame(t, region);
+            }
+            trackerTrackPoints( _srcClip, t + step, args.renderScale, &batch, prefetcher.get() );
+            std::size_t nActive = 0;
+            for (std::size_t k = 0; k < active.size(); ++k) {
+                if (!batch[k].found) {
+                    continue;
+                }
+                const TrackerTrackParams & params = tracks[active[k]];
+                params.center->setValueAtTime(t + step, batch[k].newCenter);
+                if (params.correlation) {
+                    params.correlation->setValueAtTime(t + step, batch[k].score);
+                }
+                active[nActive++] = active[k];
+            }
+            active.resize(nActive);
+            if ( showProgress && !progressUpdate( (f + 1) / (double)nFrames ) ) {
+                if ( prefetcher.get() ) {
+                    prefetcher->cancel();
+                }
+                break;
+            }
+        }
+    } catch (...) {
+        endEditBlock();
+        if (showProgress) {
+            progressEnd();
+        }
+        throw;
+    }
+    endEditBlock();
+    if (showProgress) {
+        progressEnd();
+    }
+} // GenericTrackerPlugin::trackTracks
+
 void
 genericTrackerDescribe(ImageEffectDescriptor &desc)
 {
@@ -295,287 +499,1459 @@ genericTrackerDescribePointParameters(ImageEffectDescriptor &desc,
     }
 } // genericTrackerDescribePointParameters
 
-//////////////////// INTERACT ////////////////////
+//////////////////// PATTERN MATCHING ////////////////////
+
+// the pattern must be at least that large at the coarsest level
+#define kTrackerMinPatternSize 4
+// levels are added until the search radius is at most that at the coarsest level
+#define kTrackerMaxSearchRadius 4
+#define kTrackerMaxLevels 8
+// search radius at the finer levels, around the position found at the previous level
+#define kTrackerRefineRadius 2
+#define kTrackerLKIterations 10
+
+template <typename PIX, int maxValue>
+static void
+fillLuminance(const Image & img,
+              const OfxRectI & bounds,
+              float* dst)
+{
+    const int nComponents = img.getPixelComponentCount();
+
+    for (int y = bounds.y1; y < bounds.y2; ++y) {
+        const PIX* src = (const PIX*)img.getPixelAddress(bounds.x1, y);
+        assert(src);
+        if (nComponents >= 3) {
+            for (int x = bounds.x1; x < bounds.x2; ++x, src += nComponents) {
+                *dst++ = (0.2126f * src[0] + 0.7152f * src[1] + 0.0722f * src[2]) / maxValue; // Rec.709 luminance formula
+            }
+        } else {
+            for (int x = bounds.x1; x < bounds.x2; ++x, src += nComponents) {
+                *dst++ = src[0] / (float)maxValue;
+            }
+        }
+    }
+}
+
+void
+TrackerPyramid::build(const Image & img,
+                      const OfxRectI & window,
+                      int nLevels)
+{
+    _levels.clear();
+    OfxRectI bounds;
+    if ( (nLevels <= 0) || !Coords::rectIntersection( window, img.getBounds(), &bounds ) || Coords::rectIsEmpty(bounds) ) {
+        return;
+    }
+    _levels.resize(nLevels);
+    _levels[0].bounds = bounds;
+    _levels[0].pixels.resize( (std::size_t)(bounds.x2 - bounds.x1) * (bounds.y2 - bounds.y1) );
+    switch ( img.getPixelDepth() ) {
+    case eBitDepthUByte:
+        fillLuminance<unsigned char, 255>(img, bounds, &_levels[0].pixels.front());
+        break;
+    case eBitDepthUShort:
+        fillLuminance<unsigned short, 65535>(img, bounds, &_levels[0].pixels.front());
+        break;
+    case eBitDepthFloat:
+        fillLuminance<float, 1>(img, bounds, &_levels[0].pixels.front());
+        break;
+    default:
+        _levels.clear();
+        throwSuiteStatusException(kOfxStatErrFormat);
+
+        return;
+    }
+
+    // each pixel of a level is the average of the pixels it covers in the previous level (see halveWindow() in ofxsMipmap.cpp)
+    for (int l = 1; l < nLevels; ++l) {
+        const Level & src = _levels[l - 1];
+        Level & dst = _levels[l];
+        const int srcRowSize = src.bounds.x2 - src.bounds.x1;
+        dst.bounds = Coords::downscalePowerOfTwoSmallestEnclosing(src.bounds, 1);
+        dst.pixels.resize( (std::size_t)(dst.bounds.x2 - dst.bounds.x1) * (dst.bounds.y2 - dst.bounds.y1) );
+        float* dstPix = &dst.pixels.front();
+        for (int y = dst.bounds.y1; y < dst.bounds.y2; ++y) {
+            const int sy1 = (std::max)(2 * y, src.bounds.y1);
+            const int sy2 = (std::min)(2 * y + 2, src.bounds.y2);
+            for (int x = dst.bounds.x1; x < dst.bounds.x2; ++x) {
+                const int sx1 = (std::max)(2 * x, src.bounds.x1);
+                const int sx2 = (std::min)(2 * x + 2, src.bounds.x2);
+                assert(sx1 < sx2 && sy1 < sy2);
+                float sum = 0.f;
+                for (int sy = sy1; sy < sy2; ++sy) {
+                    const float* srcPix = &src.pixels[(std::size_t)(sy - src.bounds.y1) * srcRowSize + (sx1 - src.bounds.x1)];
+                    for (int sx = sx1; sx < sx2; ++sx) {
+                        sum += *srcPix++;
+                    }
+                }
+                *dstPix++ = sum / ( (sx2 - sx1) * (sy2 - sy1) );
+            }
+        }
+    }
+} // TrackerPyramid::build
+
+const float*
+TrackerPyramid::getPixelAddress(int level,
+                                int x,
+                                int y) const
+{
+    const Level & l = _levels[level];
+
+    if ( (x < l.bounds.x1) || (x >= l.bounds.x2) || (y < l.bounds.y1) || (y >= l.bounds.y2) ) {
+        return NULL;
+    }
+
+    return &l.pixels[(std::size_t)(y - l.bounds.y1) * (l.bounds.x2 - l.bounds.x1) + (x - l.bounds.x1)];
+}
+
+float
+TrackerPyramid::getPixelBilinear(int level,
+                                 double x,
+                                 double y) const
+{
+    const Level & l = _levels[level];
+
+    x = (std::max)( (double)l.bounds.x1, (std::min)(x, l.bounds.x2 - 1.) );
+    y = (std::max)( (double)l.bounds.y1, (std::min)(y, l.bounds.y2 - 1.) );
+    const int x1 = (int)std::floor(x);
+    const int y1 = (int)std::floor(y);
+    const int x2 = (std::min)(x1 + 1, l.bounds.x2 - 1);
+    const int y2 = (std::min)(y1 + 1, l.bounds.y2 - 1);
+    const float dx = (float)(x - x1);
+    const float dy = (float)(y - y1);
+    const int rowSize = l.bounds.x2 - l.bounds.x1;
+    const float* p = &l.pixels.front();
+    const float p11 = p[(y1 - l.bounds.y1) * rowSize + (x1 - l.bounds.x1)];
+    const float p21 = p[(y1 - l.bounds.y1) * rowSize + (x2 - l.bounds.x1)];
+    const float p12 = p[(y2 - l.bounds.y1) * rowSize + (x1 - l.bounds.x1)];
+    const float p22 = p[(y2 - l.bounds.y1) * rowSize + (x2 - l.bounds.x1)];
+
+    return (1.f - dy) * ( (1.f - dx) * p11 + dx * p21 ) + dy * ( (1.f - dx) * p12 + dx * p22 );
+}
 
+// the pixels of the given level that are entirely covered by r, at level 0
+static OfxRectI
+downscalePowerOfTwoLargestEnclosed(const OfxRectI & r,
+                                   unsigned int level)
+{
+    const int pot_minus1 = (1 << level) - 1;
+    OfxRectI ret;
+
+    ret.x1 = (r.x1 + pot_minus1) >> level;
+    ret.y1 = (r.y1 + pot_minus1) >> level;
+    ret.x2 = r.x2 >> level;
+    ret.y2 = r.y2 >> level;
+
+    return ret;
+}
+
+int
+trackerGetPyramidLevels(const OfxRectI & patternWindow,
+                        const OfxRectI & searchWindow)
+{
+    const int patternSize = (std::min)(patternWindow.x2 - patternWindow.x1, patternWindow.y2 - patternWindow.y1);
+    const int searchRadius = (std::max)( (searchWindow.x2 - searchWindow.x1) - (patternWindow.x2 - patternWindow.x1),
+                                         (searchWindow.y2 - searchWindow.y1) - (patternWindow.y2 - patternWindow.y1) ) / 2;
+    int nLevels = 1;
+
+    while ( nLevels < kTrackerMaxLevels &&
+            (searchRadius >> (nLevels - 1) ) > kTrackerMaxSearchRadius &&
+            ( (patternSize >> nLevels) - 1 ) >= kTrackerMinPatternSize ) {
+        ++nLevels;
+    }
+
+    return nLevels;
+}
+
+// the pattern of the given level, with zero mean and unit norm
 static bool
-isNearby(const OfxPointD & p,
-         double x,
-         double y,
-         double tolerance,
-         const OfxPointD & pscale)
+getTrackerTemplate(const TrackerPyramid & ref,
+                   int level,
+                   const OfxRectI & pattern,
+                   std::vector<float>* t)
 {
-    return std::fabs(p.x - x) <= tolerance * pscale.x &&  std::fabs(p.y - y) <= tolerance * pscale.y;
+    const int w = pattern.x2 - pattern.x1;
+    const int h = pattern.y2 - pattern.y1;
+    double sum = 0.;
+
+    t->resize(w * h);
+    for (int y = 0; y < h; ++y) {
+        const float* src = ref.getPixelAddress(level, pattern.x1, pattern.y1 + y);
+        assert( src && ref.getPixelAddress(level, pattern.x2 - 1, pattern.y1 + y) );
+        std::copy(src, src + w, &(*t)[y * w]);
+        for (int x = 0; x < w; ++x) {
+            sum += src[x];
+        }
+    }
+    const float mean = (float)( sum / (w * h) );
+    double norm2 = 0.;
+    for (int i = 0; i < w * h; ++i) {
+        (*t)[i] -= mean;
+        norm2 += (*t)[i] * (*t)[i];
+    }
+    if (norm2 <= 1e-10 * w * h) {
+        // uniform pattern
+        return false;
+    }
+    const float s = (float)( 1. / std::sqrt(norm2) );
+    for (int i = 0; i < w * h; ++i) {
+        (*t)[i] *= s;
+    }
+
+    return true;
 }
 
-bool
-TrackerRegionInteract::draw(const DrawArgs &args)
+// NCC of the template t (w x h) with the window of img at (x,y), which must be within the bounds of the level.
+// The inner loops are contiguous dot products, which the compiler vectorizes (the float reductions
+// require -ffast-math or -fassociative-math with GCC).
+static double
+getTrackerNCC(const std::vector<float> & t,
+              int w,
+              int h,
+              const TrackerPyramid & img,
+              int level,
+              int x,
+              int y)
 {
-    OfxRGBColourD color = { 0.8, 0.8, 0.8 };
+    const float* row = img.getPixelAddress(level, x, y);
+    const int rowSize = img.getBounds(level).x2 - img.getBounds(level).x1;
+    const float* tRow = &t.front();
+    double dot = 0.;
+    double sum = 0.;
+    double sum2 = 0.;
+
+    assert( row && img.getPixelAddress(level, x + w - 1, y + h - 1) );
+    for (int j = 0; j < h; ++j, row += rowSize, tRow += w) {
+        float rowDot = 0.f;
+        float rowSum = 0.f;
+        float rowSum2 = 0.f;
+        for (int i = 0; i < w; ++i) {
+            rowDot += tRow[i] * row[i];
+            rowSum += row[i];
+            rowSum2 += row[i] * row[i];
+        }
+        dot += rowDot;
+        sum += rowSum;
+        sum2 += rowSum2;
+    }
+    const double var = sum2 - sum * sum / (w * h);
+    if (var <= 1e-10 * w * h) {
+        return 0.;
+    }
 
-    getSuggestedColour(color);
-    const OfxPointD& pscale = args.pixelScale;
-    GLdouble projection[16];
-    glGetDoublev( GL_PROJECTION_MATRIX, projection);
-    GLint viewport[4];
-    glGetIntegerv(GL_VIEWPORT, viewport);
-    OfxPointD shadow; // how much to translate GL_PROJECTION to get exactly one pixel on screen
-    shadow.x = 2. / (projection[0] * viewport[2]);
-    shadow.y = 2. / (projection[5] * viewport[3]);
+    return (std::max)( -1., (std::min)( 1., dot / std::sqrt(var) ) );
+}
 
-    double xi1, xi2, yi1, yi2, xo1, xo2, yo1, yo2, xc, yc, xoff, yoff;
+// find the best NCC for the template t over the positions (x,y) of rect, for which the window is within searchWindow
+static bool
+findTrackerNCCMax(const std::vector<float> & t,
+                  int w,
+                  int h,
+                  const TrackerPyramid & img,
+                  int level,
+                  const OfxRectI & searchWindow,
+                  const OfxRectI & rect,
+                  OfxPointI* best,
+                  double* bestScore)
+{
+    const int x1 = (std::max)(rect.x1, searchWindow.x1);
+    const int x2 = (std::min)(rect.x2, searchWindow.x2 - w + 1);
+    const int y1 = (std::max)(rect.y1, searchWindow.y1);
+    const int y2 = (std::min)(rect.y2, searchWindow.y2 - h + 1);
+    bool found = false;
+
+    for (int y = y1; y < y2; ++y) {
+        for (int x = x1; x < x2; ++x) {
+            const double score = getTrackerNCC(t, w, h, img, level, x, y);
+            if ( !found || (score > *bestScore) ) {
+                found = true;
+                *bestScore = score;
+                best->x = x;
+                best->y = y;
+            }
+        }
+    }
 
-    if (_ms != eMouseStateIdle) {
-        xi1 = _innerBtmLeftDragPos.x;
-        yi1 = _innerBtmLeftDragPos.y;
-        xi2 = _innerTopRightDragPos.x;
-        yi2 = _innerTopRightDragPos.y;
-        xo1 = _outerBtmLeftDragPos.x;
-        yo1 = _outerBtmLeftDragPos.y;
-        xo2 = _outerTopRightDragPos.x;
-        yo2 = _outerTopRightDragPos.y;
-        xc = _centerDragPos.x;
-        yc = _centerDragPos.y;
-        xoff = _offsetDragPos.x;
-        yoff = _offsetDragPos.y;
-    } else {
-        _innerBtmLeft->getValueAtTime( args.time, xi1, yi1);
-        _innerTopRight->getValueAtTime(args.time, xi2, yi2);
-        _outerBtmLeft->getValueAtTime( args.time, xo1, yo1);
-        _outerTopRight->getValueAtTime(args.time, xo2, yo2);
-        _center->getValueAtTime(args.time, xc, yc);
-        _offset->getValueAtTime(args.time, xoff, yoff);
-        ///innerBtmLeft and outerBtmLeft are relative to the center, make them absolute
-        xi1 += (xc + xoff);
-        yi1 += (yc + yoff);
-        xi2 += (xc + xoff);
-        yi2 += (yc + yoff);
-        xo1 += (xc + xoff);
-        yo1 += (yc + yoff);
-        xo2 += (xc + xoff);
-        yo2 += (yc + yoff);
+    return found;
+}
+
+// NCC at the sub-pixel displacement d of the pattern at level 0, using bilinear interpolation
+static double
+getTrackerNCCBilinear(const std::vector<float> & t,
+                      const OfxRectI & pattern,
+                      const TrackerPyramid & img,
+                      const OfxPointD & d,
+                      std::vector<float>* warped)
+{
+    const int w = pattern.x2 - pattern.x1;
+    const int h = pattern.y2 - pattern.y1;
+    double sum = 0.;
+    double sum2 = 0.;
+    double dot = 0.;
+
+    warped->resize(w * h);
+    for (int y = 0; y < h; ++y) {
+        for (int x = 0; x < w; ++x) {
+            const float v = img.getPixelBilinear(0, pattern.x1 + x + d.x, pattern.y1 + y + d.y);
+            (*warped)[y * w + x] = v;
+            sum += v;
+            sum2 += v * v;
+            dot += t[y * w + x] * v;
+        }
+    }
+    const double var = sum2 - sum * sum / (w * h);
+    if (var <= 1e-10 * w * h) {
+        return 0.;
     }
 
-    bool hiDPI = _hiDPI ? _hiDPI->getValue() : false;
-    double screenPixelRatio = hiDPI ? 2 : 1;
-#ifdef OFX_EXTENSIONS_NATRON
-    screenPixelRatio *= args.screenPixelRatio;
-    hiDPI |= args.screenPixelRatio > 1;
-#endif
-    TextRenderer::Font font = hiDPI ? TextRenderer::FONT_TIMES_ROMAN_24 : TextRenderer::FONT_HELVETICA_12;
+    return (std::max)( -1., (std::min)( 1., dot / std::sqrt(var) ) );
+}
 
-    //glPushAttrib(GL_ALL_ATTRIB_BITS); // caller is responsible for protecting attribs
+// offset of the maximum of the parabola through (-1,sm), (0,s0), (1,sp), within [-0.5,0.5]
+static double
+getTrackerParabolaMax(double sm,
+                      double s0,
+                      double sp)
+{
+    const double denom = sm - 2 * s0 + sp;
 
-    glDisable(GL_LINE_STIPPLE);
-    glEnable(GL_LINE_SMOOTH);
-    glDisable(GL_POINT_SMOOTH);
-    glEnable(GL_BLEND);
-    glHint(GL_LINE_SMOOTH_HINT, GL_DONT_CARE);
-    glLineWidth(1.5f * screenPixelRatio);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    if (denom >= 0.) {
+        return 0.;
+    }
 
-    // Draw everything twice
-    // l = 0: shadow
-    // l = 1: drawing
-    for (int l = 0; l < 2; ++l) {
-        // shadow (uses GL_PROJECTION)
-        glMatrixMode(GL_PROJECTION);
-        int direction = (l == 0) ? 1 : -1;
-        // translate (1,-1) pixels
-        glTranslated(direction * shadow.x, -direction * shadow.y, 0);
-        glMatrixMode(GL_MODELVIEW); // Modelview should be used on Nuke
+    return (std::max)( -0.5, (std::min)( 0.5, (sm - sp) / (2 * denom) ) );
+}
 
-        glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
-        glBegin(GL_LINE_LOOP);
-        glVertex2d(xi1, yi1);
-        glVertex2d(xi1, yi2);
-        glVertex2d(xi2, yi2);
-        glVertex2d(xi2, yi1);
-        glEnd();
-
-        glBegin(GL_LINE_LOOP);
-        glVertex2d(xo1, yo1);
-        glVertex2d(xo1, yo2);
-        glVertex2d(xo2, yo2);
-        glVertex2d(xo2, yo1);
-        glEnd();
-
-        glPointSize(POINT_SIZE * screenPixelRatio);
-        glBegin(GL_POINTS);
-
-        ///draw center
-        if ( (_ds == eDrawStateHoveringCenter) || (_ms == eMouseStateDraggingCenter) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
+bool
+trackerMatchPattern(const TrackerPyramid & ref,
+                    const OfxRectI & patternWindow,
+                    const TrackerPyramid & img,
+                    const OfxRectI & searchWindow,
+                    OfxPointD* delta,
+                    double* score)
+{
+    const int nLevels = (std::min)( ref.getLevelsCount(), img.getLevelsCount() );
+    OfxRectI search;
+
+    if ( (nLevels == 0) || !Coords::rectIntersection(searchWindow, img.getBounds(0), &search) || Coords::rectIsEmpty(search) ) {
+        return false;
+    }
+
+    // the coarsest level where the pattern is large enough and fits in the search window
+    int top = nLevels - 1;
+    for (; top >= 0; --top) {
+        const OfxRectI p = downscalePowerOfTwoLargestEnclosed(patternWindow, top);
+        const OfxRectI s = downscalePowerOfTwoLargestEnclosed(search, top);
+        const int w = p.x2 - p.x1;
+        const int h = p.y2 - p.y1;
+        if ( (top == 0 || (w >= kTrackerMinPatternSize && h >= kTrackerMinPatternSize) ) &&
+             w > 0 && h > 0 && w <= s.x2 - s.x1 && h <= s.y2 - s.y1 ) {
+            break;
+        }
+    }
+    if (top < 0) {
+        return false;
+    }
+
+    // coarse-to-fine search of the integer displacement
+    std::vector<float> t;
+    OfxPointI d = {0, 0};
+    double bestScore = -1.;
+    for (int level = top; level >= 0; --level) {
+        const OfxRectI p = downscalePowerOfTwoLargestEnclosed(patternWindow, level);
+        const OfxRectI s = downscalePowerOfTwoLargestEnclosed(search, level);
+        const int w = p.x2 - p.x1;
+        const int h = p.y2 - p.y1;
+        if ( !getTrackerTemplate(ref, level, p, &t) ) {
+            return false;
+        }
+        OfxRectI rect;
+        if (level == top) {
+            // exhaustive search
+            rect = s;
         } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+            rect.x1 = p.x1 + 2 * d.x - kTrackerRefineRadius;
+            rect.y1 = p.y1 + 2 * d.y - kTrackerRefineRadius;
+            rect.x2 = p.x1 + 2 * d.x + kTrackerRefineRadius + 1;
+            rect.y2 = p.y1 + 2 * d.y + kTrackerRefineRadius + 1;
         }
-        glVertex2d(xc, yc);
+        OfxPointI best;
+        if ( !findTrackerNCCMax(t, w, h, img, level, s, rect, &best, &bestScore) ) {
+            return false;
+        }
+        d.x = best.x - p.x1;
+        d.y = best.y - p.y1;
+    }
 
-        if ( (xoff != 0) || (yoff != 0) ) {
-            glVertex2d(xc + xoff, yc + yoff);
+    // sub-pixel refinement at level 0: parabola fit of the NCC scores around the maximum
+    const OfxRectI & p = patternWindow;
+    const int w = p.x2 - p.x1;
+    const int h = p.y2 - p.y1;
+    OfxPointD dSub = { (double)d.x, (double)d.y };
+    {
+        const int x = p.x1 + d.x;
+        const int y = p.y1 + d.y;
+        if ( (x > search.x1) && (x + w < search.x2) ) {
+            dSub.x += getTrackerParabolaMax(getTrackerNCC(t, w, h, img, 0, x - 1, y), bestScore,
+                                            getTrackerNCC(t, w, h, img, 0, x + 1, y));
+        }
+        if ( (y > search.y1) && (y + h < search.y2) ) {
+            dSub.y += getTrackerParabolaMax(getTrackerNCC(t, w, h, img, 0, x, y - 1), bestScore,
+                                            getTrackerNCC(t, w, h, img, 0, x, y + 1));
         }
+    }
+    std::vector<float> warped;
+    double subScore = getTrackerNCCBilinear(t, p, img, dSub, &warped);
+    if (subScore < bestScore) {
+        dSub.x = d.x;
+        dSub.y = d.y;
+        subScore = bestScore;
+    }
 
-        //////DRAWING INNER POINTS
-        if ( (_ds == eDrawStateHoveringInnerBtmLeft) || (_ms == eMouseStateDraggingInnerBtmLeft) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xi1, yi1);
+    // Lucas-Kanade refinement (inverse compositional, translation only), on the normalized pattern
+    // so that it is invariant to gain and bias. t has zero mean and unit norm.
+    std::vector<float> gx(w * h);
+    std::vector<float> gy(w * h);
+    double hxx = 0., hxy = 0., hyy = 0.;
+    {
+        // gradient of the unnormalized pattern, scaled like t
+        double sum = 0.;
+        double sum2 = 0.;
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                const float v = ref.getPixelBilinear(0, p.x1 + x, p.y1 + y);
+                sum += v;
+                sum2 += v * v;
+            }
         }
-        if ( (_ds == eDrawStateHoveringInnerBtmMid) || (_ms == eMouseStateDraggingInnerBtmMid) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xc + xoff, yi1);
+        const double var = sum2 - sum * sum / (w * h);
+        const float s = var > 0. ? (float)( 1. / std::sqrt(var) ) : 0.f;
+        for (int y = 0; y < h; ++y) {
+            for (int x = 0; x < w; ++x) {
+                const int i = y * w + x;
+                gx[i] = s * 0.5f * ( ref.getPixelBilinear(0, p.x1 + x + 1, p.y1 + y) - ref.getPixelBilinear(0, p.x1 + x - 1, p.y1 + y) );
+                gy[i] = s * 0.5f * ( ref.getPixelBilinear(0, p.x1 + x, p.y1 + y + 1) - ref.getPixelBilinear(0, p.x1 + x, p.y1 + y - 1) );
+                hxx += gx[i] * gx[i];
+                hxy += gx[i] * gy[i];
+                hyy += gy[i] * gy[i];
+            }
         }
-        if ( (_ds == eDrawStateHoveringInnerBtmRight) || (_ms == eMouseStateDraggingInnerBtmRight) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xi2, yi1);
+    }
+    const double det = hxx * hyy - hxy * hxy;
+    if (det > 1e-12) {
+        OfxPointD dLK = dSub;
+        bool converged = false;
+        for (int k = 0; k < kTrackerLKIterations; ++k) {
+            getTrackerNCCBilinear(t, p, img, dLK, &warped);
+            double sum = 0.;
+            double sum2 = 0.;
+            for (int i = 0; i < w * h; ++i) {
+                sum += warped[i];
+                sum2 += warped[i] * warped[i];
+            }
+            const double mean = sum / (w * h);
+            const double var = sum2 - sum * sum / (w * h);
+            if (var <= 0.) {
+                break;
+            }
+            const double s = 1. / std::sqrt(var);
+            double bx = 0.;
+            double by = 0.;
+            for (int i = 0; i < w * h; ++i) {
+                const double e = (warped[i] - mean) * s - t[i];
+                bx += gx[i] * e;
+                by += gy[i] * e;
+            }
+            const double ddx = ( hyy * bx - hxy * by) / det;
+            const double ddy = (-hxy * bx + hxx * by) / det;
+            dLK.x -= ddx;
+            dLK.y -= ddy;
+            if ( (std::fabs(dLK.x - d.x) > 1.5) || (std::fabs(dLK.y - d.y) > 1.5) ) {
+                // diverged
+                break;
+            }
+            if ( (std::fabs(ddx) < 1e-3) && (std::fabs(ddy) < 1e-3) ) {
+                converged = true;
+                break;
+            }
         }
-        if ( (_ds == eDrawStateHoveringInnerMidLeft) || (_ms == eMouseStateDraggingInnerMidLeft) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xi1, yc + yoff);
+        if (converged) {
+            const double lkScore = getTrackerNCCBilinear(t, p, img, dLK, &warped);
+            if (lkScore >= subScore) {
+                dSub = dLK;
+                subScore = lkScore;
+            }
         }
-        if ( (_ds == eDrawStateHoveringInnerMidRight) || (_ms == eMouseStateDraggingInnerMidRight) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xi2, yc + yoff);
+    }
+
+    *delta = dSub;
+    *score = subScore;
+
+    return true;
+} // trackerMatchPattern
+
+namespace {
+// the pixel windows of a track, computed by trackerTrackPoints()
+struct TrackerTrackWindows
+{
+    bool valid;
+    OfxRectI patternWindow;
+    OfxRectI refWindow;
+    OfxRectI searchWindow;
+    const Image* refImg;
+};
+
+// the images fetched by trackerTrackPoints(), deleted at destruction unless they belong to a prefetcher
+struct TrackerImages
+{
+    std::map<OfxTime, const Image*> refImgs;
+    const Image* img;
+    TrackerFramePrefetcher* prefetcher;
+
+    TrackerImages(TrackerFramePrefetcher* prefetcher_)
+        : refImgs()
+        , img(NULL)
+        , prefetcher(prefetcher_)
+    {
+    }
+
+    ~TrackerImages()
+    {
+        if (prefetcher) {
+            return;
         }
-        if ( (_ds == eDrawStateHoveringInnerTopLeft) || (_ms == eMouseStateDraggingInnerTopLeft) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xi1, yi2);
+        for (std::map<OfxTime, const Image*>::iterator it = refImgs.begin(); it != refImgs.end(); ++it) {
+            delete it->second;
         }
+        delete img;
+    }
 
-        if ( (_ds == eDrawStateHoveringInnerTopMid) || (_ms == eMouseStateDraggingInnerTopMid) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xc + xoff, yi2);
+    const Image* fetchImage(Clip* srcClip,
+                            OfxTime time,
+                            const OfxRectD & rect)
+    {
+        return prefetcher ? prefetcher->fetchImage(time, rect) : srcClip->fetchImage(time, rect);
+    }
+};
+
+class TrackerTrackProcessor
+    : public MultiThread::Processor
+{
+public:
+    TrackerTrackProcessor(std::vector<TrackerTrack> & tracks,
+                          const std::vector<TrackerTrackWindows> & windows,
+                          const Image & img,
+                          const OfxPointD & renderScale,
+                          double par)
+        : _tracks(tracks)
+        , _windows(windows)
+        , _img(img)
+        , _renderScale(renderScale)
+        , _par(par)
+    {
+    }
+
+    // the tracks are interleaved between the threads
+    virtual void multiThreadFunction(unsigned int threadId,
+                                     unsigned int nThreads) OVERRIDE FINAL
+    {
+        for (std::size_t i = threadId; i < _tracks.size(); i += nThreads) {
+            track(i);
         }
+    }
+
+private:
+    void track(std::size_t i)
+    {
+        const TrackerTrackWindows & w = _windows[i];
+        TrackerTrack & t = _tracks[i];
 
-        if ( (_ds == eDrawStateHoveringInnerTopRight) || (_ms == eMouseStateDraggingInnerTopRight) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xi2, yi2);
+        if (!w.valid || !w.refImg) {
+            return;
         }
+        const int nLevels = trackerGetPyramidLevels(w.patternWindow, w.searchWindow);
+        TrackerPyramid refPyramid;
+        TrackerPyramid pyramid;
+        refPyramid.build(*w.refImg, w.refWindow, nLevels);
+        pyramid.build(_img, w.searchWindow, nLevels);
+        OfxPointD delta;
+        double score;
+        if ( !trackerMatchPattern(refPyramid, w.patternWindow, pyramid, w.searchWindow, &delta, &score) ) {
+            return;
+        }
+        // the pattern moved by delta between refTime and the time tracked to
+        t.found = true;
+        t.newCenter.x = t.refCenter.x + delta.x * _par / _renderScale.x;
+        t.newCenter.y = t.refCenter.y + delta.y / _renderScale.y;
+        t.score = score;
+    }
 
+    std::vector<TrackerTrack> & _tracks;
+    const std::vector<TrackerTrackWindows> & _windows;
+    const Image & _img;
+    OfxPointD _renderScale;
+    double _par;
+};
 
-        //////DRAWING OUTTER POINTS
+bool
+isTrackerImageDepthSupported(const Image & img)
+{
+    const BitDepthEnum depth = img.getPixelDepth();
 
-        if ( (_ds == eDrawStateHoveringOuterBtmLeft) || (_ms == eMouseStateDraggingOuterBtmLeft) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xo1, yo1);
+    return depth == eBitDepthUByte || depth == eBitDepthUShort || depth == eBitDepthFloat;
+}
+} // anonymous namespace
+
+struct TrackerFramePrefetcherPrivate
+{
+    struct Frame
+    {
+        const Image* img;
+        OfxRectD region;     // the region that was requested
+        std::size_t memSize;
+    };
+
+    typedef std::map<OfxTime, Frame> FrameMap;
+
+    Clip* srcClip;
+    OfxTime step;
+    OfxTime end;     // the last frame to fetch
+    int nFrames;
+    std::size_t memoryBudget;
+    tthread::mutex mutex;     // protects all the members below
+    tthread::condition_variable cond;     // notified when any of the members below changes
+    tthread::thread* thread;
+    bool started;
+    bool cancelled;
+    OfxTime currentTime;
+    OfxRectD region;
+    FrameMap frames;
+    std::vector<const Image*> retired;     // replaced images, which may still be used until the next frame
+    std::size_t memSize;     // the memory used by frames
+    std::size_t lastFrameMemSize;     // estimate of the memory used by the next frame
+    bool fetching;
+    OfxTime fetchingTime;
+
+    TrackerFramePrefetcherPrivate(Clip* srcClip_,
+                                  const TrackArguments & args,
+                                  int nFrames_,
+                                  std::size_t memoryBudget_)
+        : srcClip(srcClip_)
+        , step(args.forward ? 1 : -1)
+        , end(args.last + (args.forward ? 1 : -1))
+        , nFrames(nFrames_)
+        , memoryBudget(memoryBudget_)
+        , mutex()
+        , cond()
+        , thread(NULL)
+        , started(false)
+        , cancelled(false)
+        , currentTime(args.first)
+        , region()
+        , frames()
+        , retired()
+        , memSize(0)
+        , lastFrameMemSize(0)
+        , fetching(false)
+        , fetchingTime(0)
+    {
+        region.x1 = region.y1 = region.x2 = region.y2 = 0.;
+    }
+
+    static std::size_t getMemSize(const Image* img)
+    {
+        if (!img) {
+            return 0;
         }
-        if ( (_ds == eDrawStateHoveringOuterBtmMid) || (_ms == eMouseStateDraggingOuterBtmMid) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xc + xoff, yo1);
+        const OfxRectI & bounds = img->getBounds();
+        const BitDepthEnum depth = img->getPixelDepth();
+        const int bytes = (depth == eBitDepthUByte) ? 1 : ( (depth == eBitDepthFloat) ? 4 : 2 );
+
+        return (std::size_t)(bounds.x2 - bounds.x1) * (bounds.y2 - bounds.y1) * img->getPixelComponentCount() * bytes;
+    }
+
+    static bool contains(const OfxRectD & a,
+                         const OfxRectD & b)
+    {
+        return a.x1 <= b.x1 && b.x2 <= a.x2 && a.y1 <= b.y1 && b.y2 <= a.y2;
+    }
+
+    // the next frame to prefetch, if any (mutex must be locked)
+    bool getNextFrame(OfxTime* time)
+    {
+        for (int i = 1; i <= nFrames; ++i) {
+            const OfxTime t = currentTime + i * step;
+            if ( (step > 0) ? (t > end) : (t < end) ) {
+                return false;
+            }
+            FrameMap::const_iterator it = frames.find(t);
+            if ( it == frames.end() ) {
+                // always prefetch at least one frame, even if it does not fit in the budget
+                if ( !frames.empty() && (memSize + lastFrameMemSize > memoryBudget) ) {
+                    return false;
+                }
+                *time = t;
+
+                return true;
+            }
         }
-        if ( (_ds == eDrawStateHoveringOuterBtmRight) || (_ms == eMouseStateDraggingOuterBtmRight) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xo2, yo1);
+
+        return false;
+    }
+
+    // store an image (mutex must be locked)
+    void store(OfxTime time,
+               const Image* img,
+               const OfxRectD & rect)
+    {
+        FrameMap::iterator it = frames.find(time);
+        if ( it != frames.end() ) {
+            retired.push_back(it->second.img);
+            memSize -= it->second.memSize;
         }
-        if ( (_ds == eDrawStateHoveringOuterMidLeft) || (_ms == eMouseStateDraggingOuterMidLeft) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xo1, yc + yoff);
+        Frame & frame = frames[time];
+        frame.img = img;
+        frame.region = rect;
+        frame.memSize = getMemSize(img);
+        memSize += frame.memSize;
+        lastFrameMemSize = frame.memSize;
+    }
+
+    void run()
+    {
+        for (;;) {
+            OfxTime time = 0;
+            OfxRectD rect;
+            {
+                tthread::lock_guard<tthread::mutex> lock(mutex);
+                while ( !cancelled && !getNextFrame(&time) ) {
+                    cond.wait(lock);
+                }
+                if (cancelled) {
+                    return;
+                }
+                rect = region;
+                fetching = true;
+                fetchingTime = time;
+            }
+            const Image* img = NULL;
+            try {
+                img = srcClip->fetchImage(time, rect);
+            } catch (...) {
+                img = NULL;
+            }
+            {
+                tthread::lock_guard<tthread::mutex> lock(mutex);
+                fetching = false;
+                // NULL images are stored too, so that they are not fetched again
+                store(time, img, rect);
+                cond.notify_all();
+            }
         }
-        if ( (_ds == eDrawStateHoveringOuterMidRight) || (_ms == eMouseStateDraggingOuterMidRight) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xo2, yc + yoff);
+    }
+
+    static void runThread(void* arg)
+    {
+        static_cast<TrackerFramePrefetcherPrivate*>(arg)->run();
+    }
+};
+
+TrackerFramePrefetcher::TrackerFramePrefetcher(Clip* srcClip,
+                                               const TrackArguments & args,
+                                               int nFrames,
+                                               std::size_t memoryBudget)
+    : _imp( new TrackerFramePrefetcherPrivate(srcClip, args, nFrames, memoryBudget) )
+{
+}
+
+TrackerFramePrefetcher::~TrackerFramePrefetcher()
+{
+    cancel();
+    if (_imp->thread) {
+        _imp->thread->join();
+        delete _imp->thread;
+    }
+    for (TrackerFramePrefetcherPrivate::FrameMap::iterator it = _imp->frames.begin(); it != _imp->frames.end(); ++it) {
+        delete it->second.img;
+    }
+    for (std::size_t i = 0; i < _imp->retired.size(); ++i) {
+        delete _imp->retired[i];
+    }
+}
+
+void
+TrackerFramePrefetcher::setCurrentFrame(OfxTime time,
+                                        const OfxRectD & region)
+{
+    tthread::lock_guard<tthread::mutex> lock(_imp->mutex);
+
+    _imp->currentTime = time;
+    _imp->region = region;
+    // release the frames behind the current frame, and the replaced images
+    TrackerFramePrefetcherPrivate::FrameMap::iterator it = _imp->frames.begin();
+    while ( it != _imp->frames.end() ) {
+        if ( (_imp->step > 0) ? (it->first < time) : (it->first > time) ) {
+            delete it->second.img;
+            _imp->memSize -= it->second.memSize;
+            _imp->frames.erase(it++);
+        } else {
+            ++it;
         }
+    }
+    for (std::size_t i = 0; i < _imp->retired.size(); ++i) {
+        delete _imp->retired[i];
+    }
+    _imp->retired.clear();
+    if (!_imp->started && !_imp->cancelled) {
+        _imp->started = true;
+        _imp->thread = new tthread::thread(&TrackerFramePrefetcherPrivate::runThread, _imp.get());
+    }
+    _imp->cond.notify_all();
+}
 
-        if ( (_ds == eDrawStateHoveringOuterTopLeft) || (_ms == eMouseStateDraggingOuterTopLeft) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xo1, yo2);
+const Image*
+TrackerFramePrefetcher::fetchImage(OfxTime time,
+                                   const OfxRectD & rect)
+{
+    {
+        tthread::lock_guard<tthread::mutex> lock(_imp->mutex);
+        for (;;) {
+            TrackerFramePrefetcherPrivate::FrameMap::const_iterator it = _imp->frames.find(time);
+            if ( ( it != _imp->frames.end() ) && it->second.img && TrackerFramePrefetcherPrivate::contains(it->second.region, rect) ) {
+                return it->second.img;
+            }
+            if ( !_imp->fetching || (_imp->fetchingTime != time) ) {
+                break;
+            }
+            // the background thread is fetching this frame
+            _imp->cond.wait(lock);
         }
-        if ( (_ds == eDrawStateHoveringOuterTopMid) || (_ms == eMouseStateDraggingOuterTopMid) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xc + xoff, yo2);
+    }
+    // not prefetched: fetch it now
+    const Image* img = _imp->srcClip->fetchImage(time, rect);
+    {
+        tthread::lock_guard<tthread::mutex> lock(_imp->mutex);
+        _imp->store(time, img, rect);
+        _imp->cond.notify_all();
+    }
+
+    return img;
+}
+
+void
+TrackerFramePrefetcher::cancel()
+{
+    tthread::lock_guard<tthread::mutex> lock(_imp->mutex);
+
+    _imp->cancelled = true;
+    _imp->cond.notify_all();
+}
+
+void
+trackerTrackPoints(Clip* srcClip,
+                   OfxTime otherTime,
+                   const OfxPointD & renderScale,
+                   std::vector<TrackerTrack>* tracks,
+                   TrackerFramePrefetcher* prefetcher)
+{
+    assert(srcClip && tracks);
+    const double par = srcClip->getPixelAspectRatio();
+    const std::size_t n = tracks->size();
+    std::vector<TrackerTrackWindows> windows(n);
+    // the union of the windows to fetch from each image
+    std::map<OfxTime, OfxRectI> refUnions;
+    OfxRectI searchUnion = {0, 0, 0, 0};
+
+    for (std::size_t i = 0; i < n; ++i) {
+        TrackerTrack & track = (*tracks)[i];
+        TrackerTrackWindows & w = windows[i];
+        track.found = false;
+        track.newCenter = track.center;
+        track.score = 0.;
+
+        OfxRectD patternCanonical;
+        patternCanonical.x1 = track.refCenter.x + track.refOffset.x + track.patternBtmLeft.x;
+        patternCanonical.y1 = track.refCenter.y + track.refOffset.y + track.patternBtmLeft.y;
+        patternCanonical.x2 = track.refCenter.x + track.refOffset.x + track.patternTopRight.x;
+        patternCanonical.y2 = track.refCenter.y + track.refOffset.y + track.patternTopRight.y;
+        Coords::toPixelNearest(patternCanonical, renderScale, par, &w.patternWindow);
+        // the reference pyramid has a one-pixel margin for the image gradients
+        w.refWindow = w.patternWindow;
+        w.refWindow.x1 -= 1;
+        w.refWindow.y1 -= 1;
+        w.refWindow.x2 += 1;
+        w.refWindow.y2 += 1;
+
+        // the search area, around the position at the time tracked from
+        OfxRectD searchCanonical;
+        searchCanonical.x1 = track.center.x + track.offset.x + track.searchBtmLeft.x;
+        searchCanonical.y1 = track.center.y + track.offset.y + track.searchBtmLeft.y;
+        searchCanonical.x2 = track.center.x + track.offset.x + track.searchTopRight.x;
+        searchCanonical.y2 = track.center.y + track.offset.y + track.searchTopRight.y;
+        Coords::toPixelEnclosing(searchCanonical, renderScale, par, &w.searchWindow);
+
+        w.refImg = NULL;
+        w.valid = !Coords::rectIsEmpty(w.patternWindow) && !Coords::rectIsEmpty(w.searchWindow);
+        if (!w.valid) {
+            continue;
         }
-        if ( (_ds == eDrawStateHoveringOuterTopRight) || (_ms == eMouseStateDraggingOuterTopRight) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-            glVertex2d(xo2, yo2);
+        std::map<OfxTime, OfxRectI>::iterator it = refUnions.find(track.refTime);
+        if ( it == refUnions.end() ) {
+            refUnions[track.refTime] = w.refWindow;
+        } else {
+            Coords::rectBoundingBox(it->second, w.refWindow, &it->second);
         }
+        Coords::rectBoundingBox(searchUnion, w.searchWindow, &searchUnion);
+    }
+    if ( Coords::rectIsEmpty(searchUnion) ) {
+        return;
+    }
 
-        glEnd();
+    // fetch each image once
+    TrackerImages images(prefetcher);
+    OfxRectD rect;
+    Coords::toCanonical(searchUnion, renderScale, par, &rect);
+    images.img = images.fetchImage(srcClip, otherTime, rect);
+    if (!images.img) {
+        return;
+    }
+    if ( !isTrackerImageDepthSupported(*images.img) ) {
+        throwSuiteStatusException(kOfxStatErrFormat);
 
-        if ( (xoff != 0) || (yoff != 0) ) {
-            glBegin(GL_LINES);
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
-            glVertex2d(xc, yc);
-            glVertex2d(xc + xoff, yc + yoff);
-            glEnd();
+        return;
+    }
+    for (std::map<OfxTime, OfxRectI>::const_iterator it = refUnions.begin(); it != refUnions.end(); ++it) {
+        Coords::toCanonical(it->second, renderScale, par, &rect);
+        const Image* refImg = images.fetchImage(srcClip, it->first, rect);
+        if (!refImg) {
+            continue;
         }
+        images.refImgs[it->first] = refImg;
+        if ( !isTrackerImageDepthSupported(*refImg) ) {
+            throwSuiteStatusException(kOfxStatErrFormat);
 
-        double handleSizeX = HANDLE_SIZE * pscale.x;
-        double handleSizeY = HANDLE_SIZE * pscale.y;
+            return;
+        }
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        if (windows[i].valid) {
+            std::map<OfxTime, const Image*>::const_iterator it = images.refImgs.find( (*tracks)[i].refTime );
+            windows[i].refImg = ( it == images.refImgs.end() ) ? NULL : it->second;
+        }
+    }
 
-        ///now show small lines at handle positions
-        glBegin(GL_LINES);
+    // match the tracks in parallel
+    TrackerTrackProcessor processor(*tracks, windows, *images.img, renderScale, par);
+    processor.multiThread( (unsigned int)(std::min)( n, (std::size_t)MultiThread::getNumCPUs() ) );
+} // trackerTrackPoints
 
-        if ( (_ds == eDrawStateHoveringInnerMidLeft) || (_ms == eMouseStateDraggingInnerMidLeft) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-        } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+//////////////////// INTERACT ////////////////////
+
+static bool
+isNearby(const OfxPointD & p,
+         double x,
+         double y,
+         double tolerance,
+         const OfxPointD & pscale)
+{
+    return std::fabs(p.x - x) <= tolerance * pscale.x &&  std::fabs(p.y - y) <= tolerance * pscale.y;
+}
+
+TrackerRegionOverlay::TrackerRegionOverlay()
+    : _tracks()
+    , _regions()
+    , _labelPositions()
+    , _labels()
+    , _handles()
+    , _handleCells()
+    , _hitIndexValid(false)
+    , _hitIndexTime(0.)
+    , _hitIndexPScale()
+    , _hitTolerance()
+{
+    _hitIndexPScale.x = _hitIndexPScale.y = 0.;
+    _hitTolerance.x = _hitTolerance.y = 0.;
+}
+
+void
+TrackerRegionOverlay::setTracks(const std::vector<Track> & tracks)
+{
+    for (std::vector<Track>::const_iterator it = tracks.begin(); it != tracks.end(); ++it) {
+        assert(it->params.center && it->params.patternBtmLeft && it->params.patternTopRight && it->params.searchBtmLeft && it->params.searchTopRight);
+    }
+    _tracks = tracks;
+    _regions.clear();
+    _hitIndexValid = false;
+}
+
+void
+TrackerRegionOverlay::moveTrackToFront(int track)
+{
+    assert( track >= 0 && track < (int)_tracks.size() );
+    std::swap(_tracks[0], _tracks[track]);
+    if ( track < (int)_regions.size() ) {
+        std::swap(_regions[0], _regions[track]);
+    }
+    _hitIndexValid = false;
+}
+
+std::vector<TrackerRegionOverlay::Region> &
+TrackerRegionOverlay::readRegions(double time)
+{
+    _regions.resize( _tracks.size() );
+    for (std::size_t i = 0; i < _tracks.size(); ++i) {
+        const TrackerTrackParams & params = _tracks[i].params;
+        Region & region = _regions[i];
+        params.center->getValueAtTime(time, region.center.x, region.center.y);
+        region.offset.x = region.offset.y = 0.;
+        if (params.offset) {
+            params.offset->getValueAtTime(time, region.offset.x, region.offset.y);
         }
-        glVertex2d(xi1, yc + yoff);
-        glVertex2d(xi1 - handleSizeX, yc + yoff);
+        params.patternBtmLeft->getValueAtTime( time, region.inner.x1, region.inner.y1);
+        params.patternTopRight->getValueAtTime(time, region.inner.x2, region.inner.y2);
+        params.searchBtmLeft->getValueAtTime( time, region.outer.x1, region.outer.y1);
+        params.searchTopRight->getValueAtTime(time, region.outer.x2, region.outer.y2);
+        ///the boxes are relative to the center, make them absolute
+        double xo = region.center.x + region.offset.x;
+        double yo = region.center.y + region.offset.y;
+        region.inner.x1 += xo;
+        region.inner.y1 += yo;
+        region.inner.x2 += xo;
+        region.inner.y2 += yo;
+        region.outer.x1 += xo;
+        region.outer.y1 += yo;
+        region.outer.x2 += xo;
+        region.outer.y2 += yo;
+        region.name.clear();
+        if (_tracks[i].name) {
+            _tracks[i].name->getValue(region.name);
+        }
+        region.highlighted = 0;
+    }
 
-        if ( (_ds == eDrawStateHoveringInnerTopMid) || (_ms == eMouseStateDraggingInnerTopMid) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-        } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+    return _regions;
+}
+
+namespace {
+// sets the normal color, or the highlight color if element is highlighted
+inline void
+setColor(OverlayBatch* batch,
+         const OfxRGBColourD & color,
+         bool highlighted)
+{
+    if (highlighted) {
+        batch->setColor(0.f, 1.f, 0.f);
+    } else {
+        batch->setColor( (float)color.r, (float)color.g, (float)color.b );
+    }
+}
+
+inline void
+addBox(OverlayBatch* batch,
+       const OfxRectD & r)
+{
+    const double xy[8] = { r.x1, r.y1, r.x1, r.y2, r.x2, r.y2, r.x2, r.y1 };
+
+    batch->addLineStrip(xy, 4, true);
+}
+}
+
+void
+TrackerRegionOverlay::buildBatch(OverlayBatch* batch,
+                                 const OfxPointD & pscale,
+                                 const OfxRGBColourD & color,
+                                 double screenPixelRatio)
+{
+    double handleSizeX = HANDLE_SIZE * pscale.x;
+    double handleSizeY = HANDLE_SIZE * pscale.y;
+
+    batch->setLineWidth(1.5f * screenPixelRatio);
+    batch->setPointSize(POINT_SIZE * screenPixelRatio);
+    _labelPositions.clear();
+    _labels.clear();
+#define HIGHLIGHTED(e) ( ( r.highlighted & (1u << (e)) ) != 0 )
+    // all the lines first, then all the points, so that they are drawn with two draw calls
+    for (std::vector<Region>::const_iterator it = _regions.begin(); it != _regions.end(); ++it) {
+        const Region & r = *it;
+        const OfxRectD & i = r.inner;
+        const OfxRectD & o = r.outer;
+        double xc = r.center.x + r.offset.x;
+        double yc = r.center.y + r.offset.y;
+
+        setColor(batch, color, false);
+        addBox(batch, i);
+        addBox(batch, o);
+        if ( (r.offset.x != 0) || (r.offset.y != 0) ) {
+            batch->addLine(r.center.x, r.center.y, xc, yc);
         }
-        glVertex2d(xc + xoff, yi2);
-        glVertex2d(xc + xoff, yi2 + handleSizeY);
 
-        if ( (_ds == eDrawStateHoveringInnerMidRight) || (_ms == eMouseStateDraggingInnerMidRight) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-        } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+        ///small lines at handle positions
+        setColor( batch, color, HIGHLIGHTED(eElementInnerMidLeft) );
+        batch->addLine(i.x1, yc, i.x1 - handleSizeX, yc);
+        setColor( batch, color, HIGHLIGHTED(eElementInnerTopMid) );
+        batch->addLine(xc, i.y2, xc, i.y2 + handleSizeY);
+        setColor( batch, color, HIGHLIGHTED(eElementInnerMidRight) );
+        batch->addLine(i.x2, yc, i.x2 + handleSizeX, yc);
+        setColor( batch, color, HIGHLIGHTED(eElementInnerBtmMid) );
+        batch->addLine(xc, i.y1, xc, i.y1 - handleSizeY);
+        setColor( batch, color, HIGHLIGHTED(eElementOuterMidLeft) );
+        batch->addLine(o.x1, yc, o.x1 - handleSizeX, yc);
+        setColor( batch, color, HIGHLIGHTED(eElementOuterTopMid) );
+        batch->addLine(xc, o.y2, xc, o.y2 + handleSizeY);
+        setColor( batch, color, HIGHLIGHTED(eElementOuterMidRight) );
+        batch->addLine(o.x2 + handleSizeX, yc, o.x2, yc);
+        setColor( batch, color, HIGHLIGHTED(eElementOuterBtmMid) );
+        batch->addLine(xc, o.y1, xc, o.y1 - handleSizeY);
+    }
+    for (std::vector<Region>::const_iterator it = _regions.begin(); it != _regions.end(); ++it) {
+        const Region & r = *it;
+        const OfxRectD & i = r.inner;
+        const OfxRectD & o = r.outer;
+        double xc = r.center.x + r.offset.x;
+        double yc = r.center.y + r.offset.y;
+
+        ///center, and offset center
+        setColor( batch, color, HIGHLIGHTED(eElementCenter) );
+        batch->addPoint(r.center.x, r.center.y);
+        if ( (r.offset.x != 0) || (r.offset.y != 0) ) {
+            batch->addPoint(xc, yc);
         }
-        glVertex2d(xi2, yc + yoff);
-        glVertex2d(xi2 + handleSizeX, yc + yoff);
 
-        if ( (_ds == eDrawStateHoveringInnerBtmMid) || (_ms == eMouseStateDraggingInnerBtmMid) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-        } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+        ///highlighted points of the boxes
+        if (r.highlighted) {
+            const double px[eElementOuterMidLeft + 1] = {
+                0.,
+                i.x1, i.x2, i.x1, i.x2, xc, i.x2, xc, i.x1,
+                o.x1, o.x2, o.x1, o.x2, xc, o.x2, xc, o.x1
+            };
+            const double py[eElementOuterMidLeft + 1] = {
+                0.,
+                i.y2, i.y2, i.y1, i.y1, i.y2, yc, i.y1, yc,
+                o.y2, o.y2, o.y1, o.y1, o.y2, yc, o.y1, yc
+            };
+            setColor(batch, color, true);
+            for (int e = eElementInnerTopLeft; e <= eElementOuterMidLeft; ++e) {
+                if ( HIGHLIGHTED(e) ) {
+                    batch->addPoint(px[e], py[e]);
+                }
+            }
         }
-        glVertex2d(xc + xoff, yi1);
-        glVertex2d(xc + xoff, yi1 - handleSizeY);
 
-        //////DRAWING OUTTER HANDLES
+        if ( !r.name.empty() ) {
+            OfxPointD p;
+            p.x = r.center.x;
+            p.y = r.center.y + POINT_SIZE * screenPixelRatio;
+            _labelPositions.push_back(p);
+            _labels.push_back(r.name);
+        }
+    }
+#undef HIGHLIGHTED
+} // TrackerRegionOverlay::buildBatch
 
-        if ( (_ds == eDrawStateHoveringOuterMidLeft) || (_ms == eMouseStateDraggingOuterMidLeft) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-        } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+void
+TrackerRegionOverlay::draw(const DrawArgs &args,
+                           const OfxRGBColourD & color,
+                           double screenPixelRatio,
+                           TextRenderer::Font font)
+{
+    if ( _regions.empty() ) {
+        return;
+    }
+    OverlayBatch batch;
+    buildBatch(&batch, args.pixelScale, color, screenPixelRatio);
+
+    GLdouble projection[16];
+    glGetDoublev( GL_PROJECTION_MATRIX, projection);
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    OfxPointD shadow; // how much to translate GL_PROJECTION to get exactly one pixel on screen
+    shadow.x = 2. / (projection[0] * viewport[2]);
+    shadow.y = 2. / (projection[5] * viewport[3]);
+
+    // Draw everything twice
+    // l = 0: shadow
+    // l = 1: drawing
+    for (int l = 0; l < 2; ++l) {
+        // shadow (uses GL_PROJECTION)
+        glMatrixMode(GL_PROJECTION);
+        int direction = (l == 0) ? 1 : -1;
+        // translate (1,-1) pixels
+        glTranslated(direction * shadow.x, -direction * shadow.y, 0);
+        glMatrixMode(GL_MODELVIEW); // Modelview should be used on Nuke
+
+        batch.draw(l == 0);
+
+        glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+        TextRenderer::bitmapStrings(_labelPositions, _labels, font);
+    }
+
+    buildHitIndex(args.time, args.pixelScale);
+} // TrackerRegionOverlay::draw
+
+// the handles in the order they are tested by TrackerRegionInteract
+static const TrackerRegionOverlay::ElementEnum gHandlePriority[] = {
+    TrackerRegionOverlay::eElementCenter,
+    TrackerRegionOverlay::eElementInnerBtmLeft,
+    TrackerRegionOverlay::eElementInnerBtmRight,
+    TrackerRegionOverlay::eElementInnerTopLeft,
+    TrackerRegionOverlay::eElementInnerTopRight,
+    TrackerRegionOverlay::eElementInnerBtmMid,
+    TrackerRegionOverlay::eElementInnerMidLeft,
+    TrackerRegionOverlay::eElementInnerTopMid,
+    TrackerRegionOverlay::eElementInnerMidRight,
+    TrackerRegionOverlay::eElementOuterBtmLeft,
+    TrackerRegionOverlay::eElementOuterBtmRight,
+    TrackerRegionOverlay::eElementOuterTopLeft,
+    TrackerRegionOverlay::eElementOuterTopRight,
+    TrackerRegionOverlay::eElementOuterBtmMid,
+    TrackerRegionOverlay::eElementOuterMidLeft,
+    TrackerRegionOverlay::eElementOuterTopMid,
+    TrackerRegionOverlay::eElementOuterMidRight
+};
+
+#define kTrackerHandleCount ( sizeof(gHandlePriority) / sizeof(gHandlePriority[0]) )
+
+// the grid cell of coordinate v, or false if it is too far to be indexed
+static bool
+getGridCell(double v,
+            double cellSize,
+            int* cell)
+{
+    double c = std::floor(v / cellSize);
+
+    if ( !(std::fabs(c) < 1e9) ) {
+        return false;
+    }
+    *cell = (int)c;
+
+    return true;
+}
+
+void
+TrackerRegionOverlay::buildHitIndex(double time,
+                                    const OfxPointD & pscale)
+{
+    _handles.clear();
+    _handleCells.clear();
+    _hitIndexValid = false;
+    if ( (pscale.x <= 0.) || (pscale.y <= 0.) ) {
+        return;
+    }
+    // with cells as large as the tolerance, the handles near the pen are in the 3x3 neighboring cells
+    _hitTolerance.x = POINT_TOLERANCE * pscale.x;
+    _hitTolerance.y = POINT_TOLERANCE * pscale.y;
+
+    _handles.reserve(_regions.size() * kTrackerHandleCount);
+    for (std::size_t t = 0; t < _regions.size(); ++t) {
+        const Region & r = _regions[t];
+        const OfxRectD & i = r.inner;
+        const OfxRectD & o = r.outer;
+        double xc = r.center.x + r.offset.x;
+        double yc = r.center.y + r.offset.y;
+        const double px[eElementOuterMidLeft + 1] = {
+            r.center.x,
+            i.x1, i.x2, i.x1, i.x2, xc, i.x2, xc, i.x1,
+            o.x1, o.x2, o.x1, o.x2, xc, o.x2, xc, o.x1
+        };
+        const double py[eElementOuterMidLeft + 1] = {
+            r.center.y,
+            i.y2, i.y2, i.y1, i.y1, i.y2, yc, i.y1, yc,
+            o.y2, o.y2, o.y1, o.y1, o.y2, yc, o.y1, yc
+        };
+        for (std::size_t k = 0; k < kTrackerHandleCount; ++k) {
+            Handle h;
+            h.element = gHandlePriority[k];
+            h.x = px[h.element];
+            h.y = py[h.element];
+            h.track = (int)t;
+            h.rank = (int)k;
+            HandleCell cell;
+            if ( !getGridCell(h.x, _hitTolerance.x, &cell.first.first) ||
+                 !getGridCell(h.y, _hitTolerance.y, &cell.first.second) ) {
+                continue;
+            }
+            cell.second = (int)_handles.size();
+            _handles.push_back(h);
+            _handleCells.push_back(cell);
         }
-        glVertex2d(xo1, yc + yoff);
-        glVertex2d(xo1 - handleSizeX, yc + yoff);
+    }
+    std::sort( _handleCells.begin(), _handleCells.end() );
+    _hitIndexTime = time;
+    _hitIndexPScale = pscale;
+    _hitIndexValid = true;
+} // TrackerRegionOverlay::buildHitIndex
 
-        if ( (_ds == eDrawStateHoveringOuterTopMid) || (_ms == eMouseStateDraggingOuterTopMid) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-        } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+bool
+TrackerRegionOverlay::isHitIndexValid(double time,
+                                      const OfxPointD & pscale) const
+{
+    return _hitIndexValid && time == _hitIndexTime && pscale.x == _hitIndexPScale.x && pscale.y == _hitIndexPScale.y;
+}
+
+bool
+TrackerRegionOverlay::hitTest(const OfxPointD & pos,
+                              int* track,
+                              ElementEnum* element) const
+{
+    assert(_hitIndexValid);
+    int cx, cy;
+    if ( !getGridCell(pos.x, _hitTolerance.x, &cx) || !getGridCell(pos.y, _hitTolerance.y, &cy) ) {
+        return false;
+    }
+    const Handle* best = NULL;
+    for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+            HandleCell key( std::make_pair(cx + dx, cy + dy), -1 );
+            for (std::vector<HandleCell>::const_iterator it = std::lower_bound(_handleCells.begin(), _handleCells.end(), key);
+                 it != _handleCells.end() && it->first == key.first; ++it) {
+                const Handle & h = _handles[it->second];
+                if ( ( std::fabs(pos.x - h.x) <= _hitTolerance.x ) && ( std::fabs(pos.y - h.y) <= _hitTolerance.y ) &&
+                     ( !best || ( h.track < best->track ) || ( ( h.track == best->track ) && ( h.rank < best->rank ) ) ) ) {
+                    best = &h;
+                }
+            }
         }
-        glVertex2d(xc + xoff, yo2);
-        glVertex2d(xc + xoff, yo2 + handleSizeY);
+    }
+    if (!best) {
+        return false;
+    }
+    *track = best->track;
+    *element = best->element;
 
-        if ( (_ds == eDrawStateHoveringOuterMidRight) || (_ms == eMouseStateDraggingOuterMidRight) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-        } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+    return true;
+}
+
+void
+TrackerRegionInteract::initOverlayTracks(ImageEffect* effect)
+{
+    std::vector<TrackerRegionOverlay::Track> tracks(1);
+    TrackerRegionOverlay::Track & track = tracks[0];
+
+    track.params.center = _center;
+    track.params.offset = _offset;
+    track.params.patternBtmLeft = _innerBtmLeft;
+    track.params.patternTopRight = _innerTopRight;
+    track.params.searchBtmLeft = _outerBtmLeft;
+    track.params.searchTopRight = _outerTopRight;
+    track.params.correlation = NULL;
+    track.params.refFrame = NULL;
+    track.params.enableRefFrame = NULL;
+    track.name = _name;
+
+    // the other tracks of the effect are drawn with the same batch
+    GenericTrackerPlugin* tracker = dynamic_cast<GenericTrackerPlugin*>(effect);
+    if (tracker) {
+        std::vector<TrackerRegionOverlay::Track> others;
+        tracker->getOverlayTracks(&others);
+        for (std::vector<TrackerRegionOverlay::Track>::const_iterator it = others.begin(); it != others.end(); ++it) {
+            if (it->params.center == _center) {
+                continue;
+            }
+            tracks.push_back(*it);
+            addParamToSlaveTo(it->params.center);
+            if (it->params.offset) {
+                addParamToSlaveTo(it->params.offset);
+            }
+            addParamToSlaveTo(it->params.patternBtmLeft);
+            addParamToSlaveTo(it->params.patternTopRight);
+            addParamToSlaveTo(it->params.searchBtmLeft);
+            addParamToSlaveTo(it->params.searchTopRight);
+            if (it->name) {
+                addParamToSlaveTo(it->name);
+            }
         }
-        glVertex2d(xo2 + handleSizeX, yc + yoff);
-        glVertex2d(xo2, yc + yoff);
+    }
+    _overlay.setTracks(tracks);
+}
 
-        if ( (_ds == eDrawStateHoveringOuterBtmMid) || (_ms == eMouseStateDraggingOuterBtmMid) ) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
-        } else {
-            glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+// make the given track of the overlay the one edited by the interact
+bool
+TrackerRegionInteract::setEditedTrack(int track)
+{
+    const TrackerRegionOverlay::Track t = _overlay.getTracks()[track]; // copy: the tracks are swapped below
+
+    if (!t.params.offset) {
+        return false;
+    }
+    _overlay.moveTrackToFront(track);
+    _center = t.params.center;
+    _offset = t.params.offset;
+    _innerBtmLeft = t.params.patternBtmLeft;
+    _innerTopRight = t.params.patternTopRight;
+    _outerBtmLeft = t.params.searchBtmLeft;
+    _outerTopRight = t.params.searchTopRight;
+    _name = t.name;
+    _hoverTrack = 0;
+
+    return true;
+}
+
+// the elements of the track drawn highlighted, because they are hovered, or dragged
+unsigned int
+TrackerRegionInteract::getHighlightedElements(bool hovered) const
+{
+    unsigned int highlighted = 0;
+
+    // the draw states and the dragging states are in the same order as TrackerRegionOverlay::ElementEnum
+    if (hovered) {
+        if (_ds != eDrawStateInactive) {
+            highlighted |= 1u << (_ds - eDrawStateHoveringCenter + TrackerRegionOverlay::eElementCenter);
         }
-        glVertex2d(xc + xoff, yo1);
-        glVertex2d(xc + xoff, yo1 - handleSizeY);
-        glEnd();
+    } else if (_ms == eMouseStateDraggingCenter) {
+        highlighted |= 1u << TrackerRegionOverlay::eElementCenter;
+    } else if (_ms >= eMouseStateDraggingInnerTopLeft) {
+        highlighted |= 1u << (_ms - eMouseStateDraggingInnerTopLeft + TrackerRegionOverlay::eElementInnerTopLeft);
+    }
 
+    return highlighted;
+}
 
-        glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
-        string name;
-        _name->getValue(name);
-        TextRenderer::bitmapString(xc, yc + POINT_SIZE * screenPixelRatio, name.c_str(), font);
+bool
+TrackerRegionInteract::draw(const DrawArgs &args)
+{
+    OfxRGBColourD color = { 0.8, 0.8, 0.8 };
+
+    getSuggestedColour(color);
+
+    std::vector<TrackerRegionOverlay::Region> & regions = _overlay.readRegions(args.time);
+    assert( !regions.empty() );
+    TrackerRegionOverlay::Region & region = regions[0];
+    if (_ms != eMouseStateIdle) {
+        region.inner.x1 = _innerBtmLeftDragPos.x;
+        region.inner.y1 = _innerBtmLeftDragPos.y;
+        region.inner.x2 = _innerTopRightDragPos.x;
+        region.inner.y2 = _innerTopRightDragPos.y;
+        region.outer.x1 = _outerBtmLeftDragPos.x;
+        region.outer.y1 = _outerBtmLeftDragPos.y;
+        region.outer.x2 = _outerTopRightDragPos.x;
+        region.outer.y2 = _outerTopRightDragPos.y;
+        region.center = _centerDragPos;
+        region.offset = _offsetDragPos;
     }
+    region.highlighted = getHighlightedElements(false);
+    if ( _hoverTrack < (int)regions.size() ) {
+        regions[_hoverTrack].highlighted |= getHighlightedElements(true);
+    }
+
+    bool hiDPI = _hiDPI ? _hiDPI->getValue() : false;
+    double screenPixelRatio = hiDPI ? 2 : 1;
+#ifdef OFX_EXTENSIONS_NATRON
+    screenPixelRatio *= args.screenPixelRatio;
+    hiDPI |= args.screenPixelRatio > 1;
+#endif
+    TextRenderer::Font font = hiDPI ? TextRenderer::FONT_TIMES_ROMAN_24 : TextRenderer::FONT_HELVETICA_12;
+
+    //glPushAttrib(GL_ALL_ATTRIB_BITS); // caller is responsible for protecting attribs
+
+    glDisable(GL_LINE_STIPPLE);
+    glEnable(GL_LINE_SMOOTH);
+    glDisable(GL_POINT_SMOOTH);
+    glEnable(GL_BLEND);
+    glHint(GL_LINE_SMOOTH_HINT, GL_DONT_CARE);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    _overlay.draw(args, color, screenPixelRatio, font);
 
     //glPopAttrib();
 
@@ -593,8 +1969,33 @@ TrackerRegionInteract::penMotion(const PenArgs &args)
     delta.x = args.penPosition.x - _lastMousePos.x;
     delta.y = args.penPosition.y - _lastMousePos.y;
 
+    if ( (_ms == eMouseStateIdle) && _overlay.isHitIndexValid(args.time, pscale) ) {
+        // hovering: look for the handles drawn by the last redraw, without fetching the params
+        bool lastStateWasHovered = _ds != eDrawStateInactive;
+        int track;
+        TrackerRegionOverlay::ElementEnum element;
+        if ( _overlay.hitTest(args.penPosition, &track, &element) ) {
+            _ds = (DrawStateEnum)(eDrawStateHoveringCenter + element - TrackerRegionOverlay::eElementCenter);
+            _hoverTrack = track;
+            didSomething = true;
+        } else {
+            _ds = eDrawStateInactive;
+        }
+        ///repaint if we toggled off a hovered handle
+        if (lastStateWasHovered) {
+            didSomething = true;
+        }
+        if (didSomething) {
+            requestRedraw();
+        }
+        _lastMousePos = args.penPosition;
+
+        return didSomething;
+    }
+
     double xi1, xi2, yi1, yi2, xo1, xo2, yo1, yo2, xc, yc, xoff, yoff;
     if (_ms == eMouseStateIdle) {
+        _hoverTrack = 0;
         _innerBtmLeft->getValueAtTime( args.time, xi1, yi1);
         _innerTopRight->getValueAtTime(args.time, xi2, yi2);
         _outerBtmLeft->getValueAtTime( args.time, xo1, yo1);
@@ -997,6 +2398,15 @@ TrackerRegionInteract::penDown(const PenArgs &args)
     bool didSomething = false;
     double xi1, xi2, yi1, yi2, xo1, xo2, yo1, yo2, xc, yc, xoff, yoff;
 
+    // the pen may be on a handle of another track drawn by the overlay: edit that track
+    if ( _overlay.isHitIndexValid(args.time, pscale) ) {
+        int track;
+        TrackerRegionOverlay::ElementEnum element;
+        if ( _overlay.hitTest(args.penPosition, &track, &element) && (track != 0) ) {
+            setEditedTrack(track);
+        }
+    }
+
     _innerBtmLeft->getValueAtTime( args.time, xi1, yi1);
     _innerTopRight->getValueAtTime(args.time, xi2, yi2);
     _outerBtmLeft->getValueAtTime( args.time, xo1, yo1);
@@ -1170,6 +2580,7 @@ TrackerRegionInteract::penUp(const PenArgs &args)
     _effect->endEditBlock();
 
     _ms = eMouseStateIdle;
+    _overlay.invalidateHitIndex();
 
     requestRedraw();
 
@@ -25,12 +25,17 @@
 #ifndef openfx_supportext_ofxsTracking_h
 #define openfx_supportext_ofxsTracking_h
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "ofxsImageEffect.h"
 #ifdef OFX_EXTENSIONS_NATRON
 #include "ofxNatron.h"
 #endif
 #include "ofxsMacros.h"
 #include "ofxsOGLHiDPI.h"
+#include "ofxsOGLTextRenderer.h"
 
 #define kParamTrackingCenterPoint "center"
 #define kParamTrackingCenterPointLabel "Center"
@@ -100,6 +105,323 @@ struct TrackArguments
     OfxPointD renderScale;
 };
 
+/**
+ * @brief Luminance pyramid of a window of an image, used by the pattern matcher.
+ * Level 0 is at full resolution, and each level is half the size of the previous one
+ * (2x2 box filter, as in ofxsMipmap.cpp). All bounds are in pixel coordinates of the source image,
+ * divided by 2^level.
+ **/
+class TrackerPyramid
+{
+public:
+    TrackerPyramid()
+        : _levels()
+    {
+    }
+
+    /**
+     * @brief Extract the luminance of img over window (clipped to the image bounds), and build
+     * the coarser levels, up to nLevels levels.
+     * Throws kOfxStatErrFormat if the image depth is not supported.
+     **/
+    void build(const OFX::Image & img,
+               const OfxRectI & window,
+               int nLevels);
+
+    void clear()
+    {
+        _levels.clear();
+    }
+
+    int getLevelsCount() const
+    {
+        return (int)_levels.size();
+    }
+
+    const OfxRectI & getBounds(int level) const
+    {
+        return _levels[level].bounds;
+    }
+
+    /**
+     * @brief Address of pixel (x,y) at the given level, or NULL if it is outside of the bounds.
+     * Consecutive rows are (bounds.x2 - bounds.x1) floats apart.
+     **/
+    const float* getPixelAddress(int level,
+                                 int x,
+                                 int y) const;
+
+    /// bilinear interpolation at (x,y), clamped to the bounds of the level
+    float getPixelBilinear(int level,
+                           double x,
+                           double y) const;
+
+private:
+    struct Level
+    {
+        OfxRectI bounds;
+        std::vector<float> pixels;
+    };
+
+    std::vector<Level> _levels;
+};
+
+/**
+ * @brief The number of pyramid levels to use for matching a pattern in a search window.
+ * Levels are added until the search radius at the coarsest level is a few pixels, as long as
+ * the pattern remains large enough to be matched at that level.
+ **/
+int trackerGetPyramidLevels(const OfxRectI & patternWindow,
+                            const OfxRectI & searchWindow);
+
+/**
+ * @brief Find the pattern of ref in the search window of img.
+ *
+ * The pattern is searched exhaustively by normalized cross-correlation (NCC) at the coarsest level,
+ * refined at each finer level in a small neighborhood, and the integer position at level 0 is refined
+ * to sub-pixel accuracy by fitting a parabola to the NCC scores, followed by Lucas-Kanade iterations.
+ * The cost is thus almost independent of the size of the search window.
+ *
+ * @param ref The pyramid containing the pattern, built over patternWindow grown by one pixel.
+ * @param patternWindow The pattern, in pixel coordinates of the reference image.
+ * @param img The pyramid of the image to search, built over searchWindow, with as many levels as ref.
+ * @param searchWindow The window where the pattern may be, in pixel coordinates.
+ * @param delta Receives the displacement of the pattern, in pixels.
+ * @param score Receives the NCC score at delta, in [-1,1].
+ * @return false if the pattern is uniform, or does not fit in the search window.
+ **/
+bool trackerMatchPattern(const TrackerPyramid & ref,
+                         const OfxRectI & patternWindow,
+                         const TrackerPyramid & img,
+                         const OfxRectI & searchWindow,
+                         OfxPointD* delta,
+                         double* score);
+
+/**
+ * @brief One track of a batch, see trackerTrackPoints().
+ * Coordinates are canonical, and the boxes are relative to center + offset, as in the track parameters.
+ **/
+struct TrackerTrack
+{
+    OfxTime refTime;     //<! the time of the pattern
+    OfxPointD refCenter;     //<! the center point at refTime
+    OfxPointD refOffset;     //<! the offset at refTime
+    OfxPointD patternBtmLeft;     //<! the pattern box at refTime
+    OfxPointD patternTopRight;
+    OfxPointD center;     //<! the center point at the time tracked from
+    OfxPointD offset;     //<! the offset at the time tracked from
+    OfxPointD searchBtmLeft;     //<! the search box at the time tracked from
+    OfxPointD searchTopRight;
+
+    bool found;     //<! set by trackerTrackPoints(): true if the pattern was found
+    OfxPointD newCenter;     //<! set by trackerTrackPoints(): the center point at the time tracked to
+    double score;     //<! set by trackerTrackPoints(): the correlation score at the time tracked to
+};
+
+struct TrackerFramePrefetcherPrivate;
+class OverlayBatch;
+
+/**
+ * @brief Fetches the source frames of a tracking range on a background thread, while the current
+ * frame is being matched.
+ *
+ * The frames that follow the current frame in the tracking direction are fetched over the region
+ * given by setCurrentFrame(), up to nFrames frames ahead and within memoryBudget bytes. Frames that
+ * are behind the current frame are released.
+ * The images are fetched with Clip::fetchImage() from a thread that was not spawned by the host, during
+ * the instance changed action. The OFX API does not guarantee that this is allowed, and some hosts
+ * deadlock or crash: only use the prefetcher with hosts that are known to support it.
+ **/
+class TrackerFramePrefetcher
+{
+public:
+    TrackerFramePrefetcher(OFX::Clip* srcClip,
+                           const TrackArguments & args,
+                           int nFrames,
+                           std::size_t memoryBudget);
+
+    /// cancels prefetching, waits for the background thread, and releases the images
+    ~TrackerFramePrefetcher();
+
+    /**
+     * @brief Set the frame tracked from, and the region (in canonical coordinates) to fetch from the
+     * next frames. The background thread is started on the first call.
+     **/
+    void setCurrentFrame(OfxTime time,
+                         const OfxRectD & region);
+
+    /**
+     * @brief The image at time, covering rect (in canonical coordinates): the prefetched image if there
+     * is one, else the image is fetched by the calling thread.
+     * The image is owned by the prefetcher, and remains valid until the current frame is past time.
+     **/
+    const OFX::Image* fetchImage(OfxTime time,
+                                 const OfxRectD & rect);
+
+    /// stop prefetching, e.g. if the user aborted. The images already fetched remain available.
+    void cancel();
+
+private:
+    auto_ptr<TrackerFramePrefetcherPrivate> _imp;
+};
+
+/**
+ * @brief Track a batch of points to otherTime, and set their found, newCenter and score members.
+ * The image at otherTime is fetched once over the union of the search areas, the reference images are
+ * fetched once per reference time over the union of the patterns, and the tracks are matched in parallel
+ * using the multithread suite.
+ * If prefetcher is not NULL, the images are obtained from it.
+ **/
+void trackerTrackPoints(OFX::Clip* srcClip,
+                        OfxTime otherTime,
+                        const OfxPointD & renderScale,
+                        std::vector<TrackerTrack>* tracks,
+                        TrackerFramePrefetcher* prefetcher = NULL);
+
+/**
+ * @brief The parameters of a track, as used by GenericTrackerPlugin::trackTracks().
+ * offset, correlation, refFrame and enableRefFrame may be NULL.
+ **/
+struct TrackerTrackParams
+{
+    OFX::Double2DParam* center;
+    OFX::Double2DParam* offset;
+    OFX::Double2DParam* patternBtmLeft;
+    OFX::Double2DParam* patternTopRight;
+    OFX::Double2DParam* searchBtmLeft;
+    OFX::Double2DParam* searchTopRight;
+    OFX::DoubleParam* correlation;
+    OFX::IntParam* refFrame;
+    OFX::BooleanParam* enableRefFrame;
+};
+
+/**
+ * @brief Draws the regions of all the tracks of an effect in one batch.
+ * The parameters of all tracks are read once per redraw by readRegions(), and the boxes, centers and
+ * handles of all tracks are then drawn with one glDrawArrays per primitive type, and the labels with a
+ * single TextRenderer::bitmapStrings(), instead of a few dozen OpenGL calls per track.
+ **/
+class TrackerRegionOverlay
+{
+public:
+    /** @brief The elements of a region that can be highlighted, in the order of the interact states. */
+    enum ElementEnum
+    {
+        eElementCenter = 0,
+
+        eElementInnerTopLeft,
+        eElementInnerTopRight,
+        eElementInnerBtmLeft,
+        eElementInnerBtmRight,
+        eElementInnerTopMid,
+        eElementInnerMidRight,
+        eElementInnerBtmMid,
+        eElementInnerMidLeft,
+
+        eElementOuterTopLeft,
+        eElementOuterTopRight,
+        eElementOuterBtmLeft,
+        eElementOuterBtmRight,
+        eElementOuterTopMid,
+        eElementOuterMidRight,
+        eElementOuterBtmMid,
+        eElementOuterMidLeft
+    };
+
+    /**
+     * @brief The parameters of a track. params.offset and name may be NULL, the other parameters
+     * used for drawing (center and boxes) must be defined.
+     **/
+    struct Track
+    {
+        TrackerTrackParams params;
+        OFX::StringParam* name;
+    };
+
+    /** @brief The region of a track at a given time, in absolute canonical coordinates. */
+    struct Region
+    {
+        OfxPointD center;
+        OfxPointD offset;
+        OfxRectD inner; // the pattern box
+        OfxRectD outer; // the search area
+        std::string name;
+        unsigned int highlighted; // a combination of (1 << ElementEnum)
+    };
+
+    TrackerRegionOverlay();
+
+    void setTracks(const std::vector<Track> & tracks);
+
+    const std::vector<Track> & getTracks() const
+    {
+        return _tracks;
+    }
+
+    /**
+     * @brief Read the regions of all tracks at the given time. The returned regions may be
+     * modified before calling draw(), e.g. to draw a region being dragged or to highlight elements.
+     **/
+    std::vector<Region> & readRegions(double time);
+
+    /**
+     * @brief Draw the regions returned by the last call to readRegions().
+     * The line smoothing and blending properties must be set by the caller.
+     * This also builds the index of the handle positions used by hitTest().
+     **/
+    void draw(const OFX::DrawArgs &args, const OfxRGBColourD & color, double screenPixelRatio, OFX::TextRenderer::Font font);
+
+    /** @brief Swap the first track with the given track, e.g. to make it the track edited by the interact. */
+    void moveTrackToFront(int track);
+
+    /**
+     * @brief Returns true if the handle index built by the last draw() can be used for pen events at
+     * this time and pixel scale.
+     **/
+    bool isHitIndexValid(double time, const OfxPointD & pscale) const;
+
+    /** @brief Invalidate the handle index, e.g. when the parameters are modified by the interact. */
+    void invalidateHitIndex()
+    {
+        _hitIndexValid = false;
+    }
+
+    /**
+     * @brief Find the handle within the pen tolerance of pos, using the handle index.
+     * Only the handles in the neighboring cells of a uniform grid are tested, so that the cost does
+     * not depend on the number of tracks. If several handles are near, the first track has priority, and
+     * within a track the center, the inner box and the outer box have priority, as in TrackerRegionInteract.
+     **/
+    bool hitTest(const OfxPointD & pos, int* track, ElementEnum* element) const;
+
+private:
+    void buildBatch(OverlayBatch* batch, const OfxPointD & pscale, const OfxRGBColourD & color, double screenPixelRatio);
+    void buildHitIndex(double time, const OfxPointD & pscale);
+
+    // a handle of the hit index
+    struct Handle
+    {
+        double x;
+        double y;
+        int track;
+        int rank; // priority within the track
+        ElementEnum element;
+    };
+
+    typedef std::pair<std::pair<int, int>, int> HandleCell; // (grid cell, handle index)
+
+    std::vector<Track> _tracks;
+    std::vector<Region> _regions;
+    std::vector<OfxPointD> _labelPositions;
+    std::vector<std::string> _labels;
+    std::vector<Handle> _handles;
+    std::vector<HandleCell> _handleCells; // sorted by cell
+    bool _hitIndexValid;
+    double _hitIndexTime;
+    OfxPointD _hitIndexPScale;
+    OfxPointD _hitTolerance; // the grid cell size, in canonical coordinates
+};
+
 class GenericTrackerPlugin
     : public OFX::ImageEffect
 {
@@ -125,6 +447,14 @@ public:
     virtual void changedParam(const OFX::InstanceChangedArgs &args, const std::string &paramName) OVERRIDE;
     virtual bool getRegionOfDefinition(const OFX::RegionOfDefinitionArguments &args, OfxRectD &rod) OVERRIDE;
 
+    /**
+     * @brief Get the tracks drawn by TrackerRegionInteract. The track of the parameters fetched by the
+     * interact is edited first, and clicking on a handle of another track makes it the edited track.
+     * Tracks without an offset parameter are drawn, but cannot be edited by the interact.
+     * The default implementation returns the track parameters of this instance, if they are defined.
+     **/
+    virtual void getOverlayTracks(std::vector<TrackerRegionOverlay::Track>* tracks);
+
 protected:
 
     /**
@@ -132,8 +462,24 @@ protected:
      * @param forward If true then it should track from first to last, otherwise it should track
      * from last to first.
      * @param currentTime The current time at which the track has been requested.
+     *
+     * The default implementation calls trackTracks() with the track parameters of this instance.
+     * These parameters are defined by the plugin, and the default implementation fails if the center
+     * point or the boxes do not exist.
      **/
-    virtual void trackRange(const OFX::TrackArguments & args) = 0;
+    virtual void trackRange(const OFX::TrackArguments & args);
+
+    /**
+     * @brief Track several tracks over the range of args, with trackerTrackPoints(): each source frame
+     * is fetched once for all the tracks, and the tracks are matched in parallel.
+     * At each tracked frame, the center point and the correlation score are set. A track stops when its
+     * pattern is not found, and tracking stops when no track is left or when the user aborts.
+     * If _prefetchFrames is not zero, the next frames are fetched by a TrackerFramePrefetcher while
+     * the current frame is tracked. Prefetching is disabled by default: see TrackerFramePrefetcher for
+     * the host requirements before enabling it.
+     **/
+    void trackTracks(const OFX::TrackArguments & args,
+                     const std::vector<TrackerTrackParams> & tracks);
 
     // do not need to delete these, the ImageEffect is managing them for us
     OFX::Clip *_dstClip;
@@ -143,6 +489,19 @@ protected:
     OFX::PushButtonParam* _nextButton;
     OFX::PushButtonParam* _forwardButton;
     OFX::StringParam* _instanceName;
+    // the track parameters, if defined by the plugin
+    OFX::Double2DParam* _center;
+    OFX::Double2DParam* _offset;
+    OFX::Double2DParam* _patternBtmLeft;
+    OFX::Double2DParam* _patternTopRight;
+    OFX::Double2DParam* _searchBtmLeft;
+    OFX::Double2DParam* _searchTopRight;
+    OFX::DoubleParam* _correlation;
+    OFX::IntParam* _refFrame;
+    OFX::BooleanParam* _enableRefFrame;
+    // frame prefetching in trackTracks(), disabled by default (the plugin may set it, e.g. to 4, for hosts that allow it)
+    int _prefetchFrames;     //<! the number of frames to prefetch (0 to disable prefetching)
+    std::size_t _prefetchMemory;     //<! the maximum memory used by the prefetched frames, in bytes
 };
 
 void genericTrackerDescribe(OFX::ImageEffectDescriptor &desc);
@@ -238,6 +597,8 @@ public:
         , _outerTopRightDragPos()
         , _controlDown(0)
         , _altDown(0)
+        , _overlay()
+        , _hoverTrack(0)
     {
         _center = effect->fetchDouble2DParam(kParamTrackingCenterPoint);
         _offset = effect->fetchDouble2DParam(kParamTrackingOffset);
@@ -258,6 +619,7 @@ public:
         addParamToSlaveTo(_outerBtmLeft);
         addParamToSlaveTo(_outerTopRight);
         addParamToSlaveTo(_name);
+        initOverlayTracks(effect);
     }
 
     // overridden functions from OFX::Interact to do things
@@ -272,6 +634,9 @@ public:
 private:
     bool isDraggingInnerPoint() const;
     bool isDraggingOuterPoint() const;
+    void initOverlayTracks(OFX::ImageEffect* effect);
+    bool setEditedTrack(int track);
+    unsigned int getHighlightedElements(bool hovered) const;
 
     OfxPointD _lastMousePos;
     MouseStateEnum _ms;
@@ -295,6 +660,8 @@ private:
     OfxPointD _outerTopRightDragPos;
     int _controlDown;
     int _altDown;
+    TrackerRegionOverlay _overlay; // the first track is the one edited by this interact
+    int _hoverTrack; // the track of the hovered handle
 };
 
 class TrackerRegionOverlayDescriptor
@@ -58,6 +58,7 @@
 #include "ofxsTransform3x3Processor.h"
 #include "ofxsCoords.h"
 #include "ofxsShutter.h"
+#include "ofxsProfiling.h"
 
 
 #ifndef ENABLE_HOST_TRANSFORM
@@ -610,6 +611,8 @@ bool
 Transform3x3Plugin::getRegionOfDefinition(const RegionOfDefinitionArguments &args,
                                           OfxRectD &rod)
 {
+    OFX_PROFILE_SCOPE(timer, "action", "Transform3x3Plugin::getRegionOfDefinition");
+
     if (!_srcClip || !_srcClip->isConnected()) {
         return false;
     }
@@ -722,6 +725,8 @@ void
 Transform3x3Plugin::getRegionsOfInterest(const RegionsOfInterestArguments &args,
                                          RegionOfInterestSetter &rois)
 {
+    OFX_PROFILE_SCOPE(timer, "action", "Transform3x3Plugin::getRegionsOfInterest");
+
     if (!_srcClip || !_srcClip->isConnected()) {
         return;
     }
@@ -931,6 +936,9 @@ Transform3x3Plugin::renderInternal(const RenderArguments &args,
 void
 Transform3x3Plugin::render(const RenderArguments &args)
 {
+    OFX_PROFILE_SCOPE(timer, "action", "Transform3x3Plugin::render");
+    OFX_PROFILE_ARG(timer, "pixels", (double)(args.renderWindow.x2 - args.renderWindow.x1) * (args.renderWindow.y2 - args.renderWindow.y1));
+
     // instantiate the render code based on the pixel depth of the dst clip
     BitDepthEnum dstBitDepth    = _dstClip->getPixelDepth();
     int dstComponentCount  = _dstClip->getPixelComponentCount();
@@ -979,6 +987,8 @@ Transform3x3Plugin::isIdentity(const IsIdentityArguments &args,
 #endif
                                )
 {
+    OFX_PROFILE_SCOPE(timer, "action", "Transform3x3Plugin::isIdentity");
+
     const double time = args.time;
 
     if (_dirBlurAmount) {
@@ -1063,6 +1073,8 @@ Transform3x3Plugin::getTransform(const TransformArguments &args,
                                  Clip * &transformClip,
                                  double transformMatrix[9])
 {
+    OFX_PROFILE_SCOPE(timer, "action", "Transform3x3Plugin::getTransform");
+
     //std::cout << "getTransform called!" << std::endl;
 
     // Even if the plugin advertizes it cannot transform, getTransform() may be called, e.g. to
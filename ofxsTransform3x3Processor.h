@@ -32,6 +32,7 @@
 #include "ofxsFilter.h"
 #include "ofxsMaskMix.h"
 #include "ofxsMacros.h"
+#include "ofxsProfiling.h"
 
 // constants for the motion blur algorithm (may depend on _motionblur)
 #define kTransform3x3ProcessorMotionBlurMaxError (_motionblur * maxValue / 1000.)
@@ -161,7 +162,7 @@ private:
         const int y2 = _srcImg ? _srcImg->getBounds().y2 : 0;
 
         for (int y = procWindow.y1; y < procWindow.y2; ++y) {
-            if ( _effect.abort() ) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
                 break;
             }
 
@@ -224,7 +225,7 @@ private:
         // Monte Carlo integration, starting with at least 13 regularly spaced samples, and then low discrepancy
         // samples from the van der Corput sequence.
         for (int y = procWindow.y1; y < procWindow.y2; ++y) {
-            if ( _effect.abort() ) {
+            if ( OFX::Profiling::checkAbort(_effect) ) {
                 break;
             }
 
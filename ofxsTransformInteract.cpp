@@ -29,23 +29,9 @@
 #include <cmath>
 #include <cfloat> // DBL_MAX
 #include <algorithm>
+#include <vector>
 
-#ifdef __APPLE__
-#ifndef GL_SILENCE_DEPRECATION
-#define GL_SILENCE_DEPRECATION // Yes, we are still doing OpenGL 2.1
-#endif
-#include <OpenGL/gl.h>
-#else
-#ifdef _WIN32
-#define WIN32_LEAN_AND_MEAN
-#ifndef NOMINMAX
-#define NOMINMAX
-#endif
-#include <windows.h>
-#endif
-
-#include <GL/gl.h>
-#endif
+#include "ofxsOGLOverlayBatch.h"
 
 #include "ofxsMatrix2D.h"
 #include "ofxsTransform3x3.h"
@@ -479,93 +465,106 @@ getTargetPoints(const OfxPointD& targetCenter,
 }
 
 static void
-drawSquare(const OfxRGBColourD& color,
-           const OfxPointD& center,
-           const OfxPointD& pixelScale,
-           bool hovered,
-           bool althovered,
-           int l)
+addSquare(OverlayBatch* batch,
+          const OfxRGBColourD& color,
+          const OfxPointD& center,
+          const OfxPointD& pixelScale,
+          bool hovered,
+          bool althovered)
 {
     // we are not axis-aligned
     double meanPixelScale = (pixelScale.x + pixelScale.y) / 2.;
 
     if (hovered) {
         if (althovered) {
-            glColor3f(0.f * l, 1.f * l, 0.f * l);
+            batch->setColor(0.f, 1.f, 0.f);
         } else {
-            glColor3f(1.f * l, 0.f * l, 0.f * l);
+            batch->setColor(1.f, 0.f, 0.f);
         }
     } else {
-        glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+        batch->setColor( (float)color.r, (float)color.g, (float)color.b );
     }
     double halfWidth = (POINT_SIZE / 2.) * meanPixelScale;
     double halfHeight = (POINT_SIZE / 2.) * meanPixelScale;
-    glPushMatrix();
-    glTranslated(center.x, center.y, 0.);
-    glBegin(GL_POLYGON);
-    glVertex2d(-halfWidth, -halfHeight);   // bottom left
-    glVertex2d(-halfWidth, +halfHeight);   // top left
-    glVertex2d(+halfWidth, +halfHeight);   // bottom right
-    glVertex2d(+halfWidth, -halfHeight);   // top right
-    glEnd();
-    glPopMatrix();
+    batch->pushMatrix();
+    batch->translate(center.x, center.y);
+    batch->addQuad(-halfWidth, -halfHeight, +halfWidth, +halfHeight);
+    batch->popMatrix();
 }
 
 static void
-drawEllipse(const OfxRGBColourD& color,
-            const OfxPointD& center,
-            const OfxPointD& targetRadius,
-            bool hovered,
-            int l)
+addEllipse(OverlayBatch* batch,
+           const OfxRGBColourD& color,
+           const OfxPointD& center,
+           const OfxPointD& targetRadius,
+           bool hovered)
 {
     if (hovered) {
-        glColor3f(1.f * l, 0.f * l, 0.f * l);
+        batch->setColor(1.f, 0.f, 0.f);
     } else {
-        glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+        batch->setColor( (float)color.r, (float)color.g, (float)color.b );
     }
 
-    glPushMatrix();
+    batch->pushMatrix();
     //  center the oval at x_center, y_center
-    glTranslatef( (float)center.x, (float)center.y, 0.f );
+    batch->translate(center.x, center.y);
     //  draw the oval using line segments
-    glBegin(GL_LINE_LOOP);
     // we don't need to be pixel-perfect here, it's just an interact!
     // 40 segments is enough.
+    double xy[2 * 40];
     for (int i = 0; i < 40; ++i) {
         double theta = i * 2 * ofxsPi() / 40.;
-        glVertex2d( targetRadius.x * std::cos(theta), targetRadius.y * std::sin(theta) );
+        xy[2 * i] = targetRadius.x * std::cos(theta);
+        xy[2 * i + 1] = targetRadius.y * std::sin(theta);
     }
-    glEnd();
+    batch->addLineStrip(xy, 40, true);
+
+    batch->popMatrix();
+}
+
+// a horizontal double arrow centered on the origin
+static void
+addDoubleArrow(OverlayBatch* batch,
+               double arrowXHalfSize,
+               double arrowHeadOffsetX,
+               double arrowHeadOffsetY)
+{
+    ///draw the central bar
+    batch->addLine(-arrowXHalfSize, 0., +arrowXHalfSize, 0.);
+
+    ///left triangle
+    batch->addLine(-arrowXHalfSize, 0., -arrowXHalfSize + arrowHeadOffsetX, arrowHeadOffsetY);
+    batch->addLine(-arrowXHalfSize, 0., -arrowXHalfSize + arrowHeadOffsetX, -arrowHeadOffsetY);
 
-    glPopMatrix();
+    ///right triangle
+    batch->addLine(+arrowXHalfSize, 0., +arrowXHalfSize - arrowHeadOffsetX, arrowHeadOffsetY);
+    batch->addLine(+arrowXHalfSize, 0., +arrowXHalfSize - arrowHeadOffsetX, -arrowHeadOffsetY);
 }
 
 static void
-drawSkewBar(const OfxRGBColourD& color,
-            const OfxPointD &center,
-            const OfxPointD& pixelScale,
-            double targetRadiusY,
-            bool hovered,
-            double angle,
-            int l)
+addSkewBar(OverlayBatch* batch,
+           const OfxRGBColourD& color,
+           const OfxPointD &center,
+           const OfxPointD& pixelScale,
+           double targetRadiusY,
+           bool hovered,
+           double angle)
 {
     if (hovered) {
-        glColor3f(1.f * l, 0.f * l, 0.f * l);
+        batch->setColor(1.f, 0.f, 0.f);
     } else {
-        glColor3f( (float)color.r * l, (float)color.g * l, (float)color.b * l );
+        batch->setColor( (float)color.r, (float)color.g, (float)color.b );
     }
 
     // we are not axis-aligned: use the mean pixel scale
     double meanPixelScale = (pixelScale.x + pixelScale.y) / 2.;
     double barHalfSize = targetRadiusY + 20. * meanPixelScale;
 
-    glPushMatrix();
-    glTranslatef( (float)center.x, (float)center.y, 0.f );
-    glRotated(angle, 0, 0, 1);
+    batch->pushMatrix();
+    batch->translate(center.x, center.y);
+    batch->rotate(angle);
 
-    glBegin(GL_LINES);
-    glVertex2d(0., -barHalfSize);
-    glVertex2d(0., +barHalfSize);
+    batch->addLine(0., -barHalfSize, 0., +barHalfSize);
 
     if (hovered) {
         double arrowYPosition = targetRadiusY + 10. * meanPixelScale;
@@ -573,50 +572,31 @@ drawSkewBar(const OfxRGBColourD& color,
         double arrowHeadOffsetX = 3 * meanPixelScale;
         double arrowHeadOffsetY = 3 * meanPixelScale;
 
-        ///draw the central bar
-        glVertex2d(-arrowXHalfSize, -arrowYPosition);
-        glVertex2d(+arrowXHalfSize, -arrowYPosition);
-
-        ///left triangle
-        glVertex2d(-arrowXHalfSize, -arrowYPosition);
-        glVertex2d(-arrowXHalfSize + arrowHeadOffsetX, -arrowYPosition + arrowHeadOffsetY);
-
-        glVertex2d(-arrowXHalfSize, -arrowYPosition);
-        glVertex2d(-arrowXHalfSize + arrowHeadOffsetX, -arrowYPosition - arrowHeadOffsetY);
-
-        ///right triangle
-        glVertex2d(+arrowXHalfSize, -arrowYPosition);
-        glVertex2d(+arrowXHalfSize - arrowHeadOffsetX, -arrowYPosition + arrowHeadOffsetY);
-
-        glVertex2d(+arrowXHalfSize, -arrowYPosition);
-        glVertex2d(+arrowXHalfSize - arrowHeadOffsetX, -arrowYPosition - arrowHeadOffsetY);
+        batch->translate(0., -arrowYPosition);
+        addDoubleArrow(batch, arrowXHalfSize, arrowHeadOffsetX, arrowHeadOffsetY);
     }
-    glEnd();
-    glPopMatrix();
+    batch->popMatrix();
 }
 
 static void
-drawRotationBar(const OfxRGBColourD& color,
-                const OfxPointD& pixelScale,
-                double targetRadiusX,
-                bool hovered,
-                bool inverted,
-                int l)
+addRotationBar(OverlayBatch* batch,
+               const OfxRGBColourD& color,
+               const OfxPointD& pixelScale,
+               double targetRadiusX,
+               bool hovered,
+               bool inverted)
 {
     // we are not axis-aligned
     double meanPixelScale = (pixelScale.x + pixelScale.y) / 2.;
 
     if (hovered) {
-        glColor3f(1.f * l, 0.f * l, 0.f * l);
+        batch->setColor(1.f, 0.f, 0.f);
     } else {
-        glColor3d(color.r * l, color.g * l, color.b * l);
+        batch->setColor( (float)color.r, (float)color.g, (float)color.b );
     }
 
     double barExtra = 30. * meanPixelScale;
-    glBegin(GL_LINES);
-    glVertex2d(0., 0.);
-    glVertex2d(0. + targetRadiusX + barExtra, 0.);
-    glEnd();
+    batch->addLine(0., 0., 0. + targetRadiusX + barExtra, 0.);
 
     if (hovered) {
         double arrowCenterX = targetRadiusX + barExtra / 2.;
@@ -626,35 +606,22 @@ drawRotationBar(const OfxRGBColourD& color,
         arrowRadius.x = 5. * meanPixelScale;
         arrowRadius.y = 10. * meanPixelScale;
 
-        glPushMatrix();
+        batch->pushMatrix();
         //  center the oval at x_center, y_center
-        glTranslatef( (float)arrowCenterX, 0.f, 0 );
+        batch->translate(arrowCenterX, 0.);
         //  draw the oval using line segments
-        glBegin(GL_LINE_STRIP);
-        glVertex2d(0, arrowRadius.y);
-        glVertex2d(arrowRadius.x, 0.);
-        glVertex2d(0, -arrowRadius.y);
-        glEnd();
+        const double arc[6] = { 0., arrowRadius.y, arrowRadius.x, 0., 0., -arrowRadius.y };
+        batch->addLineStrip(arc, 3, false);
 
-
-        glBegin(GL_LINES);
         ///draw the top head
-        glVertex2d(0., arrowRadius.y);
-        glVertex2d(0., arrowRadius.y - 5. * meanPixelScale);
-
-        glVertex2d(0., arrowRadius.y);
-        glVertex2d(4. * meanPixelScale, arrowRadius.y - 3. * meanPixelScale); // 5^2 = 3^2+4^2
+        batch->addLine(0., arrowRadius.y, 0., arrowRadius.y - 5. * meanPixelScale);
+        batch->addLine(0., arrowRadius.y, 4. * meanPixelScale, arrowRadius.y - 3. * meanPixelScale); // 5^2 = 3^2+4^2
 
         ///draw the bottom head
-        glVertex2d(0., -arrowRadius.y);
-        glVertex2d(0., -arrowRadius.y + 5. * meanPixelScale);
+        batch->addLine(0., -arrowRadius.y, 0., -arrowRadius.y + 5. * meanPixelScale);
+        batch->addLine(0., -arrowRadius.y, 4. * meanPixelScale, -arrowRadius.y + 3. * meanPixelScale); // 5^2 = 3^2+4^2
 
-        glVertex2d(0., -arrowRadius.y);
-        glVertex2d(4. * meanPixelScale, -arrowRadius.y + 3. * meanPixelScale); // 5^2 = 3^2+4^2
-
-        glEnd();
-
-        glPopMatrix();
+        batch->popMatrix();
     }
     if (inverted) {
         double arrowXPosition = targetRadiusX + barExtra * 1.5;
@@ -662,54 +629,14 @@ drawRotationBar(const OfxRGBColourD& color,
         double arrowHeadOffsetX = 3 * meanPixelScale;
         double arrowHeadOffsetY = 3 * meanPixelScale;
 
-        glPushMatrix();
-        glTranslatef( (float)arrowXPosition, 0, 0 );
-
-        glBegin(GL_LINES);
-        ///draw the central bar
-        glVertex2d(-arrowXHalfSize, 0.);
-        glVertex2d(+arrowXHalfSize, 0.);
-
-        ///left triangle
-        glVertex2d(-arrowXHalfSize, 0.);
-        glVertex2d(-arrowXHalfSize + arrowHeadOffsetX, arrowHeadOffsetY);
-
-        glVertex2d(-arrowXHalfSize, 0.);
-        glVertex2d(-arrowXHalfSize + arrowHeadOffsetX, -arrowHeadOffsetY);
-
-        ///right triangle
-        glVertex2d(+arrowXHalfSize, 0.);
-        glVertex2d(+arrowXHalfSize - arrowHeadOffsetX, arrowHeadOffsetY);
-
-        glVertex2d(+arrowXHalfSize, 0.);
-        glVertex2d(+arrowXHalfSize - arrowHeadOffsetX, -arrowHeadOffsetY);
-        glEnd();
-
-        glRotated(90., 0., 0., 1.);
-
-        glBegin(GL_LINES);
-        ///draw the central bar
-        glVertex2d(-arrowXHalfSize, 0.);
-        glVertex2d(+arrowXHalfSize, 0.);
-
-        ///left triangle
-        glVertex2d(-arrowXHalfSize, 0.);
-        glVertex2d(-arrowXHalfSize + arrowHeadOffsetX, arrowHeadOffsetY);
-
-        glVertex2d(-arrowXHalfSize, 0.);
-        glVertex2d(-arrowXHalfSize + arrowHeadOffsetX, -arrowHeadOffsetY);
-
-        ///right triangle
-        glVertex2d(+arrowXHalfSize, 0.);
-        glVertex2d(+arrowXHalfSize - arrowHeadOffsetX, arrowHeadOffsetY);
-
-        glVertex2d(+arrowXHalfSize, 0.);
-        glVertex2d(+arrowXHalfSize - arrowHeadOffsetX, -arrowHeadOffsetY);
-        glEnd();
-
-        glPopMatrix();
+        batch->pushMatrix();
+        batch->translate(arrowXPosition, 0.);
+        addDoubleArrow(batch, arrowXHalfSize, arrowHeadOffsetX, arrowHeadOffsetY);
+        batch->rotate(90.);
+        addDoubleArrow(batch, arrowXHalfSize, arrowHeadOffsetX, arrowHeadOffsetY);
+        batch->popMatrix();
     }
-} // drawRotationBar
+} // addRotationBar
 
 // draw the interact
 bool
@@ -809,123 +736,125 @@ TransformInteractHelper::draw(const DrawArgs &args)
 
     //glPushAttrib(GL_ALL_ATTRIB_BITS); // caller is responsible for protecting attribs
 
-    glDisable(GL_LINE_STIPPLE);
     glEnable(GL_LINE_SMOOTH);
-    glEnable(GL_POINT_SMOOTH);
     glEnable(GL_BLEND);
     glHint(GL_LINE_SMOOTH_HINT, GL_DONT_CARE);
-    glLineWidth(1.5f * screenPixelRatio);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-    // Draw everything twice
-    // l = 0: shadow
-    // l = 1: drawing
-    for (int l = 0; l < 2; ++l) {
-        // shadow (uses GL_PROJECTION)
-        glMatrixMode(GL_PROJECTION);
-        int direction = (l == 0) ? 1 : -1;
-        // translate (1,-1) pixels
-        glTranslated(direction * shadow.x, -direction * shadow.y, 0);
-        glMatrixMode(GL_MODELVIEW); // Modelview should be used on Nuke
+    // the geometry is built once, and drawn in both passes
+    OverlayBatch batch;
+    batch.setLineWidth(1.5f * screenPixelRatio);
+    batch.setPointSize(POINT_SIZE * screenPixelRatio);
+    batch.setPointSmooth(true);
 
-        // First, draw the motion curve, based on the keyframes for the translate parameter.
-        if (_translate) {
-            // Draw the motion curve a bit darker
-            const double darken = 0.5;
-            glColor3d(color.r * darken * l, color.g * darken * l, color.b * darken * l);
-
-            int numKeys = _translate->getNumKeys();
-
-            // Try to draw one point per frame, but no more thankDrawPointTrajectoryMaxPoints
-            // in total, and at least kDrawPointTrajectoryMinStepsPerKey between two keys.
-            if (numKeys > 0) {
-                OfxPointD targetCenter;
-                OfxPointD center = { 0., 0. };
-                OfxPointD translate = { 0., 0. };
-                int maxStepsPerKey = int(kDrawPointTrajectoryMaxPoints / numKeys);
-                glPointSize(POINT_SIZE * screenPixelRatio);
-                glBegin(GL_POINTS);
-                for (int i=0; i < numKeys; ++i) {
-                    double time = _translate->getKeyTime(i);
+    // First, draw the motion curve, based on the keyframes for the translate parameter.
+    if (_translate) {
+        // Draw the motion curve a bit darker
+        const double darken = 0.5;
+        batch.setColor(color.r * darken, color.g * darken, color.b * darken);
+
+        int numKeys = _translate->getNumKeys();
+
+        // Try to draw one point per frame, but no more thankDrawPointTrajectoryMaxPoints
+        // in total, and at least kDrawPointTrajectoryMinStepsPerKey between two keys.
+        if (numKeys > 0) {
+            OfxPointD targetCenter;
+            OfxPointD center = { 0., 0. };
+            OfxPointD translate = { 0., 0. };
+            int maxStepsPerKey = int(kDrawPointTrajectoryMaxPoints / numKeys);
+            for (int i=0; i < numKeys; ++i) {
+                double time = _translate->getKeyTime(i);
+                if (_center) {
+                    _center->getValueAtTime(time, center.x, center.y);
+                }
+                if (_translate) {
+                    _translate->getValueAtTime(time, translate.x, translate.y);
+                }
+                getTargetCenter(center, translate, &targetCenter);
+                batch.addPoint(targetCenter.x, targetCenter.y);
+
+            }
+            std::vector<double> curve;
+            double time = _translate->getKeyTime(0);
+            for (int i = 1; i < numKeys; ++i) {
+                double timeNext = _translate->getKeyTime(i);
+                int steps = std::max(kDrawPointTrajectoryMinStepsPerKey, std::min(int(timeNext - time), maxStepsPerKey));
+                for (int j = (i == 1 ? 0 : 1); j <= steps; ++j) {
+                    double timeStep = time + j * (timeNext - time) / steps;
                     if (_center) {
-                        _center->getValueAtTime(time, center.x, center.y);
+                        _center->getValueAtTime(timeStep, center.x, center.y);
                     }
                     if (_translate) {
-                        _translate->getValueAtTime(time, translate.x, translate.y);
+                        _translate->getValueAtTime(timeStep, translate.x, translate.y);
                     }
                     getTargetCenter(center, translate, &targetCenter);
-                    glVertex2d(targetCenter.x, targetCenter.y);
-
-                }
-                glEnd();
-                glBegin(GL_LINE_STRIP);
-                double time = _translate->getKeyTime(0);
-                for (int i = 1; i < numKeys; ++i) {
-                    double timeNext = _translate->getKeyTime(i);
-                    int steps = std::max(kDrawPointTrajectoryMinStepsPerKey, std::min(int(timeNext - time), maxStepsPerKey));
-                    for (int j = (i == 1 ? 0 : 1); j <= steps; ++j) {
-                        double timeStep = time + j * (timeNext - time) / steps;
-                        if (_center) {
-                            _center->getValueAtTime(timeStep, center.x, center.y);
-                        }
-                        if (_translate) {
-                            _translate->getValueAtTime(timeStep, translate.x, translate.y);
-                        }
-                        getTargetCenter(center, translate, &targetCenter);
-                        glVertex2d(targetCenter.x, targetCenter.y);
-                    }
-                    time = timeNext;
+                    curve.push_back(targetCenter.x);
+                    curve.push_back(targetCenter.y);
                 }
-                glEnd();
+                time = timeNext;
+            }
+            if ( !curve.empty() ) {
+                batch.addLineStrip(&curve.front(), (int)curve.size() / 2, false);
             }
         }
+    }
 
+    batch.pushMatrix();
+    batch.translate(targetCenter.x, targetCenter.y);
 
-        glColor3d(color.r * l, color.g * l, color.b * l);
+    batch.rotate(rotate);
+    addRotationBar(&batch, color, pscale, targetRadius.x, _mouseState == eDraggingRotationBar || _drawState == eRotationBarHovered, inverted);
+    batch.multMatrix(skewMatrix);
+    batch.translate(-targetCenter.x, -targetCenter.y);
 
-        glPushMatrix();
-        glTranslated(targetCenter.x, targetCenter.y, 0.);
+    addEllipse(&batch, color, targetCenter, targetRadius, _mouseState == eDraggingCircle || _drawState == eCircleHovered);
 
-        glRotated(rotate, 0, 0., 1.);
-        drawRotationBar(color, pscale, targetRadius.x, _mouseState == eDraggingRotationBar || _drawState == eRotationBarHovered, inverted, l);
-        glMultMatrixd(skewMatrix);
-        glTranslated(-targetCenter.x, -targetCenter.y, 0.);
+    // add 180 to the angle to draw the arrows on the other side. unfortunately, this requires knowing
+    // the mouse position in the ellipse frame
+    double flip = 0.;
+    if ( (_drawState == eSkewXBarHoverered) || (_drawState == eSkewYBarHoverered) ) {
+        double rot = ofxsToRadians(rotate);
+        Matrix3x3 transformscale;
+        transformscale = ofxsMatInverseTransformCanonical(0., 0., scale.x, scale.y, skewX, skewY, (bool)skewOrder, rot, targetCenter.x, targetCenter.y);
 
-        drawEllipse(color, targetCenter, targetRadius, _mouseState == eDraggingCircle || _drawState == eCircleHovered, l);
+        Point3D previousPos;
+        previousPos.x = _lastMousePos.x;
+        previousPos.y = _lastMousePos.y;
+        previousPos.z = 1.;
+        previousPos = transformscale * previousPos;
+        if (previousPos.z != 0) {
+            previousPos.x /= previousPos.z;
+            previousPos.y /= previousPos.z;
+        }
+        if ( ( (_drawState == eSkewXBarHoverered) && (previousPos.y > targetCenter.y) ) ||
+             ( ( _drawState == eSkewYBarHoverered) && ( previousPos.x > targetCenter.x) ) ) {
+            flip = 180.;
+        }
+    }
+    addSkewBar(&batch, color, targetCenter, pscale, targetRadius.y, _mouseState == eDraggingSkewXBar || _drawState == eSkewXBarHoverered, flip);
+    addSkewBar(&batch, color, targetCenter, pscale, targetRadius.x, _mouseState == eDraggingSkewYBar || _drawState == eSkewYBarHoverered, flip - 90.);
 
-        // add 180 to the angle to draw the arrows on the other side. unfortunately, this requires knowing
-        // the mouse position in the ellipse frame
-        double flip = 0.;
-        if ( (_drawState == eSkewXBarHoverered) || (_drawState == eSkewYBarHoverered) ) {
-            double rot = ofxsToRadians(rotate);
-            Matrix3x3 transformscale;
-            transformscale = ofxsMatInverseTransformCanonical(0., 0., scale.x, scale.y, skewX, skewY, (bool)skewOrder, rot, targetCenter.x, targetCenter.y);
 
-            Point3D previousPos;
-            previousPos.x = _lastMousePos.x;
-            previousPos.y = _lastMousePos.y;
-            previousPos.z = 1.;
-            previousPos = transformscale * previousPos;
-            if (previousPos.z != 0) {
-                previousPos.x /= previousPos.z;
-                previousPos.y /= previousPos.z;
-            }
-            if ( ( (_drawState == eSkewXBarHoverered) && (previousPos.y > targetCenter.y) ) ||
-                 ( ( _drawState == eSkewYBarHoverered) && ( previousPos.x > targetCenter.x) ) ) {
-                flip = 180.;
-            }
-        }
-        drawSkewBar(color, targetCenter, pscale, targetRadius.y, _mouseState == eDraggingSkewXBar || _drawState == eSkewXBarHoverered, flip, l);
-        drawSkewBar(color, targetCenter, pscale, targetRadius.x, _mouseState == eDraggingSkewYBar || _drawState == eSkewYBarHoverered, flip - 90., l);
+    addSquare(&batch, color, targetCenter, pscale, _mouseState == eDraggingTranslation || _mouseState == eDraggingCenter || _drawState == eCenterPointHovered, (!_translate || _modifierStateCtrl));
+    addSquare(&batch, color, left, pscale, _mouseState == eDraggingLeftPoint || _drawState == eLeftPointHovered, false);
+    addSquare(&batch, color, right, pscale, _mouseState == eDraggingRightPoint || _drawState == eRightPointHovered, false);
+    addSquare(&batch, color, top, pscale, _mouseState == eDraggingTopPoint || _drawState == eTopPointHovered, false);
+    addSquare(&batch, color, bottom, pscale, _mouseState == eDraggingBottomPoint || _drawState == eBottomPointHovered, false);
 
+    batch.popMatrix();
 
-        drawSquare(color, targetCenter, pscale, _mouseState == eDraggingTranslation || _mouseState == eDraggingCenter || _drawState == eCenterPointHovered, (!_translate || _modifierStateCtrl), l);
-        drawSquare(color, left, pscale, _mouseState == eDraggingLeftPoint || _drawState == eLeftPointHovered, false, l);
-        drawSquare(color, right, pscale, _mouseState == eDraggingRightPoint || _drawState == eRightPointHovered, false, l);
-        drawSquare(color, top, pscale, _mouseState == eDraggingTopPoint || _drawState == eTopPointHovered, false, l);
-        drawSquare(color, bottom, pscale, _mouseState == eDraggingBottomPoint || _drawState == eBottomPointHovered, false, l);
+    // Draw everything twice
+    // l = 0: shadow
+    // l = 1: drawing
+    for (int l = 0; l < 2; ++l) {
+        // shadow (uses GL_PROJECTION)
+        glMatrixMode(GL_PROJECTION);
+        int direction = (l == 0) ? 1 : -1;
+        // translate (1,-1) pixels
+        glTranslated(direction * shadow.x, -direction * shadow.y, 0);
+        glMatrixMode(GL_MODELVIEW); // Modelview should be used on Nuke
 
-        glPopMatrix();
+        batch.draw(l == 0);
     }
     //glPopAttrib();
 
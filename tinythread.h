@@ -468,7 +468,7 @@ class condition_variable {
       _wait();
       aMutex.mMutex->lock();
 #else
-      pthread_cond_wait(&mHandle, &aMutex.mHandle);
+      pthread_cond_wait(&mHandle, &aMutex.mMutex->mHandle);
 #endif
     }
 